@@ -46,6 +46,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_FBX_IMPORTER
 
 #include "FBXConverter.h"
+#include "Common/ThreadPool.h"
+#include "Common/simd.h"
 #include "FBXDocument.h"
 #include "FBXImporter.h"
 #include "FBXMeshGeometry.h"
@@ -123,7 +125,7 @@ static void correctRootTransform(const aiScene *scene) {
     scene->mRootNode->mTransformation *= mat;
 }
 
-FBXConverter::FBXConverter(aiScene *out, const Document &doc, bool removeEmptyBones) :
+FBXConverter::FBXConverter(aiScene *out, const Document &doc, bool removeEmptyBones, ThreadPool *threadPool) :
         defaultMaterialIndex(),
         mMeshes(),
         lights(),
@@ -137,7 +139,8 @@ FBXConverter::FBXConverter(aiScene *out, const Document &doc, bool removeEmptyBo
         anim_fps(),
         mSceneOut(out),
         doc(doc),
-        mRemoveEmptyBones(removeEmptyBones) {
+        mRemoveEmptyBones(removeEmptyBones),
+        mThreadPool(threadPool) {
 
 
     // animations need to be converted first since this will
@@ -152,6 +155,7 @@ FBXConverter::FBXConverter(aiScene *out, const Document &doc, bool removeEmptyBo
         ConvertOrphanedEmbeddedTextures();
     }
     ConvertRootNode();
+    ConvertPendingMeshes();
 
     if (doc.Settings().readAllMaterials) {
         // unfortunately this means we have to evaluate all objects
@@ -1124,6 +1128,30 @@ unsigned int FBXConverter::ConvertMeshSingleMaterial(const MeshGeometry &mesh, c
     const MatIndexArray &mindices = mesh.GetMaterialIndices();
     aiMesh *const out_mesh = SetupEmptyMesh(mesh, parent);
 
+    if (!doc.Settings().readMaterials || mindices.empty()) {
+        FBXImporter::LogError("no material assigned to mesh, setting default material");
+        out_mesh->mMaterialIndex = GetDefaultMaterial();
+    } else {
+        ConvertMaterialForMesh(out_mesh, model, mesh, mindices[0]);
+    }
+
+    // the geometry is copied once all output slots are assigned
+    PendingMesh pending;
+    pending.out = out_mesh;
+    pending.mesh = &mesh;
+    pending.absolute_transform = absolute_transform;
+    pending.parent = parent;
+    mPendingMeshes.push_back(pending);
+
+    return static_cast<unsigned int>(mMeshes.size() - 1);
+}
+
+void FBXConverter::FillMeshSingleMaterial(PendingMesh &pending) {
+    aiMesh *const out_mesh = pending.out;
+    const MeshGeometry &mesh = *pending.mesh;
+    const aiMatrix4x4 &absolute_transform = pending.absolute_transform;
+    aiNode *const parent = pending.parent;
+
     const std::vector<aiVector3D> &vertices = mesh.GetVertices();
     const std::vector<unsigned int> &faces = mesh.GetFaceIndexCounts();
 
@@ -1231,22 +1259,12 @@ unsigned int FBXConverter::ConvertMeshSingleMaterial(const MeshGeometry &mesh, c
         std::copy(colors.begin(), colors.end(), out_mesh->mColors[i]);
     }
 
-    if (!doc.Settings().readMaterials || mindices.empty()) {
-        FBXImporter::LogError("no material assigned to mesh, setting default material");
-        out_mesh->mMaterialIndex = GetDefaultMaterial();
-    } else {
-        ConvertMaterialForMesh(out_mesh, model, mesh, mindices[0]);
-    }
-
     if (doc.Settings().readWeights && mesh.DeformerSkin() != nullptr && !doc.Settings().useSkeleton) {
         ConvertWeights(out_mesh, mesh, absolute_transform, parent, NO_MATERIAL_SEPARATION, nullptr);
     } else if (doc.Settings().readWeights && mesh.DeformerSkin() != nullptr && doc.Settings().useSkeleton) {
         SkeletonBoneContainer sbc;
         ConvertWeightsToSkeleton(out_mesh, mesh, absolute_transform, parent, NO_MATERIAL_SEPARATION, nullptr, sbc);
-        aiSkeleton *skeleton = createAiSkeleton(sbc);
-        if (skeleton != nullptr) {
-            mSkeletons.emplace_back(skeleton);
-        }
+        pending.skeleton = createAiSkeleton(sbc);
     }
 
     std::vector<aiAnimMesh *> animMeshes;
@@ -1297,7 +1315,6 @@ unsigned int FBXConverter::ConvertMeshSingleMaterial(const MeshGeometry &mesh, c
             out_mesh->mAnimMeshes[i] = animMeshes.at(i);
         }
     }
-    return static_cast<unsigned int>(mMeshes.size() - 1);
 }
 
 std::vector<unsigned int>
@@ -1336,8 +1353,6 @@ unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, co
     const std::vector<aiVector3D> &vertices = mesh.GetVertices();
     const std::vector<unsigned int> &faces = mesh.GetFaceIndexCounts();
 
-    const bool process_weights = doc.Settings().readWeights && mesh.DeformerSkin() != nullptr;
-
     unsigned int count_faces = 0;
     unsigned int count_vertices = 0;
 
@@ -1370,6 +1385,36 @@ unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, co
         return static_cast<unsigned int>(mMeshes.size() - 1);
     }
 
+    ConvertMaterialForMesh(out_mesh, model, mesh, index);
+
+    // the geometry is copied once all output slots are assigned
+    PendingMesh pending;
+    pending.out = out_mesh;
+    pending.mesh = &mesh;
+    pending.absolute_transform = absolute_transform;
+    pending.parent = parent;
+    pending.splitByMaterial = true;
+    pending.materialIndex = index;
+    pending.numFaces = count_faces;
+    pending.numVertices = count_vertices;
+    mPendingMeshes.push_back(pending);
+
+    return static_cast<unsigned int>(mMeshes.size() - 1);
+}
+
+void FBXConverter::FillMeshMultiMaterial(PendingMesh &pending) {
+    aiMesh *const out_mesh = pending.out;
+    const MeshGeometry &mesh = *pending.mesh;
+    const MatIndexArray::value_type index = pending.materialIndex;
+    const unsigned int count_faces = pending.numFaces;
+    const unsigned int count_vertices = pending.numVertices;
+
+    const MatIndexArray &mindices = mesh.GetMaterialIndices();
+    const std::vector<aiVector3D> &vertices = mesh.GetVertices();
+    const std::vector<unsigned int> &faces = mesh.GetFaceIndexCounts();
+
+    const bool process_weights = doc.Settings().readWeights && mesh.DeformerSkin() != nullptr;
+
     // mapping from output indices to DOM indexing, needed to resolve weights or blendshapes
     std::vector<unsigned int> reverseMapping;
     std::map<unsigned int, unsigned int> translateIndexMap;
@@ -1446,7 +1491,7 @@ unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, co
 
     unsigned int cursor = 0, in_cursor = 0;
 
-    itf = faces.begin();
+    std::vector<unsigned int>::const_iterator itf = faces.begin();
     for (MatIndexArray::const_iterator it = mindices.begin(), end = mindices.end(); it != end; ++it, ++itf) {
         const unsigned int pcount = *itf;
         if ((*it) != index) {
@@ -1503,10 +1548,8 @@ unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, co
         }
     }
 
-    ConvertMaterialForMesh(out_mesh, model, mesh, index);
-
     if (process_weights) {
-        ConvertWeights(out_mesh, mesh, absolute_transform, parent, index, &reverseMapping);
+        ConvertWeights(out_mesh, mesh, pending.absolute_transform, pending.parent, index, &reverseMapping);
     }
 
     std::vector<aiAnimMesh *> animMeshes;
@@ -1551,8 +1594,32 @@ unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, co
             out_mesh->mAnimMeshes[i] = animMeshes.at(i);
         }
     }
+}
 
-    return static_cast<unsigned int>(mMeshes.size() - 1);
+void FBXConverter::ConvertPendingMeshes() {
+    // every aiMesh has its own slot and material by now, so the geometry can be copied concurrently
+    const auto fill = [this](size_t i) {
+        PendingMesh &pending = mPendingMeshes[i];
+        if (pending.splitByMaterial) {
+            FillMeshMultiMaterial(pending);
+        } else {
+            FillMeshSingleMaterial(pending);
+        }
+    };
+    if (mThreadPool != nullptr && mPendingMeshes.size() > 1) {
+        mThreadPool->ParallelFor(mPendingMeshes.size(), fill);
+    } else {
+        for (size_t i = 0; i < mPendingMeshes.size(); ++i) {
+            fill(i);
+        }
+    }
+
+    for (const PendingMesh &pending : mPendingMeshes) {
+        if (pending.skeleton != nullptr) {
+            mSkeletons.emplace_back(pending.skeleton);
+        }
+    }
+    mPendingMeshes.clear();
 }
 
 static void copyBoneToSkeletonBone(aiMesh *mesh, aiBone *bone, aiSkeletonBone *skeletonBone ) {
@@ -1598,6 +1665,7 @@ void FBXConverter::ConvertWeights(aiMesh *out, const MeshGeometry &geo, const ai
     const Skin &sk = *geo.DeformerSkin();
 
     std::vector<aiBone*> bones;
+    BoneMap bone_map;
     const bool no_mat_check = materialIndex == NO_MATERIAL_SEPARATION;
     ai_assert(no_mat_check || outputVertStartIndices);
 
@@ -1656,11 +1724,9 @@ void FBXConverter::ConvertWeights(aiMesh *out, const MeshGeometry &geo, const ai
             // if we found at least one, generate the output bones
             // XXX this could be heavily simplified by collecting the bone
             // data in a single step.
-            ConvertCluster(bones, cluster, out_indices, index_out_indices,
+            ConvertCluster(bones, bone_map, cluster, out_indices, index_out_indices,
                     count_out_indices, absolute_transform, parent);
         }
-
-        bone_map.clear();
     } catch (std::exception &) {
         std::for_each(bones.begin(), bones.end(), Util::delete_fun<aiBone>());
         throw;
@@ -1677,7 +1743,7 @@ void FBXConverter::ConvertWeights(aiMesh *out, const MeshGeometry &geo, const ai
     std::swap_ranges(bones.begin(), bones.end(), out->mBones);
 }
 
-void FBXConverter::ConvertCluster(std::vector<aiBone*> &local_mesh_bones, const Cluster *cluster,
+void FBXConverter::ConvertCluster(std::vector<aiBone*> &local_mesh_bones, BoneMap &bone_map, const Cluster *cluster,
         std::vector<size_t> &out_indices, std::vector<size_t> &index_out_indices,
         std::vector<size_t> &count_out_indices, const aiMatrix4x4 &absolute_transform,
         aiNode *) {
@@ -2732,14 +2798,21 @@ void FBXConverter::ConvertAnimationStack(const AnimationStack &st) {
     }
 
     try {
-        for (const NodeMap::value_type &kv : node_map) {
-            GenerateNodeAnimations(node_anims,
-                    kv.first,
-                    kv.second,
-                    layer_map,
-                    start_time, stop_time,
-                    max_time,
-                    min_time);
+        if (mThreadPool && mThreadPool->GetNumWorkers() > 0 && node_map.size() > 1) {
+            GenerateNodeAnimationsConcurrently(node_anims, node_map, layer_map, start_time, stop_time, max_time, min_time);
+        } else {
+            for (const NodeMap::value_type &kv : node_map) {
+                const unsigned int chain_bits = GenerateNodeAnimations(node_anims,
+                        kv.first,
+                        kv.second,
+                        layer_map,
+                        start_time, stop_time,
+                        max_time,
+                        min_time);
+                if (chain_bits) {
+                    node_anim_chain_bits[kv.first] = chain_bits;
+                }
+            }
         }
     } catch (std::exception &) {
         std::for_each(node_anims.begin(), node_anims.end(), Util::delete_fun<aiNodeAnim>());
@@ -2899,7 +2972,70 @@ static void validateAnimCurveNodes(const std::vector<const AnimationCurveNode *>
 #endif // ASSIMP_BUILD_DEBUG
 
 // ------------------------------------------------------------------------------------------------
-void FBXConverter::GenerateNodeAnimations(std::vector<aiNodeAnim *> &node_anims,
+void FBXConverter::GenerateNodeAnimationsConcurrently(std::vector<aiNodeAnim *> &node_anims,
+        const NodeMap &node_map,
+        const LayerMap &layer_map,
+        int64_t start, int64_t stop,
+        double &max_time,
+        double &min_time) {
+    // The DOM resolves curves and parses properties on first access, so do
+    // that here for everything GenerateNodeAnimations() looks at. The workers
+    // then only read.
+    std::vector<NodeMap::const_iterator> nodes;
+    nodes.reserve(node_map.size());
+    for (NodeMap::const_iterator it = node_map.begin(); it != node_map.end(); ++it) {
+        nodes.push_back(it);
+        for (const AnimationCurveNode *node : it->second) {
+            if (node->TargetProperty().empty()) {
+                continue;
+            }
+            node->Curves();
+            const Model *const model = node->TargetAsModel();
+            if (model) {
+                for (size_t i = 0; i < TransformationComp_MAXIMUM; ++i) {
+                    model->Props().Get(NameTransformationCompProperty(static_cast<TransformationComp>(i)));
+                }
+                model->RotationOrder();
+            }
+        }
+    }
+
+    struct Result {
+        std::vector<aiNodeAnim *> anims;
+        unsigned int chain_bits = 0;
+        double max_time;
+        double min_time;
+    };
+    std::vector<Result> results(nodes.size());
+    try {
+        mThreadPool->ParallelFor(nodes.size(), [&](size_t i) {
+            Result &result = results[i];
+            result.max_time = max_time;
+            result.min_time = min_time;
+            result.chain_bits = GenerateNodeAnimations(result.anims, nodes[i]->first, nodes[i]->second, layer_map,
+                    start, stop, result.max_time, result.min_time);
+        });
+    } catch (std::exception &) {
+        for (Result &result : results) {
+            std::for_each(result.anims.begin(), result.anims.end(), Util::delete_fun<aiNodeAnim>());
+        }
+        throw;
+    }
+
+    // same order and outcome as the serial loop
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        Result &result = results[i];
+        node_anims.insert(node_anims.end(), result.anims.begin(), result.anims.end());
+        if (result.chain_bits) {
+            node_anim_chain_bits[nodes[i]->first] = result.chain_bits;
+        }
+        max_time = std::max(max_time, result.max_time);
+        min_time = std::min(min_time, result.min_time);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int FBXConverter::GenerateNodeAnimations(std::vector<aiNodeAnim *> &node_anims,
         const std::string &fixed_name,
         const std::vector<const AnimationCurveNode *> &curves,
         const LayerMap &layer_map,
@@ -2973,7 +3109,7 @@ void FBXConverter::GenerateNodeAnimations(std::vector<aiNodeAnim *> &node_anims,
 
     if (!has_any) {
         FBXImporter::LogWarn("ignoring node animation, did not find any transformation key frames");
-        return;
+        return 0;
     }
 
     // this needs to play nicely with GenerateTransformationNodeChain() which will
@@ -2994,7 +3130,7 @@ void FBXConverter::GenerateNodeAnimations(std::vector<aiNodeAnim *> &node_anims,
         } else {
             node_anims.push_back(nd);
         }
-        return;
+        return 0;
     }
 
     // otherwise, things get gruesome and we need separate animation channels
@@ -3119,7 +3255,7 @@ void FBXConverter::GenerateNodeAnimations(std::vector<aiNodeAnim *> &node_anims,
         }
     }
 
-    node_anim_chain_bits[fixed_name] = flags;
+    return flags;
 }
 
 bool FBXConverter::IsRedundantAnimationData(const Model &target,
@@ -3563,52 +3699,58 @@ void FBXConverter::InterpolateKeys(aiVectorKey *valOut, const KeyTimeList &keys,
     ai_assert(!keys.empty());
     ai_assert(nullptr != valOut);
 
-    std::vector<unsigned int> next_pos;
-    const size_t count(inputs.size());
-
-    next_pos.resize(inputs.size(), 0);
+    const size_t keyCount = keys.size();
 
-    for (KeyTimeList::value_type time : keys) {
-        ai_real result[3] = { def_value.x, def_value.y, def_value.z };
+    // one sweep per input over the merged timeline gathers the surrounding keys,
+    // the blending then runs as batch over all keys. Later inputs overwrite
+    // earlier ones targeting the same component.
+    std::vector<ai_real> buffer(7 * keyCount);
+    ai_real *const result[3] = { buffer.data(), buffer.data() + keyCount, buffer.data() + 2 * keyCount };
+    ai_real *const valueA = buffer.data() + 3 * keyCount;
+    ai_real *const valueB = buffer.data() + 4 * keyCount;
+    ai_real *const elapsed = buffer.data() + 5 * keyCount;
+    ai_real *const span = buffer.data() + 6 * keyCount;
+    for (unsigned int c = 0; c < 3; ++c) {
+        std::fill(result[c], result[c] + keyCount, def_value[c]);
+    }
 
-        for (size_t i = 0; i < count; ++i) {
-            const KeyFrameList &kfl = inputs[i];
+    for (const KeyFrameList &kfl : inputs) {
+        const KeyTimeList &times = *std::get<0>(kfl);
+        const KeyValueList &values = *std::get<1>(kfl);
+        const size_t ksize = times.size();
+        if (ksize == 0) {
+            continue;
+        }
 
-            const size_t ksize = std::get<0>(kfl)->size();
-            if (ksize == 0) {
-                continue;
-            }
-            if (ksize > next_pos[i] && std::get<0>(kfl)->at(next_pos[i]) == time) {
-                ++next_pos[i];
+        size_t next_pos = 0;
+        for (size_t k = 0; k < keyCount; ++k) {
+            const KeyTimeList::value_type time = keys[k];
+            if (ksize > next_pos && times[next_pos] == time) {
+                ++next_pos;
             }
 
-            const size_t id0 = next_pos[i] > 0 ? next_pos[i] - 1 : 0;
-            const size_t id1 = next_pos[i] == ksize ? ksize - 1 : next_pos[i];
+            const size_t id0 = next_pos > 0 ? next_pos - 1 : 0;
+            const size_t id1 = next_pos == ksize ? ksize - 1 : next_pos;
 
             // use lerp for interpolation
-            const KeyValueList::value_type valueA = std::get<1>(kfl)->at(id0);
-            const KeyValueList::value_type valueB = std::get<1>(kfl)->at(id1);
-
-            const KeyTimeList::value_type timeA = std::get<0>(kfl)->at(id0);
-            const KeyTimeList::value_type timeB = std::get<0>(kfl)->at(id1);
-
-            const ai_real factor = timeB == timeA ? ai_real(0.) : static_cast<ai_real>((time - timeA)) / (timeB - timeA);
-            const ai_real interpValue = static_cast<ai_real>(valueA + (valueB - valueA) * factor);
-
-            result[std::get<2>(kfl)] = interpValue;
+            valueA[k] = values[id0];
+            valueB[k] = values[id1];
+            elapsed[k] = static_cast<ai_real>(time - times[id0]);
+            span[k] = static_cast<ai_real>(times[id1] - times[id0]);
         }
+        SIMD::InterpolateLinear(valueA, valueB, elapsed, span, result[std::get<2>(kfl)], keyCount);
+    }
 
+    for (size_t k = 0; k < keyCount; ++k, ++valOut) {
         // magic value to convert fbx times to seconds
-        valOut->mTime = CONVERT_FBX_TIME(time) * anim_fps;
+        valOut->mTime = CONVERT_FBX_TIME(keys[k]) * anim_fps;
 
         min_time = std::min(min_time, valOut->mTime);
         max_time = std::max(max_time, valOut->mTime);
 
-        valOut->mValue.x = result[0];
-        valOut->mValue.y = result[1];
-        valOut->mValue.z = result[2];
-
-        ++valOut;
+        valOut->mValue.x = result[0][k];
+        valOut->mValue.y = result[1][k];
+        valOut->mValue.z = result[2][k];
     }
 }
 
@@ -3830,8 +3972,8 @@ void FBXConverter::ConvertOrphanedEmbeddedTextures() {
 }
 
 // ------------------------------------------------------------------------------------------------
-void ConvertToAssimpScene(aiScene *out, const Document &doc, bool removeEmptyBones) {
-    FBXConverter converter(out, doc, removeEmptyBones);
+void ConvertToAssimpScene(aiScene *out, const Document &doc, bool removeEmptyBones, ThreadPool *threadPool) {
+    FBXConverter converter(out, doc, removeEmptyBones, threadPool);
 }
 
 } // namespace FBX
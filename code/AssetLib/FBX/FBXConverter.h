@@ -72,6 +72,9 @@ struct morphKeyData {
 using morphAnimData = std::map<int64_t, morphKeyData*> ;
 
 namespace Assimp {
+
+class ThreadPool;
+
 namespace FBX {
 
 class MeshGeometry;
@@ -91,8 +94,9 @@ class Document;
  *  @param out Empty scene to be populated
  *  @param doc Parsed FBX document
  *  @param removeEmptyBones Will remove bones, which do not have any references to vertices.
+ *  @param threadPool Optional worker pool the mesh geometry is converted on.
  */
-void ConvertToAssimpScene(aiScene* out, const Document& doc, bool removeEmptyBones);
+void ConvertToAssimpScene(aiScene* out, const Document& doc, bool removeEmptyBones, ThreadPool *threadPool = nullptr);
 
 /** Dummy class to encapsulate the conversion process */
 class FBXConverter {
@@ -123,10 +127,27 @@ public:
     };
 
 public:
-    FBXConverter(aiScene* out, const Document& doc, bool removeEmptyBones);
+    FBXConverter(aiScene* out, const Document& doc, bool removeEmptyBones, ThreadPool *threadPool = nullptr);
     ~FBXConverter();
 
 private:
+    // Deformer name is not the same as a bone name - it does contain the bone name though :)
+    // Deformer names in FBX are always unique in an FBX file.
+    using BoneMap = std::map<const std::string, aiBone *>;
+
+    // An output mesh whose slot and material are assigned, but whose data is not copied yet.
+    struct PendingMesh {
+        aiMesh *out = nullptr;
+        const MeshGeometry *mesh = nullptr;
+        aiMatrix4x4 absolute_transform;
+        aiNode *parent = nullptr;
+        bool splitByMaterial = false;
+        MatIndexArray::value_type materialIndex = 0;
+        unsigned int numFaces = 0;
+        unsigned int numVertices = 0;
+        aiSkeleton *skeleton = nullptr;
+    };
+
     // ------------------------------------------------------------------------------------------------
     // find scene root and trigger recursive scene conversion
     void ConvertRootNode();
@@ -215,6 +236,17 @@ private:
     unsigned int ConvertMeshMultiMaterial(const MeshGeometry &mesh, const Model &model, const aiMatrix4x4 &absolute_transform, MatIndexArray::value_type index,
                                           aiNode *parent, aiNode *root_node);
 
+    // ------------------------------------------------------------------------------------------------
+    // copy the geometry, weights and blend shapes into an output mesh
+    void FillMeshSingleMaterial(PendingMesh &pending);
+
+    // ------------------------------------------------------------------------------------------------
+    void FillMeshMultiMaterial(PendingMesh &pending);
+
+    // ------------------------------------------------------------------------------------------------
+    // fill all output meshes set up by ConvertRootNode(), concurrently if a thread pool is set
+    void ConvertPendingMeshes();
+
     // ------------------------------------------------------------------------------------------------
     static const unsigned int NO_MATERIAL_SEPARATION = /* std::numeric_limits<unsigned int>::max() */
         static_cast<unsigned int>(-1);
@@ -236,7 +268,7 @@ private:
             SkeletonBoneContainer &skeletonContainer);
 
     // ------------------------------------------------------------------------------------------------
-    void ConvertCluster(std::vector<aiBone *> &local_mesh_bones, const Cluster *cl,
+    void ConvertCluster(std::vector<aiBone *> &local_mesh_bones, BoneMap &bone_map, const Cluster *cl,
                         std::vector<size_t> &out_indices, std::vector<size_t> &index_out_indices,
             std::vector<size_t> &count_out_indices, const aiMatrix4x4 &absolute_transform, aiNode *parent);
 
@@ -315,7 +347,20 @@ private:
         const BlendShapeChannel* bsc, const AnimationCurveNode* node);
 
     // ------------------------------------------------------------------------------------------------
-    void GenerateNodeAnimations(std::vector<aiNodeAnim*>& node_anims,
+    // runs GenerateNodeAnimations() for all nodes of an animation stack on the thread pool
+    void GenerateNodeAnimationsConcurrently(std::vector<aiNodeAnim*>& node_anims,
+        const NodeMap& node_map,
+        const LayerMap& layer_map,
+        int64_t start, int64_t stop,
+        double& max_time,
+        double& min_time);
+
+    // ------------------------------------------------------------------------------------------------
+    // returns the transformation chain components which got separate animation
+    // channels, 0 if there is a single channel for the node. Only reads the DOM,
+    // so it may run for different nodes concurrently once the curves and the
+    // target properties have been resolved.
+    unsigned int GenerateNodeAnimations(std::vector<aiNodeAnim*>& node_anims,
         const std::string& fixed_name,
         const std::vector<const AnimationCurveNode*>& curves,
         const LayerMap& layer_map,
@@ -455,16 +500,14 @@ private:
     using NodeNameCache = std::fbx_unordered_map<std::string, unsigned int>;
     NodeNameCache mNodeNames;
 
-    // Deformer name is not the same as a bone name - it does contain the bone name though :)
-    // Deformer names in FBX are always unique in an FBX file.
-    std::map<const std::string, aiBone *> bone_map;
-
     double anim_fps;
 
     std::vector<aiSkeleton *> mSkeletons;
+    std::vector<PendingMesh> mPendingMeshes;
     aiScene* const mSceneOut;
     const FBX::Document& doc;
     bool mRemoveEmptyBones;
+    ThreadPool *mThreadPool;
     static void BuildBoneList(aiNode *current_node, const aiNode *root_node, const aiScene *scene,
                              std::vector<aiBone*>& bones);
 
@@ -74,7 +74,7 @@ LazyObject::LazyObject(uint64_t id, const Element& element, const Document& doc)
 
 // ------------------------------------------------------------------------------------------------
 const Object* LazyObject::Get(bool dieOnError) {
-    if(IsBeingConstructed() || FailedToConstruct()) {
+    if(IsBeingConstructed() || FailedToConstruct() || IsSkipped()) {
         return nullptr;
     }
 
@@ -83,7 +83,7 @@ const Object* LazyObject::Get(bool dieOnError) {
     }
 
     const Token& key = element.KeyToken();
-    const TokenList& tokens = element.Tokens();
+    const ElementTokenList& tokens = element.Tokens();
 
     if(tokens.size() < 3) {
         DOMError("expected at least 3 tokens: id, name and class tag",&element);
@@ -351,6 +351,44 @@ void Document::ReadGlobalSettings() {
     globals.reset(new FileGlobalSettings(*this, std::move(props)));
 }
 
+// ------------------------------------------------------------------------------------------------
+bool Document::IsObjectWanted(const Element& element) const {
+    const std::string obtype = element.KeyToken().StringContents();
+    if (obtype == "AnimationStack" || obtype == "AnimationLayer" ||
+            obtype == "AnimationCurveNode" || obtype == "AnimationCurve") {
+        return settings.readAnimations;
+    }
+    if (obtype == "Material") {
+        return settings.readMaterials;
+    }
+    if (obtype == "Video") {
+        return settings.readTextures;
+    }
+
+    // the class tag tells skin deformers and node attributes apart
+    const ElementTokenList& tokens = element.Tokens();
+    const bool isDeformer = obtype == "Deformer";
+    if (tokens.size() < 3 || (!isDeformer && obtype != "NodeAttribute")) {
+        return true;
+    }
+
+    const char* err;
+    const std::string classtag = ParseTokenAsString(*tokens[2], err);
+    if (err) {
+        return true;
+    }
+    if (isDeformer) {
+        return settings.readWeights || (classtag != "Skin" && classtag != "Cluster");
+    }
+    if (classtag == "Camera" || classtag == "CameraSwitcher") {
+        return settings.readCameras;
+    }
+    if (classtag == "Light") {
+        return settings.readLights;
+    }
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 void Document::ReadObjects() {
     // read ID objects from "Objects" section
@@ -366,11 +404,16 @@ void Document::ReadObjects() {
     // which is only indirectly defined in the input file
     objects[0] = new_LazyObject(0L, *eobjects, *this);
 
+    // objects which the import settings exclude are never parsed, and neither are
+    // their compressed data arrays inflated
+    std::vector<const Element*> wanted;
+    size_t skipped = 0;
+
     const Scope& sobjects = *eobjects->Compound();
     for(const ElementMap::value_type& el : sobjects.Elements()) {
 
         // extract ID
-        const TokenList& tok = el.second->Tokens();
+        const ElementTokenList& tok = el.second->Tokens();
 
         if (tok.empty()) {
             DOMError("expected ID after object key",el.second);
@@ -393,13 +436,25 @@ void Document::ReadObjects() {
             delete_LazyObject(foundObject->second);
         }
 
-        objects[id] = new_LazyObject(id, *el.second, *this);
+        LazyObject* const lazy = new_LazyObject(id, *el.second, *this);
+        objects[id] = lazy;
+        if (!IsObjectWanted(*el.second)) {
+            lazy->Skip();
+            ++skipped;
+            continue;
+        }
+        wanted.push_back(el.second);
 
         // grab all animation stacks upfront since there is no listing of them
-        if(!strcmp(el.first.c_str(),"AnimationStack")) {
+        if(el.first == "AnimationStack") {
             animationStacks.push_back(id);
         }
     }
+
+    if (skipped) {
+        ASSIMP_LOG_DEBUG("Skipping ", skipped, " objects excluded by the import settings");
+    }
+    parser.InflateDataArrays(wanted);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -422,7 +477,7 @@ void Document::ReadPropertyTemplates() {
             continue;
         }
 
-        const TokenList& tok = el.Tokens();
+        const ElementTokenList& tok = el.Tokens();
         if(tok.empty()) {
             DOMWarning("expected name for ObjectType element, ignoring",&el);
             continue;
@@ -439,7 +494,7 @@ void Document::ReadPropertyTemplates() {
                 continue;
             }
 
-            const TokenList &curTok = innerEl.Tokens();
+            const ElementTokenList &curTok = innerEl.Tokens();
             if (curTok.empty()) {
                 DOMWarning("expected name for PropertyTemplate element, ignoring",&el);
                 continue;
@@ -501,6 +556,11 @@ void Document::ReadConnections()
             continue;
         }
 
+        // links to skipped objects are dropped, so the consumers never see them
+        if (objects[src]->IsSkipped() || objects[dest]->IsSkipped()) {
+            continue;
+        }
+
         // add new connection
         const Connection* const c = new_Connection(insertionOrder++,src,dest,prop,*this);
         src_connections.insert(ConnectionMap::value_type(src,c));
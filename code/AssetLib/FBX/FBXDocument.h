@@ -120,6 +120,16 @@ public:
         return (flags & FAILED_TO_CONSTRUCT) != 0;
     }
 
+    /** Objects which are of no use under the current import settings are
+     *  skipped, Get() returns nullptr for them without parsing anything. */
+    bool IsSkipped() const {
+        return (flags & SKIPPED) != 0;
+    }
+
+    void Skip() {
+        flags |= SKIPPED;
+    }
+
     const Element& GetElement() const {
         return element;
     }
@@ -137,7 +147,8 @@ private:
 
     enum Flags {
         BEING_CONSTRUCTED = 0x1,
-        FAILED_TO_CONSTRUCT = 0x2
+        FAILED_TO_CONSTRUCT = 0x2,
+        SKIPPED = 0x4
     };
 
     unsigned int flags;
@@ -1157,6 +1168,7 @@ private:
         const char* const* classnames,
         size_t count) const;
     void ReadHeader();
+    bool IsObjectWanted(const Element& element) const;
     void ReadObjects();
     void ReadPropertyTemplates();
     void ReadConnections();
@@ -57,6 +57,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/StreamReader.h>
 #include <assimp/importerdesc.h>
 #include <assimp/Importer.hpp>
+#include <assimp/Profiler.h>
 
 namespace Assimp {
 
@@ -139,11 +140,20 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 	// then becomes very large, too. Assimp doesn't support
 	// streaming for its output data structures so the net win with
 	// streaming input data would be very low.
+	// If the stream already holds the whole file in memory, binary files are
+	// tokenized in place. The tokens reference the input, so the stream must
+	// stay open until the conversion is done.
 	std::vector<char> contents;
-	contents.resize(stream->FileSize() + 1);
-	stream->Read(&*contents.begin(), 1, contents.size() - 1);
-	contents[contents.size() - 1] = 0;
-	const char *const begin = &*contents.begin();
+	const char *begin = reinterpret_cast<const char *>(stream->GetMappedPointer());
+	size_t length = stream->FileSize();
+	if (nullptr == begin || length < 18 || strncmp(begin, "Kaydara FBX Binary", 18)) {
+		Profiling::ScopedRegion readRegion(m_profiler, "read");
+		contents.resize(length + 1);
+		stream->Read(&*contents.begin(), 1, contents.size() - 1);
+		contents[contents.size() - 1] = 0;
+		begin = &*contents.begin();
+		length = contents.size();
+	}
 
 	// broad-phase tokenized pass in which we identify the core
 	// syntax elements of FBX (brackets, commas, key:value mappings)
@@ -151,22 +161,35 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     Assimp::StackAllocator tempAllocator;
     try {
 		bool is_binary = false;
+		if (m_profiler) {
+			m_profiler->BeginRegion("tokenize");
+		}
 		if (!strncmp(begin, "Kaydara FBX Binary", 18)) {
 			is_binary = true;
-            TokenizeBinary(tokens, begin, contents.size(), tempAllocator);
+            TokenizeBinary(tokens, begin, length, tempAllocator);
 		} else {
             Tokenize(tokens, begin, tempAllocator);
 		}
+		if (m_profiler) {
+			m_profiler->EndRegion("tokenize");
+			m_profiler->BeginRegion("parse");
+		}
 
 		// use this information to construct a very rudimentary
 		// parse-tree representing the FBX scope structure
-        Parser parser(tokens, tempAllocator, is_binary);
+        Parser parser(tokens, tempAllocator, is_binary, m_threadPool);
 
 		// take the raw parse-tree and convert it to a FBX DOM
 		Document doc(parser, mSettings);
+		if (m_profiler) {
+			m_profiler->EndRegion("parse");
+		}
 
 		// convert the FBX DOM to aiScene
-		ConvertToAssimpScene(pScene, doc, mSettings.removeEmptyBones);
+		{
+			Profiling::ScopedRegion convertRegion(m_profiler, "convert");
+			ConvertToAssimpScene(pScene, doc, mSettings.removeEmptyBones, m_threadPool);
+		}
 
 		// size relative to cm
 		float size_relative_to_cm = doc.GlobalSettings().UnitScaleFactor();
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_FBX_IMPORTER
 
 #include "Common/Compression.h"
+#include "Common/ThreadPool.h"
 
 #include "FBXTokenizer.h"
 #include "FBXParser.h"
@@ -56,6 +57,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ByteSwapper.h>
 #include <assimp/DefaultLogger.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 
 using namespace Assimp;
@@ -112,10 +115,12 @@ namespace FBX {
 
 // ------------------------------------------------------------------------------------------------
 Element::Element(const Token& key_token, Parser& parser) :
-    key_token(key_token), compound(nullptr)
+    key_token(key_token), parser(parser), tokens(StackAllocatorAdapter<TokenPtr>(parser.GetAllocator())), compound(nullptr)
 {
     TokenPtr n = nullptr;
     StackAllocator &allocator = parser.GetAllocator();
+    TokenList &scratch = parser.scratchTokens;
+    scratch.clear();
     do {
         n = parser.AdvanceToNextToken();
         if(!n) {
@@ -123,7 +128,7 @@ Element::Element(const Token& key_token, Parser& parser) :
         }
 
         if (n->Type() == TokenType_DATA) {
-            tokens.push_back(n);
+            scratch.push_back(n);
 			TokenPtr prev = n;
             n = parser.AdvanceToNextToken();
             if(!n) {
@@ -134,7 +139,7 @@ Element::Element(const Token& key_token, Parser& parser) :
 
 			// some exporters are missing a comma on the next line
 			if (ty == TokenType_DATA && prev->Type() == TokenType_DATA && (n->Line() == prev->Line() + 1)) {
-				tokens.push_back(n);
+				scratch.push_back(n);
 				continue;
 			}
 
@@ -144,6 +149,7 @@ Element::Element(const Token& key_token, Parser& parser) :
         }
 
         if (n->Type() == TokenType_OPEN_BRACKET) {
+            tokens.assign(scratch.begin(), scratch.end());
             compound = new_Scope(parser);
 
             // current token should be a TOK_CLOSE_BRACKET
@@ -159,6 +165,8 @@ Element::Element(const Token& key_token, Parser& parser) :
         }
     }
     while(n->Type() != TokenType_KEY && n->Type() != TokenType_CLOSE_BRACKET);
+
+    tokens.assign(scratch.begin(), scratch.end());
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -171,7 +179,8 @@ Element::~Element()
      // no need to delete tokens, they are owned by the parser
 }
 
-Scope::Scope(Parser& parser,bool topLevel)
+Scope::Scope(Parser& parser,bool topLevel) :
+    elements(std::less<>(), ElementMap::allocator_type(parser.GetAllocator()))
 {
     if(!topLevel) {
         TokenPtr t = parser.CurrentToken();
@@ -192,7 +201,7 @@ Scope::Scope(Parser& parser,bool topLevel)
             ParseError("unexpected token, expected TOK_KEY",n);
         }
 
-        const std::string& str = n->StringContents();
+        const std::string_view str(n->begin(), static_cast<size_t>(n->end() - n->begin()));
         if (str.empty()) {
             ParseError("unexpected content: empty string.");
         }
@@ -225,8 +234,8 @@ Scope::~Scope()
 }
 
 // ------------------------------------------------------------------------------------------------
-Parser::Parser(const TokenList &tokens, StackAllocator &allocator, bool is_binary) :
-        tokens(tokens), allocator(allocator), last(), current(), cursor(tokens.begin()), is_binary(is_binary)
+Parser::Parser(const TokenList &tokens, StackAllocator &allocator, bool is_binary, ThreadPool *threadPool) :
+        tokens(tokens), allocator(allocator), last(), current(), cursor(tokens.begin()), threadPool(threadPool), is_binary(is_binary)
 {
     ASSIMP_LOG_DEBUG("Parsing FBX tokens");
     root = new_Scope(*this, true);
@@ -238,6 +247,115 @@ Parser::~Parser()
     delete_Scope(root);
 }
 
+// ------------------------------------------------------------------------------------------------
+static void CollectDataTokens(const Element& element, std::vector<TokenPtr>& out)
+{
+    const ElementTokenList& tokens = element.Tokens();
+    out.insert(out.end(), tokens.begin(), tokens.end());
+    if (element.Compound()) {
+        for (const ElementMap::value_type& child : element.Compound()->Elements()) {
+            CollectDataTokens(*child.second, out);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void Parser::InflateDataArrays(const std::vector<const Element*>& elements)
+{
+    if (!is_binary || threadPool == nullptr || threadPool->GetNumWorkers() == 0) {
+        return;
+    }
+
+    std::vector<TokenPtr> dataTokens;
+    for (const Element* element : elements) {
+        CollectDataTokens(*element, dataTokens);
+    }
+
+    // collect all deflate-compressed arrays, the tokenizer already checked their headers
+    std::vector<std::pair<TokenPtr, std::vector<char>*>> arrays;
+    for (TokenPtr token : dataTokens) {
+        if (token->Type() != TokenType_DATA || token->end() - token->begin() < 13) {
+            continue;
+        }
+
+        const char* data = token->begin();
+        uint32_t stride = 0;
+        if (*data == 'f' || *data == 'i') {
+            stride = 4;
+        } else if (*data == 'd' || *data == 'l') {
+            stride = 8;
+        } else {
+            continue;
+        }
+
+        BE_NCONST uint32_t count = SafeParse<uint32_t>(data + 1, token->end());
+        BE_NCONST uint32_t encmode = SafeParse<uint32_t>(data + 5, token->end());
+        AI_SWAP4(count);
+        AI_SWAP4(encmode);
+        const uint64_t full_length = static_cast<uint64_t>(stride) * count;
+        if (encmode != 1 || full_length == 0 || full_length > SIZE_MAX || full_length > AI_MAX_ALLOC(char)) {
+            continue;
+        }
+
+        std::vector<char>& buff = inflatedArrays[token];
+        if (!buff.empty()) {
+            continue;
+        }
+        buff.resize(static_cast<size_t>(full_length));
+        arrays.emplace_back(token, &buff);
+    }
+    if (arrays.empty()) {
+        return;
+    }
+
+    ASSIMP_LOG_DEBUG("Inflating ", arrays.size(), " binary data arrays");
+
+    // every thread inflates arrays with its own context until none are left
+    std::atomic<size_t> next(0);
+    std::vector<char> inflated(arrays.size(), 0);
+    const size_t numThreads = std::min<size_t>(threadPool->GetNumWorkers() + 1, arrays.size());
+    threadPool->ParallelFor(numThreads, [&](size_t) {
+        Compression compress;
+        if (!compress.open(Compression::Format::Binary, Compression::FlushMode::Finish, 0)) {
+            return;
+        }
+        for (size_t i = next++; i < arrays.size(); i = next++) {
+            const char* data = arrays[i].first->begin() + 9;
+            BE_NCONST uint32_t comp_len = SafeParse<uint32_t>(data, arrays[i].first->end());
+            AI_SWAP4(comp_len);
+            data += 4;
+            try {
+                compress.decompress(data, comp_len, *arrays[i].second);
+                inflated[i] = 1;
+            } catch (const DeadlyImportError&) {
+                // leave it to the reader
+            }
+            compress.reset();
+        }
+        compress.close();
+    });
+
+    // broken arrays are inflated again when they are read, so the error is reported there
+    for (size_t i = 0; i < arrays.size(); ++i) {
+        if (!inflated[i]) {
+            inflatedArrays.erase(arrays[i].first);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool Parser::TakeInflatedArray(const Token& token, std::vector<char>& out)
+{
+    std::lock_guard<std::mutex> lock(inflatedArraysMutex);
+    auto it = inflatedArrays.find(&token);
+    if (it == inflatedArrays.end()) {
+        return false;
+    }
+    out.swap((*it).second);
+    inflatedArrays.erase(it);
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 TokenPtr Parser::AdvanceToNextToken()
 {
@@ -574,21 +692,26 @@ void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const cha
     }
 
     const auto full_length = static_cast<uint32_t>(full_length64);
-    buff.resize(full_length);
 
     if(encmode == 0) {
         ai_assert(full_length == comp_len);
 
         // plain data, no compression
+        buff.resize(full_length);
         std::copy(data, end, buff.begin());
     }
     else if(encmode == 1) {
-        // zlib/deflate, next comes ZIP head (0x78 0x01)
-        // see http://www.ietf.org/rfc/rfc1950.txt
-         Compression compress;
-        if (compress.open(Compression::Format::Binary, Compression::FlushMode::Finish, 0)) {
-            compress.decompress(data, comp_len, buff);
-            compress.close();
+        // the parser may have inflated the array already, take it over instead of copying
+        if (!el.GetParser().TakeInflatedArray(*el.Tokens()[0], buff) || buff.size() != full_length) {
+            buff.resize(full_length);
+
+            // zlib/deflate, next comes ZIP head (0x78 0x01)
+            // see http://www.ietf.org/rfc/rfc1950.txt
+            Compression compress;
+            if (compress.open(Compression::Format::Binary, Compression::FlushMode::Finish, 0)) {
+                compress.decompress(data, comp_len, buff);
+                compress.close();
+            }
         }
     }
 #ifdef ASSIMP_BUILD_DEBUG
@@ -611,7 +734,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
 {
     out.resize( 0 );
 
-    const TokenList& tok = el.Tokens();
+    const ElementTokenList& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -697,7 +820,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
     if (a.Tokens().size() % 3 != 0) {
         ParseError("number of floats is not a multiple of three (3)",&el);
     }
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (ElementTokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         aiVector3D v;
         v.x = ParseTokenAsFloat(**it++);
         v.y = ParseTokenAsFloat(**it++);
@@ -712,7 +835,7 @@ void ParseVectorDataArray(std::vector<aiVector3D>& out, const Element& el)
 void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
 {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const ElementTokenList& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -793,7 +916,7 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
     if (a.Tokens().size() % 4 != 0) {
         ParseError("number of floats is not a multiple of four (4)",&el);
     }
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (ElementTokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         aiColor4D v;
         v.r = ParseTokenAsFloat(**it++);
         v.g = ParseTokenAsFloat(**it++);
@@ -809,7 +932,7 @@ void ParseVectorDataArray(std::vector<aiColor4D>& out, const Element& el)
 // read an array of float2 tuples
 void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el) {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const ElementTokenList& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -880,7 +1003,7 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el) {
     if (a.Tokens().size() % 2 != 0) {
         ParseError("number of floats is not a multiple of two (2)",&el);
     }
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (ElementTokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         aiVector2D v;
         v.x = ParseTokenAsFloat(**it++);
         v.y = ParseTokenAsFloat(**it++);
@@ -894,7 +1017,7 @@ void ParseVectorDataArray(std::vector<aiVector2D>& out, const Element& el) {
 // read an array of ints
 void ParseVectorDataArray(std::vector<int>& out, const Element& el) {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const ElementTokenList& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -943,7 +1066,7 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el) {
     const Scope& scope = GetRequiredScope(el);
     const Element& a = GetRequiredElement(scope,"a",&el);
 
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (ElementTokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         const int ival = ParseTokenAsInt(**it++);
         out.push_back(ival);
     }
@@ -955,7 +1078,7 @@ void ParseVectorDataArray(std::vector<int>& out, const Element& el) {
 void ParseVectorDataArray(std::vector<float>& out, const Element& el)
 {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const ElementTokenList& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -1012,7 +1135,7 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
     const Scope& scope = GetRequiredScope(el);
     const Element& a = GetRequiredElement(scope,"a",&el);
 
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (ElementTokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         const float ival = ParseTokenAsFloat(**it++);
         out.push_back(ival);
     }
@@ -1022,7 +1145,7 @@ void ParseVectorDataArray(std::vector<float>& out, const Element& el)
 // read an array of uints
 void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el) {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const ElementTokenList& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -1075,7 +1198,7 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el) {
     const Scope& scope = GetRequiredScope(el);
     const Element& a = GetRequiredElement(scope,"a",&el);
 
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (ElementTokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         const int ival = ParseTokenAsInt(**it++);
         if(ival < 0) {
             ParseError("encountered negative integer index");
@@ -1090,7 +1213,7 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el) {
 void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
 {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const ElementTokenList& tok = el.Tokens();
     if(tok.empty()) {
         ParseError("unexpected empty element",&el);
     }
@@ -1139,7 +1262,7 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
     const Scope& scope = GetRequiredScope(el);
     const Element& a = GetRequiredElement(scope,"a",&el);
 
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
+    for (ElementTokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end; ) {
         const uint64_t ival = ParseTokenAsID(**it++);
 
         out.push_back(ival);
@@ -1151,7 +1274,7 @@ void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& el)
 void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
 {
     out.resize( 0 );
-    const TokenList& tok = el.Tokens();
+    const ElementTokenList& tok = el.Tokens();
     if (tok.empty()) {
         ParseError("unexpected empty element", &el);
     }
@@ -1200,7 +1323,7 @@ void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el)
     const Scope& scope = GetRequiredScope(el);
     const Element& a = GetRequiredElement(scope, "a", &el);
 
-    for (TokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end;) {
+    for (ElementTokenList::const_iterator it = a.Tokens().begin(), end = a.Tokens().end(); it != end;) {
         const int64_t ival = ParseTokenAsInt64(**it++);
 
         out.push_back(ival);
@@ -1256,7 +1379,7 @@ std::string ParseTokenAsString(const Token& t)
     return i;
 }
 
-bool HasElement( const Scope& sc, const std::string& index ) {
+bool HasElement( const Scope& sc, std::string_view index ) {
     const Element* el = sc[ index ];
     if ( nullptr == el ) {
         return false;
@@ -1267,11 +1390,11 @@ bool HasElement( const Scope& sc, const std::string& index ) {
 
 // ------------------------------------------------------------------------------------------------
 // extract a required element from a scope, abort if the element cannot be found
-const Element& GetRequiredElement(const Scope& sc, const std::string& index, const Element* element /*= nullptr*/)
+const Element& GetRequiredElement(const Scope& sc, std::string_view index, const Element* element /*= nullptr*/)
 {
     const Element* el = sc[index];
     if(!el) {
-        ParseError("did not find required element \"" + index + "\"",element);
+        ParseError("did not find required element \"" + std::string(index) + "\"",element);
     }
     return *el;
 }
@@ -1294,7 +1417,7 @@ const Scope& GetRequiredScope(const Element& el)
 // get token at a particular index
 const Token& GetRequiredToken(const Element& el, unsigned int index)
 {
-    const TokenList& t = el.Tokens();
+    const ElementTokenList& t = el.Tokens();
     if(index >= t.size()) {
         ParseError(Formatter::format( "missing token at index " ) << index,&el);
     }
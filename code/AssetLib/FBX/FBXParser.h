@@ -48,6 +48,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <assimp/LogAux.h>
 #include <assimp/fast_atof.h>
@@ -57,6 +60,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXTokenizer.h"
 
 namespace Assimp {
+
+class ThreadPool;
+
 namespace FBX {
 
 class Scope;
@@ -64,7 +70,13 @@ class Parser;
 class Element;
 
 using ScopeList = std::vector<Scope*>;
-using ElementMap = std::multimap< std::string, Element*>;
+
+// The parse tree lives in the parser's StackAllocator: keys are views of the
+// key tokens and neither the element maps nor the token lists of the elements
+// allocate from the heap.
+using ElementMap = std::multimap<std::string_view, Element*, std::less<>,
+        StackAllocatorAdapter<std::pair<const std::string_view, Element*>>>;
+using ElementTokenList = std::vector<TokenPtr, StackAllocatorAdapter<TokenPtr>>;
 using ElementCollection = std::pair<ElementMap::const_iterator,ElementMap::const_iterator>;
 
 #define new_Scope new (allocator.Allocate(sizeof(Scope))) Scope
@@ -97,13 +109,18 @@ public:
         return key_token;
     }
 
-    const TokenList& Tokens() const {
+    const ElementTokenList& Tokens() const {
         return tokens;
     }
 
+    Parser& GetParser() const {
+        return parser;
+    }
+
 private:
     const Token& key_token;
-    TokenList tokens;
+    Parser& parser;
+    ElementTokenList tokens;
     Scope* compound;
 };
 
@@ -124,23 +141,23 @@ public:
     Scope(Parser& parser, bool topLevel = false);
     ~Scope();
 
-    const Element* operator[] (const std::string& index) const {
+    const Element* operator[] (std::string_view index) const {
         ElementMap::const_iterator it = elements.find(index);
         return it == elements.end() ? nullptr : (*it).second;
     }
 
-	const Element* FindElementCaseInsensitive(const std::string& elementName) const {
-		const char* elementNameCStr = elementName.c_str();
+	const Element* FindElementCaseInsensitive(std::string_view elementName) const {
 		for (auto element = elements.begin(); element != elements.end(); ++element)
 		{
-            if (!ASSIMP_strincmp(element->first.c_str(), elementNameCStr, AI_MAXLEN)) {
+            if (element->first.size() == elementName.size() &&
+                    !ASSIMP_strincmp(element->first.data(), elementName.data(), static_cast<unsigned int>(elementName.size()))) {
 				return element->second;
 			}
 		}
         return nullptr;
 	}
 
-    ElementCollection GetCollection(const std::string& index) const {
+    ElementCollection GetCollection(std::string_view index) const {
         return elements.equal_range(index);
     }
 
@@ -158,8 +175,9 @@ class Parser
 {
 public:
     /** Parse given a token list. Does not take ownership of the tokens -
-     *  the objects must persist during the entire parser lifetime */
-    Parser(const TokenList &tokens, StackAllocator &allocator, bool is_binary);
+     *  the objects must persist during the entire parser lifetime.
+     *  If a thread pool is given, InflateDataArrays() uses it. */
+    Parser(const TokenList &tokens, StackAllocator &allocator, bool is_binary, ThreadPool *threadPool = nullptr);
     ~Parser();
 
     const Scope& GetRootScope() const {
@@ -174,6 +192,15 @@ public:
         return allocator;
     }
 
+    /** Inflate the compressed binary data arrays below the given elements
+     *  concurrently. Does nothing for text files or without a thread pool. */
+    void InflateDataArrays(const std::vector<const Element*>& elements);
+
+    /** Move the inflated contents of a compressed binary data array token
+     *  into out and drop them from the parser. Returns false if the array
+     *  was not inflated ahead of time. May be called concurrently. */
+    bool TakeInflatedArray(const Token& token, std::vector<char>& out);
+
 private:
     friend class Scope;
     friend class Element;
@@ -187,7 +214,13 @@ private:
     StackAllocator &allocator;
     TokenPtr last, current;
     TokenList::const_iterator cursor;
+    // collects the tokens of the element being parsed, nested elements
+    // only start once their parent's tokens have been copied out
+    TokenList scratchTokens;
     Scope *root;
+    ThreadPool *threadPool;
+    std::unordered_map<TokenPtr, std::vector<char>> inflatedArrays;
+    std::mutex inflatedArraysMutex;
 
     const bool is_binary;
 };
@@ -220,10 +253,10 @@ void ParseVectorDataArray(std::vector<unsigned int>& out, const Element& el);
 void ParseVectorDataArray(std::vector<uint64_t>& out, const Element& e);
 void ParseVectorDataArray(std::vector<int64_t>& out, const Element& el);
 
-bool HasElement( const Scope& sc, const std::string& index );
+bool HasElement( const Scope& sc, std::string_view index );
 
 // extract a required element from a scope, abort if the element cannot be found
-const Element &GetRequiredElement(const Scope &sc, const std::string &index, const Element *element = nullptr);
+const Element &GetRequiredElement(const Scope &sc, std::string_view index, const Element *element = nullptr);
 
 // extract required compound scope
 const Scope& GetRequiredScope(const Element& el);
@@ -62,7 +62,7 @@ using namespace Util;
 
 namespace {
 
-    void checkTokenCount(const TokenList &tok, unsigned int expectedCount) {
+    void checkTokenCount(const ElementTokenList &tok, unsigned int expectedCount) {
         ai_assert(expectedCount >= 2);
         if (tok.size() < expectedCount) {
             const std::string &s = ParseTokenAsString(*tok[1]);
@@ -80,7 +80,7 @@ Property* ReadTypedProperty(const Element& element)
 {
     ai_assert(element.KeyToken().StringContents() == "P");
 
-    const TokenList& tok = element.Tokens();
+    const ElementTokenList& tok = element.Tokens();
     if (tok.size() < 2) {
         return nullptr;
     }
@@ -144,7 +144,7 @@ Property* ReadTypedProperty(const Element& element)
 std::string PeekPropertyName(const Element& element) {
     ai_assert(element.KeyToken().StringContents() == "P");
 
-    const TokenList& tok = element.Tokens();
+    const ElementTokenList& tok = element.Tokens();
     if(tok.size() < 4) {
         return std::string();
     }
@@ -52,6 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
 #include <assimp/ObjMaterial.h>
+#include <assimp/Profiler.h>
 #include <memory>
 
 static constexpr aiImporterDesc desc = {
@@ -124,12 +125,6 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
         throw DeadlyImportError("OBJ-file is too small.");
     }
 
-    IOStreamBuffer<char> streamedBuffer;
-    streamedBuffer.open(fileStream.get());
-
-    // Allocate buffer and read file into it
-    //TextFileToBuffer( fileStream.get(),m_Buffer);
-
     // Get the model name
     std::string modelName, folderName;
     std::string::size_type pos = file.find_last_of("\\/");
@@ -144,10 +139,28 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
     }
 
     // parse the file into a temporary representation
-    ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file);
+    if (m_profiler) {
+        m_profiler->BeginRegion("parse");
+    }
+    IOStreamBuffer<char> streamedBuffer;
+    std::unique_ptr<ObjFileParser> parser;
+    if (nullptr == m_threadPool) {
+        streamedBuffer.open(fileStream.get());
+        parser.reset(new ObjFileParser(streamedBuffer, modelName, pIOHandler, m_progress, file));
+    } else {
+        // tokenize chunks of the file on the worker pool
+        parser.reset(new ObjFileParser(fileStream.get(), modelName, pIOHandler, m_progress, file, m_threadPool));
+    }
+    if (m_profiler) {
+        m_profiler->EndRegion("parse");
+        m_profiler->BeginRegion("convert");
+    }
 
     // And create the proper return structures out of it
-    CreateDataFromImport(parser.GetModel(), pScene);
+    CreateDataFromImport(parser->GetModel(), pScene);
+    if (m_profiler) {
+        m_profiler->EndRegion("convert");
+    }
 
     streamedBuffer.close();
 
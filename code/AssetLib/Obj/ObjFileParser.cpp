@@ -44,12 +44,19 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ObjFileData.h"
 #include "ObjFileMtlImporter.h"
 #include "ObjTools.h"
+#include "Common/ThreadPool.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/ParsingUtils.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <memory>
 #include <utility>
 
@@ -79,6 +86,32 @@ static bool isNanOrInf(const char *in) {
            ((in[0] == 'I' || in[0] == 'i') && ASSIMP_strincmp(in, "inf", 3) == 0);
 }
 
+// -------------------------------------------------------------------
+static size_t countComponents(const char *tmp, const char *end) {
+    size_t numComponents(0);
+    bool end_of_definition = false;
+    while (!end_of_definition) {
+        if (isDataDefinitionEnd(tmp)) {
+            tmp += 2;
+        } else if (IsLineEnd(*tmp)) {
+            end_of_definition = true;
+        }
+        if (!SkipSpaces(&tmp, end) || *tmp == '#') {
+            break;
+        }
+        const bool isNum(IsNumeric(*tmp) || isNanOrInf(tmp));
+        SkipToken(tmp, end);
+        if (isNum) {
+            ++numComponents;
+        }
+        if (!SkipSpaces(&tmp, end) || *tmp == '#') {
+            break;
+        }
+    }
+
+    return numComponents;
+}
+
 // -------------------------------------------------------------------
 ObjFileParser::ObjFileParser() {
     mBuffer.clear();
@@ -91,7 +124,27 @@ ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::stri
             mProgress(progress),
             mOriginalObjFileName(originalObjFileName) { 
     mBuffer.clear();
+    createModel(modelName);
+
+    // Start parsing the file
+    parseFile(streamBuffer);
+}
+
+// -------------------------------------------------------------------
+ObjFileParser::ObjFileParser(IOStream *stream, const std::string &modelName, IOSystem *io,
+        ProgressHandler *progress, const std::string &originalObjFileName, ThreadPool *threadPool) :
+            mIO(io),
+            mProgress(progress),
+            mOriginalObjFileName(originalObjFileName) {
+    mBuffer.clear();
+    createModel(modelName);
 
+    // Start parsing the file
+    parseFileChunked(stream, threadPool);
+}
+
+// -------------------------------------------------------------------
+void ObjFileParser::createModel(const std::string &modelName) {
     // Create the model instance to store all the data
     mModel.reset(new ObjFile::Model());
     mModel->mModelName = modelName;
@@ -101,9 +154,6 @@ ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::stri
     mModel->mDefaultMaterial->MaterialName.Set(DEFAULT_MATERIAL);
     mModel->mMaterialLib.emplace_back(DEFAULT_MATERIAL);
     mModel->mMaterialMap[DEFAULT_MATERIAL] = mModel->mDefaultMaterial;
-
-    // Start parsing the file
-    parseFile(streamBuffer);
 }
 
 void ObjFileParser::setBuffer(std::vector<char> &buffer) {
@@ -153,128 +203,133 @@ void ObjFileParser::parseFile(IOStreamBuffer<char> &streamBuffer) {
 			}
         }
 
-        // handle c-stype section end (http://paulbourke.net/dataformats/obj/)
-        if (insideCstype) {
-            switch (*mDataIt) {
-	            case 'e': {
-	                std::string name;
-	                getNameNoSpace(mDataIt, mDataItEnd, name);
-	                insideCstype = name != "end";
-	            } break;
-				default:
-					break;
-            }
-            goto pf_skip_line;
-        }
+        parseLine(insideCstype);
+    }
+}
 
-        // parse line
+// -------------------------------------------------------------------
+void ObjFileParser::parseLine(bool &insideCstype) {
+    // handle c-stype section end (http://paulbourke.net/dataformats/obj/)
+    if (insideCstype) {
         switch (*mDataIt) {
-        case 'v': // Parse a vertex texture coordinate
-        {
-            ++mDataIt;
-            if (*mDataIt == ' ' || *mDataIt == '\t') {
-                size_t numComponents = getNumComponentsInDataDefinition();
-                if (numComponents == 3) {
-                    // read in vertex definition
-                    getVector3(mModel->mVertices);
-                } else if (numComponents == 4) {
-                    // read in vertex definition (homogeneous coords)
-                    getHomogeneousVector3(mModel->mVertices);
-                } else if (numComponents == 6) {
-                    // fill previous omitted vertex-colors by default
-                    if (mModel->mVertexColors.size() < mModel->mVertices.size()) {
-                        mModel->mVertexColors.resize(mModel->mVertices.size(), aiVector3D(0, 0, 0));
-                    }
-                    // read vertex and vertex-color
-                    getTwoVectors3(mModel->mVertices, mModel->mVertexColors);
-                }
-                // append omitted vertex-colors as default for the end if any vertex-color exists
-                if (!mModel->mVertexColors.empty() && mModel->mVertexColors.size() < mModel->mVertices.size()) {
-                    mModel->mVertexColors.resize(mModel->mVertices.size(), aiVector3D(0, 0, 0));
-                }
-            } else if (*mDataIt == 't') {
-                // read in texture coordinate ( 2D or 3D )
-                ++mDataIt;
-                size_t dim = getTexCoordVector(mModel->mTextureCoord);
-                mModel->mTextureCoordDim = std::max(mModel->mTextureCoordDim, (unsigned int)dim);
-            } else if (*mDataIt == 'n') {
-                // Read in normal vector definition
-                ++mDataIt;
-                getVector3(mModel->mNormals);
-            }
-        } break;
-
-        case 'p': // Parse a face, line or point statement
-        case 'l':
-        case 'f': {
-            getFace(*mDataIt == 'f' ? aiPrimitiveType_POLYGON : (*mDataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
-        } break;
-
-        case '#': // Parse a comment
-        {
-            skipComment();
-        } break;
-
-        case 'u': // Parse a material desc. setter
-        {
+        case 'e': {
             std::string name;
             getNameNoSpace(mDataIt, mDataItEnd, name);
-
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
-
-            if (name == "usemtl") {
-                getMaterialDesc();
-            }
+            insideCstype = name != "end";
         } break;
+        default:
+            break;
+        }
+        goto pf_skip_line;
+    }
 
-        case 'm': // Parse a material library or merging group ('mg')
-        {
-            std::string name;
-
-            getNameNoSpace(mDataIt, mDataItEnd, name);
-
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
-
-            if (name == "mg")
-                skipGroupNumberAndResolution();
-            else if (name == "mtllib")
-                getMaterialLib();
-            else
-                goto pf_skip_line;
-        } break;
+    // parse line
+    switch (*mDataIt) {
+    case 'v': // Parse a vertex texture coordinate
+    {
+        ++mDataIt;
+        if (*mDataIt == ' ' || *mDataIt == '\t') {
+            size_t numComponents = getNumComponentsInDataDefinition();
+            if (numComponents == 3) {
+                // read in vertex definition
+                getVector3(mModel->mVertices);
+            } else if (numComponents == 4) {
+                // read in vertex definition (homogeneous coords)
+                getHomogeneousVector3(mModel->mVertices);
+            } else if (numComponents == 6) {
+                // fill previous omitted vertex-colors by default
+                if (mModel->mVertexColors.size() < mModel->mVertices.size()) {
+                    mModel->mVertexColors.resize(mModel->mVertices.size(), aiVector3D(0, 0, 0));
+                }
+                // read vertex and vertex-color
+                getTwoVectors3(mModel->mVertices, mModel->mVertexColors);
+            }
+            // append omitted vertex-colors as default for the end if any vertex-color exists
+            if (!mModel->mVertexColors.empty() && mModel->mVertexColors.size() < mModel->mVertices.size()) {
+                mModel->mVertexColors.resize(mModel->mVertices.size(), aiVector3D(0, 0, 0));
+            }
+        } else if (*mDataIt == 't') {
+            // read in texture coordinate ( 2D or 3D )
+            ++mDataIt;
+            size_t dim = getTexCoordVector(mModel->mTextureCoord);
+            mModel->mTextureCoordDim = std::max(mModel->mTextureCoordDim, (unsigned int)dim);
+        } else if (*mDataIt == 'n') {
+            // Read in normal vector definition
+            ++mDataIt;
+            getVector3(mModel->mNormals);
+        }
+    } break;
+
+    case 'p': // Parse a face, line or point statement
+    case 'l':
+    case 'f': {
+        getFace(*mDataIt == 'f' ? aiPrimitiveType_POLYGON : (*mDataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
+    } break;
+
+    case '#': // Parse a comment
+    {
+        skipComment();
+    } break;
+
+    case 'u': // Parse a material desc. setter
+    {
+        std::string name;
+        getNameNoSpace(mDataIt, mDataItEnd, name);
+
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
+
+        if (name == "usemtl") {
+            getMaterialDesc();
+        }
+    } break;
 
-        case 'g': // Parse group name
-        {
-            getGroupName();
-        } break;
+    case 'm': // Parse a material library or merging group ('mg')
+    {
+        std::string name;
 
-        case 's': // Parse group number
-        {
-            skipGroupNumber();
-        } break;
+        getNameNoSpace(mDataIt, mDataItEnd, name);
 
-        case 'o': // Parse object name
-        {
-            getObjectName();
-        } break;
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
 
-        case 'c': // handle cstype section start
-        {
-            std::string name;
-            getNameNoSpace(mDataIt, mDataItEnd, name);
-            insideCstype = name == "cstype";
+        if (name == "mg")
+            skipGroupNumberAndResolution();
+        else if (name == "mtllib")
+            getMaterialLib();
+        else
             goto pf_skip_line;
-        }
+    } break;
+
+    case 'g': // Parse group name
+    {
+        getGroupName();
+    } break;
+
+    case 's': // Parse group number
+    {
+        skipGroupNumber();
+    } break;
+
+    case 'o': // Parse object name
+    {
+        getObjectName();
+    } break;
+
+    case 'c': // handle cstype section start
+    {
+        std::string name;
+        getNameNoSpace(mDataIt, mDataItEnd, name);
+        insideCstype = name == "cstype";
+        goto pf_skip_line;
+    }
 
-        default: {
-        pf_skip_line:
-            mDataIt = skipLine<DataArrayIt>(mDataIt, mDataItEnd, mLine);
-        } break;
-        }
+    default: {
+    pf_skip_line:
+        mDataIt = skipLine<DataArrayIt>(mDataIt, mDataItEnd, mLine);
+    } break;
     }
 }
 
@@ -304,29 +359,7 @@ void ObjFileParser::copyNextWord() {
 
 // -------------------------------------------------------------------
 size_t ObjFileParser::getNumComponentsInDataDefinition() {
-    size_t numComponents(0);
-    const char *tmp = &mDataIt[0];
-    bool end_of_definition = false;
-    while (!end_of_definition) {
-        if (isDataDefinitionEnd(tmp)) {
-            tmp += 2;
-        } else if (IsLineEnd(*tmp)) {
-            end_of_definition = true;
-        }
-        if (!SkipSpaces(&tmp, mEnd) || *tmp == '#') {
-            break;
-        }
-        const bool isNum(IsNumeric(*tmp) || isNanOrInf(tmp));
-        SkipToken(tmp, mEnd);
-        if (isNum) {
-            ++numComponents;
-        }
-        if (!SkipSpaces(&tmp, mEnd) || *tmp == '#') {
-            break;
-        }
-    }
-
-    return numComponents;
+    return countComponents(&mDataIt[0], mEnd);
 }
 
 // -------------------------------------------------------------------
@@ -450,40 +483,39 @@ void ObjFileParser::getVector2(std::vector<aiVector2D> &point2d_array) {
 
 static constexpr char DefaultObjName[] = "defaultobject";
 
-// -------------------------------------------------------------------
-void ObjFileParser::getFace(aiPrimitiveType type) {
-    mDataIt = getNextToken<DataArrayIt>(mDataIt, mDataItEnd);
-    if (mDataIt == mDataItEnd || *mDataIt == '\0') {
-        return;
-    }
-
-    ObjFile::Face *face = new ObjFile::Face(type);
-    bool hasNormal = false;
+// Problems found in a face statement, logged when the face is stored.
+enum FaceError : unsigned int {
+    FaceError_SeparatorInPoint = 1,
+    FaceError_UnsupportedToken = 2
+};
 
-    const int vSize = static_cast<unsigned int>(mModel->mVertices.size());
-    const int vtSize = static_cast<unsigned int>(mModel->mTextureCoord.size());
-    const int vnSize = static_cast<unsigned int>(mModel->mNormals.size());
-
-    const bool vt = (!mModel->mTextureCoord.empty());
-    const bool vn = (!mModel->mNormals.empty());
+// -------------------------------------------------------------------
+//  Reads the index tuples of a face statement up to the end of the line. Relative
+//  indices are resolved against the passed array sizes.
+static ObjFile::Face *parseFaceIndices(const char *it, const char *end, aiPrimitiveType type,
+        int vSize, int vtSize, int vnSize, unsigned int &errors) {
+    std::unique_ptr<ObjFile::Face> face(new ObjFile::Face(type));
+
+    const bool vt = vtSize > 0;
+    const bool vn = vnSize > 0;
     int iPos = 0;
-    while (mDataIt < mDataItEnd) {
+    while (it < end) {
         int iStep = 1;
 
-        if (IsLineEnd(*mDataIt) || *mDataIt == '#') {
+        if (IsLineEnd(*it) || *it == '#') {
             break;
         }
 
-        if (*mDataIt == '/') {
+        if (*it == '/') {
             if (type == aiPrimitiveType_POINT) {
-                ASSIMP_LOG_ERROR("Obj: Separator unexpected in point statement");
+                errors |= FaceError_SeparatorInPoint;
             }
             ++iPos;
-        } else if (IsSpaceOrNewLine(*mDataIt) || *mDataIt == '\v') {
+        } else if (IsSpaceOrNewLine(*it) || *it == '\v') {
             iPos = 0;
         } else {
             //OBJ USES 1 Base ARRAYS!!!!
-            const int iVal = ::atoi(&(*mDataIt));
+            const int iVal = ::atoi(it);
 
             // increment iStep position based off of the sign and # of digits
             int tmp = iVal;
@@ -498,43 +530,60 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
                 iPos = 2; // skip texture coords for normals if there are no tex coords
             }
 
-            if (iVal > 0) {
-                // Store parsed index
-                if (0 == iPos) {
-                    face->m_vertices.push_back(iVal - 1);
-                } else if (1 == iPos) {
-                    face->m_texturCoords.push_back(iVal - 1);
-                } else if (2 == iPos) {
-                    face->m_normals.push_back(iVal - 1);
-                    hasNormal = true;
-                } else {
-                    reportErrorTokenInFace();
-                }
-            } else if (iVal < 0) {
-                // Store relatively index
-                if (0 == iPos) {
-                    face->m_vertices.push_back(vSize + iVal);
-                } else if (1 == iPos) {
-                    face->m_texturCoords.push_back(vtSize + iVal);
-                } else if (2 == iPos) {
-                    face->m_normals.push_back(vnSize + iVal);
-                    hasNormal = true;
-                } else {
-                    reportErrorTokenInFace();
-                }
-            } else {
+            if (iVal == 0) {
                 //On error, std::atoi will return 0 which is not a valid value
-                delete face;
                 throw DeadlyImportError("OBJ: Invalid face index.");
             }
+            if (iPos > 2) {
+                // skip the rest of the line
+                errors |= FaceError_UnsupportedToken;
+                break;
+            }
+
+            // Store parsed or relative index
+            if (0 == iPos) {
+                face->m_vertices.push_back(iVal > 0 ? iVal - 1 : vSize + iVal);
+            } else if (1 == iPos) {
+                face->m_texturCoords.push_back(iVal > 0 ? iVal - 1 : vtSize + iVal);
+            } else {
+                face->m_normals.push_back(iVal > 0 ? iVal - 1 : vnSize + iVal);
+            }
         }
-        mDataIt += iStep;
+        it += iStep;
+    }
+
+    return face.release();
+}
+
+// -------------------------------------------------------------------
+void ObjFileParser::getFace(aiPrimitiveType type) {
+    mDataIt = getNextToken<DataArrayIt>(mDataIt, mDataItEnd);
+    if (mDataIt == mDataItEnd || *mDataIt == '\0') {
+        return;
+    }
+
+    unsigned int errors = 0;
+    ObjFile::Face *face = parseFaceIndices(&*mDataIt, mEnd, type,
+            static_cast<int>(mModel->mVertices.size()),
+            static_cast<int>(mModel->mTextureCoord.size()),
+            static_cast<int>(mModel->mNormals.size()), errors);
+    storeFace(face, errors);
+
+    // Skip the rest of the line
+    mDataIt = skipLine<DataArrayIt>(mDataIt, mDataItEnd, mLine);
+}
+
+// -------------------------------------------------------------------
+void ObjFileParser::storeFace(ObjFile::Face *face, unsigned int errors) {
+    if (errors & FaceError_SeparatorInPoint) {
+        ASSIMP_LOG_ERROR("Obj: Separator unexpected in point statement");
+    }
+    if (errors & FaceError_UnsupportedToken) {
+        ASSIMP_LOG_ERROR("OBJ: Not supported token in face description detected");
     }
 
     if (face->m_vertices.empty()) {
         ASSIMP_LOG_ERROR("Obj: Ignoring empty face");
-        // skip line and clean up
-        mDataIt = skipLine<DataArrayIt>(mDataIt, mDataItEnd, mLine);
         delete face;
         return;
     }
@@ -560,11 +609,423 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
     mModel->mCurrentMesh->m_Faces.emplace_back(face);
     mModel->mCurrentMesh->m_uiNumIndices += static_cast<unsigned int>(face->m_vertices.size());
     mModel->mCurrentMesh->m_uiUVCoordinates[0] += static_cast<unsigned int>(face->m_texturCoords.size());
-    if (!mModel->mCurrentMesh->m_hasNormals && hasNormal) {
+    if (!mModel->mCurrentMesh->m_hasNormals && !face->m_normals.empty()) {
         mModel->mCurrentMesh->m_hasNormals = true;
     }
-    // Skip the rest of the line
-    mDataIt = skipLine<DataArrayIt>(mDataIt, mDataItEnd, mLine);
+}
+
+// Size of the windows a file is read in, if the stream cannot be mapped.
+static constexpr size_t ObjWindowSize = 64 * 1024 * 1024;
+// Minimum amount of text handed to a single task.
+static constexpr size_t ObjMinChunkSize = 256 * 1024;
+
+namespace {
+
+// A statement which is not a vertex definition. Faces are tokenized once the number
+// of vertices in front of the chunk is known, all others are replayed in file order.
+struct ObjStatement {
+    const char *begin;
+    const char *end;
+    size_t numVertices;
+    size_t numTexCoords;
+    size_t numNormals;
+    unsigned int errors;
+    std::unique_ptr<ObjFile::Face> face;
+};
+
+// The data defined by a range of complete lines.
+struct ObjChunk {
+    std::vector<aiVector3D> vertices;
+    std::vector<aiVector3D> colors;
+    std::vector<aiVector3D> texCoords;
+    std::vector<aiVector3D> normals;
+    unsigned int texCoordDim = 0;
+    std::vector<ObjStatement> statements;
+    std::deque<std::vector<char>> joinedLines;
+    bool hasCstype = false;
+    std::exception_ptr error;
+    size_t firstVertex = 0;
+    size_t firstTexCoord = 0;
+    size_t firstNormal = 0;
+};
+
+} // namespace
+
+// -------------------------------------------------------------------
+//  Returns true, if the '\n' at newLine surely ends a statement. Lines continued
+//  with a backslash are joined, and the character behind such a continuation is
+//  always taken as part of the statement, so lines which contain a backslash or
+//  follow an empty line are not used to split the file.
+static bool isStatementEnd(const char *begin, const char *newLine) {
+    if (newLine != begin && newLine[-1] == '\n') {
+        return false;
+    }
+    for (const char *it = newLine; it != begin && it[-1] != '\n'; --it) {
+        if (it[-1] == '\\') {
+            return false;
+        }
+    }
+    return true;
+}
+
+// -------------------------------------------------------------------
+//  Returns the start of the first statement behind pos, or end.
+static const char *findStatementStart(const char *begin, const char *pos, const char *end) {
+    while (pos < end) {
+        const char *newLine = static_cast<const char *>(std::memchr(pos, '\n', end - pos));
+        if (newLine == nullptr) {
+            break;
+        }
+        pos = newLine + 1;
+        if (isStatementEnd(begin, newLine)) {
+            return pos;
+        }
+    }
+    return end;
+}
+
+// -------------------------------------------------------------------
+//  Returns the end of the last complete statement in [begin, end), or begin.
+static const char *findLastStatementEnd(const char *begin, const char *end) {
+    for (const char *it = end; it != begin; --it) {
+        if (it[-1] == '\n' && isStatementEnd(begin, it - 1)) {
+            return it;
+        }
+    }
+    return begin;
+}
+
+// -------------------------------------------------------------------
+//  Gets the next line like IOStreamBuffer::getNextDataLine. Lines continued with
+//  a backslash and an unterminated last line are copied into storage, so every
+//  line is followed by a line end.
+static bool getNextLine(const char *&it, const char *end, std::deque<std::vector<char>> &storage,
+        const char *&lineBegin, const char *&lineEnd) {
+    if (it >= end) {
+        return false;
+    }
+
+    const char *pos = it;
+    while (pos != end && !IsLineEnd(*pos) && !(*pos == '\\' && pos + 1 != end && IsLineEnd(pos[1]))) {
+        ++pos;
+    }
+    if (pos != end && IsLineEnd(*pos)) {
+        lineBegin = it;
+        lineEnd = pos;
+        it = pos + 1;
+        return true;
+    }
+
+    storage.emplace_back(it, pos);
+    std::vector<char> &line = storage.back();
+    while (pos != end && !IsLineEnd(*pos)) {
+        if (*pos == '\\' && pos + 1 != end && IsLineEnd(pos[1])) {
+            // skip to the next line, its first character is never checked for a line end
+            pos = static_cast<const char *>(std::memchr(pos, '\n', end - pos));
+            if (pos == nullptr || ++pos == end) {
+                pos = end;
+                break;
+            }
+        }
+        line.push_back(*pos++);
+    }
+    it = pos != end ? pos + 1 : end;
+    line.push_back('\n');
+    lineBegin = line.data();
+    lineEnd = lineBegin + line.size() - 1;
+    return true;
+}
+
+// -------------------------------------------------------------------
+//  Reads the next word as a real number, like copyNextWord() followed by fast_atof().
+static ai_real getNextReal(const char *&it, const char *end, std::string &word) {
+    word.clear();
+    it = getNextWord(it, end);
+    if (it != end && *it == '\\') {
+        if (++it == end) {
+            return fast_atof(word.c_str());
+        }
+        it = getNextWord(++it, end);
+    }
+    const char *start = it;
+    while (it != end && !IsSpaceOrNewLine(*it)) {
+        ++it;
+    }
+    word.assign(start, it);
+    return fast_atof(word.c_str());
+}
+
+// -------------------------------------------------------------------
+//  Parses a v, vt or vn statement into the arrays of a chunk.
+static void parseVertexLine(const char *it, const char *end, ObjChunk &chunk, std::string &word) {
+    ai_real x, y, z;
+    ++it;
+    if (*it == ' ' || *it == '\t') {
+        const size_t numComponents = countComponents(it, end);
+        if (numComponents == 3) {
+            x = getNextReal(it, end, word);
+            y = getNextReal(it, end, word);
+            z = getNextReal(it, end, word);
+            chunk.vertices.emplace_back(x, y, z);
+        } else if (numComponents == 4) {
+            x = getNextReal(it, end, word);
+            y = getNextReal(it, end, word);
+            z = getNextReal(it, end, word);
+            const ai_real w = getNextReal(it, end, word);
+            if (w == 0) {
+                throw DeadlyImportError("OBJ: Invalid component in homogeneous vector (Division by zero)");
+            }
+            chunk.vertices.emplace_back(x / w, y / w, z / w);
+        } else if (numComponents == 6) {
+            // fill previous omitted vertex-colors by default
+            chunk.colors.resize(chunk.vertices.size(), aiVector3D(0, 0, 0));
+            x = getNextReal(it, end, word);
+            y = getNextReal(it, end, word);
+            z = getNextReal(it, end, word);
+            chunk.vertices.emplace_back(x, y, z);
+            x = getNextReal(it, end, word);
+            y = getNextReal(it, end, word);
+            z = getNextReal(it, end, word);
+            chunk.colors.emplace_back(x, y, z);
+        }
+    } else if (*it == 't') {
+        ++it;
+        const size_t numComponents = countComponents(it, end);
+        if (2 != numComponents && 3 != numComponents) {
+            throw DeadlyImportError("OBJ: Invalid number of components");
+        }
+        x = getNextReal(it, end, word);
+        y = getNextReal(it, end, word);
+        z = 3 == numComponents ? getNextReal(it, end, word) : ai_real(0.0);
+
+        // Coerce nan and inf to 0 as is the OBJ default value
+        chunk.texCoords.emplace_back(std::isfinite(x) ? x : 0, std::isfinite(y) ? y : 0, std::isfinite(z) ? z : 0);
+        chunk.texCoordDim = std::max(chunk.texCoordDim, static_cast<unsigned int>(numComponents));
+    } else if (*it == 'n') {
+        ++it;
+        x = getNextReal(it, end, word);
+        y = getNextReal(it, end, word);
+        z = getNextReal(it, end, word);
+        chunk.normals.emplace_back(x, y, z);
+    }
+}
+
+// -------------------------------------------------------------------
+//  Reads the vertex data of a range of complete lines and collects all other statements.
+static void tokenizeChunk(const char *begin, const char *end, ObjChunk &chunk) {
+    std::string word;
+    const char *lineBegin = nullptr, *lineEnd = nullptr;
+    try {
+        while (getNextLine(begin, end, chunk.joinedLines, lineBegin, lineEnd)) {
+            switch (*lineBegin) {
+            case 'v':
+                parseVertexLine(lineBegin, lineEnd + 1, chunk, word);
+                break;
+            case 'p':
+            case 'l':
+            case 'f':
+            case 'u':
+            case 'm':
+            case 'g':
+            case 'o':
+                chunk.statements.push_back({ lineBegin, lineEnd, chunk.vertices.size(), chunk.texCoords.size(),
+                        chunk.normals.size(), 0, nullptr });
+                break;
+            case 'c':
+                chunk.hasCstype = chunk.hasCstype ||
+                        (lineEnd - lineBegin >= 6 && 0 == ::strncmp(lineBegin, "cstype", 6) && IsSpaceOrNewLine(lineBegin[6]));
+                break;
+            default:
+                // comments, smoothing groups and unsupported statements carry no data
+                break;
+            }
+        }
+    } catch (...) {
+        chunk.error = std::current_exception();
+    }
+
+    if (!chunk.colors.empty()) {
+        // append omitted vertex-colors as default for the end
+        chunk.colors.resize(chunk.vertices.size(), aiVector3D(0, 0, 0));
+    }
+}
+
+// -------------------------------------------------------------------
+void ObjFileParser::parseFileChunked(IOStream *stream, ThreadPool *threadPool) {
+    const size_t fileSize = stream->FileSize();
+    const unsigned int progressTotal = static_cast<unsigned int>(fileSize);
+    bool insideCstype = false;
+
+    // Parse the file in place if the stream can hand out all of it
+    const char *mapped = reinterpret_cast<const char *>(stream->GetMappedPointer());
+    if (mapped != nullptr) {
+        parseWindow(mapped, mapped + fileSize, true, insideCstype, threadPool);
+        if (mProgress != nullptr) {
+            mProgress->UpdateFileRead(progressTotal, progressTotal);
+        }
+        return;
+    }
+
+    // Otherwise read windows of complete lines, the incomplete statement at the end
+    // of a window is moved to the start of the next one.
+    std::vector<char> window;
+    size_t filePos = 0, carry = 0;
+    bool isFileStart = true;
+    for (;;) {
+        const size_t toRead = std::min(ObjWindowSize, fileSize - filePos);
+        window.resize(carry + toRead);
+        const size_t readLen = stream->Read(window.data() + carry, 1, toRead);
+        const size_t available = carry + readLen;
+        filePos += readLen;
+        const bool isFileEnd = readLen < toRead || filePos >= fileSize;
+
+        const char *begin = window.data();
+        const char *end = isFileEnd ? begin + available : findLastStatementEnd(begin, begin + available);
+        if (end != begin) {
+            parseWindow(begin, end, isFileStart, insideCstype, threadPool);
+            isFileStart = false;
+        }
+        if (mProgress != nullptr) {
+            mProgress->UpdateFileRead(static_cast<unsigned int>(filePos), progressTotal);
+        }
+        if (isFileEnd) {
+            break;
+        }
+
+        carry = available - (end - begin);
+        std::memmove(window.data(), end, carry);
+    }
+}
+
+// -------------------------------------------------------------------
+void ObjFileParser::parseWindow(const char *begin, const char *end, bool isFileStart, bool &insideCstype, ThreadPool *threadPool) {
+    if (isFileStart && end - begin >= 3 &&
+            static_cast<unsigned char>(begin[0]) == 0xEF &&
+            static_cast<unsigned char>(begin[1]) == 0xBB &&
+            static_cast<unsigned char>(begin[2]) == 0xBF) {
+        begin += 3; // skip BOM
+    }
+
+    // Split the window into chunks of complete statements
+    const size_t numThreads = threadPool != nullptr ? threadPool->GetNumWorkers() + 1 : 1;
+    const size_t size = static_cast<size_t>(end - begin);
+    const size_t numChunks = numThreads > 1 ? std::max<size_t>(1, std::min(numThreads * 4, size / ObjMinChunkSize)) : 1;
+    std::vector<const char *> bounds(numChunks + 1, end);
+    bounds[0] = begin;
+    for (size_t i = 1; i < numChunks; ++i) {
+        bounds[i] = findStatementStart(begin, std::max(bounds[i - 1], begin + size / numChunks * i), end);
+    }
+
+    const auto forEachChunk = [&](const std::function<void(size_t)> &fn) {
+        if (numChunks > 1) {
+            threadPool->ParallelFor(numChunks, fn);
+        } else {
+            fn(0);
+        }
+    };
+
+    // Read all vertex data, in parallel if possible
+    std::vector<ObjChunk> chunks(numChunks);
+    bool parseLines = insideCstype;
+    if (!parseLines) {
+        forEachChunk([&](size_t i) {
+            tokenizeChunk(bounds[i], bounds[i + 1], chunks[i]);
+        });
+        for (const ObjChunk &chunk : chunks) {
+            parseLines = parseLines || chunk.hasCstype;
+        }
+    }
+
+    // Curves and surfaces change the meaning of the statements in their section,
+    // windows containing them are parsed line by line.
+    if (parseLines) {
+        chunks.clear();
+        std::deque<std::vector<char>> joinedLines;
+        const char *lineBegin = nullptr, *lineEnd = nullptr;
+        while (getNextLine(begin, end, joinedLines, lineBegin, lineEnd)) {
+            replayLine(lineBegin, lineEnd, insideCstype);
+            joinedLines.clear();
+        }
+        return;
+    }
+    for (const ObjChunk &chunk : chunks) {
+        if (chunk.error) {
+            std::rethrow_exception(chunk.error);
+        }
+    }
+
+    // Place the data of each chunk behind the data of the previous ones
+    size_t numVertices = mModel->mVertices.size();
+    size_t numTexCoords = mModel->mTextureCoord.size();
+    size_t numNormals = mModel->mNormals.size();
+    bool hasColors = !mModel->mVertexColors.empty();
+    for (ObjChunk &chunk : chunks) {
+        chunk.firstVertex = numVertices;
+        chunk.firstTexCoord = numTexCoords;
+        chunk.firstNormal = numNormals;
+        numVertices += chunk.vertices.size();
+        numTexCoords += chunk.texCoords.size();
+        numNormals += chunk.normals.size();
+        hasColors = hasColors || !chunk.colors.empty();
+        mModel->mTextureCoordDim = std::max(mModel->mTextureCoordDim, chunk.texCoordDim);
+    }
+    mModel->mVertices.resize(numVertices);
+    mModel->mTextureCoord.resize(numTexCoords);
+    mModel->mNormals.resize(numNormals);
+    if (hasColors) {
+        mModel->mVertexColors.resize(numVertices, aiVector3D(0, 0, 0));
+    }
+
+    // Copy the vertex data and tokenize the faces, all indices are known now
+    forEachChunk([&](size_t i) {
+        ObjChunk &chunk = chunks[i];
+        std::copy(chunk.vertices.begin(), chunk.vertices.end(), mModel->mVertices.begin() + chunk.firstVertex);
+        std::copy(chunk.colors.begin(), chunk.colors.end(), mModel->mVertexColors.begin() + chunk.firstVertex);
+        std::copy(chunk.texCoords.begin(), chunk.texCoords.end(), mModel->mTextureCoord.begin() + chunk.firstTexCoord);
+        std::copy(chunk.normals.begin(), chunk.normals.end(), mModel->mNormals.begin() + chunk.firstNormal);
+
+        for (ObjStatement &statement : chunk.statements) {
+            const char type = *statement.begin;
+            if (type != 'f' && type != 'l' && type != 'p') {
+                continue;
+            }
+            const char *lineEnd = statement.end + 1;
+            const char *it = getNextToken(statement.begin, lineEnd);
+            if (it == lineEnd || *it == '\0') {
+                continue;
+            }
+            statement.face.reset(parseFaceIndices(it, lineEnd,
+                    type == 'f' ? aiPrimitiveType_POLYGON : (type == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT),
+                    static_cast<int>(chunk.firstVertex + statement.numVertices),
+                    static_cast<int>(chunk.firstTexCoord + statement.numTexCoords),
+                    static_cast<int>(chunk.firstNormal + statement.numNormals), statement.errors));
+        }
+    });
+
+    // Assign the faces to objects, groups and materials in file order
+    for (ObjChunk &chunk : chunks) {
+        for (ObjStatement &statement : chunk.statements) {
+            if (statement.face) {
+                storeFace(statement.face.release(), statement.errors);
+            } else if (*statement.begin != 'f' && *statement.begin != 'l' && *statement.begin != 'p') {
+                replayLine(statement.begin, statement.end, insideCstype);
+            }
+        }
+    }
+}
+
+// -------------------------------------------------------------------
+void ObjFileParser::replayLine(const char *begin, const char *end, bool &insideCstype) {
+    // The statement handlers expect a line end and some slack behind the line,
+    // as left by IOStreamBuffer::getNextDataLine
+    mLineBuffer.assign(begin, end);
+    mLineBuffer.push_back('\n');
+    mLineBuffer.push_back('\0');
+    mDataIt = mLineBuffer.begin();
+    mDataItEnd = mLineBuffer.end();
+    mEnd = mLineBuffer.data() + mLineBuffer.size();
+
+    parseLine(insideCstype);
 }
 
 // -------------------------------------------------------------------
@@ -873,13 +1334,6 @@ bool ObjFileParser::needsNewMesh(const std::string &materialName) {
     return newMat;
 }
 
-// -------------------------------------------------------------------
-//  Shows an error in parsing process.
-void ObjFileParser::reportErrorTokenInFace() {
-    mDataIt = skipLine<DataArrayIt>(mDataIt, mDataItEnd, mLine);
-    ASSIMP_LOG_ERROR("OBJ: Not supported token in face description detected");
-}
-
 // -------------------------------------------------------------------
 
 } // Namespace Assimp
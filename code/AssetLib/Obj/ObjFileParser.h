@@ -57,8 +57,10 @@ namespace Assimp {
 
 // Forward declarations
 class ObjFileImporter;
+class IOStream;
 class IOSystem;
 class ProgressHandler;
+class ThreadPool;
 
 // ------------------------------------------------------------------------------------------------
 /// \class  ObjFileParser
@@ -75,6 +77,9 @@ public:
     ObjFileParser();
     /// @brief  Constructor with data array.
     ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName);
+    /// @brief  Constructor with stream, the file is parsed in chunks which are tokenized
+    ///         concurrently if a thread pool is passed.
+    ObjFileParser(IOStream *stream, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName, ThreadPool *threadPool);
     /// @brief  Destructor
     ~ObjFileParser() = default;
     /// @brief  If you want to load in-core data.
@@ -86,8 +91,18 @@ public:
     ObjFileParser &operator=(const ObjFileParser& ) = delete;
 
 protected:
+    /// Creates the model and its default material.
+    void createModel(const std::string &modelName);
     /// Parse the loaded file
     void parseFile(IOStreamBuffer<char> &streamBuffer);
+    /// Parse the file in windows of complete lines.
+    void parseFileChunked(IOStream *stream, ThreadPool *threadPool);
+    /// Parse a window of complete lines.
+    void parseWindow(const char *begin, const char *end, bool isFileStart, bool &insideCstype, ThreadPool *threadPool);
+    /// Parse the line in the current buffer.
+    void parseLine(bool &insideCstype);
+    /// Copies a line into the current buffer and parses it.
+    void replayLine(const char *begin, const char *end, bool &insideCstype);
     /// Method to copy the new delimited word in the current line.
     void copyNextWord();
     /// Get the number of components in a line.
@@ -104,6 +119,8 @@ protected:
     void getVector2(std::vector<aiVector2D> &point2d_array);
     /// Stores the following face.
     void getFace(aiPrimitiveType type);
+    /// Assigns a parsed face to the current mesh, takes ownership of the face.
+    void storeFace(ObjFile::Face *face, unsigned int errors);
     /// Reads the material description.
     void getMaterialDesc();
     /// Skip a comment.
@@ -128,8 +145,6 @@ protected:
     void createMesh(const std::string &meshName);
     /// Returns true, if a new mesh instance must be created.
     bool needsNewMesh(const std::string &rMaterialName);
-    /// Error report in token
-    void reportErrorTokenInFace();
 
 protected:
     /// Default material name
@@ -144,6 +159,8 @@ protected:
     unsigned int mLine{ 0 };
     //! Helper buffer (safe)
     std::string mBuffer;
+    //! Copy of the current line when parsing chunks
+    std::vector<char> mLineBuffer;
 	/// End of buffer
     const char *mEnd{ nullptr };
     /// Pointer to IO system instance.
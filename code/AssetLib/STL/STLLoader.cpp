@@ -172,13 +172,19 @@ void STLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     mFileSize = file->FileSize();
 
-    // allocate storage and copy the contents of the file to a memory buffer
-    // (terminate it with zero)
+    // binary files can be parsed in place if the stream exposes its contents,
+    // otherwise allocate storage and copy the contents of the file to a
+    // memory buffer (terminate it with zero)
     std::vector<char> buffer2;
-    TextFileToBuffer(file.get(), buffer2);
+    const char *mapped = reinterpret_cast<const char *>(file->GetMappedPointer());
+    if (nullptr != mapped && IsBinarySTL(mapped, mFileSize)) {
+        mBuffer = mapped;
+    } else {
+        TextFileToBuffer(file.get(), buffer2);
+        mBuffer = &buffer2[0];
+    }
 
     mScene = pScene;
-    mBuffer = &buffer2[0];
 
     // the default vertex color is light gray.
     mClrColorDefault.r = mClrColorDefault.g = mClrColorDefault.b = mClrColorDefault.a = 0.6f;
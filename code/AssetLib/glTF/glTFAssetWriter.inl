@@ -591,11 +591,11 @@ namespace glTF {
         //
 
         size_t bodyLength = 0;
+        size_t bodyOffset = sizeof(GLB_Header) + sceneLength;
         if (Ref<Buffer> b = mAsset.GetBodyBuffer()) {
             bodyLength = b->byteLength;
 
             if (bodyLength > 0) {
-                size_t bodyOffset = sizeof(GLB_Header) + sceneLength;
                 bodyOffset = (bodyOffset + 3) & ~3; // Round up to next multiple of 4
 
                 outfile->Seek(bodyOffset, aiOrigin_SET);
@@ -616,7 +616,8 @@ namespace glTF {
         header.version = 1;
         AI_SWAP4(header.version);
 
-        header.length = uint32_t(sizeof(header) + sceneLength + bodyLength);
+        // the padding in front of the body counts as well
+        header.length = uint32_t(bodyOffset + bodyLength);
         AI_SWAP4(header.length);
 
         header.sceneLength = uint32_t(sceneLength);
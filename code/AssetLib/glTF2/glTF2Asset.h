@@ -63,11 +63,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exceptional.h>
 
 #include <algorithm>
+#include <limits>
 #include <list>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 // clang-format off
@@ -120,6 +125,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/GltfMaterial.h>
 
 #include "AssetLib/glTFCommon/glTFCommon.h"
+#include "AssetLib/glTFCommon/glTFMeshopt.h"
+
+namespace Assimp {
+class ThreadPool;
+}
 
 namespace glTF2 {
 
@@ -454,6 +464,9 @@ public:
 
     Type type;
 
+    //! EXT_meshopt_compression: the buffer has no data and only reserves the size of the decoded views
+    bool meshoptFallback = false;
+
     /// Pointer to currently active encoded region.
     /// Why not decoding all regions at once and not to set one buffer with decoded data?
     /// Yes, why not? Even "accessor" point to decoded data. I mean that fields "byteOffset", "byteStride" and "count" has values which describes decoded
@@ -478,6 +491,9 @@ public:
 private:
     shared_ptr<uint8_t> mData; //!< Pointer to the data
     bool mIsSpecial; //!< Set to true for special cases (e.g. the body buffer)
+    shared_ptr<IOStream> mStream; //!< Stream the data is read from on demand (see BindToStream)
+    size_t mStreamOffset; //!< Offset of the data in mStream, in bytes
+    std::mutex mStreamMutex; //!< Serializes reads from mStream
 
     /// \var EncodedRegion_List
     /// List of encoded regions.
@@ -493,6 +509,31 @@ public:
 
     bool LoadFromStream(IOStream &stream, size_t length = 0, size_t baseOffset = 0);
 
+    /// Like LoadFromStream, but references the data in place if the stream exposes its contents
+    /// (see IOStream::GetMappedPointer). The buffer then keeps the stream open and must not be modified.
+    /// \param [in] stream - stream to load from.
+    /// \param [in] length - number of bytes to load, 0 loads the whole stream.
+    /// \param [in] baseOffset - offset of the data in the stream, in bytes.
+    bool LoadFromSharedStream(const shared_ptr<IOStream> &stream, size_t length = 0, size_t baseOffset = 0);
+
+    /// Keeps the stream open instead of loading it. GetPointer() then returns nullptr and each
+    /// bufferView reads its own bytes on demand (see BufferView::GetPointer). Mapped streams are
+    /// referenced in place as with LoadFromSharedStream.
+    /// \param [in] stream - stream to read from.
+    /// \param [in] length - number of bytes of the buffer, 0 uses the whole stream.
+    /// \param [in] baseOffset - offset of the data in the stream, in bytes.
+    bool BindToStream(const shared_ptr<IOStream> &stream, size_t length = 0, size_t baseOffset = 0);
+
+    /// Whether the data is read on demand, see BindToStream.
+    bool IsStreamed() const { return mStream != nullptr; }
+
+    /// Reads a part of a streamed buffer.
+    /// \param [in] offset - offset from the begin of the buffer, in bytes.
+    /// \param [in] length - number of bytes to read.
+    /// \param [out] out - destination, must hold length bytes.
+    /// \return true - if the bytes were read, false if the range is invalid or the read failed.
+    bool ReadRange(size_t offset, size_t length, uint8_t *out);
+
     /// Mark region of "bufferView" as encoded. When data is request from such region then "bufferView" use decoded data.
     /// \param [in] pOffset - offset from begin of "bufferView" to encoded region, in bytes.
     /// \param [in] pEncodedData_Length - size of encoded region, in bytes.
@@ -517,6 +558,11 @@ public:
     size_t AppendData(uint8_t *data, size_t length);
     void Grow(size_t amount);
 
+    /// Replaces the whole data of the buffer with a copy of the given bytes.
+    /// \param [in] data - pointer to the new data.
+    /// \param [in] length - count of bytes in the new data.
+    void SetData(const uint8_t *data, size_t length);
+
     uint8_t *GetPointer() { return mData.get(); }
 
     void MarkAsSpecial() { mIsSpecial = true; }
@@ -537,8 +583,46 @@ struct BufferView : public Object {
 
     BufferViewTarget target; //! The target that the WebGL buffer should be bound to.
 
+    //! EXT_meshopt_compression: the data of the view is decoded from another buffer
+    struct MeshoptCompression {
+        enum Mode {
+            Mode_ATTRIBUTES,
+            Mode_TRIANGLES,
+            Mode_INDICES
+        };
+
+        Ref<Buffer> buffer; //!< The buffer holding the compressed data. (required)
+        size_t byteOffset; //!< The offset of the compressed data in the buffer, in bytes. (default: 0)
+        size_t byteLength; //!< The length of the compressed data, in bytes. (required)
+        size_t byteStride; //!< The size of one decoded element, in bytes. (required)
+        size_t count; //!< The number of decoded elements. (required)
+        Mode mode; //!< The codec the data was compressed with. (required)
+        glTFCommon::Meshopt::Filter filter; //!< The filter to apply after decoding. (default: None)
+    };
+    std::unique_ptr<MeshoptCompression> meshoptCompression;
+
     void Read(Value &obj, Asset &r);
     uint8_t *GetPointerAndTailSize(size_t accOffset, size_t& outTailSize);
+
+    //! Start of the view's data. For streamed buffers the bytes are read on first use, compressed
+    //! views are decoded on first use.
+    uint8_t *GetPointer();
+
+    //! Whether the view's bytes are held by the view itself instead of living in the buffer
+    bool HasSeparateData() { return meshoptCompression || (buffer && buffer->IsStreamed()); }
+
+    //! Drops the separately held bytes, they are read or decoded again if needed.
+    void ReleaseData() {
+        std::lock_guard<std::mutex> lock(mDataMutex);
+        mData.reset();
+    }
+
+private:
+    void ReadMeshoptCompression(Value &ext, Asset &r);
+    void DecodeMeshopt();
+
+    std::unique_ptr<uint8_t[]> mData; //!< The view's bytes, see HasSeparateData
+    std::mutex mDataMutex; //!< Guards the lazy loading of mData
 };
 
 //! A typed view into a BufferView. A BufferView contains raw binary data.
@@ -556,6 +640,7 @@ struct Accessor : public Object {
     std::vector<double> min; //!< Minimum value of each component in this attribute.
     std::unique_ptr<Sparse> sparse;
     std::unique_ptr<Buffer> decodedBuffer; // Packed decoded data, returned instead of original bufferView if present
+    bool normalized = false; //!< Whether integer components are normalized to [0, 1] or [-1, 1]. (default: false)
 
     unsigned int GetNumComponents();
     unsigned int GetBytesPerComponent();
@@ -564,10 +649,20 @@ struct Accessor : public Object {
     inline uint8_t *GetPointer();
     inline size_t GetStride();
     inline size_t GetMaxByteSize();
+    inline uint8_t *GetCheckedPointer();
 
     template <class T>
     size_t ExtractData(T *&outData, const std::vector<unsigned int> *remappingIndices = nullptr);
 
+    //! Decodes the elements straight into outData, which must hold one T per (remapped) element.
+    //! T is a plain aggregate of ai_real (aiVector3D, aiColor4D, ...); integer components are
+    //! widened or dequantized (KHR_mesh_quantization), missing components are zero-filled.
+    template <class T>
+    size_t DecodeData(T *outData, const std::vector<unsigned int> *remappingIndices = nullptr, bool forceNormalized = false);
+
+    //! Decodes a scalar index accessor into outData, which must hold count indices.
+    size_t DecodeIndices(unsigned int *outData);
+
     void WriteData(size_t count, const void *src_buffer, size_t src_stride);
     void WriteSparseValues(size_t count, const void *src_data, size_t src_dataStride);
     void WriteSparseIndices(size_t count, const void *src_idx, size_t src_idxStride);
@@ -898,6 +993,13 @@ struct Mesh : public Object {
         // extension: FB_ngon_encoding
         bool ngonEncoded;
 
+        //! extension: KHR_draco_mesh_compression, only used for writing. Shared by copies of the primitive.
+        struct DracoCompression {
+            Ref<BufferView> bufferView; //!< The compressed mesh.
+            std::vector<std::pair<std::string, uint32_t>> attributes; //!< Attribute semantics and their Draco ids.
+        };
+        std::shared_ptr<DracoCompression> draco;
+
         Primitive(): ngonEncoded(false) {}
     };
 
@@ -1135,6 +1237,8 @@ public:
         bool KHR_materials_emissive_strength{false};
         bool KHR_materials_anisotropy{false};
         bool KHR_draco_mesh_compression{false};
+        bool KHR_mesh_quantization{false};
+        bool EXT_meshopt_compression{false};
         bool FB_ngon_encoding{false};
         bool KHR_texture_basisu{false};
         bool EXT_texture_webp{false};
@@ -1146,6 +1250,8 @@ public:
     //! Keeps info about the required extensions
     struct RequiredExtensions {
         bool KHR_draco_mesh_compression{false};
+        bool KHR_mesh_quantization{false};
+        bool EXT_meshopt_compression{false};
         bool KHR_texture_basisu{false};
         bool EXT_texture_webp{false};
 
@@ -1214,6 +1320,20 @@ public:
 
     Ref<Buffer> GetBodyBuffer() { return mBodyBuffer; }
 
+    //! Read buffer data on demand instead of loading whole buffers (see Buffer::BindToStream)
+    void SetStreamBuffers(bool streamBuffers) { mStreamBuffers = streamBuffers; }
+
+    //! Decode compressed data on the pool's workers, nullptr decodes on the calling thread
+    void SetThreadPool(Assimp::ThreadPool *threadPool) { mThreadPool = threadPool; }
+
+    //! Compressed data whose decoding is deferred to the end of Load(), so it can run concurrently
+    struct DeferredDecode {
+        std::function<void()> decode; //!< Runs on any thread, must only write data owned by the job
+        std::function<void()> apply; //!< Runs on the loading thread, in queue order
+    };
+
+    void QueueDecode(DeferredDecode job) { mDeferredDecodes.push_back(std::move(job)); }
+
     Asset(Asset &) = delete;
     Asset &operator=(const Asset &) = delete;
 
@@ -1228,6 +1348,9 @@ private:
     void ReadExtensionsUsed(Document &doc);
     void ReadExtensionsRequired(Document &doc);
 
+    /// Decodes all meshopt compressed buffer views and runs the queued decodes.
+    void DecodeCompressedData();
+
     IOStream *OpenFile(const std::string &path, const char *mode, bool absolute = false);
 
 private:
@@ -1238,6 +1361,9 @@ private:
     size_t mBodyOffset;
     size_t mBodyLength;
     Ref<Buffer> mBodyBuffer;
+    bool mStreamBuffers = false;
+    Assimp::ThreadPool *mThreadPool = nullptr;
+    std::vector<DeferredDecode> mDeferredDecodes;
     std::unordered_map<std::string, int> lastUsedID;
 };
 
@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "AssetLib/glTFCommon/glTFCommon.h"
+#include "Common/ThreadPool.h"
 
 #include <assimp/MemoryIOWrapper.h>
 #include <assimp/StringUtils.h>
@@ -173,6 +174,52 @@ inline void CopyData(size_t count, const uint8_t *src, size_t src_stride,
     }
 }
 
+//! Converts one component to ai_real following the glTF rules for normalized integers.
+template <class C>
+inline ai_real DequantizeComponent(C c, bool normalized) {
+    if (!normalized || std::is_floating_point<C>::value) {
+        return static_cast<ai_real>(c);
+    }
+    const ai_real value = static_cast<ai_real>(c) / static_cast<ai_real>(std::numeric_limits<C>::max());
+    return std::is_signed<C>::value ? std::max(value, ai_real(-1)) : value;
+}
+
+//! Decodes count elements of numComps components each into a packed ai_real array.
+template <class C>
+inline void DecodeComponents(const uint8_t *src, size_t stride, unsigned int numComps, bool normalized,
+        const unsigned int *remap, size_t count, ai_real *dst, unsigned int dstComps) {
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t *elem = src + (remap ? remap[i] : i) * stride;
+        unsigned int c = 0;
+        for (; c < numComps; ++c) {
+            C value;
+            memcpy(&value, elem + c * sizeof(C), sizeof(C));
+            dst[c] = DequantizeComponent(value, normalized);
+        }
+        for (; c < dstComps; ++c) {
+            dst[c] = ai_real(0);
+        }
+        dst += dstComps;
+    }
+}
+
+//! Widens count indices of type C into unsigned int.
+template <class C>
+inline void WidenIndices(const uint8_t *src, size_t stride, size_t count, unsigned int *dst) {
+    if (stride == sizeof(C)) {
+        const C *packed = reinterpret_cast<const C *>(src);
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = packed[i];
+        }
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        C value;
+        memcpy(&value, src + i * stride, sizeof(C));
+        dst[i] = value;
+    }
+}
+
 void SetVector(vec4 &v, const float (&in)[4]) {
     v[0] = in[0];
     v[1] = in[1];
@@ -280,12 +327,12 @@ inline void CopyFaceIndex_Draco(Buffer &decodedIndexBuffer, const draco::Mesh &d
     }
 }
 
-inline void SetDecodedIndexBuffer_Draco(const draco::Mesh &dracoMesh, Mesh::Primitive &prim) {
-    if (!prim.indices || dracoMesh.num_faces() == 0)
-        return;
+inline std::unique_ptr<Buffer> DecodeIndexBuffer_Draco(const draco::Mesh &dracoMesh, Accessor &indices) {
+    if (dracoMesh.num_faces() == 0)
+        return nullptr;
 
     // Create a decoded Index buffer (if there is one)
-    size_t componentBytes = prim.indices->GetBytesPerComponent();
+    size_t componentBytes = indices.GetBytesPerComponent();
 
     std::unique_ptr<Buffer> decodedIndexBuffer(new Buffer());
     decodedIndexBuffer->Grow(dracoMesh.num_faces() * 3 * componentBytes);
@@ -295,9 +342,7 @@ inline void SetDecodedIndexBuffer_Draco(const draco::Mesh &dracoMesh, Mesh::Prim
     // Usually uint32_t but shouldn't assume
     if (sizeof(dracoMesh.face(draco::FaceIndex(0))[0]) == componentBytes) {
         memcpy(decodedIndexBuffer->GetPointer(), &dracoMesh.face(draco::FaceIndex(0))[0], decodedIndexBuffer->byteLength);
-        // Assign this alternate data buffer to the accessor
-        prim.indices->decodedBuffer.swap(decodedIndexBuffer);
-        return;
+        return decodedIndexBuffer;
     }
 
     // Not same size, convert
@@ -316,8 +361,7 @@ inline void SetDecodedIndexBuffer_Draco(const draco::Mesh &dracoMesh, Mesh::Prim
         break;
     }
 
-    // Assign this alternate data buffer to the accessor
-    prim.indices->decodedBuffer.swap(decodedIndexBuffer);
+    return decodedIndexBuffer;
 }
 
 template <typename T>
@@ -339,7 +383,7 @@ static bool GetAttributeForAllPoints_Draco(const draco::Mesh &dracoMesh,
     return true;
 }
 
-inline void SetDecodedAttributeBuffer_Draco(const draco::Mesh &dracoMesh, uint32_t dracoAttribId, Accessor &accessor) {
+inline std::unique_ptr<Buffer> DecodeAttributeBuffer_Draco(const draco::Mesh &dracoMesh, uint32_t dracoAttribId, Accessor &accessor) {
     // Create decoded buffer
     const draco::PointAttribute *pDracoAttribute = dracoMesh.GetAttributeByUniqueId(dracoAttribId);
     if (pDracoAttribute == nullptr) {
@@ -375,8 +419,7 @@ inline void SetDecodedAttributeBuffer_Draco(const draco::Mesh &dracoMesh, uint32
         break;
     }
 
-    // Assign this alternate data buffer to the accessor
-    accessor.decodedBuffer.swap(decodedAttribBuffer);
+    return decodedAttribBuffer;
 }
 
 #endif // ASSIMP_ENABLE_DRACO
@@ -558,7 +601,8 @@ inline Buffer::Buffer() :
         byteLength(0),
         type(Type_arraybuffer),
         EncodedRegion_Current(nullptr),
-        mIsSpecial(false) {
+        mIsSpecial(false),
+        mStreamOffset(0) {
     // empty
 }
 
@@ -576,7 +620,11 @@ inline void Buffer::Read(Value &obj, Asset &r) {
 
     Value *it = FindString(obj, "uri");
     if (!it) {
-        if (statedLength > 0) {
+        // EXT_meshopt_compression fallback buffers only reserve the space of the decoded views
+        Value *meshoptExt = FindExtension(obj, "EXT_meshopt_compression");
+        const bool isFallback = meshoptExt && MemberOrDefault(*meshoptExt, "fallback", false);
+        meshoptFallback = isFallback;
+        if (statedLength > 0 && !isFallback) {
             throw DeadlyImportError("GLTF: buffer with non-zero length missing the \"uri\" attribute");
         }
         return;
@@ -610,8 +658,13 @@ inline void Buffer::Read(Value &obj, Asset &r) {
 
             IOStream *file = r.OpenFile(dir + uri, "rb");
             if (file) {
-                bool ok = LoadFromStream(*file, byteLength);
-                delete file;
+                bool ok;
+                if (r.mStreamBuffers) {
+                    ok = BindToStream(shared_ptr<IOStream>(file), byteLength);
+                } else {
+                    ok = LoadFromStream(*file, byteLength);
+                    delete file;
+                }
 
                 if (!ok)
                     throw DeadlyImportError("GLTF: error while reading referenced file \"", uri, "\"");
@@ -641,6 +694,55 @@ inline bool Buffer::LoadFromStream(IOStream &stream, size_t length, size_t baseO
     return true;
 }
 
+inline bool Buffer::LoadFromSharedStream(const shared_ptr<IOStream> &stream, size_t length, size_t baseOffset) {
+    const uint8_t *mapped = stream->GetMappedPointer();
+    if (nullptr == mapped) {
+        return LoadFromStream(*stream, length, baseOffset);
+    }
+
+    const size_t fileSize = stream->FileSize();
+    byteLength = length ? length : fileSize;
+    if (baseOffset > fileSize || byteLength > fileSize - baseOffset) {
+        throw DeadlyImportError("GLTF: Invalid byteLength exceeds size of actual data.");
+    }
+
+    // share ownership with the stream, the importer only ever reads from loaded buffers
+    mData = shared_ptr<uint8_t>(stream, const_cast<uint8_t *>(mapped + baseOffset));
+    return true;
+}
+
+inline bool Buffer::BindToStream(const shared_ptr<IOStream> &stream, size_t length, size_t baseOffset) {
+    if (nullptr != stream->GetMappedPointer()) {
+        // mapped pages cost nothing until touched
+        return LoadFromSharedStream(stream, length, baseOffset);
+    }
+
+    const size_t fileSize = stream->FileSize();
+    byteLength = length ? length : fileSize;
+    if (baseOffset > fileSize || byteLength > fileSize - baseOffset) {
+        throw DeadlyImportError("GLTF: Invalid byteLength exceeds size of actual data.");
+    }
+
+    mData.reset();
+    mStream = stream;
+    mStreamOffset = baseOffset;
+    return true;
+}
+
+inline bool Buffer::ReadRange(size_t offset, size_t length, uint8_t *out) {
+    std::lock_guard<std::mutex> lock(mStreamMutex);
+    if (!mStream || offset > byteLength || length > byteLength - offset) {
+        return false;
+    }
+    if (length == 0) {
+        return true;
+    }
+    if (mStream->Seek(mStreamOffset + offset, aiOrigin_SET) != aiReturn_SUCCESS) {
+        return false;
+    }
+    return mStream->Read(out, length, 1) == 1;
+}
+
 inline void Buffer::EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t *pDecodedData, const size_t pDecodedData_Length, const std::string &pID) {
     // Check pointer to data
     if (pDecodedData == nullptr) throw DeadlyImportError("GLTF: for marking encoded region pointer to decoded data must be provided.");
@@ -759,6 +861,16 @@ inline void Buffer::Grow(size_t amount) {
     byteLength += amount;
 }
 
+inline void Buffer::SetData(const uint8_t *data, size_t length) {
+    uint8_t *b = new uint8_t[length];
+    if (length > 0) {
+        memcpy(b, data, length);
+    }
+    mData.reset(b, std::default_delete<uint8_t[]>());
+    byteLength = length;
+    capacity = length;
+}
+
 //
 // struct BufferView
 //
@@ -779,6 +891,133 @@ inline void BufferView::Read(Value &obj, Asset &r) {
     if ((byteOffset + byteLength) > buffer->byteLength) {
         throw DeadlyImportError("GLTF: Buffer view with offset/length (", byteOffset, "/", byteLength, ") is out of range.");
     }
+
+    if (Value *meshoptExt = FindExtension(obj, "EXT_meshopt_compression")) {
+        ReadMeshoptCompression(*meshoptExt, r);
+    }
+}
+
+inline void BufferView::ReadMeshoptCompression(Value &ext, Asset &r) {
+    std::unique_ptr<MeshoptCompression> compression(new MeshoptCompression());
+    if (Value *bufferVal = FindUInt(ext, "buffer")) {
+        compression->buffer = r.buffers.Retrieve(bufferVal->GetUint());
+    }
+    if (!compression->buffer) {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression of ", getContextForErrorMessages(id, name), " without valid buffer.");
+    }
+
+    compression->byteOffset = MemberOrDefault(ext, "byteOffset", size_t(0));
+    compression->byteLength = MemberOrDefault(ext, "byteLength", size_t(0));
+    compression->byteStride = MemberOrDefault(ext, "byteStride", size_t(0));
+    compression->count = MemberOrDefault(ext, "count", size_t(0));
+
+    const char *mode = "";
+    ReadMember(ext, "mode", mode);
+    if (strcmp(mode, "ATTRIBUTES") == 0) {
+        compression->mode = MeshoptCompression::Mode_ATTRIBUTES;
+    } else if (strcmp(mode, "TRIANGLES") == 0) {
+        compression->mode = MeshoptCompression::Mode_TRIANGLES;
+    } else if (strcmp(mode, "INDICES") == 0) {
+        compression->mode = MeshoptCompression::Mode_INDICES;
+    } else {
+        throw DeadlyImportError("GLTF: Unknown EXT_meshopt_compression mode \"", mode, "\" in ", getContextForErrorMessages(id, name));
+    }
+
+    const char *filter = "NONE";
+    ReadMember(ext, "filter", filter);
+    if (strcmp(filter, "NONE") == 0) {
+        compression->filter = glTFCommon::Meshopt::Filter::None;
+    } else if (strcmp(filter, "OCTAHEDRAL") == 0) {
+        compression->filter = glTFCommon::Meshopt::Filter::Octahedral;
+    } else if (strcmp(filter, "QUATERNION") == 0) {
+        compression->filter = glTFCommon::Meshopt::Filter::Quaternion;
+    } else if (strcmp(filter, "EXPONENTIAL") == 0) {
+        compression->filter = glTFCommon::Meshopt::Filter::Exponential;
+    } else {
+        throw DeadlyImportError("GLTF: Unknown EXT_meshopt_compression filter \"", filter, "\" in ", getContextForErrorMessages(id, name));
+    }
+
+    const size_t stride = compression->byteStride;
+    const bool validStride = compression->mode == MeshoptCompression::Mode_ATTRIBUTES ?
+            (stride > 0 && stride <= 256 && stride % 4 == 0) :
+            (stride == 2 || stride == 4);
+    if (!validStride || (compression->mode != MeshoptCompression::Mode_ATTRIBUTES && compression->filter != glTFCommon::Meshopt::Filter::None) ||
+            (compression->mode == MeshoptCompression::Mode_TRIANGLES && compression->count % 3 != 0)) {
+        throw DeadlyImportError("GLTF: Invalid EXT_meshopt_compression layout in ", getContextForErrorMessages(id, name));
+    }
+    if (compression->byteOffset > compression->buffer->byteLength ||
+            compression->byteLength > compression->buffer->byteLength - compression->byteOffset) {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression data of ", getContextForErrorMessages(id, name), " is out of range.");
+    }
+    if (compression->count > byteLength / stride) {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression of ", getContextForErrorMessages(id, name), " decodes more than byteLength bytes.");
+    }
+
+    meshoptCompression = std::move(compression);
+}
+
+inline uint8_t *BufferView::GetPointer() {
+    if (!buffer) {
+        return nullptr;
+    }
+
+    if (!HasSeparateData()) {
+        uint8_t *basePtr = buffer->GetPointer();
+        return basePtr ? basePtr + byteOffset : nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mDataMutex);
+    if (!mData && byteLength > 0) {
+        if (meshoptCompression) {
+            DecodeMeshopt();
+        } else {
+            std::unique_ptr<uint8_t[]> data(new uint8_t[byteLength]);
+            if (!buffer->ReadRange(byteOffset, byteLength, data.get())) {
+                throw DeadlyImportError("GLTF: Could not read the data of ", getContextForErrorMessages(id, name));
+            }
+            mData = std::move(data);
+        }
+    }
+    return mData.get();
+}
+
+inline void BufferView::DecodeMeshopt() {
+    MeshoptCompression &compression = *meshoptCompression;
+
+    // the compressed bytes are only needed while decoding
+    std::vector<uint8_t> streamedSource;
+    const uint8_t *source = nullptr;
+    if (compression.buffer->IsStreamed()) {
+        streamedSource.resize(compression.byteLength);
+        if (compression.buffer->ReadRange(compression.byteOffset, compression.byteLength, streamedSource.data())) {
+            source = streamedSource.data();
+        }
+    } else if (uint8_t *basePtr = compression.buffer->GetPointer()) {
+        source = basePtr + compression.byteOffset;
+    }
+    if (source == nullptr && compression.byteLength > 0) {
+        throw DeadlyImportError("GLTF: Could not read the compressed data of ", getContextForErrorMessages(id, name));
+    }
+
+    // the part of the view not covered by the decoded elements stays zeroed
+    std::unique_ptr<uint8_t[]> data(new uint8_t[byteLength]());
+    bool ok = false;
+    switch (compression.mode) {
+    case MeshoptCompression::Mode_ATTRIBUTES:
+        ok = glTFCommon::Meshopt::DecodeVertexBuffer(data.get(), compression.count, compression.byteStride, source, compression.byteLength) &&
+             glTFCommon::Meshopt::ApplyFilter(compression.filter, data.get(), compression.count, compression.byteStride);
+        break;
+    case MeshoptCompression::Mode_TRIANGLES:
+        ok = glTFCommon::Meshopt::DecodeIndexBuffer(data.get(), compression.count, compression.byteStride, source, compression.byteLength);
+        break;
+    case MeshoptCompression::Mode_INDICES:
+        ok = glTFCommon::Meshopt::DecodeIndexSequence(data.get(), compression.count, compression.byteStride, source, compression.byteLength);
+        break;
+    }
+    if (!ok) {
+        throw DeadlyImportError("GLTF: Invalid EXT_meshopt_compression data in ", getContextForErrorMessages(id, name));
+    }
+    mData = std::move(data);
 }
 
 inline uint8_t *BufferView::GetPointerAndTailSize(size_t accOffset, size_t& outTailSize) {
@@ -786,6 +1025,14 @@ inline uint8_t *BufferView::GetPointerAndTailSize(size_t accOffset, size_t& outT
         outTailSize = 0;
         return nullptr;
     }
+
+    if (HasSeparateData()) {
+        // only the view itself is loaded
+        uint8_t *viewPtr = accOffset < byteLength ? GetPointer() : nullptr;
+        outTailSize = viewPtr ? byteLength - accOffset : 0;
+        return viewPtr ? viewPtr + accOffset : nullptr;
+    }
+
     uint8_t * const basePtr = buffer->GetPointer();
     if (!basePtr) {
         outTailSize = 0;
@@ -885,6 +1132,7 @@ inline void Accessor::Read(Value &obj, Asset &r) {
 
     const char *typestr;
     type = ReadMember(obj, "type", typestr) ? AttribType::FromString(typestr) : AttribType::SCALAR;
+    normalized = MemberOrDefault(obj, "normalized", false);
 
     if (bufferView) {
         // Check length
@@ -953,6 +1201,15 @@ inline void Accessor::Read(Value &obj, Asset &r) {
             sparse->PopulateData(dataSize, nullptr);
         }
         sparse->PatchData(elementSize);
+
+        if (sparse->values && sparse->values->buffer && sparse->values->buffer->IsStreamed()) {
+            // the patched copy is all that is needed from now on
+            sparse->indices->ReleaseData();
+            sparse->values->ReleaseData();
+            if (bufferView) {
+                bufferView->ReleaseData();
+            }
+        }
     }
 }
 
@@ -976,6 +1233,11 @@ inline uint8_t *Accessor::GetPointer() {
         return sparse->data.data();
 
     if (!bufferView || !bufferView->buffer) return nullptr;
+    if (bufferView->HasSeparateData()) {
+        uint8_t *viewPtr = bufferView->GetPointer();
+        return viewPtr ? viewPtr + byteOffset : nullptr;
+    }
+
     uint8_t *basePtr = bufferView->buffer->GetPointer();
     if (!basePtr) return nullptr;
 
@@ -1017,13 +1279,30 @@ inline size_t Accessor::GetMaxByteSize() {
     return 0;
 }
 
-template <class T>
-size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remappingIndices) {
+inline uint8_t *Accessor::GetCheckedPointer() {
     uint8_t *data = GetPointer();
     if (!data) {
         throw DeadlyImportError("GLTF2: data is null when extracting data from ", getContextForErrorMessages(id, name));
     }
 
+    const size_t elemSize = GetElementSize();
+    const size_t maxSize = GetMaxByteSize();
+
+    if (elemSize > maxSize) {
+        throw DeadlyImportError("GLTF: elemSize ", elemSize, " > maxSize ", maxSize, " in ", getContextForErrorMessages(id, name));
+    }
+
+    const size_t maxCount = (maxSize - elemSize) / GetStride() + 1;
+
+    if (count > maxCount) {
+        throw DeadlyImportError("GLTF: count ", count, " > maxCount ", maxCount, " in ", getContextForErrorMessages(id, name));
+    }
+
+    return data;
+}
+
+template <class T>
+size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remappingIndices) {
     const size_t usedCount = (remappingIndices != nullptr) ? remappingIndices->size() : count;
     const size_t elemSize = GetElementSize();
     const size_t totalSize = elemSize * usedCount;
@@ -1036,17 +1315,7 @@ size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remap
         throw DeadlyImportError("GLTF: elemSize ", elemSize, " > targetElemSize ", targetElemSize, " in ", getContextForErrorMessages(id, name));
     }
 
-    const size_t maxSize = GetMaxByteSize();
-
-    if (elemSize > maxSize) {
-        throw DeadlyImportError("GLTF: elemSize ", elemSize, " > maxSize ", maxSize, " in ", getContextForErrorMessages(id, name));
-    }
-
-    const size_t maxCount = (maxSize - elemSize) / stride + 1;
-
-    if (count > maxCount) {
-        throw DeadlyImportError("GLTF: count ", count, " > maxCount ", maxCount, " in ", getContextForErrorMessages(id, name));
-    }
+    uint8_t *data = GetCheckedPointer();
 
     outData = new T[usedCount];
 
@@ -1070,11 +1339,91 @@ size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remap
     return usedCount;
 }
 
+template <class T>
+size_t Accessor::DecodeData(T *outData, const std::vector<unsigned int> *remappingIndices, bool forceNormalized) {
+    static_assert(sizeof(T) % sizeof(ai_real) == 0, "DecodeData needs a target made of ai_real components");
+    constexpr unsigned int dstComps = static_cast<unsigned int>(sizeof(T) / sizeof(ai_real));
+
+    const size_t usedCount = (remappingIndices != nullptr) ? remappingIndices->size() : count;
+    const unsigned int numComps = GetNumComponents();
+    if (numComps > dstComps) {
+        throw DeadlyImportError("GLTF: numComponents ", numComps, " > targetComponents ", dstComps, " in ", getContextForErrorMessages(id, name));
+    }
+
+    const uint8_t *data = GetCheckedPointer();
+    const size_t stride = GetStride();
+    const unsigned int *remap = nullptr;
+    if (remappingIndices != nullptr) {
+        for (unsigned int srcIdx : *remappingIndices) {
+            if (srcIdx >= count) {
+                throw DeadlyImportError("GLTF: index ", srcIdx, " >= count ", count, " in ", getContextForErrorMessages(id, name));
+            }
+        }
+        remap = remappingIndices->data();
+    }
+
+    ai_real *dst = reinterpret_cast<ai_real *>(outData);
+    const bool norm = normalized || forceNormalized;
+    switch (componentType) {
+    case ComponentType_FLOAT:
+        // Tightly packed float data with a matching layout needs no conversion at all
+        if (std::is_same<ai_real, float>::value && remap == nullptr && numComps == dstComps && stride == sizeof(T)) {
+            memcpy(dst, data, usedCount * sizeof(T));
+        } else {
+            DecodeComponents<float>(data, stride, numComps, norm, remap, usedCount, dst, dstComps);
+        }
+        break;
+    case ComponentType_BYTE:
+        DecodeComponents<int8_t>(data, stride, numComps, norm, remap, usedCount, dst, dstComps);
+        break;
+    case ComponentType_UNSIGNED_BYTE:
+        DecodeComponents<uint8_t>(data, stride, numComps, norm, remap, usedCount, dst, dstComps);
+        break;
+    case ComponentType_SHORT:
+        DecodeComponents<int16_t>(data, stride, numComps, norm, remap, usedCount, dst, dstComps);
+        break;
+    case ComponentType_UNSIGNED_SHORT:
+        DecodeComponents<uint16_t>(data, stride, numComps, norm, remap, usedCount, dst, dstComps);
+        break;
+    case ComponentType_UNSIGNED_INT:
+        DecodeComponents<uint32_t>(data, stride, numComps, norm, remap, usedCount, dst, dstComps);
+        break;
+    default:
+        throw DeadlyImportError("GLTF: Unsupported component type in ", getContextForErrorMessages(id, name));
+    }
+    return usedCount;
+}
+
+inline size_t Accessor::DecodeIndices(unsigned int *outData) {
+    const uint8_t *data = GetCheckedPointer();
+    const size_t stride = GetStride();
+
+    // Like Indexer::GetUInt, only the component width matters here
+    switch (GetBytesPerComponent()) {
+    case 1:
+        WidenIndices<uint8_t>(data, stride, count, outData);
+        break;
+    case 2:
+        WidenIndices<uint16_t>(data, stride, count, outData);
+        break;
+    case 4:
+        if (stride == sizeof(unsigned int)) {
+            memcpy(outData, data, count * sizeof(unsigned int));
+        } else {
+            WidenIndices<uint32_t>(data, stride, count, outData);
+        }
+        break;
+    default:
+        throw DeadlyImportError("GLTF: Unsupported index component type in ", getContextForErrorMessages(id, name));
+    }
+    return count;
+}
+
 inline void Accessor::WriteData(size_t _count, const void *src_buffer, size_t src_stride) {
     uint8_t *buffer_ptr = bufferView->buffer->GetPointer();
     size_t offset = byteOffset + bufferView->byteOffset;
 
-    size_t dst_stride = GetNumComponents() * GetBytesPerComponent();
+    size_t dst_stride = bufferView->byteStride ? bufferView->byteStride : GetNumComponents() * GetBytesPerComponent();
 
     const uint8_t *src = reinterpret_cast<const uint8_t *>(src_buffer);
     uint8_t *dst = reinterpret_cast<uint8_t *>(buffer_ptr + offset);
@@ -1172,7 +1521,18 @@ inline void Image::Read(Value &obj, Asset &r) {
             // maybe this memcpy could be avoided if aiTexture does not delete[] pcData at destruction.
 
             this->mData.reset(new uint8_t[this->mDataLength]);
-            memcpy(this->mData.get(), buffer->GetPointer() + this->bufferView->byteOffset, this->mDataLength);
+            if (this->bufferView->HasSeparateData() && !this->bufferView->meshoptCompression) {
+                // read straight into the image, the view itself is never loaded
+                if (!buffer->ReadRange(this->bufferView->byteOffset, this->mDataLength, this->mData.get())) {
+                    throw DeadlyImportError("GLTF2: Could not read the data of ", getContextForErrorMessages(id, name));
+                }
+            } else {
+                const uint8_t *viewPtr = this->bufferView->GetPointer();
+                if (viewPtr == nullptr) {
+                    throw DeadlyImportError("GLTF2: Could not read the data of ", getContextForErrorMessages(id, name));
+                }
+                memcpy(this->mData.get(), viewPtr, this->mDataLength);
+            }
         } else {
             throw DeadlyImportError("GLTF2: ", getContextForErrorMessages(id, name), " should have either a URI of a bufferView and mimetype");
         }
@@ -1554,27 +1914,10 @@ inline void Mesh::Read(Value &pJSON_Object, Asset &pAsset_Root) {
                 if (Value *dracoExt = FindExtension(primitive, "KHR_draco_mesh_compression")) {
                     if (Value *bufView = FindUInt(*dracoExt, "bufferView")) {
                         // Attempt to load indices and attributes using draco compression
-                        auto bufferView = pAsset_Root.bufferViews.Retrieve(bufView->GetUint());
-                        // Attempt to perform the draco decode on the buffer data
-                        const char *bufferViewData = reinterpret_cast<const char *>(bufferView->buffer->GetPointer() + bufferView->byteOffset);
-                        draco::DecoderBuffer decoderBuffer;
-                        decoderBuffer.Init(bufferViewData, bufferView->byteLength);
-                        draco::Decoder decoder;
-                        auto decodeResult = decoder.DecodeMeshFromBuffer(&decoderBuffer);
-                        if (!decodeResult.ok()) {
-                            // A corrupt Draco isn't actually fatal if the primitive data is also provided in a standard buffer, but does anyone do that?
-                            throw DeadlyImportError("GLTF: Invalid Draco mesh compression in mesh: ", name, " primitive: ", i, ": ", decodeResult.status().error_msg_string());
-                        }
-
-                        // Now we have a draco mesh
-                        const std::unique_ptr<draco::Mesh> &pDracoMesh = decodeResult.value();
-
-                        // Redirect the accessors to the decoded data
+                        Ref<BufferView> bufferView = pAsset_Root.bufferViews.Retrieve(bufView->GetUint());
 
-                        // Indices
-                        SetDecodedIndexBuffer_Draco(*pDracoMesh, prim);
-
-                        // Vertex attributes
+                        // Collect the accessors to redirect to the decoded data
+                        std::vector<std::pair<Accessor *, uint32_t>> dracoAttributes;
                         if (Value *attrs = FindObject(*dracoExt, "attributes")) {
                             for (Value::MemberIterator it = attrs->MemberBegin(); it != attrs->MemberEnd(); ++it) {
                                 if (!it->value.IsUint()) continue;
@@ -1598,12 +1941,58 @@ inline void Mesh::Read(Value &pJSON_Object, Asset &pAsset_Root) {
                                     if (attribAccessor.count == 0)
                                         throw DeadlyImportError("GLTF: Invalid draco attribute in mesh: ", name, " primitive: ", i, " attrib: ", attr);
 
-                                    // Redirect this accessor to the appropriate Draco vertex attribute data
-                                    const uint32_t dracoAttribId = it->value.GetUint();
-                                    SetDecodedAttributeBuffer_Draco(*pDracoMesh, dracoAttribId, attribAccessor);
+                                    dracoAttributes.emplace_back(&attribAccessor, it->value.GetUint());
                                 }
                             }
                         }
+
+                        // The decode only writes into its own buffers, so the primitives can be decoded
+                        // concurrently at the end of the load. The accessors are redirected afterwards.
+                        struct DecodedBuffers {
+                            std::unique_ptr<Buffer> indices;
+                            std::vector<std::unique_ptr<Buffer>> attributes;
+                        };
+                        std::shared_ptr<DecodedBuffers> decoded = std::make_shared<DecodedBuffers>();
+                        Accessor *indices = prim.indices ? &*prim.indices : nullptr;
+                        const std::string meshName = name;
+
+                        Asset::DeferredDecode job;
+                        job.decode = [bufferView, decoded, indices, dracoAttributes, meshName, i]() mutable {
+                            // Attempt to perform the draco decode on the buffer data
+                            const char *bufferViewData = reinterpret_cast<const char *>(bufferView->GetPointer());
+                            draco::DecoderBuffer decoderBuffer;
+                            decoderBuffer.Init(bufferViewData, bufferView->byteLength);
+                            draco::Decoder decoder;
+                            auto decodeResult = decoder.DecodeMeshFromBuffer(&decoderBuffer);
+                            if (!decodeResult.ok()) {
+                                // A corrupt Draco isn't actually fatal if the primitive data is also provided in a standard buffer, but does anyone do that?
+                                throw DeadlyImportError("GLTF: Invalid Draco mesh compression in mesh: ", meshName, " primitive: ", i, ": ", decodeResult.status().error_msg_string());
+                            }
+                            const std::unique_ptr<draco::Mesh> &pDracoMesh = decodeResult.value();
+
+                            // Indices
+                            if (indices) {
+                                decoded->indices = DecodeIndexBuffer_Draco(*pDracoMesh, *indices);
+                            }
+
+                            // Vertex attributes
+                            for (const auto &attribute : dracoAttributes) {
+                                decoded->attributes.push_back(DecodeAttributeBuffer_Draco(*pDracoMesh, attribute.second, *attribute.first));
+                            }
+                        };
+                        job.apply = [bufferView, decoded, indices, dracoAttributes]() mutable {
+                            // Now we have a draco mesh, the compressed bytes of a streamed buffer are no longer needed
+                            bufferView->ReleaseData();
+
+                            // Redirect the accessors to the decoded data
+                            if (decoded->indices) {
+                                indices->decodedBuffer = std::move(decoded->indices);
+                            }
+                            for (size_t a = 0; a < dracoAttributes.size(); ++a) {
+                                dracoAttributes[a].first->decodedBuffer = std::move(decoded->attributes[a]);
+                            }
+                        };
+                        pAsset_Root.QueueDecode(std::move(job));
                     }
                 }
             }
@@ -2099,7 +2488,9 @@ inline void Asset::Load(const std::string &pFile, bool isBinary)
 
     // Fill the buffer instance for the current file embedded contents
     if (mBodyLength > 0) {
-        if (!mBodyBuffer->LoadFromStream(*stream, mBodyLength, mBodyOffset)) {
+        const bool ok = mStreamBuffers ? mBodyBuffer->BindToStream(stream, mBodyLength, mBodyOffset) :
+                mBodyBuffer->LoadFromSharedStream(stream, mBodyLength, mBodyOffset);
+        if (!ok) {
             throw DeadlyImportError("GLTF: Unable to read gltf file");
         }
     }
@@ -2155,12 +2546,40 @@ inline void Asset::Load(const std::string &pFile, bool isBinary)
         }
     }
 
+    DecodeCompressedData();
+
     // Clean up
     for (size_t i = 0; i < mDicts.size(); ++i) {
         mDicts[i]->DetachFromDocument();
     }
 }
 
+inline void Asset::DecodeCompressedData() {
+    std::vector<std::function<void()>> decodes;
+    for (unsigned int i = 0; i < bufferViews.Size(); ++i) {
+        BufferView *view = &bufferViews[i];
+        if (view->meshoptCompression) {
+            decodes.emplace_back([view]() { view->GetPointer(); });
+        }
+    }
+    for (const DeferredDecode &job : mDeferredDecodes) {
+        decodes.push_back(job.decode);
+    }
+
+    if (mThreadPool) {
+        mThreadPool->ParallelFor(decodes.size(), [&decodes](size_t i) { decodes[i](); });
+    } else {
+        for (const std::function<void()> &decode : decodes) {
+            decode();
+        }
+    }
+
+    for (const DeferredDecode &job : mDeferredDecodes) {
+        job.apply();
+    }
+    mDeferredDecodes.clear();
+}
+
 inline bool Asset::CanRead(const std::string &pFile, bool isBinary) {
     try {
         shared_ptr<IOStream> stream(OpenFile(pFile.c_str(), "rb", true));
@@ -2202,6 +2621,8 @@ inline void Asset::ReadExtensionsRequired(Document &doc) {
     }
 
     CHECK_REQUIRED_EXT(KHR_draco_mesh_compression);
+    CHECK_REQUIRED_EXT(KHR_mesh_quantization);
+    CHECK_REQUIRED_EXT(EXT_meshopt_compression);
     CHECK_REQUIRED_EXT(KHR_texture_basisu);
     CHECK_REQUIRED_EXT(EXT_texture_webp);
 
@@ -2233,6 +2654,8 @@ inline void Asset::ReadExtensionsUsed(Document &doc) {
     CHECK_EXT(KHR_materials_emissive_strength);
     CHECK_EXT(KHR_materials_anisotropy);
     CHECK_EXT(KHR_draco_mesh_compression);
+    CHECK_EXT(KHR_mesh_quantization);
+    CHECK_EXT(EXT_meshopt_compression);
     CHECK_EXT(KHR_texture_basisu);
     CHECK_EXT(EXT_texture_webp);
 
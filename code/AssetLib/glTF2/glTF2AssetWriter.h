@@ -64,6 +64,43 @@ namespace glTF2
 
 using rapidjson::MemoryPoolAllocator;
 
+//! Output stream for the rapidjson writers. The serialized JSON is collected in a
+//! small buffer and forwarded to an IOStream, so the text is never held as a whole.
+class IOStreamOutput
+{
+public:
+    typedef char Ch;
+
+    explicit IOStreamOutput(IOStream* stream);
+
+    void Put(Ch c);
+    void Flush();
+
+    //! Number of bytes written so far
+    size_t Tell() const { return mWritten + mUsed; }
+
+private:
+    IOStream* mStream;
+    std::vector<Ch> mBuffer;
+    size_t mUsed;
+    size_t mWritten;
+};
+
+//! The SAX calls the asset writer needs, independent of the rapidjson writer
+//! that formats them (compact for GLB, pretty printed for glTF)
+class JsonOutput
+{
+public:
+    virtual ~JsonOutput() = default;
+
+    virtual void StartObject() = 0;
+    virtual void EndObject() = 0;
+    virtual void StartArray() = 0;
+    virtual void EndArray() = 0;
+    virtual void Key(const char* key) = 0;
+    virtual void Write(const Value& value) = 0;
+};
+
 class AssetWriter
 {
     template<class T>
@@ -73,17 +110,30 @@ private:
 
     void WriteBinaryData(IOStream* outfile, size_t sceneLength);
 
+    //! Streams the JSON document, one object at a time
+    void WriteDocument(JsonOutput& out);
+
     void WriteMetadata();
     void WriteExtensionsUsed();
 
+    //! Serializes a value built with mAl and releases the memory again
+    void Emit(const Value& value);
+
     template<class T>
     void WriteObjects(LazyDict<T>& d);
 
+    JsonOutput* mOutput;      //!< Set while a document is written
+    bool mWritingExtensions;  //!< Whether the dictionaries of extensions are written
+    bool mExtensionsOpen;     //!< Whether the "extensions" object has been started
+
 public:
-    Document mDoc;
     Asset& mAsset;
 
-    MemoryPoolAllocator<>& mAl;
+    //! Allocator for the value of the object being written, cleared after each object
+    MemoryPoolAllocator<> mAl;
+
+    //! Whether the body buffer is written to a GLB chunk instead of an own file
+    bool mBinary;
 
     AssetWriter(Asset& asset);
 
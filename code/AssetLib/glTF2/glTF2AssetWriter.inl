@@ -113,6 +113,9 @@ namespace glTF2 {
             obj.AddMember("byteOffset", (unsigned int)a.byteOffset, w.mAl);
         }
         obj.AddMember("componentType", int(a.componentType), w.mAl);
+        if (a.normalized) {
+            obj.AddMember("normalized", true, w.mAl);
+        }
         obj.AddMember("count", (unsigned int)a.count, w.mAl);
         obj.AddMember("type", StringRef(AttribType::ToString(a.type)), w.mAl);
         Value vTmpMax, vTmpMin;
@@ -221,6 +224,19 @@ namespace glTF2 {
     {
         obj.AddMember("byteLength", static_cast<uint64_t>(b.byteLength), w.mAl);
 
+        if (b.meshoptFallback) {
+            // no data, the views of the buffer are decoded from other buffers
+            Value meshopt;
+            meshopt.SetObject();
+            meshopt.AddMember("fallback", true, w.mAl);
+
+            Value exts;
+            exts.SetObject();
+            exts.AddMember("EXT_meshopt_compression", meshopt, w.mAl);
+            obj.AddMember("extensions", exts, w.mAl);
+            return;
+        }
+
         const auto uri = b.GetURI();
         const auto relativeUri = uri.substr(uri.find_last_of("/\\") + 1u);
         obj.AddMember("uri", Value(relativeUri, w.mAl).Move(), w.mAl);
@@ -237,6 +253,46 @@ namespace glTF2 {
         if (bv.target != BufferViewTarget_NONE) {
             obj.AddMember("target", int(bv.target), w.mAl);
         }
+
+        if (bv.meshoptCompression) {
+            const BufferView::MeshoptCompression &mc = *bv.meshoptCompression;
+            Value meshopt;
+            meshopt.SetObject();
+            meshopt.AddMember("buffer", mc.buffer.GetIndex(), w.mAl);
+            meshopt.AddMember("byteOffset", static_cast<uint64_t>(mc.byteOffset), w.mAl);
+            meshopt.AddMember("byteLength", static_cast<uint64_t>(mc.byteLength), w.mAl);
+            meshopt.AddMember("byteStride", static_cast<uint64_t>(mc.byteStride), w.mAl);
+            meshopt.AddMember("count", static_cast<uint64_t>(mc.count), w.mAl);
+            switch (mc.mode) {
+                case BufferView::MeshoptCompression::Mode_ATTRIBUTES:
+                    meshopt.AddMember("mode", "ATTRIBUTES", w.mAl);
+                    break;
+                case BufferView::MeshoptCompression::Mode_TRIANGLES:
+                    meshopt.AddMember("mode", "TRIANGLES", w.mAl);
+                    break;
+                case BufferView::MeshoptCompression::Mode_INDICES:
+                    meshopt.AddMember("mode", "INDICES", w.mAl);
+                    break;
+            }
+            switch (mc.filter) {
+                case glTFCommon::Meshopt::Filter::None:
+                    break;
+                case glTFCommon::Meshopt::Filter::Octahedral:
+                    meshopt.AddMember("filter", "OCTAHEDRAL", w.mAl);
+                    break;
+                case glTFCommon::Meshopt::Filter::Quaternion:
+                    meshopt.AddMember("filter", "QUATERNION", w.mAl);
+                    break;
+                case glTFCommon::Meshopt::Filter::Exponential:
+                    meshopt.AddMember("filter", "EXPONENTIAL", w.mAl);
+                    break;
+            }
+
+            Value exts;
+            exts.SetObject();
+            exts.AddMember("EXT_meshopt_compression", meshopt, w.mAl);
+            obj.AddMember("extensions", exts, w.mAl);
+        }
     }
 
     inline void Write(Value& /*obj*/, Camera& /*c*/, AssetWriter& /*w*/)
@@ -602,15 +658,33 @@ namespace glTF2 {
             prim.SetObject();
 
             // Extensions
-            if (p.ngonEncoded)
+            if (p.ngonEncoded || p.draco)
             {
                 Value exts;
                 exts.SetObject();
 
-                Value FB_ngon_encoding;
-                FB_ngon_encoding.SetObject();
+                if (p.ngonEncoded) {
+                    Value FB_ngon_encoding;
+                    FB_ngon_encoding.SetObject();
+
+                    exts.AddMember(StringRef("FB_ngon_encoding"), FB_ngon_encoding, w.mAl);
+                }
+
+                if (p.draco) {
+                    Value dracoAttrs;
+                    dracoAttrs.SetObject();
+                    for (const auto &attr : p.draco->attributes) {
+                        dracoAttrs.AddMember(Value(attr.first, w.mAl).Move(), attr.second, w.mAl);
+                    }
+
+                    Value KHR_draco_mesh_compression;
+                    KHR_draco_mesh_compression.SetObject();
+                    KHR_draco_mesh_compression.AddMember("bufferView", p.draco->bufferView->index, w.mAl);
+                    KHR_draco_mesh_compression.AddMember("attributes", dracoAttrs, w.mAl);
+
+                    exts.AddMember(StringRef("KHR_draco_mesh_compression"), KHR_draco_mesh_compression, w.mAl);
+                }
 
-                exts.AddMember(StringRef("FB_ngon_encoding"), FB_ngon_encoding, w.mAl);
                 prim.AddMember("extensions", exts, w.mAl);
             }
 
@@ -824,29 +898,130 @@ namespace glTF2 {
         }
     }
 
+    inline IOStreamOutput::IOStreamOutput(IOStream* stream)
+        : mStream(stream)
+        , mBuffer(64 * 1024)
+        , mUsed(0)
+        , mWritten(0)
+    {
+    }
+
+    inline void IOStreamOutput::Put(Ch c)
+    {
+        if (mUsed == mBuffer.size()) {
+            Flush();
+        }
+        mBuffer[mUsed++] = c;
+    }
+
+    inline void IOStreamOutput::Flush()
+    {
+        if (mUsed == 0) {
+            return;
+        }
+        if (mStream->Write(mBuffer.data(), 1, mUsed) != mUsed) {
+            throw DeadlyExportError("Failed to write scene data!");
+        }
+        mWritten += mUsed;
+        mUsed = 0;
+    }
+
+    namespace {
+
+        template<class WriterT>
+        class JsonWriterOutput : public JsonOutput {
+        public:
+            explicit JsonWriterOutput(IOStreamOutput& stream)
+                : mWriter(stream)
+            {
+            }
+
+            void StartObject() override { mWriter.StartObject(); }
+            void EndObject() override { mWriter.EndObject(); }
+            void StartArray() override { mWriter.StartArray(); }
+            void EndArray() override { mWriter.EndArray(); }
+            void Key(const char* key) override { mWriter.Key(key); }
+
+            void Write(const Value& value) override {
+                if (!value.Accept(mWriter)) {
+                    throw DeadlyExportError("Failed to write scene data!");
+                }
+            }
+
+            bool IsComplete() const { return mWriter.IsComplete(); }
+
+        private:
+            WriterT mWriter;
+        };
+
+        // Only the body buffer is special, it is listed with its length in GLB files
+        inline bool WriteSpecial(Value& /*obj*/, Object& /*o*/, AssetWriter& /*w*/)
+        {
+            return false;
+        }
+
+        inline bool WriteSpecial(Value& obj, Buffer& b, AssetWriter& w)
+        {
+            if (!w.mBinary || b.byteLength == 0) {
+                return false;
+            }
+            obj.AddMember("byteLength", static_cast<uint64_t>(b.byteLength), w.mAl);
+            return true;
+        }
+
+    }
+
     inline AssetWriter::AssetWriter(Asset& a)
-        : mDoc()
+        : mOutput(nullptr)
+        , mWritingExtensions(false)
+        , mExtensionsOpen(false)
         , mAsset(a)
-        , mAl(mDoc.GetAllocator())
+        , mAl()
+        , mBinary(false)
+    {
+    }
+
+    inline void AssetWriter::Emit(const Value& value)
+    {
+        mOutput->Write(value);
+        mAl.Clear();
+    }
+
+    inline void AssetWriter::WriteDocument(JsonOutput& out)
     {
-        mDoc.SetObject();
+        mOutput = &out;
+        out.StartObject();
 
         WriteMetadata();
         WriteExtensionsUsed();
 
-        // Dump the contents of the dictionaries
-        for (size_t i = 0; i < a.mDicts.size(); ++i) {
-            a.mDicts[i]->WriteObjects(*this);
+        // Dump the contents of the dictionaries, the ones of extensions are
+        // collected in the "extensions" object after the core ones
+        for (int pass = 0; pass < 2; ++pass) {
+            mWritingExtensions = pass == 1;
+            for (size_t i = 0; i < mAsset.mDicts.size(); ++i) {
+                mAsset.mDicts[i]->WriteObjects(*this);
+            }
+        }
+        if (mExtensionsOpen) {
+            out.EndObject();
+            mExtensionsOpen = false;
         }
+        mWritingExtensions = false;
 
         // Add the target scene field
         if (mAsset.scene) {
-            mDoc.AddMember("scene", mAsset.scene->index, mAl);
+            out.Key("scene");
+            Emit(Value(mAsset.scene->index));
         }
 
-        if(mAsset.extras) {
-            mDoc.AddMember("extras", *mAsset.extras, mAl);
+        if (mAsset.extras) {
+            out.Key("extras");
+            Emit(*mAsset.extras);
         }
+
+        out.EndObject();
+        mOutput = nullptr;
     }
 
     inline void AssetWriter::WriteFile(const char* path)
@@ -857,20 +1032,21 @@ namespace glTF2 {
             throw DeadlyExportError("Could not open output file: " + std::string(path));
         }
 
-        StringBuffer docBuffer;
-
-        PrettyWriter<StringBuffer> writer(docBuffer);
-        if (!mDoc.Accept(writer)) {
-            throw DeadlyExportError("Failed to write scene data!");
-        }
-
-        if (jsonOutFile->Write(docBuffer.GetString(), docBuffer.GetSize(), 1) != 1) {
+        mBinary = false;
+        IOStreamOutput docStream(jsonOutFile.get());
+        JsonWriterOutput<PrettyWriter<IOStreamOutput>> writer(docStream);
+        WriteDocument(writer);
+        if (!writer.IsComplete()) {
             throw DeadlyExportError("Failed to write scene data!");
         }
+        docStream.Flush();
 
         // Write buffer data to separate .bin files
         for (unsigned int i = 0; i < mAsset.buffers.Size(); ++i) {
             Ref<Buffer> b = mAsset.buffers.Get(i);
+            if (b->meshoptFallback) {
+                continue;
+            }
 
             std::string binPath = b->GetURI();
 
@@ -897,41 +1073,27 @@ namespace glTF2 {
         }
 
         Ref<Buffer> bodyBuffer = mAsset.GetBodyBuffer();
-        if (bodyBuffer->byteLength > 0) {
-            rapidjson::Value glbBodyBuffer;
-            glbBodyBuffer.SetObject();
-            glbBodyBuffer.AddMember("byteLength", static_cast<uint64_t>(bodyBuffer->byteLength), mAl);
-            mDoc["buffers"].PushBack(glbBodyBuffer, mAl);
-        }
 
         // Padding with spaces as required by the spec
         uint32_t padding = 0x20202020;
 
         //
-        // JSON chunk
+        // JSON chunk, streamed behind its header which is written once the length is known
         //
 
-        StringBuffer docBuffer;
-        Writer<StringBuffer> writer(docBuffer);
-        if (!mDoc.Accept(writer)) {
+        mBinary = true;
+        outfile->Seek(sizeof(GLB_Header) + sizeof(GLB_Chunk), aiOrigin_SET);
+        IOStreamOutput docStream(outfile.get());
+        JsonWriterOutput<Writer<IOStreamOutput>> writer(docStream);
+        WriteDocument(writer);
+        if (!writer.IsComplete()) {
             throw DeadlyExportError("Failed to write scene data!");
         }
+        docStream.Flush();
 
-        uint32_t jsonChunkLength = static_cast<uint32_t>((docBuffer.GetSize() + 3) & ~3); // Round up to next multiple of 4
-        auto paddingLength = jsonChunkLength - docBuffer.GetSize();
-
-        GLB_Chunk jsonChunk;
-        jsonChunk.chunkLength = jsonChunkLength;
-        jsonChunk.chunkType = ChunkType_JSON;
-        AI_SWAP4(jsonChunk.chunkLength);
-
-        outfile->Seek(sizeof(GLB_Header), aiOrigin_SET);
-        if (outfile->Write(&jsonChunk, 1, sizeof(GLB_Chunk)) != sizeof(GLB_Chunk)) {
-            throw DeadlyExportError("Failed to write scene data header!");
-        }
-        if (outfile->Write(docBuffer.GetString(), 1, docBuffer.GetSize()) != docBuffer.GetSize()) {
-            throw DeadlyExportError("Failed to write scene data!");
-        }
+        const size_t docLength = docStream.Tell();
+        uint32_t jsonChunkLength = static_cast<uint32_t>((docLength + 3) & ~3); // Round up to next multiple of 4
+        auto paddingLength = jsonChunkLength - docLength;
         if (paddingLength && outfile->Write(&padding, 1, paddingLength) != paddingLength) {
             throw DeadlyExportError("Failed to write scene data padding!");
         }
@@ -953,7 +1115,7 @@ namespace glTF2 {
             binaryChunk.chunkType = ChunkType_BIN;
             AI_SWAP4(binaryChunk.chunkLength);
 
-            size_t bodyOffset = sizeof(GLB_Header) + sizeof(GLB_Chunk) + jsonChunk.chunkLength;
+            size_t bodyOffset = sizeof(GLB_Header) + sizeof(GLB_Chunk) + jsonChunkLength;
             outfile->Seek(bodyOffset, aiOrigin_SET);
             if (outfile->Write(&binaryChunk, 1, sizeof(GLB_Chunk)) != sizeof(GLB_Chunk)) {
                 throw DeadlyExportError("Failed to write body data header!");
@@ -966,6 +1128,16 @@ namespace glTF2 {
             }
         }
 
+        GLB_Chunk jsonChunk;
+        jsonChunk.chunkLength = jsonChunkLength;
+        jsonChunk.chunkType = ChunkType_JSON;
+        AI_SWAP4(jsonChunk.chunkLength);
+
+        outfile->Seek(sizeof(GLB_Header), aiOrigin_SET);
+        if (outfile->Write(&jsonChunk, 1, sizeof(GLB_Chunk)) != sizeof(GLB_Chunk)) {
+            throw DeadlyExportError("Failed to write scene data header!");
+        }
+
         //
         // Header
         //
@@ -993,7 +1165,8 @@ namespace glTF2 {
         asset.AddMember("generator", Value(mAsset.asset.generator, mAl).Move(), mAl);
         if (!mAsset.asset.copyright.empty())
             asset.AddMember("copyright", Value(mAsset.asset.copyright, mAl).Move(), mAl);
-        mDoc.AddMember("asset", asset, mAl);
+        mOutput->Key("asset");
+        Emit(asset);
     }
 
     inline void AssetWriter::WriteExtensionsUsed()
@@ -1049,67 +1222,88 @@ namespace glTF2 {
             if (this->mAsset.extensionsUsed.KHR_texture_basisu) {
                 exts.PushBack(StringRef("KHR_texture_basisu"), mAl);
             }
+
+            if (this->mAsset.extensionsUsed.KHR_mesh_quantization) {
+                exts.PushBack(StringRef("KHR_mesh_quantization"), mAl);
+            }
+
+            if (this->mAsset.extensionsUsed.EXT_meshopt_compression) {
+                exts.PushBack(StringRef("EXT_meshopt_compression"), mAl);
+            }
+
+            if (this->mAsset.extensionsUsed.KHR_draco_mesh_compression) {
+                exts.PushBack(StringRef("KHR_draco_mesh_compression"), mAl);
+            }
         }
 
-        if (!exts.Empty())
-            mDoc.AddMember("extensionsUsed", exts, mAl);
+        if (!exts.Empty()) {
+            mOutput->Key("extensionsUsed");
+            Emit(exts);
+        }
 
-        //basisu extensionRequired
         Value extsReq;
         extsReq.SetArray();
         if (this->mAsset.extensionsUsed.KHR_texture_basisu) {
             extsReq.PushBack(StringRef("KHR_texture_basisu"), mAl);
-            mDoc.AddMember("extensionsRequired", extsReq, mAl);
+        }
+        if (this->mAsset.extensionsRequired.KHR_mesh_quantization) {
+            extsReq.PushBack(StringRef("KHR_mesh_quantization"), mAl);
+        }
+        if (this->mAsset.extensionsRequired.EXT_meshopt_compression) {
+            extsReq.PushBack(StringRef("EXT_meshopt_compression"), mAl);
+        }
+        if (this->mAsset.extensionsRequired.KHR_draco_mesh_compression) {
+            extsReq.PushBack(StringRef("KHR_draco_mesh_compression"), mAl);
+        }
+
+        if (!extsReq.Empty()) {
+            mOutput->Key("extensionsRequired");
+            Emit(extsReq);
         }
     }
 
     template<class T>
     void AssetWriter::WriteObjects(LazyDict<T>& d)
     {
-        if (d.mObjs.empty()) return;
-
-        Value* container = &mDoc;
-        const char* context = "Document";
+        if (d.mObjs.empty() || (d.mExtId != nullptr) != mWritingExtensions) return;
 
         if (d.mExtId) {
-            Value* exts = FindObject(mDoc, "extensions");
-            if (nullptr != exts) {
-                mDoc.AddMember("extensions", Value().SetObject().Move(), mDoc.GetAllocator());
-                exts = FindObject(mDoc, "extensions");
-            }
-
-            container = FindObjectInContext(*exts, d.mExtId, "extensions");
-            if (nullptr != container) {
-                exts->AddMember(StringRef(d.mExtId), Value().SetObject().Move(), mDoc.GetAllocator());
-                container = FindObjectInContext(*exts, d.mExtId, "extensions");
-                context = d.mExtId;
+            if (!mExtensionsOpen) {
+                mOutput->Key("extensions");
+                mOutput->StartObject();
+                mExtensionsOpen = true;
             }
+            mOutput->Key(d.mExtId);
+            mOutput->StartObject();
         }
 
-        Value *dict = FindArrayInContext(*container, d.mDictId, context);
-        if (nullptr == dict) {
-            container->AddMember(StringRef(d.mDictId), Value().SetArray().Move(), mDoc.GetAllocator());
-            dict = FindArrayInContext(*container, d.mDictId, context);
-            if (nullptr == dict) {
-                return;
-            }
-        }
+        mOutput->Key(d.mDictId);
+        mOutput->StartArray();
 
         for (size_t i = 0; i < d.mObjs.size(); ++i) {
+            Value obj;
+            obj.SetObject();
+
             if (d.mObjs[i]->IsSpecial()) {
+                if (WriteSpecial(obj, *d.mObjs[i], *this)) {
+                    Emit(obj);
+                }
                 continue;
             }
 
-            Value obj;
-            obj.SetObject();
-
             if (!d.mObjs[i]->name.empty()) {
                 obj.AddMember("name", StringRef(d.mObjs[i]->name.c_str()), mAl);
             }
 
             Write(obj, *d.mObjs[i], *this);
 
-            dict->PushBack(obj, mAl);
+            Emit(obj);
+        }
+
+        mOutput->EndArray();
+
+        if (d.mExtId) {
+            mOutput->EndObject();
         }
     }
 
@@ -43,9 +43,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AssetLib/glTF2/glTF2Exporter.h"
 #include "AssetLib/glTF2/glTF2AssetWriter.h"
+#include "AssetLib/glTFCommon/glTFMeshopt.h"
+#include "Common/ThreadPool.h"
 #include "PostProcessing/SplitLargeMeshes.h"
 
 #include <assimp/ByteSwapper.h>
+#include <assimp/DefaultLogger.hpp>
 #include <assimp/Exceptional.h>
 #include <assimp/SceneCombiner.h>
 #include <assimp/StringComparison.h>
@@ -63,6 +66,39 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <limits>
 #include <memory>
 #include <iostream>
+#include <type_traits>
+
+// clang-format off
+#ifdef ASSIMP_ENABLE_DRACO
+
+// Google draco library headers spew many warnings. Bad Google, no cookie
+#   if _MSC_VER
+#       pragma warning(push)
+#       pragma warning(disable : 4018) // Signed/unsigned mismatch
+#       pragma warning(disable : 4804) // Unsafe use of type 'bool'
+#   elif defined(__clang__)
+#       pragma clang diagnostic push
+#       pragma clang diagnostic ignored "-Wsign-compare"
+#   elif defined(__GNUC__)
+#       pragma GCC diagnostic push
+#       if (__GNUC__ > 4)
+#           pragma GCC diagnostic ignored "-Wbool-compare"
+#       endif
+#   pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+
+#include "draco/compression/encode.h"
+#include "draco/mesh/mesh.h"
+
+#if _MSC_VER
+#   pragma warning(pop)
+#elif defined(__clang__)
+#   pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#   pragma GCC diagnostic pop
+#endif
+#endif
+// clang-format on
 
 #include <rapidjson/rapidjson.h>
 #include <rapidjson/document.h>
@@ -93,7 +129,8 @@ void ExportSceneGLB2(const char *pFile, IOSystem *pIOSystem, const aiScene *pSce
 
 glTF2Exporter::glTF2Exporter(const char *filename, IOSystem *pIOSystem, const aiScene *pScene,
         const ExportProperties *pProperties, bool isBinary) :
-        mFilename(filename), mIOSystem(pIOSystem), mScene(pScene), mProperties(pProperties), mAsset(new Asset(pIOSystem)) {
+        mFilename(filename), mIOSystem(pIOSystem), mScene(pScene), mProperties(pProperties), mAsset(new Asset(pIOSystem)),
+        mQuantizePositions(false), mPositionScale(1) {
     // Always on as our triangulation process is aware of this type of encoding
     mAsset->extensionsUsed.FB_ngon_encoding = true;
 
@@ -101,6 +138,16 @@ glTF2Exporter::glTF2Exporter(const char *filename, IOSystem *pIOSystem, const ai
             AI_CONFIG_CHECK_IDENTITY_MATRIX_EPSILON,
                     (ai_real)AI_CONFIG_CHECK_IDENTITY_MATRIX_EPSILON_DEFAULT);
 
+    mQuantize = mProperties->GetPropertyBool(AI_CONFIG_EXPORT_GLTF_QUANTIZE_MESHES, false);
+    mMeshoptCompression = mProperties->GetPropertyBool(AI_CONFIG_EXPORT_GLTF_MESHOPT_COMPRESSION, false);
+    mDracoCompression = mProperties->GetPropertyBool(AI_CONFIG_EXPORT_GLTF_DRACO_COMPRESSION, false);
+#ifndef ASSIMP_ENABLE_DRACO
+    if (mDracoCompression) {
+        ASSIMP_LOG_WARN("glTF2: assimp was built without Draco, ignoring " AI_CONFIG_EXPORT_GLTF_DRACO_COMPRESSION);
+        mDracoCompression = false;
+    }
+#endif
+
     if (isBinary) {
         mAsset->SetAsBinary();
     }
@@ -115,11 +162,14 @@ glTF2Exporter::glTF2Exporter(const char *filename, IOSystem *pIOSystem, const ai
 
     ExportMeshes();
     MergeMeshes();
+    AddDequantizationNodes();
 
     ExportScene();
 
     ExportAnimations();
 
+    CompressMeshes();
+
     // export extras
     if (mProperties->HasPropertyCallback("extras")) {
         std::function<void *(void *)> ExportExtras = mProperties->GetPropertyCallback("extras");
@@ -396,8 +446,11 @@ inline Ref<Accessor> ExportDataSparse(Asset &a, std::string &meshName, Ref<Buffe
     }
     return acc;
 }
+// Without a buffer only the accessor is created, its data is then stored by an extension (e.g. Draco).
+// A byteStride pads the elements, numCompsIn must then cover the padding.
 inline Ref<Accessor> ExportData(Asset &a, std::string &meshName, Ref<Buffer> &buffer,
-        size_t count, void *data, AttribType::Value typeIn, AttribType::Value typeOut, ComponentType compType, BufferViewTarget target = BufferViewTarget_NONE) {
+        size_t count, void *data, AttribType::Value typeIn, AttribType::Value typeOut, ComponentType compType, BufferViewTarget target = BufferViewTarget_NONE,
+        bool normalized = false, unsigned int byteStride = 0) {
     if (!count || !data) {
         return Ref<Accessor>();
     }
@@ -406,11 +459,30 @@ inline Ref<Accessor> ExportData(Asset &a, std::string &meshName, Ref<Buffer> &bu
     unsigned int numCompsOut = AttribType::GetNumComponents(typeOut);
     unsigned int bytesPerComp = ComponentTypeSize(compType);
 
+    // accessor
+    Ref<Accessor> acc = a.accessors.Create(a.FindUniqueID(meshName, "accessor"));
+    acc->byteOffset = 0;
+    acc->componentType = compType;
+    acc->count = count;
+    acc->type = typeOut;
+    acc->normalized = normalized;
+
+    // calculate min and max values
+    SetAccessorRange(compType, acc, data, count, numCompsIn, numCompsOut);
+
+    if (!buffer) {
+        return acc;
+    }
+
     size_t offset = buffer->byteLength;
     // make sure offset is correctly byte-aligned, as required by spec
     size_t padding = offset % bytesPerComp;
+    if (byteStride != 0 || target == BufferViewTarget_ARRAY_BUFFER) {
+        // vertex attributes start on a 4 byte boundary
+        padding = (4 - offset % 4) % 4;
+    }
     offset += padding;
-    size_t length = count * numCompsOut * bytesPerComp;
+    size_t length = count * (byteStride != 0 ? byteStride : numCompsOut * bytesPerComp);
     buffer->Grow(length + padding);
 
     // bufferView
@@ -418,19 +490,9 @@ inline Ref<Accessor> ExportData(Asset &a, std::string &meshName, Ref<Buffer> &bu
     bv->buffer = buffer;
     bv->byteOffset = offset;
     bv->byteLength = length; //! The target that the WebGL buffer should be bound to.
-    bv->byteStride = 0;
+    bv->byteStride = byteStride;
     bv->target = target;
-
-    // accessor
-    Ref<Accessor> acc = a.accessors.Create(a.FindUniqueID(meshName, "accessor"));
     acc->bufferView = bv;
-    acc->byteOffset = 0;
-    acc->componentType = compType;
-    acc->count = count;
-    acc->type = typeOut;
-
-    // calculate min and max values
-    SetAccessorRange(compType, acc, data, count, numCompsIn, numCompsOut);
 
     // copy the data
     acc->WriteData(count, data, numCompsIn * bytesPerComp);
@@ -438,6 +500,39 @@ inline Ref<Accessor> ExportData(Asset &a, std::string &meshName, Ref<Buffer> &bu
     return acc;
 }
 
+// Whether all numComps components of the count elements are within [0, 1]
+inline bool IsInUnitRange(const ai_real *values, size_t count, unsigned int numComps, unsigned int stride) {
+    for (size_t i = 0; i < count; ++i, values += stride) {
+        for (unsigned int c = 0; c < numComps; ++c) {
+            if (!(values[c] >= 0 && values[c] <= 1)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Quantizes values in [-1, 1] (resp. [0, 1] for unsigned T) to normalized integers, see KHR_mesh_quantization
+template <typename T>
+inline T QuantizeNormalized(ai_real v) {
+    const ai_real max = static_cast<ai_real>(std::numeric_limits<T>::max());
+    const ai_real min = std::is_signed<T>::value ? -1 : 0;
+    v = std::max(min, std::min(ai_real(1), v)) * max;
+    return static_cast<T>(v >= 0 ? v + ai_real(0.5) : v - ai_real(0.5));
+}
+
+// Copies numCompsIn components per element into numCompsOut normalized integers, padding with zeros
+template <typename T>
+std::vector<T> QuantizeNormalized(const ai_real *values, size_t count, unsigned int numCompsIn, unsigned int numCompsOut) {
+    std::vector<T> result(count * numCompsOut, T(0));
+    for (size_t i = 0; i < count; ++i) {
+        for (unsigned int c = 0; c < numCompsIn && c < numCompsOut; ++c) {
+            result[i * numCompsOut + c] = QuantizeNormalized<T>(values[i * numCompsIn + c]);
+        }
+    }
+    return result;
+}
+
 inline void ExportNodeExtras(const aiMetadataEntry &metadataEntry, aiString name, CustomExtension &value) {
 
     value.name = name.C_Str();
@@ -1165,6 +1260,113 @@ void ExportSkin(Asset &mAsset, const aiMesh *aimesh, Ref<Mesh> &meshRef, Ref<Buf
     delete[] vertexJointData;
 }
 
+// A mesh staged for KHR_draco_mesh_compression, with copies of its float data
+struct glTF2Exporter::DracoPrimitive {
+    struct Attribute {
+        std::string semantic;
+        unsigned int numComponents;
+        std::vector<float> values;
+        Ref<Accessor> accessor;
+    };
+
+    std::shared_ptr<Mesh::Primitive::DracoCompression> compression;
+    std::vector<Attribute> attributes;
+    std::vector<uint32_t> indices;
+    Ref<Accessor> indicesAccessor;
+
+    // results of EncodeDracoPrimitive
+    std::vector<uint8_t> encoded;
+    size_t numEncodedPoints = 0;
+    size_t numEncodedFaces = 0;
+};
+
+// KHR_draco_mesh_compression covers triangles; skins and morph targets are left to uncompressed accessors
+inline bool IsDracoCompatible(const aiMesh *aim) {
+    return aim->mPrimitiveTypes == aiPrimitiveType_TRIANGLE && !aim->HasBones() && aim->mNumAnimMeshes == 0;
+}
+
+void glTF2Exporter::StageDracoAttribute(DracoPrimitive *primitive, const std::string &semantic, Ref<Accessor> &accessor,
+        const ai_real *values, unsigned int numCompsIn, unsigned int numCompsOut) {
+    if (nullptr == primitive || !accessor) {
+        return;
+    }
+
+    DracoPrimitive::Attribute attribute;
+    attribute.semantic = semantic;
+    attribute.numComponents = numCompsOut;
+    attribute.accessor = accessor;
+    attribute.values.resize(accessor->count * numCompsOut);
+    for (size_t i = 0; i < accessor->count; ++i) {
+        for (unsigned int c = 0; c < numCompsOut; ++c) {
+            attribute.values[i * numCompsOut + c] = static_cast<float>(values[i * numCompsIn + c]);
+        }
+    }
+    primitive->attributes.push_back(std::move(attribute));
+}
+
+void glTF2Exporter::EncodeDracoPrimitive(DracoPrimitive &primitive) {
+#ifdef ASSIMP_ENABLE_DRACO
+    if (primitive.attributes.empty()) {
+        throw DeadlyExportError("GLTF: Draco compressed mesh without attributes");
+    }
+
+    draco::Mesh mesh;
+    const size_t numPoints = primitive.attributes[0].accessor->count;
+    mesh.set_num_points(static_cast<draco::PointIndex::ValueType>(numPoints));
+    for (size_t i = 0; i + 2 < primitive.indices.size(); i += 3) {
+        draco::Mesh::Face face;
+        for (size_t j = 0; j < 3; ++j) {
+            face[j] = draco::PointIndex(primitive.indices[i + j]);
+        }
+        mesh.AddFace(face);
+    }
+
+    for (const DracoPrimitive::Attribute &attribute : primitive.attributes) {
+        draco::GeometryAttribute::Type type = draco::GeometryAttribute::GENERIC;
+        if (attribute.semantic == "POSITION") {
+            type = draco::GeometryAttribute::POSITION;
+        } else if (attribute.semantic == "NORMAL") {
+            type = draco::GeometryAttribute::NORMAL;
+        } else if (attribute.semantic.compare(0, 9, "TEXCOORD_") == 0) {
+            type = draco::GeometryAttribute::TEX_COORD;
+        } else if (attribute.semantic.compare(0, 6, "COLOR_") == 0) {
+            type = draco::GeometryAttribute::COLOR;
+        }
+
+        draco::GeometryAttribute geometryAttribute;
+        geometryAttribute.Init(type, nullptr, static_cast<uint8_t>(attribute.numComponents), draco::DT_FLOAT32, false,
+                sizeof(float) * attribute.numComponents, 0);
+        const int id = mesh.AddAttribute(geometryAttribute, true, static_cast<draco::AttributeValueIndex::ValueType>(numPoints));
+        draco::PointAttribute *pointAttribute = mesh.attribute(id);
+        for (size_t i = 0; i < numPoints; ++i) {
+            pointAttribute->SetAttributeValue(draco::AttributeValueIndex(static_cast<uint32_t>(i)), &attribute.values[i * attribute.numComponents]);
+        }
+        primitive.compression->attributes.emplace_back(attribute.semantic, pointAttribute->unique_id());
+    }
+
+    // the quantization gltfpack and the Draco tools use by default
+    draco::Encoder encoder;
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 14);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 10);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 12);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::COLOR, 8);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::GENERIC, 12);
+    // the accessor counts need the number of points after deduplication
+    encoder.SetTrackEncodedProperties(true);
+
+    draco::EncoderBuffer buffer;
+    const draco::Status status = encoder.EncodeMeshToBuffer(mesh, &buffer);
+    if (!status.ok()) {
+        throw DeadlyExportError("GLTF: Draco compression failed: " + status.error_msg_string());
+    }
+    primitive.encoded.assign(buffer.data(), buffer.data() + buffer.size());
+    primitive.numEncodedPoints = encoder.num_encoded_points();
+    primitive.numEncodedFaces = encoder.num_encoded_faces();
+#else
+    (void)primitive;
+#endif
+}
+
 void glTF2Exporter::ExportMeshes() {
     typedef decltype(aiFace::mNumIndices) IndicesType;
 
@@ -1197,6 +1399,38 @@ void glTF2Exporter::ExportMeshes() {
     }
     //----------------------------------------
 
+    //----------------------------------------
+    // KHR_mesh_quantization: all positions share one grid, so that a single transform maps them back.
+    // Draco quantizes on its own and decodes to floats, a shared transform would not fit those meshes.
+    mQuantizePositions = false;
+    if (mQuantize && !mDracoCompression) {
+        aiVector3D min(std::numeric_limits<ai_real>::max());
+        aiVector3D max(-std::numeric_limits<ai_real>::max());
+        for (unsigned int idx_mesh = 0; idx_mesh < mScene->mNumMeshes; ++idx_mesh) {
+            const aiMesh *aim = mScene->mMeshes[idx_mesh];
+            if (aim->mNumFaces == 0) {
+                continue;
+            }
+            for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
+                min = aiVector3D(std::min(min.x, aim->mVertices[i].x), std::min(min.y, aim->mVertices[i].y), std::min(min.z, aim->mVertices[i].z));
+                max = aiVector3D(std::max(max.x, aim->mVertices[i].x), std::max(max.y, aim->mVertices[i].y), std::max(max.z, aim->mVertices[i].z));
+            }
+        }
+        const aiVector3D extent = max - min;
+        if (std::isfinite(extent.x) && std::isfinite(extent.y) && std::isfinite(extent.z) && extent.x >= 0) {
+            const ai_real halfExtent = std::max(extent.x, std::max(extent.y, extent.z)) / 2;
+            mPositionCenter = (min + max) * ai_real(0.5);
+            mPositionScale = halfExtent > 0 ? halfExtent / 32767 : ai_real(1);
+            mQuantizePositions = true;
+
+            aiMatrix4x4 scaling, translation;
+            aiMatrix4x4::Scaling(aiVector3D(mPositionScale), scaling);
+            aiMatrix4x4::Translation(mPositionCenter, translation);
+            mDequantization = translation * scaling;
+        }
+    }
+    //----------------------------------------
+
     for (unsigned int idx_mesh = 0; idx_mesh < mScene->mNumMeshes; ++idx_mesh) {
         const aiMesh *aim = mScene->mMeshes[idx_mesh];
         if (aim->mNumFaces == 0) {
@@ -1215,9 +1449,35 @@ void glTF2Exporter::ExportMeshes() {
         p.material = mAsset->materials.Get(aim->mMaterialIndex);
         p.ngonEncoded = (aim->mPrimitiveTypes & aiPrimitiveType_NGONEncodingFlag) != 0;
 
+        // Draco meshes only get accessors here, their data is compressed at the end of the export
+        std::unique_ptr<DracoPrimitive> draco;
+        Ref<Buffer> noBuffer;
+        Ref<Buffer> &vb = mDracoCompression && IsDracoCompatible(aim) ? noBuffer : b;
+        if (!vb) {
+            draco.reset(new DracoPrimitive);
+            draco->compression = std::make_shared<Mesh::Primitive::DracoCompression>();
+            p.draco = draco->compression;
+        }
+        const bool quantize = mQuantize && !draco;
+
         /******************* Vertices ********************/
-        Ref<Accessor> v = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mVertices, AttribType::VEC3,
-                AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+        Ref<Accessor> v;
+        if (mQuantizePositions) {
+            std::vector<int16_t> positions(aim->mNumVertices * 4, int16_t(0));
+            for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
+                const aiVector3D q = (aim->mVertices[i] - mPositionCenter) / mPositionScale;
+                for (unsigned int c = 0; c < 3; ++c) {
+                    positions[i * 4 + c] = static_cast<int16_t>(std::lround(std::max(ai_real(-32767), std::min(ai_real(32767), q[c]))));
+                }
+            }
+            v = ExportData(*mAsset, meshId, b, aim->mNumVertices, positions.data(), AttribType::VEC4,
+                    AttribType::VEC3, ComponentType_SHORT, BufferViewTarget_ARRAY_BUFFER, false, 8);
+            mAsset->extensionsUsed.KHR_mesh_quantization = true;
+        } else {
+            v = ExportData(*mAsset, meshId, vb, aim->mNumVertices, aim->mVertices, AttribType::VEC3,
+                    AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+            StageDracoAttribute(draco.get(), "POSITION", v, &aim->mVertices[0].x, 3, 3);
+        }
         if (v) {
             p.attributes.position.push_back(v);
         }
@@ -1230,8 +1490,19 @@ void glTF2Exporter::ExportMeshes() {
             }
         }
 
-        Ref<Accessor> n = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mNormals, AttribType::VEC3,
-                AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+        Ref<Accessor> n;
+        if (quantize && nullptr != aim->mNormals) {
+            std::vector<int8_t> normals = QuantizeNormalized<int8_t>(&aim->mNormals[0].x, aim->mNumVertices, 3, 4);
+            n = ExportData(*mAsset, meshId, b, aim->mNumVertices, normals.data(), AttribType::VEC4,
+                    AttribType::VEC3, ComponentType_BYTE, BufferViewTarget_ARRAY_BUFFER, true, 4);
+            mAsset->extensionsUsed.KHR_mesh_quantization = true;
+        } else {
+            n = ExportData(*mAsset, meshId, vb, aim->mNumVertices, aim->mNormals, AttribType::VEC3,
+                    AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+            if (n) {
+                StageDracoAttribute(draco.get(), "NORMAL", n, &aim->mNormals[0].x, 3, 3);
+            }
+        }
         if (n) {
             p.attributes.normal.push_back(n);
         }
@@ -1253,10 +1524,19 @@ void glTF2Exporter::ExportMeshes() {
                 tangentsWithHandedness[i * 4 + 3] = handedness;
             }
 
-            Ref<Accessor> t = ExportData(
-                *mAsset, meshId, b, aim->mNumVertices, &tangentsWithHandedness[0], AttribType::VEC4,
-                AttribType::VEC4, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER
-            );
+            Ref<Accessor> t;
+            if (quantize) {
+                std::vector<int8_t> tangents = QuantizeNormalized<int8_t>(tangentsWithHandedness.data(), aim->mNumVertices, 4, 4);
+                t = ExportData(*mAsset, meshId, b, aim->mNumVertices, tangents.data(), AttribType::VEC4,
+                        AttribType::VEC4, ComponentType_BYTE, BufferViewTarget_ARRAY_BUFFER, true);
+                mAsset->extensionsUsed.KHR_mesh_quantization = true;
+            } else {
+                t = ExportData(
+                    *mAsset, meshId, vb, aim->mNumVertices, &tangentsWithHandedness[0], AttribType::VEC4,
+                    AttribType::VEC4, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER
+                );
+                StageDracoAttribute(draco.get(), "TANGENT", t, tangentsWithHandedness.data(), 4, 4);
+            }
             if (t) {
                 p.attributes.tangent.push_back(t);
             }
@@ -1278,8 +1558,17 @@ void glTF2Exporter::ExportMeshes() {
             if (aim->mNumUVComponents[i] > 0) {
                 AttribType::Value type = (aim->mNumUVComponents[i] == 2) ? AttribType::VEC2 : AttribType::VEC3;
 
-                Ref<Accessor> tc = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mTextureCoords[i],
-                        AttribType::VEC3, type, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+                Ref<Accessor> tc;
+                if (quantize && type == AttribType::VEC2 && IsInUnitRange(&aim->mTextureCoords[i][0].x, aim->mNumVertices, 2, 3)) {
+                    std::vector<uint16_t> uvs = QuantizeNormalized<uint16_t>(&aim->mTextureCoords[i][0].x, aim->mNumVertices, 3, 2);
+                    tc = ExportData(*mAsset, meshId, b, aim->mNumVertices, uvs.data(), AttribType::VEC2,
+                            AttribType::VEC2, ComponentType_UNSIGNED_SHORT, BufferViewTarget_ARRAY_BUFFER, true);
+                } else {
+                    tc = ExportData(*mAsset, meshId, vb, aim->mNumVertices, aim->mTextureCoords[i],
+                            AttribType::VEC3, type, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+                    StageDracoAttribute(draco.get(), "TEXCOORD_" + ai_to_string(p.attributes.texcoord.size()), tc,
+                            &aim->mTextureCoords[i][0].x, 3, AttribType::GetNumComponents(type));
+                }
                 if (tc) {
                     p.attributes.texcoord.push_back(tc);
                 }
@@ -1288,8 +1577,17 @@ void glTF2Exporter::ExportMeshes() {
 
         /*************** Vertex colors ****************/
         for (unsigned int indexColorChannel = 0; indexColorChannel < aim->GetNumColorChannels(); ++indexColorChannel) {
-            Ref<Accessor> c = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mColors[indexColorChannel],
-                    AttribType::VEC4, AttribType::VEC4, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+            const ai_real *colors = &aim->mColors[indexColorChannel][0].r;
+            Ref<Accessor> c;
+            if (quantize && IsInUnitRange(colors, aim->mNumVertices, 4, 4)) {
+                std::vector<uint16_t> quantized = QuantizeNormalized<uint16_t>(colors, aim->mNumVertices, 4, 4);
+                c = ExportData(*mAsset, meshId, b, aim->mNumVertices, quantized.data(), AttribType::VEC4,
+                        AttribType::VEC4, ComponentType_UNSIGNED_SHORT, BufferViewTarget_ARRAY_BUFFER, true);
+            } else {
+                c = ExportData(*mAsset, meshId, vb, aim->mNumVertices, aim->mColors[indexColorChannel],
+                        AttribType::VEC4, AttribType::VEC4, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+                StageDracoAttribute(draco.get(), "COLOR_" + ai_to_string(indexColorChannel), c, colors, 4, 4);
+            }
             if (c) {
                 p.attributes.color.push_back(c);
             }
@@ -1306,8 +1604,20 @@ void glTF2Exporter::ExportMeshes() {
                 }
             }
 
-            p.indices = ExportData(*mAsset, meshId, b, indices.size(), &indices[0], AttribType::SCALAR, AttribType::SCALAR,
-                    ComponentType_UNSIGNED_INT, BufferViewTarget_ELEMENT_ARRAY_BUFFER);
+            if ((quantize || mMeshoptCompression) && !draco && aim->mNumVertices <= std::numeric_limits<uint16_t>::max()) {
+                // 16 bit indices, as long as they fit
+                std::vector<uint16_t> shortIndices(indices.begin(), indices.end());
+                p.indices = ExportData(*mAsset, meshId, b, shortIndices.size(), &shortIndices[0], AttribType::SCALAR, AttribType::SCALAR,
+                        ComponentType_UNSIGNED_SHORT, BufferViewTarget_ELEMENT_ARRAY_BUFFER);
+            } else {
+                p.indices = ExportData(*mAsset, meshId, vb, indices.size(), &indices[0], AttribType::SCALAR, AttribType::SCALAR,
+                        ComponentType_UNSIGNED_INT, BufferViewTarget_ELEMENT_ARRAY_BUFFER);
+            }
+            if (draco) {
+                draco->indices.assign(indices.begin(), indices.end());
+                draco->indicesAccessor = p.indices;
+                mDracoPrimitives.push_back(std::move(draco));
+            }
         }
 
         switch (aim->mPrimitiveTypes) {
@@ -1361,6 +1671,10 @@ void glTF2Exporter::ExportMeshes() {
                     aiVector3D *pPositionDiff = new aiVector3D[pAnimMesh->mNumVertices];
                     for (unsigned int vt = 0; vt < pAnimMesh->mNumVertices; ++vt) {
                         pPositionDiff[vt] = pAnimMesh->mVertices[vt] - aim->mVertices[vt];
+                        if (mQuantizePositions) {
+                            // the displacement is added before the positions are dequantized
+                            pPositionDiff[vt] /= mPositionScale;
+                        }
                     }
                     Ref<Accessor> vec;
                     if (bUseSparse) {
@@ -1405,6 +1719,9 @@ void glTF2Exporter::ExportMeshes() {
         }
     }
 
+    // integer positions, normals and tangents need the extension to be understood
+    mAsset->extensionsRequired.KHR_mesh_quantization = mAsset->extensionsUsed.KHR_mesh_quantization;
+
     //----------------------------------------
     // Finish the skin
     // Create the Accessor for skinRef->inverseBindMatrices
@@ -1412,6 +1729,10 @@ void glTF2Exporter::ExportMeshes() {
     if (createSkin) {
         mat4 *invBindMatrixData = new mat4[inverseBindMatricesData.size()];
         for (unsigned int idx_joint = 0; idx_joint < inverseBindMatricesData.size(); ++idx_joint) {
+            // skinned meshes ignore the node transform, so the bind matrices dequantize the positions
+            if (mQuantizePositions) {
+                inverseBindMatricesData[idx_joint] *= mDequantization;
+            }
             CopyValue(inverseBindMatricesData[idx_joint], invBindMatrixData[idx_joint]);
         }
 
@@ -1502,6 +1823,209 @@ void glTF2Exporter::MergeMeshes() {
     }
 }
 
+// Moves the meshes of each node using quantized positions to a child node, which dequantizes them.
+// Skinned meshes are handled by their inverse bind matrices instead.
+void glTF2Exporter::AddDequantizationNodes() {
+    if (!mQuantizePositions) {
+        return;
+    }
+
+    const unsigned int numNodes = mAsset->nodes.Size();
+    for (unsigned int n = 0; n < numNodes; ++n) {
+        Ref<Node> node = mAsset->nodes.Get(n);
+        if (node->meshes.empty() || node->skin) {
+            continue;
+        }
+
+        Ref<Node> child = mAsset->nodes.Create(mAsset->FindUniqueID(node->name, "dequantize"));
+        child->name = child->id;
+        child->parent = node;
+        child->matrix.isPresent = true;
+        CopyValue(mDequantization, child->matrix.value);
+        child->meshes.swap(node->meshes);
+        node->children.push_back(child);
+    }
+}
+
+// Compresses the staged Draco meshes and, with EXT_meshopt_compression, the vertex and index data of
+// all meshes. The codecs run concurrently, the buffer is then rebuilt with the compressed data.
+void glTF2Exporter::CompressMeshes() {
+    if (mDracoPrimitives.empty() && !mMeshoptCompression) {
+        return;
+    }
+
+    Ref<Buffer> b = mAsset->buffers.Get(unsigned(0));
+
+    struct MeshoptView {
+        Ref<BufferView> view;
+        size_t byteStride;
+        BufferView::MeshoptCompression::Mode mode;
+        std::vector<uint8_t> encoded;
+    };
+    std::vector<MeshoptView> meshoptViews;
+    std::vector<int> meshoptViewIndex(mAsset->bufferViews.Size(), -1);
+
+    auto addMeshoptView = [&](Ref<Accessor> accessor, bool isIndices, PrimitiveMode mode) {
+        if (!accessor || !accessor->bufferView || accessor->sparse || accessor->byteOffset != 0) {
+            return;
+        }
+        Ref<BufferView> view = accessor->bufferView;
+        if (view->buffer.GetIndex() != b.GetIndex() || meshoptViewIndex[view.GetIndex()] >= 0) {
+            return;
+        }
+
+        MeshoptView entry;
+        entry.view = view;
+        entry.byteStride = view->byteStride ? view->byteStride : accessor->GetElementSize();
+        if (view->byteLength != accessor->count * entry.byteStride) {
+            return;
+        }
+        if (isIndices) {
+            entry.mode = mode == PrimitiveMode_TRIANGLES && accessor->count % 3 == 0 ?
+                    BufferView::MeshoptCompression::Mode_TRIANGLES :
+                    BufferView::MeshoptCompression::Mode_INDICES;
+        } else {
+            if (entry.byteStride % 4 != 0 || entry.byteStride > 256) {
+                return;
+            }
+            entry.mode = BufferView::MeshoptCompression::Mode_ATTRIBUTES;
+        }
+        meshoptViewIndex[view.GetIndex()] = static_cast<int>(meshoptViews.size());
+        meshoptViews.push_back(std::move(entry));
+    };
+
+    if (mMeshoptCompression) {
+        for (unsigned int i = 0; i < mAsset->meshes.Size(); ++i) {
+            Ref<Mesh> mesh = mAsset->meshes.Get(i);
+            for (Mesh::Primitive &p : mesh->primitives) {
+                for (Mesh::AccessorList *list : { &p.attributes.position, &p.attributes.normal, &p.attributes.tangent,
+                             &p.attributes.texcoord, &p.attributes.color, &p.attributes.joint, &p.attributes.weight }) {
+                    for (Ref<Accessor> &accessor : *list) {
+                        addMeshoptView(accessor, false, p.mode);
+                    }
+                }
+                for (Mesh::Primitive::Target &target : p.targets) {
+                    for (Mesh::AccessorList *list : { &target.position, &target.normal, &target.tangent }) {
+                        for (Ref<Accessor> &accessor : *list) {
+                            addMeshoptView(accessor, false, p.mode);
+                        }
+                    }
+                }
+                addMeshoptView(p.indices, true, p.mode);
+            }
+        }
+    }
+
+    // the calling thread counts as one of the requested threads
+    int numThreads = mProperties->GetPropertyInteger(AI_CONFIG_EXPORT_NUM_THREADS, 1);
+    if (numThreads <= 0) {
+        numThreads = static_cast<int>(ThreadPool::GetHardwareConcurrency());
+    }
+    std::unique_ptr<ThreadPool> threadPool(numThreads > 1 ? new ThreadPool(numThreads - 1) : nullptr);
+
+    const size_t numDraco = mDracoPrimitives.size();
+    auto compress = [&](size_t i) {
+        if (i < numDraco) {
+            EncodeDracoPrimitive(*mDracoPrimitives[i]);
+            return;
+        }
+
+        MeshoptView &entry = meshoptViews[i - numDraco];
+        const uint8_t *data = b->GetPointer() + entry.view->byteOffset;
+        const size_t count = entry.view->byteLength / entry.byteStride;
+        switch (entry.mode) {
+        case BufferView::MeshoptCompression::Mode_ATTRIBUTES:
+            glTFCommon::Meshopt::EncodeVertexBuffer(entry.encoded, data, count, entry.byteStride);
+            break;
+        case BufferView::MeshoptCompression::Mode_TRIANGLES:
+            glTFCommon::Meshopt::EncodeIndexBuffer(entry.encoded, data, count, entry.byteStride);
+            break;
+        case BufferView::MeshoptCompression::Mode_INDICES:
+            glTFCommon::Meshopt::EncodeIndexSequence(entry.encoded, data, count, entry.byteStride);
+            break;
+        }
+    };
+    const size_t numJobs = numDraco + meshoptViews.size();
+    if (threadPool) {
+        threadPool->ParallelFor(numJobs, compress);
+    } else {
+        for (size_t i = 0; i < numJobs; ++i) {
+            compress(i);
+        }
+    }
+
+    // the Draco meshes are appended as views of their own
+    for (const std::unique_ptr<DracoPrimitive> &primitive : mDracoPrimitives) {
+        Ref<BufferView> view = mAsset->bufferViews.Create(mAsset->FindUniqueID("draco", "view"));
+        view->buffer = b;
+        view->byteLength = primitive->encoded.size();
+        view->byteOffset = b->AppendData(primitive->encoded.data(), primitive->encoded.size());
+        view->byteStride = 0;
+        view->target = BufferViewTarget_NONE;
+        primitive->compression->bufferView = view;
+
+        for (DracoPrimitive::Attribute &attribute : primitive->attributes) {
+            attribute.accessor->count = primitive->numEncodedPoints;
+        }
+        if (primitive->indicesAccessor) {
+            primitive->indicesAccessor->count = primitive->numEncodedFaces * 3;
+        }
+    }
+    if (!mDracoPrimitives.empty()) {
+        mAsset->extensionsUsed.KHR_draco_mesh_compression = true;
+        mAsset->extensionsRequired.KHR_draco_mesh_compression = true;
+    }
+
+    if (meshoptViews.empty()) {
+        return;
+    }
+
+    // Rebuild the buffer from the uncompressed views and the compressed data, the compressed views
+    // move to a fallback buffer which only reserves their size.
+    Ref<Buffer> fallback = mAsset->buffers.Create(mAsset->FindUniqueID(b->id, "fallback"));
+    fallback->meshoptFallback = true;
+    fallback->byteLength = 0;
+
+    std::vector<uint8_t> packed;
+    packed.reserve(b->byteLength);
+    for (unsigned int i = 0; i < mAsset->bufferViews.Size(); ++i) {
+        Ref<BufferView> view = mAsset->bufferViews.Get(i);
+        if (view->buffer.GetIndex() != b.GetIndex()) {
+            continue;
+        }
+
+        packed.resize((packed.size() + 3) & ~size_t(3), 0);
+        const int entryIndex = i < meshoptViewIndex.size() ? meshoptViewIndex[i] : -1;
+        if (entryIndex < 0) {
+            const uint8_t *data = b->GetPointer() + view->byteOffset;
+            view->byteOffset = packed.size();
+            packed.insert(packed.end(), data, data + view->byteLength);
+            continue;
+        }
+
+        MeshoptView &entry = meshoptViews[entryIndex];
+        std::unique_ptr<BufferView::MeshoptCompression> compression(new BufferView::MeshoptCompression);
+        compression->buffer = b;
+        compression->byteOffset = packed.size();
+        compression->byteLength = entry.encoded.size();
+        compression->byteStride = entry.byteStride;
+        compression->count = view->byteLength / entry.byteStride;
+        compression->mode = entry.mode;
+        compression->filter = glTFCommon::Meshopt::Filter::None;
+        packed.insert(packed.end(), entry.encoded.begin(), entry.encoded.end());
+
+        fallback->byteLength = (fallback->byteLength + 3) & ~size_t(3);
+        view->buffer = fallback;
+        view->byteOffset = fallback->byteLength;
+        fallback->byteLength += view->byteLength;
+        view->meshoptCompression = std::move(compression);
+    }
+    b->SetData(packed.data(), packed.size());
+
+    mAsset->extensionsUsed.EXT_meshopt_compression = true;
+    mAsset->extensionsRequired.EXT_meshopt_compression = true;
+}
+
 /*
  * Export the root node of the node hierarchy.
  * Calls ExportNode for all children.
@@ -67,6 +67,7 @@ class Ref;
 namespace glTF2 {
 
 class Asset;
+struct Accessor;
 
 struct TexProperty;
 struct TextureInfo;
@@ -133,8 +134,17 @@ protected:
     unsigned int ExportNode(const aiNode *node, glTFCommon::Ref<glTF2::Node> &parent);
     void ExportScene();
     void ExportAnimations();
+    void AddDequantizationNodes();
+    void CompressMeshes();
 
 private:
+    struct DracoPrimitive;
+
+    static void StageDracoAttribute(DracoPrimitive *primitive, const std::string &semantic, glTFCommon::Ref<glTF2::Accessor> &accessor,
+            const ai_real *values, unsigned int numCompsIn, unsigned int numCompsOut);
+    static void EncodeDracoPrimitive(DracoPrimitive &primitive);
+
+
     const char *mFilename;
     IOSystem *mIOSystem;
     const aiScene *mScene;
@@ -143,6 +153,14 @@ private:
     std::shared_ptr<glTF2::Asset> mAsset;
     std::vector<unsigned char> mBodyData;
     ai_real configEpsilon;
+    bool mQuantize; //!< Store vertex attributes as integers, see AI_CONFIG_EXPORT_GLTF_QUANTIZE_MESHES
+    bool mMeshoptCompression; //!< See AI_CONFIG_EXPORT_GLTF_MESHOPT_COMPRESSION
+    bool mDracoCompression; //!< See AI_CONFIG_EXPORT_GLTF_DRACO_COMPRESSION
+    bool mQuantizePositions; //!< Positions are stored on the grid below
+    aiVector3D mPositionCenter;
+    ai_real mPositionScale;
+    aiMatrix4x4 mDequantization; //!< Maps quantized positions back to their original space
+    std::vector<std::unique_ptr<DracoPrimitive>> mDracoPrimitives; //!< Meshes to compress with Draco
 };
 
 } // namespace Assimp
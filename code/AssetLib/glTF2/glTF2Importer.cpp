@@ -59,6 +59,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
+#include <assimp/Profiler.h>
 
 #include <memory>
 #include <unordered_map>
@@ -457,19 +458,32 @@ static inline bool CheckValidFacesIndices(aiFace *faces, unsigned nFaces, unsign
 }
 #endif // ASSIMP_BUILD_DEBUG
 
+// Allocates the destination array and decodes the accessor straight into it
 template <typename T>
-aiColor4D *GetVertexColorsForType(Ref<Accessor> input, std::vector<unsigned int> *vertexRemappingTable) {
-    constexpr float max = std::numeric_limits<T>::max();
-    aiColor4t<T> *colors;
-    size_t count = input->ExtractData(colors, vertexRemappingTable);
-    auto output = new aiColor4D[count];
-    for (size_t i = 0; i < count; i++) {
-        output[i] = aiColor4D(
-                colors[i].r / max, colors[i].g / max,
-                colors[i].b / max, colors[i].a / max);
+T *DecodeAttribute(Accessor &input, std::vector<unsigned int> *vertexRemappingTable, bool forceNormalized = false) {
+    const size_t count = (vertexRemappingTable != nullptr) ? vertexRemappingTable->size() : input.count;
+    std::unique_ptr<T[]> output(new T[count]);
+    input.DecodeData(output.get(), vertexRemappingTable, forceNormalized);
+    return output.release();
+}
+
+// Calls fn for every accessor whose data is only needed while importing the primitive itself
+template <typename Fn>
+static void ForEachPrimitiveAccessor(Mesh::Primitive &prim, Fn fn) {
+    Mesh::Primitive::Attributes &attr = prim.attributes;
+    for (Mesh::AccessorList *list : { &attr.position, &attr.normal, &attr.tangent, &attr.texcoord, &attr.color }) {
+        for (Ref<Accessor> &accessor : *list) {
+            fn(accessor);
+        }
+    }
+    fn(prim.indices);
+    for (Mesh::Primitive::Target &target : prim.targets) {
+        for (Mesh::AccessorList *list : { &target.position, &target.normal, &target.tangent }) {
+            for (Ref<Accessor> &accessor : *list) {
+                fn(accessor);
+            }
+        }
     }
-    delete[] colors;
-    return output;
 }
 
 void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
@@ -493,6 +507,28 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
     meshes.reserve(num_aiMeshes);
     mVertexRemappingTables.resize(num_aiMeshes);
 
+    // With streamed buffers, count the primitives reading each buffer view so its bytes can be
+    // dropped after the last one. Skin attributes are read later by ImportNodes, keep their views.
+    std::unordered_map<BufferView *, unsigned int> pendingViewReads;
+    if (mStreamBuffers) {
+        for (unsigned int m = 0; m < r.meshes.Size(); ++m) {
+            for (Mesh::Primitive &prim : r.meshes[m].primitives) {
+                ForEachPrimitiveAccessor(prim, [&](Ref<Accessor> &accessor) {
+                    if (accessor && accessor->bufferView) {
+                        ++pendingViewReads[&*accessor->bufferView];
+                    }
+                });
+                for (Mesh::AccessorList *list : { &prim.attributes.joint, &prim.attributes.weight }) {
+                    for (Ref<Accessor> &accessor : *list) {
+                        if (accessor && accessor->bufferView) {
+                            pendingViewReads[&*accessor->bufferView] = std::numeric_limits<unsigned int>::max();
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     for (unsigned int m = 0; m < r.meshes.Size(); ++m) {
         Mesh &mesh = r.meshes[m];
 
@@ -517,19 +553,18 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                 reverseMappingIndices.clear();
                 vertexRemappingTable = &mVertexRemappingTables[meshes.size()];
                 vertexRemappingTable->reserve(count / 3); // this is a very rough heuristic to reduce re-allocations
-                Accessor::Indexer data = prim.indices->GetIndexer();
-                if (!data.IsValid()) {
+                if (prim.indices->GetPointer() == nullptr) {
                     throw DeadlyImportError("GLTF: Invalid accessor without data in mesh ", getContextForErrorMessages(mesh.id, mesh.name));
                 }
+                prim.indices->DecodeIndices(indexBuffer.data());
 
                 // Build the vertex remapping table and the modified index buffer (used later instead of the original one)
                 // In case no index buffer is used, the original vertex arrays are being used so no remapping is required in the first place.
                 const unsigned int unusedIndex = ~0u;
                 for (unsigned int i = 0; i < count; ++i) {
-                    unsigned int index = data.GetUInt(i);
+                    const unsigned int index = indexBuffer[i];
                     if (index >= numAllVertices) {
                         // Out-of-range indices will be filtered out when adding the faces and then lead to a warning. At this stage, we just keep them.
-                        indexBuffer[i] = index;
                         continue;
                     }
                     if (index >= reverseMappingIndices.size()) {
@@ -573,14 +608,15 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
             }
 
             if (!attr.position.empty() && attr.position[0]) {
-                aim->mNumVertices = static_cast<unsigned int>(attr.position[0]->ExtractData(aim->mVertices, vertexRemappingTable));
+                aim->mVertices = DecodeAttribute<aiVector3D>(*attr.position[0], vertexRemappingTable);
+                aim->mNumVertices = static_cast<unsigned int>(vertexRemappingTable ? vertexRemappingTable->size() : numAllVertices);
             }
 
             if (!attr.normal.empty() && attr.normal[0]) {
                     if (attr.normal[0]->count != numAllVertices) {
                     DefaultLogger::get()->warn("Normal count in mesh \"", mesh.name, "\" does not match the vertex count, normals ignored.");
                 } else {
-                    attr.normal[0]->ExtractData(aim->mNormals, vertexRemappingTable);
+                    aim->mNormals = DecodeAttribute<aiVector3D>(*attr.normal[0], vertexRemappingTable);
 
                     // only extract tangents if normals are present
                     if (!attr.tangent.empty() && attr.tangent[0]) {
@@ -588,9 +624,7 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                             DefaultLogger::get()->warn("Tangent count in mesh \"", mesh.name, "\" does not match the vertex count, tangents ignored.");
                         } else {
                             // generate bitangents from normals and tangents according to spec
-                            Tangent *tangents = nullptr;
-
-                            attr.tangent[0]->ExtractData(tangents, vertexRemappingTable);
+                            Tangent *tangents = DecodeAttribute<Tangent>(*attr.tangent[0], vertexRemappingTable);
 
                             aim->mTangents = new aiVector3D[aim->mNumVertices];
                             aim->mBitangents = new aiVector3D[aim->mNumVertices];
@@ -614,14 +648,11 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                 }
 
                 auto componentType = attr.color[c]->componentType;
-                if (componentType == glTF2::ComponentType_FLOAT) {
-                    attr.color[c]->ExtractData(aim->mColors[c], vertexRemappingTable);
-                } else {
-                    if (componentType == glTF2::ComponentType_UNSIGNED_BYTE) {
-                        aim->mColors[c] = GetVertexColorsForType<unsigned char>(attr.color[c], vertexRemappingTable);
-                    } else if (componentType == glTF2::ComponentType_UNSIGNED_SHORT) {
-                        aim->mColors[c] = GetVertexColorsForType<unsigned short>(attr.color[c], vertexRemappingTable);
-                    }
+                if (componentType == glTF2::ComponentType_FLOAT ||
+                        componentType == glTF2::ComponentType_UNSIGNED_BYTE ||
+                        componentType == glTF2::ComponentType_UNSIGNED_SHORT) {
+                    // Integer colors are always normalized, even if the accessor does not say so
+                    aim->mColors[c] = DecodeAttribute<aiColor4D>(*attr.color[c], vertexRemappingTable, true);
                 }
             }
             for (size_t tc = 0; tc < attr.texcoord.size() && tc < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++tc) {
@@ -636,7 +667,7 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                     continue;
                 }
 
-                attr.texcoord[tc]->ExtractData(aim->mTextureCoords[tc], vertexRemappingTable);
+                aim->mTextureCoords[tc] = DecodeAttribute<aiVector3D>(*attr.texcoord[tc], vertexRemappingTable);
                 aim->mNumUVComponents[tc] = attr.texcoord[tc]->GetNumComponents();
 
                 aiVector3D *values = aim->mTextureCoords[tc];
@@ -664,8 +695,7 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                         if (target.position[0]->count != numAllVertices) {
                             ASSIMP_LOG_WARN("Positions of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
                         } else {
-                            aiVector3D *positionDiff = nullptr;
-                            target.position[0]->ExtractData(positionDiff, vertexRemappingTable);
+                            aiVector3D *positionDiff = DecodeAttribute<aiVector3D>(*target.position[0], vertexRemappingTable);
                             for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
                                 aiAnimMesh.mVertices[vertexId] += positionDiff[vertexId];
                             }
@@ -676,8 +706,7 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                         if (target.normal[0]->count != numAllVertices) {
                             ASSIMP_LOG_WARN("Normals of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
                         } else {
-                            aiVector3D *normalDiff = nullptr;
-                            target.normal[0]->ExtractData(normalDiff, vertexRemappingTable);
+                            aiVector3D *normalDiff = DecodeAttribute<aiVector3D>(*target.normal[0], vertexRemappingTable);
                             for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
                                 aiAnimMesh.mNormals[vertexId] += normalDiff[vertexId];
                             }
@@ -691,11 +720,8 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                         } else if (target.tangent[0]->count != numAllVertices) {
                             ASSIMP_LOG_WARN("Tangents of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
                         } else {
-                            Tangent *tangent = nullptr;
-                            attr.tangent[0]->ExtractData(tangent, vertexRemappingTable);
-
-                            aiVector3D *tangentDiff = nullptr;
-                            target.tangent[0]->ExtractData(tangentDiff, vertexRemappingTable);
+                            Tangent *tangent = DecodeAttribute<Tangent>(*attr.tangent[0], vertexRemappingTable);
+                            aiVector3D *tangentDiff = DecodeAttribute<aiVector3D>(*target.tangent[0], vertexRemappingTable);
 
                             for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; ++vertexId) {
                                 tangent[vertexId].xyz += tangentDiff[vertexId];
@@ -896,6 +922,18 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
             } else {
                 aim->mMaterialIndex = mScene->mNumMaterials - 1;
             }
+
+            if (mStreamBuffers) {
+                ForEachPrimitiveAccessor(prim, [&](Ref<Accessor> &accessor) {
+                    if (!accessor || !accessor->bufferView) {
+                        return;
+                    }
+                    unsigned int &pending = pendingViewReads[&*accessor->bufferView];
+                    if (pending != std::numeric_limits<unsigned int>::max() && --pending == 0) {
+                        accessor->bufferView->ReleaseData();
+                    }
+                });
+            }
         }
     }
 
@@ -1044,11 +1082,13 @@ static void BuildVertexWeightMapping(Mesh::Primitive &primitive, std::vector<std
     size_t num_vertices = 0;
 
     struct Weights {
-        float values[4];
+        ai_real values[4];
     };
     Weights **weights = new Weights*[attr.weight.size()];
     for (size_t w = 0; w < attr.weight.size(); ++w) {
-        num_vertices = attr.weight[w]->ExtractData(weights[w], vertexRemappingTablePtr);
+        // Quantized weights are always normalized
+        weights[w] = DecodeAttribute<Weights>(*attr.weight[w], vertexRemappingTablePtr, true);
+        num_vertices = vertexRemappingTablePtr ? vertexRemappingTablePtr->size() : attr.weight[w]->count;
     }
 
     struct Indices8 {
@@ -1082,7 +1122,7 @@ static void BuildVertexWeightMapping(Mesh::Primitive &primitive, std::vector<std
         for (size_t i = 0; i < num_vertices; ++i) {
             for (int j = 0; j < 4; ++j) {
                 const unsigned int bone = (indices8 != nullptr) ? indices8[w][i].values[j] : indices16[w][i].values[j];
-                const float weight = weights[w][i].values[j];
+                const ai_real weight = weights[w][i].values[j];
                 if (weight > 0 && bone < map.size()) {
                     map[bone].reserve(8);
                     map[bone].emplace_back(static_cast<unsigned int>(i), weight);
@@ -1794,6 +1834,11 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
 
     // read the asset file
     glTF2::Asset asset(pIOHandler, static_cast<rapidjson::IRemoteSchemaDocumentProvider *>(mSchemaDocumentProvider));
+    asset.SetStreamBuffers(mStreamBuffers);
+    asset.SetThreadPool(m_threadPool);
+    if (m_profiler) {
+        m_profiler->BeginRegion("read");
+    }
     asset.Load(pFile,
                CheckMagicToken(
                    pIOHandler, pFile, AI_GLB_MAGIC_NUMBER, 1, 0,
@@ -1801,8 +1846,12 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     if (asset.scene) {
         pScene->mName = asset.scene->name;
     }
+    if (m_profiler) {
+        m_profiler->EndRegion("read");
+    }
 
     // Copy the data out
+    Profiling::ScopedRegion convertRegion(m_profiler, "convert");
     ImportEmbeddedTextures(asset);
     ImportMaterials(asset);
 
@@ -1824,6 +1873,7 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
 
 void glTF2Importer::SetupProperties(const Importer *pImp) {
     mSchemaDocumentProvider = static_cast<rapidjson::IRemoteSchemaDocumentProvider *>(pImp->GetPropertyPointer(AI_CONFIG_IMPORT_SCHEMA_DOCUMENT_PROVIDER));
+    mStreamBuffers = pImp->GetPropertyBool(AI_CONFIG_IMPORT_GLTF_STREAM_BUFFERS, false);
 }
 
 #endif // ASSIMP_BUILD_NO_GLTF_IMPORTER
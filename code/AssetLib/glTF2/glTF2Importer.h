@@ -86,6 +86,9 @@ private:
 
     /// An instance of rapidjson::IRemoteSchemaDocumentProvider
     void *mSchemaDocumentProvider = nullptr;
+
+    /// Read buffer data on demand, see AI_CONFIG_IMPORT_GLTF_STREAM_BUFFERS
+    bool mStreamBuffers = false;
 };
 
 } // namespace Assimp
@@ -0,0 +1,786 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+#include "AssetLib/glTFCommon/glTFMeshopt.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace glTFCommon {
+namespace Meshopt {
+
+namespace {
+
+// Vertex codec
+constexpr uint8_t kVertexHeader = 0xa0;
+constexpr size_t kVertexBlockSizeBytes = 8192;
+constexpr size_t kVertexBlockMaxSize = 256;
+constexpr size_t kByteGroupSize = 16;
+constexpr size_t kByteGroupDecodeLimit = 24;
+constexpr size_t kTailMaxSize = 32;
+
+// Index codecs
+constexpr uint8_t kIndexHeader = 0xe0;
+constexpr uint8_t kSequenceHeader = 0xd0;
+
+size_t GetVertexBlockSize(size_t stride) {
+    // a block must fit the 8k scratch area and be a whole number of byte groups
+    const size_t result = (kVertexBlockSizeBytes / stride) & ~(kByteGroupSize - 1);
+    return result < kVertexBlockMaxSize ? result : kVertexBlockMaxSize;
+}
+
+inline uint8_t Unzigzag8(uint8_t v) {
+    return static_cast<uint8_t>((v >> 1) ^ -static_cast<int>(v & 1));
+}
+
+// Unpacks 16 values of Bits bits, most significant first. The all-ones value
+// is an escape: the actual byte follows the packed values.
+template <unsigned int Bits>
+const uint8_t *DecodeBitGroup(const uint8_t *data, uint8_t *out) {
+    constexpr unsigned int kPerByte = 8 / Bits;
+    constexpr unsigned int kEscape = (1u << Bits) - 1;
+    const uint8_t *extra = data + kByteGroupSize / kPerByte;
+    for (unsigned int i = 0; i < kByteGroupSize; ++i) {
+        const unsigned int shift = 8 - Bits - (i % kPerByte) * Bits;
+        const unsigned int value = (data[i / kPerByte] >> shift) & kEscape;
+        out[i] = value == kEscape ? *extra++ : static_cast<uint8_t>(value);
+    }
+    return extra;
+}
+
+const uint8_t *DecodeBytes(const uint8_t *data, const uint8_t *dataEnd, uint8_t *out, size_t size) {
+    // two header bits per group of 16 bytes, four groups per header byte
+    const uint8_t *header = data;
+    const size_t numGroups = size / kByteGroupSize;
+    const size_t headerSize = (numGroups + 3) / 4;
+    if (static_cast<size_t>(dataEnd - data) < headerSize) {
+        return nullptr;
+    }
+    data += headerSize;
+
+    for (size_t g = 0; g < numGroups; ++g) {
+        // the tail of the stream guarantees this much data for valid input
+        if (static_cast<size_t>(dataEnd - data) < kByteGroupDecodeLimit) {
+            return nullptr;
+        }
+        uint8_t *group = out + g * kByteGroupSize;
+        switch ((header[g / 4] >> ((g % 4) * 2)) & 3) {
+        case 0:
+            memset(group, 0, kByteGroupSize);
+            break;
+        case 1:
+            data = DecodeBitGroup<2>(data, group);
+            break;
+        case 2:
+            data = DecodeBitGroup<4>(data, group);
+            break;
+        default:
+            memcpy(group, data, kByteGroupSize);
+            data += kByteGroupSize;
+            break;
+        }
+    }
+    return data;
+}
+
+const uint8_t *DecodeVertexBlock(const uint8_t *data, const uint8_t *dataEnd, uint8_t *vertices, size_t count,
+        size_t stride, uint8_t *lastVertex) {
+    uint8_t deltas[kVertexBlockMaxSize];
+    const size_t alignedCount = (count + kByteGroupSize - 1) & ~(kByteGroupSize - 1);
+
+    // each byte of the vertex is stored as its own stream of deltas to the previous vertex
+    for (size_t k = 0; k < stride; ++k) {
+        data = DecodeBytes(data, dataEnd, deltas, alignedCount);
+        if (nullptr == data) {
+            return nullptr;
+        }
+
+        uint8_t p = lastVertex[k];
+        uint8_t *out = vertices + k;
+        for (size_t i = 0; i < count; ++i, out += stride) {
+            p = static_cast<uint8_t>(p + Unzigzag8(deltas[i]));
+            *out = p;
+        }
+    }
+
+    memcpy(lastVertex, vertices + (count - 1) * stride, stride);
+    return data;
+}
+
+inline uint8_t Zigzag8(uint8_t v) {
+    return static_cast<uint8_t>((v << 1) ^ (static_cast<int8_t>(v) >> 7));
+}
+
+// Packs 16 values into Bits bits each, most significant first, and appends
+// the values which do not fit after the packed ones.
+template <unsigned int Bits>
+void EncodeBitGroup(std::vector<uint8_t> &out, const uint8_t *group) {
+    constexpr unsigned int kPerByte = 8 / Bits;
+    constexpr unsigned int kEscape = (1u << Bits) - 1;
+    uint8_t packed[kByteGroupSize / kPerByte] = {};
+    for (unsigned int i = 0; i < kByteGroupSize; ++i) {
+        const unsigned int value = group[i] < kEscape ? group[i] : kEscape;
+        packed[i / kPerByte] |= static_cast<uint8_t>(value << (8 - Bits - (i % kPerByte) * Bits));
+    }
+    out.insert(out.end(), packed, packed + sizeof(packed));
+    for (unsigned int i = 0; i < kByteGroupSize; ++i) {
+        if (group[i] >= kEscape) {
+            out.push_back(group[i]);
+        }
+    }
+}
+
+template <unsigned int Bits>
+size_t GetBitGroupSize(const uint8_t *group) {
+    constexpr unsigned int kEscape = (1u << Bits) - 1;
+    size_t result = kByteGroupSize / (8 / Bits);
+    for (unsigned int i = 0; i < kByteGroupSize; ++i) {
+        result += group[i] >= kEscape ? 1 : 0;
+    }
+    return result;
+}
+
+void EncodeBytes(std::vector<uint8_t> &out, const uint8_t *data, size_t size) {
+    const size_t numGroups = size / kByteGroupSize;
+    const size_t headerOffset = out.size();
+    out.resize(out.size() + (numGroups + 3) / 4, 0);
+
+    for (size_t g = 0; g < numGroups; ++g) {
+        const uint8_t *group = data + g * kByteGroupSize;
+
+        // pick the smallest of the four group encodings
+        int mode = 3;
+        size_t best = kByteGroupSize;
+        bool zero = true;
+        for (size_t i = 0; i < kByteGroupSize; ++i) {
+            zero = zero && group[i] == 0;
+        }
+        if (zero) {
+            mode = 0;
+        } else {
+            const size_t size2 = GetBitGroupSize<2>(group);
+            const size_t size4 = GetBitGroupSize<4>(group);
+            if (size2 <= size4 && size2 < best) {
+                mode = 1;
+            } else if (size4 < best) {
+                mode = 2;
+            }
+        }
+
+        out[headerOffset + g / 4] |= static_cast<uint8_t>(mode << ((g % 4) * 2));
+        switch (mode) {
+        case 0:
+            break;
+        case 1:
+            EncodeBitGroup<2>(out, group);
+            break;
+        case 2:
+            EncodeBitGroup<4>(out, group);
+            break;
+        default:
+            out.insert(out.end(), group, group + kByteGroupSize);
+            break;
+        }
+    }
+}
+
+inline unsigned int DecodeVByte(const uint8_t *&data) {
+    const uint8_t lead = *data++;
+    if (lead < 128) {
+        return lead;
+    }
+
+    // up to four more groups of 7 bits
+    unsigned int result = lead & 127;
+    unsigned int shift = 7;
+    for (int i = 0; i < 4; ++i) {
+        const uint8_t group = *data++;
+        result |= static_cast<unsigned int>(group & 127) << shift;
+        shift += 7;
+        if (group < 128) {
+            break;
+        }
+    }
+    return result;
+}
+
+inline unsigned int DecodeIndex(const uint8_t *&data, unsigned int last) {
+    const unsigned int v = DecodeVByte(data);
+    return last + ((v >> 1) ^ (0u - (v & 1)));
+}
+
+inline void EncodeVByte(std::vector<uint8_t> &out, unsigned int v) {
+    while (v >= 128) {
+        out.push_back(static_cast<uint8_t>((v & 127) | 128));
+        v >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+inline unsigned int Zigzag32(unsigned int v) {
+    return (v << 1) ^ static_cast<unsigned int>(static_cast<int>(v) >> 31);
+}
+
+inline void EncodeIndex(std::vector<uint8_t> &out, unsigned int index, unsigned int &last) {
+    EncodeVByte(out, Zigzag32(index - last));
+    last = index;
+}
+
+inline unsigned int ReadIndex(const uint8_t *source, size_t i, size_t indexSize) {
+    if (indexSize == 2) {
+        uint16_t v;
+        memcpy(&v, source + i * 2, 2);
+        return v;
+    }
+    unsigned int v;
+    memcpy(&v, source + i * 4, 4);
+    return v;
+}
+
+inline void WriteIndex(uint8_t *destination, size_t i, size_t indexSize, unsigned int value) {
+    if (indexSize == 2) {
+        const uint16_t v = static_cast<uint16_t>(value);
+        memcpy(destination + i * 2, &v, 2);
+    } else {
+        memcpy(destination + i * 4, &value, 4);
+    }
+}
+
+// FIFOs of recently seen edges and vertices, as maintained by the encoder
+struct TriangleFifos {
+    unsigned int edges[16][2];
+    unsigned int vertices[16];
+    size_t edgeOffset = 0;
+    size_t vertexOffset = 0;
+
+    TriangleFifos() {
+        memset(edges, -1, sizeof(edges));
+        memset(vertices, -1, sizeof(vertices));
+    }
+
+    void PushEdge(unsigned int a, unsigned int b) {
+        edges[edgeOffset][0] = a;
+        edges[edgeOffset][1] = b;
+        edgeOffset = (edgeOffset + 1) & 15;
+    }
+
+    void PushVertex(unsigned int v, bool cond = true) {
+        vertices[vertexOffset] = v;
+        vertexOffset = (vertexOffset + (cond ? 1 : 0)) & 15;
+    }
+
+    //! \return the age of edge (a, b), or -1 if it is not among the last 15 edges
+    int FindEdge(unsigned int a, unsigned int b) const {
+        for (int i = 0; i < 15; ++i) {
+            const unsigned int *e = edges[(edgeOffset - 1 - i) & 15];
+            if (e[0] == a && e[1] == b) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    //! \return the age of vertex v, or -1 if it is not among the last 16 vertices
+    int FindVertex(unsigned int v) const {
+        for (int i = 0; i < 16; ++i) {
+            if (vertices[(vertexOffset - 1 - i) & 15] == v) {
+                return i;
+            }
+        }
+        return -1;
+    }
+};
+
+template <typename T>
+inline T LoadComponent(const uint8_t *data) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+template <typename T>
+inline void StoreComponent(uint8_t *data, int value) {
+    const T v = static_cast<T>(value);
+    memcpy(data, &v, sizeof(T));
+}
+
+inline int RoundToInt(float v) {
+    return static_cast<int>(v + (v >= 0.f ? 0.5f : -0.5f));
+}
+
+template <typename T>
+void DecodeOctahedral(uint8_t *data, size_t count) {
+    // the third component holds the value of 1.0 at the encoded precision
+    const float max = static_cast<float>((1 << (sizeof(T) * 8 - 1)) - 1);
+    for (size_t i = 0; i < count; ++i, data += 4 * sizeof(T)) {
+        float x = static_cast<float>(LoadComponent<T>(data));
+        float y = static_cast<float>(LoadComponent<T>(data + sizeof(T)));
+        const float z = static_cast<float>(LoadComponent<T>(data + 2 * sizeof(T))) - std::fabs(x) - std::fabs(y);
+
+        // unfold the lower hemisphere
+        const float t = z >= 0.f ? 0.f : z;
+        x += x >= 0.f ? t : -t;
+        y += y >= 0.f ? t : -t;
+
+        const float s = max / std::sqrt(x * x + y * y + z * z);
+        StoreComponent<T>(data, RoundToInt(x * s));
+        StoreComponent<T>(data + sizeof(T), RoundToInt(y * s));
+        StoreComponent<T>(data + 2 * sizeof(T), RoundToInt(z * s));
+    }
+}
+
+void DecodeQuaternion(uint8_t *data, size_t count) {
+    const float scale = 1.f / std::sqrt(2.f);
+    for (size_t i = 0; i < count; ++i, data += 8) {
+        const int16_t last = LoadComponent<int16_t>(data + 6);
+
+        // the high bits of the last component hold the scale of the others
+        const float ss = scale / static_cast<float>(last | 3);
+        const float x = static_cast<float>(LoadComponent<int16_t>(data)) * ss;
+        const float y = static_cast<float>(LoadComponent<int16_t>(data + 2)) * ss;
+        const float z = static_cast<float>(LoadComponent<int16_t>(data + 4)) * ss;
+
+        // the dropped component is the largest one, so it is positive
+        const float ww = 1.f - x * x - y * y - z * z;
+        const float w = std::sqrt(ww >= 0.f ? ww : 0.f);
+
+        // the low bits of the last component name the dropped one
+        const int qc = last & 3;
+        StoreComponent<int16_t>(data + 2 * ((qc + 1) & 3), RoundToInt(x * 32767.f));
+        StoreComponent<int16_t>(data + 2 * ((qc + 2) & 3), RoundToInt(y * 32767.f));
+        StoreComponent<int16_t>(data + 2 * ((qc + 3) & 3), RoundToInt(z * 32767.f));
+        StoreComponent<int16_t>(data + 2 * qc, static_cast<int>(w * 32767.f + 0.5f));
+    }
+}
+
+void DecodeExponential(uint8_t *data, size_t count) {
+    for (size_t i = 0; i < count; ++i, data += 4) {
+        const uint32_t v = LoadComponent<uint32_t>(data);
+
+        // signed 24-bit mantissa, signed 8-bit exponent
+        const int32_t m = static_cast<int32_t>(v << 8) >> 8;
+        const int32_t e = static_cast<int32_t>(v) >> 24;
+
+        // ldexp(m, e), with the power of two built directly
+        const uint32_t bits = static_cast<uint32_t>(e + 127) << 23;
+        float f;
+        memcpy(&f, &bits, 4);
+        f *= static_cast<float>(m);
+        memcpy(data, &f, 4);
+    }
+}
+
+} // namespace
+
+bool DecodeVertexBuffer(uint8_t *destination, size_t count, size_t stride, const uint8_t *buffer, size_t bufferSize) {
+    if (stride == 0 || stride > 256 || stride % 4 != 0) {
+        return false;
+    }
+    if (bufferSize < 1 || (buffer[0] & 0xf0) != kVertexHeader || (buffer[0] & 0x0f) != 0) {
+        return false;
+    }
+
+    const uint8_t *data = buffer + 1;
+    const uint8_t *dataEnd = buffer + bufferSize;
+
+    // the stream ends with the first vertex, padded to at least 32 bytes
+    const size_t tailSize = stride < kTailMaxSize ? kTailMaxSize : stride;
+    if (static_cast<size_t>(dataEnd - data) < tailSize) {
+        return false;
+    }
+    uint8_t lastVertex[256];
+    memcpy(lastVertex, dataEnd - stride, stride);
+
+    const size_t blockSize = GetVertexBlockSize(stride);
+    for (size_t offset = 0; offset < count; offset += blockSize) {
+        const size_t n = offset + blockSize < count ? blockSize : count - offset;
+        data = DecodeVertexBlock(data, dataEnd, destination + offset * stride, n, stride, lastVertex);
+        if (nullptr == data) {
+            return false;
+        }
+    }
+    return static_cast<size_t>(dataEnd - data) == tailSize;
+}
+
+bool DecodeIndexBuffer(uint8_t *destination, size_t count, size_t indexSize, const uint8_t *buffer, size_t bufferSize) {
+    if (count % 3 != 0 || (indexSize != 2 && indexSize != 4)) {
+        return false;
+    }
+
+    // header, one code per triangle and the 16 byte codeaux table
+    if (bufferSize < 1 + count / 3 + 16 || (buffer[0] & 0xf0) != kIndexHeader) {
+        return false;
+    }
+    const int version = buffer[0] & 0x0f;
+    if (version > 1) {
+        return false;
+    }
+
+    TriangleFifos fifo;
+    unsigned int next = 0;
+    unsigned int last = 0;
+    const int fecmax = version >= 1 ? 13 : 15;
+
+    const uint8_t *code = buffer + 1;
+    const uint8_t *data = code + count / 3;
+    const uint8_t *dataSafeEnd = buffer + bufferSize - 16;
+    const uint8_t *codeauxTable = dataSafeEnd;
+
+    for (size_t i = 0; i < count; i += 3) {
+        // a triangle reads at most 16 bytes, which the codeaux table guards
+        if (data > dataSafeEnd) {
+            return false;
+        }
+
+        const uint8_t codetri = *code++;
+        unsigned int a, b, c;
+        if (codetri < 0xf0) {
+            // recent edge plus a new, recent or free vertex
+            const int fe = codetri >> 4;
+            a = fifo.edges[(fifo.edgeOffset - 1 - fe) & 15][0];
+            b = fifo.edges[(fifo.edgeOffset - 1 - fe) & 15][1];
+
+            const int fec = codetri & 15;
+            if (fec < fecmax) {
+                const bool isNext = fec == 0;
+                c = isNext ? next : fifo.vertices[(fifo.vertexOffset - 1 - fec) & 15];
+                next += isNext ? 1 : 0;
+                fifo.PushVertex(c, isNext);
+            } else {
+                // 13 and 14 are a delta of -1 and +1 to the last free index
+                last = c = (fec != 15) ? last + (fec - (fec ^ 3)) : DecodeIndex(data, last);
+                fifo.PushVertex(c);
+            }
+
+            fifo.PushEdge(c, b);
+            fifo.PushEdge(a, c);
+        } else {
+            // three vertices, described by a codeaux byte
+            const bool fromTable = codetri < 0xfe;
+            const uint8_t codeaux = fromTable ? codeauxTable[codetri & 15] : *data++;
+            const int fea = (fromTable || codetri == 0xfe) ? 0 : 15;
+            const int feb = codeaux >> 4;
+            const int fec = codeaux & 15;
+
+            if (!fromTable && codeaux == 0) {
+                next = 0;
+            }
+
+            a = fea == 0 ? next++ : 0;
+            b = feb == 0 ? next++ : fifo.vertices[(fifo.vertexOffset - feb) & 15];
+            c = fec == 0 ? next++ : fifo.vertices[(fifo.vertexOffset - fec) & 15];
+
+            if (fea == 15) {
+                last = a = DecodeIndex(data, last);
+            }
+            if (feb == 15) {
+                last = b = DecodeIndex(data, last);
+            }
+            if (fec == 15) {
+                last = c = DecodeIndex(data, last);
+            }
+
+            fifo.PushVertex(a);
+            fifo.PushVertex(b, feb == 0 || feb == 15);
+            fifo.PushVertex(c, fec == 0 || fec == 15);
+
+            fifo.PushEdge(b, a);
+            fifo.PushEdge(c, b);
+            fifo.PushEdge(a, c);
+        }
+
+        WriteIndex(destination, i + 0, indexSize, a);
+        WriteIndex(destination, i + 1, indexSize, b);
+        WriteIndex(destination, i + 2, indexSize, c);
+    }
+
+    // all data must be consumed, up to the codeaux table
+    return data == dataSafeEnd;
+}
+
+bool DecodeIndexSequence(uint8_t *destination, size_t count, size_t indexSize, const uint8_t *buffer, size_t bufferSize) {
+    if (indexSize != 2 && indexSize != 4) {
+        return false;
+    }
+
+    // header, at least one byte per index and a 4 byte tail
+    if (bufferSize < 1 + count + 4 || (buffer[0] & 0xf0) != kSequenceHeader || (buffer[0] & 0x0f) > 1) {
+        return false;
+    }
+
+    const uint8_t *data = buffer + 1;
+    const uint8_t *dataSafeEnd = buffer + bufferSize - 4;
+
+    // deltas are relative to one of two baselines, chosen by the lowest bit
+    unsigned int last[2] = { 0, 0 };
+    for (size_t i = 0; i < count; ++i) {
+        if (data >= dataSafeEnd) {
+            return false;
+        }
+        unsigned int v = DecodeVByte(data);
+        const unsigned int baseline = v & 1;
+        v >>= 1;
+        const unsigned int index = last[baseline] + ((v >> 1) ^ (0u - (v & 1)));
+        last[baseline] = index;
+        WriteIndex(destination, i, indexSize, index);
+    }
+    return data == dataSafeEnd;
+}
+
+bool EncodeVertexBuffer(std::vector<uint8_t> &out, const uint8_t *vertices, size_t count, size_t stride) {
+    if (stride == 0 || stride > 256 || stride % 4 != 0) {
+        return false;
+    }
+
+    out.clear();
+    out.push_back(kVertexHeader);
+
+    uint8_t firstVertex[256] = {};
+    if (count > 0) {
+        memcpy(firstVertex, vertices, stride);
+    }
+    uint8_t lastVertex[256];
+    memcpy(lastVertex, firstVertex, stride);
+
+    uint8_t deltas[kVertexBlockMaxSize];
+    const size_t blockSize = GetVertexBlockSize(stride);
+    for (size_t offset = 0; offset < count; offset += blockSize) {
+        const size_t n = offset + blockSize < count ? blockSize : count - offset;
+        const size_t alignedCount = (n + kByteGroupSize - 1) & ~(kByteGroupSize - 1);
+
+        for (size_t k = 0; k < stride; ++k) {
+            uint8_t p = lastVertex[k];
+            const uint8_t *in = vertices + offset * stride + k;
+            for (size_t i = 0; i < n; ++i, in += stride) {
+                deltas[i] = Zigzag8(static_cast<uint8_t>(*in - p));
+                p = *in;
+            }
+            memset(deltas + n, 0, alignedCount - n);
+            EncodeBytes(out, deltas, alignedCount);
+        }
+        memcpy(lastVertex, vertices + (offset + n - 1) * stride, stride);
+    }
+
+    // the first vertex seeds the decoder, padded to the minimal tail size
+    const size_t tailSize = stride < kTailMaxSize ? kTailMaxSize : stride;
+    out.resize(out.size() + tailSize - stride, 0);
+    out.insert(out.end(), firstVertex, firstVertex + stride);
+    return true;
+}
+
+bool EncodeIndexBuffer(std::vector<uint8_t> &out, const uint8_t *indices, size_t count, size_t indexSize) {
+    if (count % 3 != 0 || (indexSize != 2 && indexSize != 4)) {
+        return false;
+    }
+
+    TriangleFifos fifo;
+    unsigned int next = 0;
+    unsigned int last = 0;
+    constexpr int fecmax = 13;
+
+    std::vector<uint8_t> codes;
+    codes.reserve(count / 3);
+    std::vector<uint8_t> data;
+
+    for (size_t i = 0; i < count; i += 3) {
+        const unsigned int tri[3] = {
+            ReadIndex(indices, i + 0, indexSize),
+            ReadIndex(indices, i + 1, indexSize),
+            ReadIndex(indices, i + 2, indexSize)
+        };
+
+        // try each rotation of the triangle for a recent edge
+        bool encoded = false;
+        for (int r = 0; r < 3 && !encoded; ++r) {
+            const unsigned int a = tri[r], b = tri[(r + 1) % 3], c = tri[(r + 2) % 3];
+            const int fe = fifo.FindEdge(a, b);
+            if (fe < 0) {
+                continue;
+            }
+
+            const int fc = fifo.FindVertex(c);
+            int fec;
+            if (c == next) {
+                fec = 0;
+                ++next;
+                fifo.PushVertex(c);
+            } else if (fc >= 1 && fc < fecmax) {
+                fec = fc;
+                fifo.PushVertex(c, false);
+            } else {
+                if (c == last - 1) {
+                    fec = 13;
+                    last = c;
+                } else if (c == last + 1) {
+                    fec = 14;
+                    last = c;
+                } else {
+                    fec = 15;
+                    EncodeIndex(data, c, last);
+                }
+                fifo.PushVertex(c);
+            }
+
+            codes.push_back(static_cast<uint8_t>((fe << 4) | fec));
+            fifo.PushEdge(c, b);
+            fifo.PushEdge(a, c);
+            encoded = true;
+        }
+        if (encoded) {
+            continue;
+        }
+
+        // three vertices, each new, recent or free
+        const unsigned int a = tri[0], b = tri[1], c = tri[2];
+        const bool aIsNext = a == next;
+        next += aIsNext ? 1 : 0;
+
+        auto findVertex = [&](unsigned int v) {
+            if (v == next) {
+                ++next;
+                return 0;
+            }
+            const int f = fifo.FindVertex(v);
+            return f >= 0 && f + 1 < 15 ? f + 1 : 15;
+        };
+
+        const unsigned int nextB = next;
+        int feb = findVertex(b);
+        int fec = findVertex(c);
+        if (!aIsNext && feb == 0 && fec == 0) {
+            // a zero codeaux byte resets the decoder, so b is stored explicitly
+            next = nextB;
+            feb = 15;
+            fec = findVertex(c);
+        }
+
+        const uint8_t codeaux = static_cast<uint8_t>((feb << 4) | fec);
+        if (aIsNext && codeaux == 0) {
+            // the first entry of the codeaux table is zero, see below
+            codes.push_back(0xf0);
+        } else {
+            codes.push_back(aIsNext ? 0xfe : 0xff);
+            data.push_back(codeaux);
+        }
+
+        if (!aIsNext) {
+            EncodeIndex(data, a, last);
+        }
+        if (feb == 15) {
+            EncodeIndex(data, b, last);
+        }
+        if (fec == 15) {
+            EncodeIndex(data, c, last);
+        }
+
+        fifo.PushVertex(a);
+        fifo.PushVertex(b, feb == 0 || feb == 15);
+        fifo.PushVertex(c, fec == 0 || fec == 15);
+
+        fifo.PushEdge(b, a);
+        fifo.PushEdge(c, b);
+        fifo.PushEdge(a, c);
+    }
+
+    out.clear();
+    out.push_back(kIndexHeader | 1);
+    out.insert(out.end(), codes.begin(), codes.end());
+    out.insert(out.end(), data.begin(), data.end());
+
+    // the codeaux table, all zero
+    out.resize(out.size() + 16, 0);
+    return true;
+}
+
+bool EncodeIndexSequence(std::vector<uint8_t> &out, const uint8_t *indices, size_t count, size_t indexSize) {
+    if (indexSize != 2 && indexSize != 4) {
+        return false;
+    }
+
+    out.clear();
+    out.push_back(kSequenceHeader | 1);
+
+    // each delta goes against the closer of the two baselines
+    unsigned int last[2] = { 0, 0 };
+    for (size_t i = 0; i < count; ++i) {
+        const unsigned int index = ReadIndex(indices, i, indexSize);
+        const unsigned int d0 = Zigzag32(index - last[0]);
+        const unsigned int d1 = Zigzag32(index - last[1]);
+        const unsigned int baseline = d1 < d0 ? 1 : 0;
+        EncodeVByte(out, ((baseline ? d1 : d0) << 1) | baseline);
+        last[baseline] = index;
+    }
+
+    out.resize(out.size() + 4, 0);
+    return true;
+}
+
+bool ApplyFilter(Filter filter, uint8_t *data, size_t count, size_t stride) {
+    switch (filter) {
+    case Filter::None:
+        return true;
+    case Filter::Octahedral:
+        if (stride == 4) {
+            DecodeOctahedral<int8_t>(data, count);
+            return true;
+        }
+        if (stride == 8) {
+            DecodeOctahedral<int16_t>(data, count);
+            return true;
+        }
+        return false;
+    case Filter::Quaternion:
+        if (stride != 8) {
+            return false;
+        }
+        DecodeQuaternion(data, count);
+        return true;
+    case Filter::Exponential:
+        if (stride % 4 != 0) {
+            return false;
+        }
+        DecodeExponential(data, count * (stride / 4));
+        return true;
+    }
+    return false;
+}
+
+} // namespace Meshopt
+} // namespace glTFCommon
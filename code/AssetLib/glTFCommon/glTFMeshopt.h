@@ -0,0 +1,99 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file glTFMeshopt.h
+ *  @brief Encoders and decoders for the EXT_meshopt_compression bitstreams.
+ *
+ *  The format is described in the extension specification:
+ *  https://github.com/KhronosGroup/glTF/tree/main/extensions/2.0/Vendor/EXT_meshopt_compression
+ */
+#ifndef AI_GLTFMESHOPT_H_INC
+#define AI_GLTFMESHOPT_H_INC
+
+#include <assimp/defs.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace glTFCommon {
+namespace Meshopt {
+
+//! Attribute filters, applied after decoding a vertex buffer
+enum class Filter {
+    None,
+    Octahedral, //!< unit vectors stored as two octahedral coordinates
+    Quaternion, //!< unit quaternions stored as three components and the index of the fourth
+    Exponential //!< floats stored as a 24-bit mantissa and an 8-bit exponent
+};
+
+//! Decodes count vertices of stride bytes (a multiple of 4, at most 256) into destination.
+//! \return false if the bitstream is malformed.
+ASSIMP_API bool DecodeVertexBuffer(uint8_t *destination, size_t count, size_t stride, const uint8_t *buffer, size_t bufferSize);
+
+//! Decodes count triangle indices (a multiple of 3) of indexSize bytes (2 or 4) into destination.
+//! \return false if the bitstream is malformed.
+ASSIMP_API bool DecodeIndexBuffer(uint8_t *destination, size_t count, size_t indexSize, const uint8_t *buffer, size_t bufferSize);
+
+//! Decodes count indices of indexSize bytes (2 or 4) of an arbitrary index list into destination.
+//! \return false if the bitstream is malformed.
+ASSIMP_API bool DecodeIndexSequence(uint8_t *destination, size_t count, size_t indexSize, const uint8_t *buffer, size_t bufferSize);
+
+//! Encodes count vertices of stride bytes (a multiple of 4, at most 256) into out.
+//! \return false if the stride is not valid.
+ASSIMP_API bool EncodeVertexBuffer(std::vector<uint8_t> &out, const uint8_t *vertices, size_t count, size_t stride);
+
+//! Encodes count triangle indices (a multiple of 3) of indexSize bytes (2 or 4) into out.
+//! \return false if the count or the index size is not valid.
+ASSIMP_API bool EncodeIndexBuffer(std::vector<uint8_t> &out, const uint8_t *indices, size_t count, size_t indexSize);
+
+//! Encodes count indices of indexSize bytes (2 or 4) of an arbitrary index list into out.
+//! \return false if the index size is not valid.
+ASSIMP_API bool EncodeIndexSequence(std::vector<uint8_t> &out, const uint8_t *indices, size_t count, size_t indexSize);
+
+//! Reverts an attribute filter in place on count elements of stride bytes.
+//! \return false if the stride is not valid for the filter.
+ASSIMP_API bool ApplyFilter(Filter filter, uint8_t *data, size_t count, size_t stride);
+
+} // namespace Meshopt
+} // namespace glTFCommon
+
+#endif // AI_GLTFMESHOPT_H_INC
@@ -45,6 +45,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FileSystemFilter.h"
 #include "Importer.h"
+#include "ProbingIOSystem.h"
+#include "ThreadPool.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/ByteSwapper.h>
 #include <assimp/ParsingUtils.h>
@@ -58,6 +60,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <list>
 #include <memory>
 #include <sstream>
+#include <vector>
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+#   include <mutex>
+#endif
 
 namespace {
 // Checks whether the passed string is a gcs version.
@@ -89,7 +96,9 @@ using namespace Assimp;
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 BaseImporter::BaseImporter() AI_NO_EXCEPT
-        : m_progress() {
+        : m_progress(),
+          m_profiler(),
+          m_threadPool() {
     // empty
 }
 
@@ -116,6 +125,7 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
     }
 
     ai_assert(m_progress);
+    m_profiler = pImp->Pimpl()->mProfiler.get();
 
     // Gather configuration properties for this run
     SetupProperties(pImp);
@@ -126,15 +136,27 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
     // create a scene object to hold the data
     std::unique_ptr<aiScene> sc(new aiScene());
 
+    // Importers may spread the parsing over a worker pool, the calling thread counts as one
+    // of the requested threads.
+    int numThreads = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 1);
+    if (numThreads <= 0) {
+        numThreads = static_cast<int>(ThreadPool::GetHardwareConcurrency());
+    }
+    std::unique_ptr<ThreadPool> threadPool(numThreads > 1 ? new ThreadPool(numThreads - 1) : nullptr);
+    m_threadPool = threadPool.get();
+
     // dispatch importing
     try {
         InternReadFile(pFile, sc.get(), &filter);
+        m_threadPool = nullptr;
 
         // Calculate import scale hook - required because pImp not available anywhere else
         // passes scale into ScaleProcess
         UpdateImporterScale(pImp);
 
     } catch( const std::exception &err ) {
+        m_threadPool = nullptr;
+
         // extract error description
         m_ErrorText = err.what();
         ASSIMP_LOG_ERROR(err.what());
@@ -188,57 +210,69 @@ void BaseImporter::GetExtensionList(std::set<std::string> &extensions) {
         return false;
     }
 
-    std::unique_ptr<IOStream> pStream(pIOHandler->Open(pFile));
-    if (pStream) {
-        // read 200 characters from the file
-        std::unique_ptr<char[]> _buffer(new char[searchBytes + 1 /* for the '\0' */]);
-        char *buffer(_buffer.get());
-        const size_t read(pStream->Read(buffer, 1, searchBytes));
-        if (0 == read) {
+    // read 200 characters from the file, preferably from the header
+    // shared by all importers probing this file
+    std::unique_ptr<char[]> _buffer(new char[searchBytes + 1 /* for the '\0' */]);
+    char *buffer(_buffer.get());
+    size_t read = 0;
+    size_t cached = 0;
+    bool complete = false;
+    ProbingIOSystem *probe = dynamic_cast<ProbingIOSystem *>(pIOHandler);
+    const char *header = probe ? probe->GetHeader(pFile, cached, complete) : nullptr;
+    if (nullptr != header && (searchBytes <= cached || complete)) {
+        read = std::min<size_t>(searchBytes, cached);
+        ::memcpy(buffer, header, read);
+    } else {
+        std::unique_ptr<IOStream> pStream(pIOHandler->Open(pFile));
+        if (!pStream) {
             return false;
         }
+        read = pStream->Read(buffer, 1, searchBytes);
+    }
+    if (0 == read) {
+        return false;
+    }
 
-        for (size_t i = 0; i < read; ++i) {
-            buffer[i] = static_cast<char>(::tolower((unsigned char)buffer[i]));
-        }
+    for (size_t i = 0; i < read; ++i) {
+        buffer[i] = static_cast<char>(::tolower((unsigned char)buffer[i]));
+    }
 
-        // It is not a proper handling of unicode files here ...
-        // ehm ... but it works in most cases.
-        char *cur = buffer, *cur2 = buffer, *end = &buffer[read];
-        while (cur != end) {
-            if (*cur) {
-                *cur2++ = *cur;
-            }
-            ++cur;
+    // It is not a proper handling of unicode files here ...
+    // ehm ... but it works in most cases.
+    char *cur = buffer, *cur2 = buffer, *end = &buffer[read];
+    while (cur != end) {
+        if (*cur) {
+            *cur2++ = *cur;
         }
-        *cur2 = '\0';
-
-        std::string token;
-        for (unsigned int i = 0; i < numTokens; ++i) {
-            ai_assert(nullptr != tokens[i]);
-            const size_t len(strlen(tokens[i]));
-            token.clear();
-            const char *ptr(tokens[i]);
-            for (size_t tokIdx = 0; tokIdx < len; ++tokIdx) {
-                token.push_back(static_cast<char>(tolower(static_cast<unsigned char>(*ptr))));
-                ++ptr;
-            }
-            const char *r = strstr(buffer, token.c_str());
-            if (!r) {
-                continue;
-            }
-            // We need to make sure that we didn't accidentally identify the end of another token as our token,
-            // e.g. in a previous version the "gltf " present in some gltf files was detected as "f ", or a
-            // Blender-exported glb file containing "Khronos glTF Blender I/O " was detected as "o "
-            if (noGraphBeforeTokens && (r != buffer && isgraph(static_cast<unsigned char>(r[-1])))) {
-                continue;
-            }
-            // We got a match, either we don't care where it is, or it happens to
-            // be in the beginning of the file / line
-            if (!tokensSol || r == buffer || r[-1] == '\r' || r[-1] == '\n') {
-                ASSIMP_LOG_DEBUG("Found positive match for header keyword: ", tokens[i]);
-                return true;
-            }
+        ++cur;
+    }
+    *cur2 = '\0';
+
+    std::string token;
+    for (unsigned int i = 0; i < numTokens; ++i) {
+        ai_assert(nullptr != tokens[i]);
+        const size_t len(strlen(tokens[i]));
+        token.clear();
+        const char *ptr(tokens[i]);
+        for (size_t tokIdx = 0; tokIdx < len; ++tokIdx) {
+            token.push_back(static_cast<char>(tolower(static_cast<unsigned char>(*ptr))));
+            ++ptr;
+        }
+        const char *r = strstr(buffer, token.c_str());
+        if (!r) {
+            continue;
+        }
+        // We need to make sure that we didn't accidentally identify the end of another token as our token,
+        // e.g. in a previous version the "gltf " present in some gltf files was detected as "f ", or a
+        // Blender-exported glb file containing "Khronos glTF Blender I/O " was detected as "o "
+        if (noGraphBeforeTokens && (r != buffer && isgraph(static_cast<unsigned char>(r[-1])))) {
+            continue;
+        }
+        // We got a match, either we don't care where it is, or it happens to
+        // be in the beginning of the file / line
+        if (!tokensSol || r == buffer || r[-1] == '\r' || r[-1] == '\n') {
+            ASSIMP_LOG_DEBUG("Found positive match for header keyword: ", tokens[i]);
+            return true;
         }
     }
 
@@ -310,46 +344,59 @@ std::string BaseImporter::GetExtension(const std::string &pFile) {
         return false;
     }
     const char *magic = reinterpret_cast<const char *>(_magic);
-    std::unique_ptr<IOStream> pStream(pIOHandler->Open(pFile));
-    if (pStream) {
+
+    // read 'size' characters at 'offset', preferably from the header
+    // shared by all importers probing this file
+    union {
+        char data[16];
+        uint16_t data_u16[8];
+        uint32_t data_u32[4];
+    };
+    size_t cached = 0;
+    bool complete = false;
+    ProbingIOSystem *probe = dynamic_cast<ProbingIOSystem *>(pIOHandler);
+    const char *header = probe ? probe->GetHeader(pFile, cached, complete) : nullptr;
+    if (nullptr != header && (offset + size <= cached || complete)) {
+        if (offset + size > cached) {
+            return false;
+        }
+        ::memcpy(data, header + offset, size);
+    } else {
+        std::unique_ptr<IOStream> pStream(pIOHandler->Open(pFile));
+        if (!pStream) {
+            return false;
+        }
 
         // skip to offset
         pStream->Seek(offset, aiOrigin_SET);
-
-        // read 'size' characters from the file
-        union {
-            char data[16];
-            uint16_t data_u16[8];
-            uint32_t data_u32[4];
-        };
         if (size != pStream->Read(data, 1, size)) {
             return false;
         }
+    }
 
-        for (unsigned int i = 0; i < num; ++i) {
-            // also check against big endian versions of tokens with size 2,4
-            // that's just for convenience, the chance that we cause conflicts
-            // is quite low and it can save some lines and prevent nasty bugs
-            if (2 == size) {
-                uint16_t magic_u16;
-                memcpy(&magic_u16, magic, 2);
-                if (data_u16[0] == magic_u16 || data_u16[0] == ByteSwap::Swapped(magic_u16)) {
-                    return true;
-                }
-            } else if (4 == size) {
-                uint32_t magic_u32;
-                memcpy(&magic_u32, magic, 4);
-                if (data_u32[0] == magic_u32 || data_u32[0] == ByteSwap::Swapped(magic_u32)) {
-                    return true;
-                }
-            } else {
-                // any length ... just compare
-                if (!memcmp(magic, data, size)) {
-                    return true;
-                }
+    for (unsigned int i = 0; i < num; ++i) {
+        // also check against big endian versions of tokens with size 2,4
+        // that's just for convenience, the chance that we cause conflicts
+        // is quite low and it can save some lines and prevent nasty bugs
+        if (2 == size) {
+            uint16_t magic_u16;
+            memcpy(&magic_u16, magic, 2);
+            if (data_u16[0] == magic_u16 || data_u16[0] == ByteSwap::Swapped(magic_u16)) {
+                return true;
+            }
+        } else if (4 == size) {
+            uint32_t magic_u32;
+            memcpy(&magic_u32, magic, 4);
+            if (data_u32[0] == magic_u32 || data_u32[0] == ByteSwap::Swapped(magic_u32)) {
+                return true;
+            }
+        } else {
+            // any length ... just compare
+            if (!memcmp(magic, data, size)) {
+                return true;
             }
-            magic += size;
         }
+        magic += size;
     }
     return false;
 }
@@ -520,7 +567,7 @@ struct LoadRequest {
 // BatchLoader::pimpl data structure
 struct Assimp::BatchData {
     BatchData(IOSystem *pIO, bool validate) :
-            pIOSystem(pIO), pImporter(nullptr), next_id(0xffff), validate(validate) {
+            pIOSystem(pIO), pImporter(nullptr), next_id(0xffff), validate(validate), numThreads(1) {
         ai_assert(nullptr != pIO);
 
         pImporter = new Importer();
@@ -549,6 +596,9 @@ struct Assimp::BatchData {
 
     // Validation enabled state
     bool validate;
+
+    // Number of files to load concurrently
+    unsigned int numThreads;
 };
 
 typedef std::list<LoadRequest>::iterator LoadReqIt;
@@ -579,6 +629,16 @@ bool BatchLoader::getValidation() const {
     return m_data->validate;
 }
 
+// ------------------------------------------------------------------------------------------------
+void BatchLoader::setNumThreads(unsigned int numThreads) {
+    m_data->numThreads = numThreads > 0 ? numThreads : ThreadPool::GetHardwareConcurrency();
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int BatchLoader::getNumThreads() const {
+    return m_data->numThreads;
+}
+
 // ------------------------------------------------------------------------------------------------
 unsigned int BatchLoader::AddLoadRequest(const std::string &file,
         unsigned int steps /*= 0*/, const PropertyMap *map /*= nullptr*/) {
@@ -620,31 +680,82 @@ aiScene *BatchLoader::GetImport(unsigned int which) {
     return nullptr;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Loads a single request with the given importer
+static void LoadRequestedFile(Importer *importer, LoadRequest &req, bool validate) {
+    // force validation in debug builds
+    unsigned int pp = req.flags;
+    if (validate) {
+        pp |= aiProcess_ValidateDataStructure;
+    }
+
+    // setup config properties if necessary
+    ImporterPimpl *pimpl = importer->Pimpl();
+    pimpl->mFloatProperties = req.map.floats;
+    pimpl->mIntProperties = req.map.ints;
+    pimpl->mStringProperties = req.map.strings;
+    pimpl->mMatrixProperties = req.map.matrices;
+
+    if (!DefaultLogger::isNullLogger()) {
+        ASSIMP_LOG_INFO("%%% BEGIN EXTERNAL FILE %%%");
+        ASSIMP_LOG_INFO("File: ", req.file);
+    }
+    importer->ReadFile(req.file, pp);
+    req.scene = importer->GetOrphanedScene();
+    req.loaded = true;
+
+    ASSIMP_LOG_INFO("%%% END EXTERNAL FILE %%%");
+}
+
 // ------------------------------------------------------------------------------------------------
 void BatchLoader::LoadAll() {
-    // no threaded implementation for the moment
-    for (LoadReqIt it = m_data->requests.begin(); it != m_data->requests.end(); ++it) {
-        // force validation in debug builds
-        unsigned int pp = (*it).flags;
-        if (m_data->validate) {
-            pp |= aiProcess_ValidateDataStructure;
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    const size_t numThreads = std::min<size_t>(m_data->numThreads, m_data->requests.size());
+    if (numThreads > 1) {
+        std::vector<LoadRequest *> requests;
+        requests.reserve(m_data->requests.size());
+        for (LoadRequest &req : m_data->requests) {
+            requests.push_back(&req);
         }
 
-        // setup config properties if necessary
-        ImporterPimpl *pimpl = m_data->pImporter->Pimpl();
-        pimpl->mFloatProperties = (*it).map.floats;
-        pimpl->mIntProperties = (*it).map.ints;
-        pimpl->mStringProperties = (*it).map.strings;
-        pimpl->mMatrixProperties = (*it).map.matrices;
+        // one importer per concurrently running request, all sharing our IO system
+        std::vector<std::unique_ptr<Importer>> extraImporters;
+        std::vector<Importer *> idle(1, m_data->pImporter);
+        for (size_t i = 1; i < numThreads; ++i) {
+            extraImporters.emplace_back(new Importer());
+            extraImporters.back()->SetIOHandler(m_data->pIOSystem);
+            idle.push_back(extraImporters.back().get());
+        }
 
-        if (!DefaultLogger::isNullLogger()) {
-            ASSIMP_LOG_INFO("%%% BEGIN EXTERNAL FILE %%%");
-            ASSIMP_LOG_INFO("File: ", (*it).file);
+        std::mutex idleMutex;
+        try {
+            ThreadPool pool(static_cast<unsigned int>(numThreads - 1));
+            pool.ParallelFor(requests.size(), [&](size_t i) {
+                Importer *importer = nullptr;
+                {
+                    std::lock_guard<std::mutex> lock(idleMutex);
+                    importer = idle.back();
+                    idle.pop_back();
+                }
+                LoadRequestedFile(importer, *requests[i], m_data->validate);
+                std::lock_guard<std::mutex> lock(idleMutex);
+                idle.push_back(importer);
+            });
+        } catch (...) {
+            for (auto &importer : extraImporters) {
+                importer->SetIOHandler(nullptr); /* get pointer back into our possession */
+            }
+            throw;
         }
-        m_data->pImporter->ReadFile((*it).file, pp);
-        (*it).scene = m_data->pImporter->GetOrphanedScene();
-        (*it).loaded = true;
 
-        ASSIMP_LOG_INFO("%%% END EXTERNAL FILE %%%");
+        for (auto &importer : extraImporters) {
+            importer->SetIOHandler(nullptr); /* get pointer back into our possession */
+        }
+        return;
+    }
+#endif
+
+    for (LoadReqIt it = m_data->requests.begin(); it != m_data->requests.end(); ++it) {
+        LoadRequestedFile(m_data->pImporter, *it, m_data->validate);
     }
 }
@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "BaseProcess.h"
 #include "Importer.h"
+#include "ThreadPool.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
@@ -53,7 +54,8 @@ using namespace Assimp;
 // Constructor to be privately used by Importer
 BaseProcess::BaseProcess() AI_NO_EXCEPT
         : shared(),
-          progress() {
+          progress(),
+          threadPool() {
     // empty
 }
 
@@ -101,3 +103,47 @@ void BaseProcess::SetupProperties(const Importer * /*pImp*/) {
 bool BaseProcess::RequireVerboseFormat() const {
     return true;
 }
+
+// ------------------------------------------------------------------------------------------------
+bool BaseProcess::IsMeshLocal() const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+const char *BaseProcess::GetName(unsigned int pFlags) const {
+    // indexed by the bit of the aiPostProcessSteps flag
+    static const char *const names[32] = {
+        "CalcTangentSpace", "JoinIdenticalVertices", "MakeLeftHanded", "Triangulate",
+        "RemoveComponent", "GenNormals", "GenSmoothNormals", "SplitLargeMeshes",
+        "PreTransformVertices", "LimitBoneWeights", "ValidateDataStructure", "ImproveCacheLocality",
+        "RemoveRedundantMaterials", "FixInfacingNormals", "PopulateArmatureData", "SortByPType",
+        "FindDegenerates", "FindInvalidData", "GenUVCoords", "TransformUVCoords",
+        "FindInstances", "OptimizeMeshes", "OptimizeGraph", "FlipUVs",
+        "FlipWindingOrder", "SplitByBoneCount", "Debone", "GlobalScale",
+        "EmbedTextures", "ForceGenNormals", "DropNormals", "GenBoundingBoxes"
+    };
+
+    for (unsigned int bit = 0; bit < 32; ++bit) {
+        const unsigned int flag = 1u << bit;
+        if ((pFlags & flag) && IsActive(flag)) {
+            return names[bit];
+        }
+    }
+    return "PostProcessStep";
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ForEachMesh(aiScene *pScene, const std::function<void(unsigned int)> &fn) {
+    ai_assert(nullptr != pScene);
+
+    if (nullptr == threadPool || !IsMeshLocal() || pScene->mNumMeshes < 2) {
+        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    threadPool->ParallelFor(pScene->mNumMeshes, [&fn](size_t i) {
+        fn(static_cast<unsigned int>(i));
+    });
+}
@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/GenericProperty.h>
 
+#include <functional>
 #include <map>
 
 struct aiScene;
@@ -52,6 +53,7 @@ struct aiScene;
 namespace Assimp {
 
 class Importer;
+class ThreadPool;
 
 // ---------------------------------------------------------------------------
 /** Helper class to allow post-processing steps to interact with each other.
@@ -200,6 +202,18 @@ public:
      *  in verbose format. */
     virtual bool RequireVerboseFormat() const;
 
+    // -------------------------------------------------------------------
+    /** Check whether this step only reads and writes one mesh at a time.
+     *  Mesh-local steps may process the meshes of a scene concurrently
+     *  via ForEachMesh() if a thread pool has been assigned. */
+    virtual bool IsMeshLocal() const;
+
+    // -------------------------------------------------------------------
+    /** Returns a name for the step, e.g. for profiling. Steps are
+     *  named after the first flag in pFlags which activates them.
+     *  @param pFlags The processing flags the step is run with. */
+    virtual const char *GetName(unsigned int pFlags) const;
+
     // -------------------------------------------------------------------
     /**
      * @brief Executes the post processing step on the given imported data.
@@ -242,12 +256,34 @@ public:
         return shared;
     }
 
+    // -------------------------------------------------------------------
+    /** Assign the thread pool used by ForEachMesh(). Only mesh-local
+     *  steps make use of it.
+     * @param pool May be nullptr to process all meshes serially
+     */
+    inline void SetThreadPool(ThreadPool *pool) {
+        threadPool = pool;
+    }
+
 protected:
+    // -------------------------------------------------------------------
+    /** Invokes fn for each mesh index of the scene. The calls run
+     *  concurrently if the step is mesh-local and a thread pool has been
+     *  assigned, otherwise they run in ascending order. fn must not touch
+     *  any mesh but the one it has been called for.
+     * @param pScene The scene to work at.
+     * @param fn     Function receiving the mesh index.
+     */
+    void ForEachMesh(aiScene *pScene, const std::function<void(unsigned int)> &fn);
+
     /** See the doc of #SharedPostProcessInfo for more details */
     SharedPostProcessInfo *shared;
 
     /** Currently active progress handler */
     ProgressHandler *progress;
+
+    /** Pool for mesh-local steps, may be nullptr */
+    ThreadPool *threadPool;
 };
 
 } // end of namespace Assimp
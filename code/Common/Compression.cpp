@@ -202,6 +202,16 @@ bool Compression::isOpen() const {
     return mImpl->mOpen;
 }
 
+bool Compression::reset() {
+    ai_assert(mImpl != nullptr);
+
+    if (!mImpl->mOpen) {
+        return false;
+    }
+
+    return ::inflateReset(&mImpl->mZSstream) == Z_OK;
+}
+
 bool Compression::close() {
     ai_assert(mImpl != nullptr);
 
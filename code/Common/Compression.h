@@ -91,6 +91,11 @@ public:
     /// @return true if the access is opened, false if not.
     bool isOpen() const;
 
+    /// @brief  Will reset the opened access, so the next buffer can be decompressed without
+    ///         allocating a new inflate state.
+    /// @return true if reset was successful, false if not.
+    bool reset();
+
     /// @brief  Will close the decompress access.
     /// @return true if close was successful, false if not.
     bool close();
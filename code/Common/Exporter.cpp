@@ -60,6 +60,7 @@ Here we implement only the C++ interface (Assimp::Exporter).
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/Exceptional.h>
+#include <assimp/Profiler.h>
 
 #include "Common/DefaultProgressHandler.h"
 #include "Common/BaseProcess.h"
@@ -275,6 +276,9 @@ public:
 
     /** Exporters, this includes those registered using #Assimp::Exporter::RegisterExporter */
     std::vector<Exporter::ExportFormatEntry> mExporters;
+
+    /** Timings of the last export, nullptr unless AI_CONFIG_GLOB_MEASURE_TIME is set */
+    std::unique_ptr<Profiling::Profiler> mProfiler;
 };
 
 } // end of namespace Assimp
@@ -372,15 +376,26 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
 
     pimpl->mProgressHandler->UpdateFileWrite(0, 4);
 
+    pimpl->mProfiler.reset(pProperties && pProperties->GetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME) ? new Profiling::Profiler() : nullptr);
+    Profiling::Profiler *profiler = pimpl->mProfiler.get();
+
     pimpl->mError = "";
     for (size_t i = 0; i < pimpl->mExporters.size(); ++i) {
         const Exporter::ExportFormatEntry& exp = pimpl->mExporters[i];
         if (!strcmp(exp.mDescription.id,pFormatId)) {
             try {
+                Profiling::ScopedRegion exportRegion(profiler, "export");
+
                 // Always create a full copy of the scene. We might optimize this one day,
                 // but for now it is the most pragmatic way.
                 aiScene* scenecopy_tmp = nullptr;
+                if (profiler) {
+                    profiler->BeginRegion("copy");
+                }
                 SceneCombiner::CopyScene(&scenecopy_tmp,pScene);
+                if (profiler) {
+                    profiler->EndRegion("copy");
+                }
 
                 pimpl->mProgressHandler->UpdateFileWrite(1, 4);
 
@@ -433,10 +448,13 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                 pimpl->mProgressHandler->UpdateFileWrite(2, 4);
 
                 if (pp) {
+                    Profiling::ScopedRegion postProcessRegion(profiler, "postprocess");
+
                     // the three 'conversion' steps need to be executed first because all other steps rely on the standard data layout
                     {
                         FlipWindingOrderProcess step;
                         if (step.IsActive(pp)) {
+                            Profiling::ScopedRegion stepRegion(profiler, step.GetName(pp));
                             step.Execute(scenecopy.get());
                         }
                     }
@@ -444,6 +462,7 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                     {
                         FlipUVsProcess step;
                         if (step.IsActive(pp)) {
+                            Profiling::ScopedRegion stepRegion(profiler, step.GetName(pp));
                             step.Execute(scenecopy.get());
                         }
                     }
@@ -451,6 +470,7 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                     {
                         MakeLeftHandedProcess step;
                         if (step.IsActive(pp)) {
+                            Profiling::ScopedRegion stepRegion(profiler, step.GetName(pp));
                             step.Execute(scenecopy.get());
                         }
                     }
@@ -471,6 +491,7 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                             if (dynamic_cast<PretransformVertices*>(p) && exportPointCloud) {
                                 continue;
                             }
+                            Profiling::ScopedRegion stepRegion(profiler, p->GetName(pp));
                             p->Execute(scenecopy.get());
                         }
                     }
@@ -490,7 +511,10 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                 ExportProperties emptyProperties;  // Never pass nullptr ExportProperties so Exporters don't have to worry.
                 ExportProperties* pProp = pProperties ? (ExportProperties*)pProperties : &emptyProperties;
         		pProp->SetPropertyBool("bJoinIdenticalVertices", pp & aiProcess_JoinIdenticalVertices);
-                exp.mExportFunction(pPath,pimpl->mIOSystem.get(),scenecopy.get(), pProp);
+                {
+                    Profiling::ScopedRegion writeRegion(profiler, "write");
+                    exp.mExportFunction(pPath,pimpl->mIOSystem.get(),scenecopy.get(), pProp);
+                }
 
                 pimpl->mProgressHandler->UpdateFileWrite(4, 4);
             } catch (DeadlyExportError& err) {
@@ -513,6 +537,12 @@ const char* Exporter::GetErrorString() const {
     return pimpl->mError.c_str();
 }
 
+// ------------------------------------------------------------------------------------------------
+const Profiling::Profiler* Exporter::GetProfile() const {
+	ai_assert(nullptr != pimpl);
+    return pimpl->mProfiler.get();
+}
+
 // ------------------------------------------------------------------------------------------------
 void Exporter::FreeBlob() {
 	ai_assert(nullptr != pimpl);
@@ -68,6 +68,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PostProcessing/ProcessHelper.h"
 #include "Common/ScenePreprocessor.h"
 #include "Common/ScenePrivate.h"
+#include "Common/ThreadPool.h"
+#include "Common/ProbingIOSystem.h"
 
 #include <assimp/BaseImporter.h>
 #include <assimp/GenericProperty.h>
@@ -75,7 +77,6 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Profiler.h>
 #include <assimp/TinyFormatter.h>
 #include <assimp/Exceptional.h>
-#include <assimp/Profiler.h>
 #include <assimp/commonMetaData.h>
 
 #include <exception>
@@ -97,6 +98,9 @@ namespace Assimp {
     // ImporterRegistry.cpp
     void GetImporterInstanceList(std::vector< BaseImporter* >& out);
 	void DeleteImporterInstanceList(std::vector< BaseImporter* >& out);
+    void GetImporterExtensionIndex(const std::vector< BaseImporter* >& importers, ImporterPimpl::ExtensionIndex& out);
+    void AddImporterExtensions(BaseImporter* importer, unsigned int index, ImporterPimpl::ExtensionIndex& out);
+    std::shared_ptr<const ImporterPimpl::ExtensionIndex> GetDefaultImporterExtensionIndex(const std::vector< BaseImporter* >& importers);
 
     // PostStepRegistry.cpp
     void GetPostProcessingStepInstanceList(std::vector< BaseProcess* >& out);
@@ -160,6 +164,7 @@ Importer::Importer()
     pimpl->mIsDefaultProgressHandler = true;
 
     GetImporterInstanceList(pimpl->mImporter);
+    pimpl->mExtensionIndex = GetDefaultImporterExtensionIndex(pimpl->mImporter);
     GetPostProcessingStepInstanceList(pimpl->mPostProcessingSteps);
 
     // Allocate a SharedPostProcessInfo object and store pointers to it in all post-process steps in the list.
@@ -239,7 +244,11 @@ aiReturn Importer::RegisterLoader(BaseImporter* pImp) {
     }
 
     // add the loader
+    // the table may be shared with other importers, so extend a copy of it
+    std::shared_ptr<ImporterPimpl::ExtensionIndex> index = std::make_shared<ImporterPimpl::ExtensionIndex>(*pimpl->mExtensionIndex);
+    AddImporterExtensions(pImp, static_cast<unsigned int>(pimpl->mImporter.size()), *index);
     pimpl->mImporter.push_back(pImp);
+    pimpl->mExtensionIndex = index;
     ASSIMP_LOG_INFO("Registering custom importer for these file extensions: ", baked);
     ASSIMP_END_EXCEPTION_REGION(aiReturn);
 
@@ -260,6 +269,9 @@ aiReturn Importer::UnregisterLoader(BaseImporter* pImp) {
 
     if (it != pimpl->mImporter.end())   {
         pimpl->mImporter.erase(it);
+        std::shared_ptr<ImporterPimpl::ExtensionIndex> index = std::make_shared<ImporterPimpl::ExtensionIndex>();
+        GetImporterExtensionIndex(pimpl->mImporter, *index);
+        pimpl->mExtensionIndex = index;
         ASSIMP_LOG_INFO("Unregistering custom importer: ");
         return AI_SUCCESS;
     }
@@ -577,6 +589,7 @@ void WriteLogOpening(const std::string& file) {
            << (flags & ASSIMP_CFLAGS_NOBOOST ? " noboost" : "")
            << (flags & ASSIMP_CFLAGS_SHARED ? " shared" : "")
            << (flags & ASSIMP_CFLAGS_SINGLETHREADED ? " singlethreaded" : "")
+           << (flags & ASSIMP_CFLAGS_MULTITHREADED ? " multithreaded" : "")
            << (flags & ASSIMP_CFLAGS_DOUBLE_SUPPORT ? " double : " : "single : ");
 
     ASSIMP_LOG_DEBUG(stream.str());
@@ -610,6 +623,9 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             FreeScene();
         }
 
+        pimpl->mProfiler.reset(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+        Profiler *profiler = pimpl->mProfiler.get();
+
         // First check if the file is accessible at all
         if( !pimpl->mIOHandler->Exists( pFile)) {
 
@@ -618,9 +634,9 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             return nullptr;
         }
 
-        std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+        ScopedRegion totalRegion(profiler, "total");
         if (profiler) {
-            profiler->BeginRegion("total");
+            profiler->BeginRegion("detect");
         }
 
         // Find an worker class which can handle the file extension.
@@ -631,18 +647,24 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             unsigned int   index;
         };
         std::vector<ImporterAndIndex> possibleImporters;
-        for (unsigned int a = 0; a < pimpl->mImporter.size(); a++)  {
-
-            // Every importer has a list of supported extensions.
-            std::set<std::string> extensions;
-            pimpl->mImporter[a]->GetExtensionList(extensions);
+        const ImporterPimpl::ExtensionIndex::const_iterator entries = pimpl->mExtensionIndex->find(BaseImporter::GetExtension(pFile));
+        if (entries != pimpl->mExtensionIndex->end()) {
+            for (const ImporterPimpl::ExtensionEntry &entry : entries->second) {
+                if (!possibleImporters.empty() && possibleImporters.back().index == entry.mIndex) {
+                    continue;
+                }
 
-            if (BaseImporter::HasExtension(pFile, extensions)) {
-                ImporterAndIndex candidate = { pimpl->mImporter[a], a };
-                possibleImporters.push_back(candidate);
+                // Extensions containing dots (e.g. mesh.xml) have to match the entire end of the file name.
+                if (entry.mExtension.find('.') == std::string::npos || BaseImporter::HasExtension(pFile, { entry.mExtension })) {
+                    ImporterAndIndex candidate = { pimpl->mImporter[entry.mIndex], entry.mIndex };
+                    possibleImporters.push_back(candidate);
+                }
             }
         }
 
+        // All signature checks share a single read of the file header.
+        ProbingIOSystem probe(pFile, pimpl->mIOHandler);
+
         // If just one importer supports this extension, pick it and close the case.
         BaseImporter* imp = nullptr;
         if (1 == possibleImporters.size()) {
@@ -656,7 +678,7 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
                 BaseImporter & importer = *it->importer;
 
                 ASSIMP_LOG_INFO("Found a possible importer: " + std::string(importer.GetInfo()->mName) + "; trying signature-based detection");
-                if (importer.CanRead( pFile, pimpl->mIOHandler, true)) {
+                if (importer.CanRead( pFile, &probe, true)) {
                     imp = &importer;
                     SetPropertyInteger("importerIndex", it->index);
                     break;
@@ -670,7 +692,7 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             // not so bad yet ... try format auto detection.
             ASSIMP_LOG_INFO("File extension not known, trying signature-based detection");
             for( unsigned int a = 0; a < pimpl->mImporter.size(); a++)  {
-                if( pimpl->mImporter[a]->CanRead( pFile, pimpl->mIOHandler, true)) {
+                if( pimpl->mImporter[a]->CanRead( pFile, &probe, true)) {
                     imp = pimpl->mImporter[a];
                     SetPropertyInteger("importerIndex", a);
                     break;
@@ -684,6 +706,10 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             }
         }
 
+        if (profiler) {
+            profiler->EndRegion("detect");
+        }
+
         // Get file size for progress handler
         IOStream * fileIO = pimpl->mIOHandler->Open( pFile );
         uint32_t fileSize = 0;
@@ -758,10 +784,6 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
 
         // clear any data allocated by post-process steps
         pimpl->mPPShared->Clean();
-
-        if (profiler) {
-            profiler->EndRegion("total");
-        }
     }
 #ifdef ASSIMP_CATCH_GLOBAL_EXCEPTIONS
     catch (std::exception &e) {
@@ -830,20 +852,30 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    // Nest into the profile of ReadFile() if there is one
+    if (!pimpl->mProfiler && GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0)) {
+        pimpl->mProfiler.reset(new Profiler());
+    }
+    Profiler *profiler = pimpl->mProfiler.get();
+    ScopedRegion postProcessRegion(profiler, "postprocess");
+
+    // Mesh-local steps may fan out over a worker pool, the calling thread counts as one of the
+    // requested threads. Each step still completes before the next one starts.
+    int numThreads = GetPropertyInteger(AI_CONFIG_PP_NUM_THREADS, 1);
+    if (numThreads <= 0) {
+        numThreads = static_cast<int>(ThreadPool::GetHardwareConcurrency());
+    }
+    std::unique_ptr<ThreadPool> threadPool(numThreads > 1 ? new ThreadPool(numThreads - 1) : nullptr);
+
     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)   {
         BaseProcess* process = pimpl->mPostProcessingSteps[a];
         pimpl->mProgressHandler->UpdatePostProcess(static_cast<int>(a), static_cast<int>(pimpl->mPostProcessingSteps.size()) );
         if( process->IsActive( pFlags)) {
-            if (profiler) {
-                profiler->BeginRegion("postprocess");
-            }
+            ScopedRegion stepRegion(profiler, profiler ? process->GetName(pFlags) : nullptr);
 
+            process->SetThreadPool(threadPool.get());
             process->ExecuteOnScene ( this );
-
-            if (profiler) {
-                profiler->EndRegion("postprocess");
-            }
+            process->SetThreadPool(nullptr);
         }
         if( !pimpl->mScene) {
             break;
@@ -925,7 +957,10 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    if ( !pimpl->mProfiler && GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ) {
+        pimpl->mProfiler.reset( new Profiler() );
+    }
+    Profiler *profiler = pimpl->mProfiler.get();
 
     if ( profiler ) {
         profiler->BeginRegion( "postprocess" );
@@ -1017,14 +1052,12 @@ size_t Importer::GetImporterIndex (const char* szExtension) const {
         return static_cast<size_t>(-1);
     }
     ext = ai_tolower(ext);
-    std::set<std::string> str;
-    for (std::vector<BaseImporter*>::const_iterator i =  pimpl->mImporter.begin();i != pimpl->mImporter.end();++i)  {
-        str.clear();
-
-        (*i)->GetExtensionList(str);
-        for (std::set<std::string>::const_iterator it = str.begin(); it != str.end(); ++it) {
-            if (ext == *it) {
-                return std::distance(static_cast< std::vector<BaseImporter*>::const_iterator >(pimpl->mImporter.begin()), i);
+    const std::string::size_type dot = ext.find_last_of('.');
+    const ImporterPimpl::ExtensionIndex::const_iterator entries = pimpl->mExtensionIndex->find(std::string::npos == dot ? ext : ext.substr(dot + 1));
+    if (entries != pimpl->mExtensionIndex->end()) {
+        for (const ImporterPimpl::ExtensionEntry &entry : entries->second) {
+            if (ext == entry.mExtension) {
+                return entry.mIndex;
             }
         }
     }
@@ -1174,6 +1207,13 @@ void AddNodeWeight(unsigned int& iScene,const aiNode* pcNode) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Get the timings of the last import
+const Profiler* Importer::GetProfile() const {
+    ai_assert(nullptr != pimpl);
+    return pimpl->mProfiler.get();
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get the memory requirements of the scene
 void Importer::GetMemoryRequirements(aiMemoryInfo& in) const {
@@ -46,9 +46,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <exception>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
+#include <memory>
 #include <assimp/matrix4x4.h>
+#include <assimp/Profiler.h>
 
 struct aiScene;
 
@@ -80,6 +83,16 @@ public:
     using MatrixPropertyMap = std::map<KeyType, aiMatrix4x4>;
     using PointerPropertyMap = std::map<KeyType, void*>;
 
+    /** An importer claiming a file extension. mExtension is the complete
+     *  lower-case extension, which may contain dots (e.g. mesh.xml). */
+    struct ExtensionEntry {
+        unsigned int mIndex;
+        std::string mExtension;
+    };
+
+    // Importers by the part of their extensions behind the last dot
+    using ExtensionIndex = std::unordered_map<std::string, std::vector<ExtensionEntry>>;
+
     /** IO handler to use for all file accesses. */
     IOSystem* mIOHandler;
     bool mIsDefaultHandler;
@@ -91,6 +104,10 @@ public:
     /** Format-specific importer worker objects - one for each format we can read.*/
     std::vector< BaseImporter* > mImporter;
 
+    /** Lookup table from file extension to entries in mImporter. All importers
+     *  with the default list share one table, it is replaced whenever mImporter changes. */
+    std::shared_ptr<const ExtensionIndex> mExtensionIndex;
+
     /** Post processing steps we can apply at the imported data. */
     std::vector< BaseProcess* > mPostProcessingSteps;
 
@@ -126,6 +143,9 @@ public:
     /** Used by post-process steps to share data */
     SharedPostProcessInfo* mPPShared;
 
+    /** Timings of the last import, nullptr unless AI_CONFIG_GLOB_MEASURE_TIME is set */
+    std::unique_ptr<Profiling::Profiler> mProfiler;
+
     /// The default class constructor.
     ImporterPimpl() AI_NO_EXCEPT;
 
@@ -139,6 +159,7 @@ inline ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mProgressHandler( nullptr ),
         mIsDefaultProgressHandler( false ),
         mImporter(),
+        mExtensionIndex(),
         mPostProcessingSteps(),
         mScene( nullptr ),
         mErrorString(),
@@ -149,7 +170,8 @@ inline ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mMatrixProperties(),
         mPointerProperties(),
         bExtraVerbose( false ),
-        mPPShared( nullptr ) {
+        mPPShared( nullptr ),
+        mProfiler() {
     // empty
 }
 //! @endcond
@@ -160,8 +182,7 @@ struct BatchData;
 /** FOR IMPORTER PLUGINS ONLY: A helper class to the pleasure of importers
  *  that need to load many external meshes recursively.
  *
- *  The class uses several threads to load these meshes (or at least it
- *  could, this has not yet been implemented at the moment).
+ *  The class can load several files concurrently, see setNumThreads().
  *
  *  @note The class may not be used by more than one thread*/
 class ASSIMP_API BatchLoader {
@@ -210,6 +231,21 @@ public:
      */
     bool getValidation() const;
 
+    // -------------------------------------------------------------------
+    /** Sets the number of files LoadAll() loads at the same time. Each
+     *  concurrently running load gets its own Importer, but all of them
+     *  share the IOSystem, which must be thread-safe for values > 1.
+     *  @param  numThreads  Number of threads, 0 uses one per hardware thread.
+     *                      The default is 1.
+     */
+    void setNumThreads( unsigned int numThreads );
+
+    // -------------------------------------------------------------------
+    /** Returns the number of files LoadAll() loads at the same time.
+     *  @return The number of threads.
+     */
+    unsigned int getNumThreads() const;
+
     // -------------------------------------------------------------------
     /** Add a new file to the list of files to be loaded.
      *  @param file File to be loaded
@@ -48,6 +48,10 @@ corresponding preprocessor flag to selectively disable formats.
 
 #include <assimp/anim.h>
 #include <assimp/BaseImporter.h>
+#include <assimp/StringUtils.h>
+#include "Common/Importer.h"
+#include <memory>
+#include <set>
 #include <vector>
 #include <cstdlib>
 
@@ -390,6 +394,50 @@ void GetImporterInstanceList(std::vector<BaseImporter *> &out) {
 #endif
 }
 
+/** Adds the extensions of the importer at the given index of the importer list
+ *  to an extension lookup table. */
+void AddImporterExtensions(BaseImporter *importer, unsigned int index, ImporterPimpl::ExtensionIndex &out) {
+    std::set<std::string> extensions;
+    importer->GetExtensionList(extensions);
+    for (const std::string &ext : extensions) {
+        const std::string lower = ai_tolower(ext);
+        const std::string::size_type dot = lower.find_last_of('.');
+        const std::string key = std::string::npos == dot ? lower : lower.substr(dot + 1);
+        out[key].push_back({ index, lower });
+    }
+}
+
+/** Builds the extension lookup table for a list of importers. Entries are
+ *  stored in importer order, so lookups preserve the registration priority. */
+void GetImporterExtensionIndex(const std::vector<BaseImporter *> &importers, ImporterPimpl::ExtensionIndex &out) {
+    out.clear();
+    for (size_t i = 0; i < importers.size(); ++i) {
+        AddImporterExtensions(importers[i], static_cast<unsigned int>(i), out);
+    }
+}
+
+/** Returns the extension lookup table for a list created by GetImporterInstanceList.
+ *  It is built once and shared by all importers. */
+std::shared_ptr<const ImporterPimpl::ExtensionIndex> GetDefaultImporterExtensionIndex(const std::vector<BaseImporter *> &importers) {
+    struct DefaultIndex {
+        size_t mNumImporters;
+        std::shared_ptr<ImporterPimpl::ExtensionIndex> mIndex;
+    };
+    static const DefaultIndex defaultIndex = [&importers]() {
+        DefaultIndex result = { importers.size(), std::make_shared<ImporterPimpl::ExtensionIndex>() };
+        GetImporterExtensionIndex(importers, *result.mIndex);
+        return result;
+    }();
+    if (defaultIndex.mNumImporters == importers.size()) {
+        return defaultIndex.mIndex;
+    }
+
+    // ASSIMP_ENABLE_DEV_IMPORTERS changed since the shared table was built
+    std::shared_ptr<ImporterPimpl::ExtensionIndex> index = std::make_shared<ImporterPimpl::ExtensionIndex>();
+    GetImporterExtensionIndex(importers, *index);
+    return index;
+}
+
 /** will delete all registered importers. */
 void DeleteImporterInstanceList(std::vector<BaseImporter *> &deleteList) {
     for (size_t i = 0; i < deleteList.size(); ++i) {
@@ -0,0 +1,257 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file  MemoryMappedIOSystem.cpp
+ *  @brief Memory-mapped file I/O implementation for #Importer
+ */
+
+#include <assimp/MemoryMappedIOSystem.h>
+#include <assimp/ai_assert.h>
+
+#include <cstring>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+using namespace Assimp;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Modes which may modify the file can't be served from a read-only mapping
+bool IsReadOnlyMode(const char *mode) {
+    return nullptr == ::strpbrk(mode, "wa+");
+}
+
+#ifdef _WIN32
+
+// ------------------------------------------------------------------------------------------------
+std::wstring Utf8ToWide(const char *in) {
+    int size = MultiByteToWideChar(CP_UTF8, 0, in, -1, nullptr, 0);
+    if (size <= 0) {
+        return std::wstring();
+    }
+    std::wstring out(static_cast<size_t>(size) - 1, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, in, -1, &out[0], size);
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Map the whole file, the view keeps the file alive after the handles are closed
+const uint8_t *MapFile(const char *file, size_t &length) {
+    const std::wstring name = Utf8ToWide(file);
+    if (name.empty()) {
+        return nullptr;
+    }
+    HANDLE handle = ::CreateFileW(name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (INVALID_HANDLE_VALUE == handle) {
+        return nullptr;
+    }
+    LARGE_INTEGER size;
+    const uint8_t *data = nullptr;
+    if (::GetFileSizeEx(handle, &size) && size.QuadPart > 0 && static_cast<unsigned long long>(size.QuadPart) <= SIZE_MAX) {
+        HANDLE mapping = ::CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (nullptr != mapping) {
+            data = static_cast<const uint8_t *>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            ::CloseHandle(mapping);
+            length = static_cast<size_t>(size.QuadPart);
+        }
+    }
+    ::CloseHandle(handle);
+    return data;
+}
+
+// ------------------------------------------------------------------------------------------------
+void UnmapFile(const uint8_t *data, size_t) {
+    ::UnmapViewOfFile(data);
+}
+
+#else
+
+// ------------------------------------------------------------------------------------------------
+// Map the whole file, the mapping keeps the file alive after the descriptor is closed
+const uint8_t *MapFile(const char *file, size_t &length) {
+    const int fd = ::open(file, O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat statbuf;
+    const uint8_t *data = nullptr;
+    if (0 == ::fstat(fd, &statbuf) && S_ISREG(statbuf.st_mode) && statbuf.st_size > 0) {
+        void *ptr = ::mmap(nullptr, static_cast<size_t>(statbuf.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED != ptr) {
+            data = static_cast<const uint8_t *>(ptr);
+            length = static_cast<size_t>(statbuf.st_size);
+        }
+    }
+    ::close(fd);
+    return data;
+}
+
+// ------------------------------------------------------------------------------------------------
+void UnmapFile(const uint8_t *data, size_t length) {
+    ::munmap(const_cast<uint8_t *>(data), length);
+}
+
+#endif
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOStream::MemoryMappedIOStream(const uint8_t *data, size_t length) AI_NO_EXCEPT :
+        mData(data),
+        mLength(length),
+        mPos(0) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOStream::~MemoryMappedIOStream() {
+    UnmapFile(mData, mLength);
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Read(void *pvBuffer, size_t pSize, size_t pCount) {
+    ai_assert(nullptr != pvBuffer);
+    ai_assert(0 != pSize);
+
+    const size_t available = (mLength - mPos) / pSize;
+    const size_t cnt = pCount < available ? pCount : available;
+    const size_t ofs = pSize * cnt;
+
+    ::memcpy(pvBuffer, mData + mPos, ofs);
+    mPos += ofs;
+
+    return cnt;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Write(const void *, size_t, size_t) {
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiReturn MemoryMappedIOStream::Seek(size_t pOffset, aiOrigin pOrigin) {
+    size_t target;
+    if (aiOrigin_SET == pOrigin) {
+        target = pOffset;
+    } else if (aiOrigin_END == pOrigin) {
+        if (pOffset > mLength) {
+            return AI_FAILURE;
+        }
+        target = mLength - pOffset;
+    } else {
+        target = mPos + pOffset;
+    }
+
+    if (target > mLength) {
+        return AI_FAILURE;
+    }
+    mPos = target;
+    return AI_SUCCESS;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Tell() const {
+    return mPos;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::FileSize() const {
+    return mLength;
+}
+
+// ------------------------------------------------------------------------------------------------
+void MemoryMappedIOStream::Flush() {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+const uint8_t *MemoryMappedIOStream::GetMappedPointer() const {
+    return mData;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Tests for the existence of a file at the given path.
+bool MemoryMappedIOSystem::Exists(const char *pFile) const {
+    return mDefault.Exists(pFile);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns the operation specific directory separator
+char MemoryMappedIOSystem::getOsSeparator() const {
+    return mDefault.getOsSeparator();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Open a new file with a given path.
+IOStream *MemoryMappedIOSystem::Open(const char *strFile, const char *strMode) {
+    ai_assert(strFile != nullptr);
+    ai_assert(strMode != nullptr);
+
+    if (IsReadOnlyMode(strMode)) {
+        size_t length = 0;
+        if (const uint8_t *data = MapFile(strFile, length)) {
+            return new MemoryMappedIOStream(data, length);
+        }
+    }
+
+    // writing, empty files, pipes and the like go through stdio
+    return mDefault.Open(strFile, strMode);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Closes the given file and releases all resources associated with it.
+void MemoryMappedIOSystem::Close(IOStream *pFile) {
+    delete pFile;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Compare two paths
+bool MemoryMappedIOSystem::ComparePaths(const char *one, const char *second) const {
+    return mDefault.ComparePaths(one, second);
+}
@@ -0,0 +1,285 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  ParallelImporter.cpp
+ *  @brief Implementation of the ParallelImporter class.
+ */
+
+#include <assimp/ParallelImporter.hpp>
+#include <assimp/GenericProperty.h>
+#include <assimp/Importer.hpp>
+
+#include "Common/Importer.h"
+#include "Common/ThreadPool.h"
+
+#include <exception>
+#include <vector>
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+#   include <condition_variable>
+#   include <mutex>
+#endif
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+// ParallelImporter::pimpl data structure
+struct ParallelImporterPimpl {
+    explicit ParallelImporterPimpl(unsigned int numThreads) :
+            numThreads(numThreads), ioHandler(nullptr), pending(0), pool(numThreads) {
+        // empty
+    }
+
+    ~ParallelImporterPimpl() {
+        for (Importer *imp : importers) {
+            if (ioHandler) {
+                imp->SetIOHandler(nullptr); // get the pointer back into the caller's possession
+            }
+            delete imp;
+        }
+    }
+
+    // Fetches an idle importer or creates a new one. There are never more
+    // importers than workers, one per concurrently running import.
+    Importer *AcquireImporter() {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        std::lock_guard<std::mutex> lock(mutex);
+#endif
+        if (!idle.empty()) {
+            Importer *imp = idle.back();
+            idle.pop_back();
+            return imp;
+        }
+        Importer *imp = new Importer();
+        if (ioHandler) {
+            imp->SetIOHandler(ioHandler);
+        }
+        importers.push_back(imp);
+        return imp;
+    }
+
+    void ReleaseImporter(Importer *imp) {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        std::lock_guard<std::mutex> lock(mutex);
+#endif
+        idle.push_back(imp);
+    }
+
+    void FinishRequest() {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--pending == 0) {
+            finished.notify_all();
+        }
+#else
+        --pending;
+#endif
+    }
+
+    ImportResult Import(const std::string &file, unsigned int flags, const BatchLoader::PropertyMap &properties);
+
+    // Number of workers
+    unsigned int numThreads;
+
+    // Custom IO handler shared by all importers, nullptr for the default one
+    IOSystem *ioHandler;
+
+    // Properties to be copied into the next request
+    BatchLoader::PropertyMap properties;
+
+    // All importers created so far and the ones not busy right now
+    std::vector<Importer *> importers;
+    std::vector<Importer *> idle;
+
+    // Number of queued or running imports
+    unsigned int pending;
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    std::mutex mutex;
+    std::condition_variable finished;
+#endif
+
+    // Declared last so the workers are joined before the importers are destroyed
+    ThreadPool pool;
+};
+
+// ------------------------------------------------------------------------------------------------
+ImportResult ParallelImporterPimpl::Import(const std::string &file, unsigned int flags, const BatchLoader::PropertyMap &props) {
+    ImportResult result;
+    result.mFile = file;
+
+    Importer *imp = AcquireImporter();
+
+    // setup config properties, this replaces the ones of the previous request
+    ImporterPimpl *pimpl = imp->Pimpl();
+    pimpl->mFloatProperties = props.floats;
+    pimpl->mIntProperties = props.ints;
+    pimpl->mStringProperties = props.strings;
+    pimpl->mMatrixProperties = props.matrices;
+
+    try {
+        if (imp->ReadFile(file, flags)) {
+            result.mScene.reset(imp->GetOrphanedScene());
+        } else {
+            result.mErrorString = imp->GetErrorString();
+        }
+    } catch (const std::exception &e) {
+        imp->FreeScene();
+        result.mErrorString = e.what();
+    }
+
+    ReleaseImporter(imp);
+    return result;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Marks a request as done when leaving the scope, even if the import or the callback throws.
+struct RequestGuard {
+    explicit RequestGuard(ParallelImporterPimpl *pimpl) :
+            mPimpl(pimpl) {}
+    ~RequestGuard() {
+        mPimpl->FinishRequest();
+    }
+    ParallelImporterPimpl *mPimpl;
+};
+
+// ------------------------------------------------------------------------------------------------
+static unsigned int ResolveNumThreads(unsigned int numThreads) {
+    return numThreads > 0 ? numThreads : ThreadPool::GetHardwareConcurrency();
+}
+
+// ------------------------------------------------------------------------------------------------
+ParallelImporter::ParallelImporter(unsigned int numThreads) :
+        mPimpl(new ParallelImporterPimpl(ResolveNumThreads(numThreads))) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+ParallelImporter::~ParallelImporter() {
+    WaitAll();
+    delete mPimpl;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ParallelImporter::GetNumThreads() const {
+    return mPimpl->numThreads;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ParallelImporter::SetIOHandler(IOSystem *pIOHandler) {
+    ai_assert(0 == mPimpl->pending);
+
+    for (Importer *imp : mPimpl->importers) {
+        if (mPimpl->ioHandler) {
+            imp->SetIOHandler(nullptr); // get the previous handler back into the caller's possession
+        }
+        if (pIOHandler) {
+            imp->SetIOHandler(pIOHandler);
+        }
+    }
+    mPimpl->ioHandler = pIOHandler;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ParallelImporter::SetPropertyInteger(const char *szName, int iValue) {
+    return SetGenericProperty<int>(mPimpl->properties.ints, szName, iValue);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ParallelImporter::SetPropertyFloat(const char *szName, ai_real fValue) {
+    return SetGenericProperty<ai_real>(mPimpl->properties.floats, szName, fValue);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ParallelImporter::SetPropertyString(const char *szName, const std::string &sValue) {
+    return SetGenericProperty<std::string>(mPimpl->properties.strings, szName, sValue);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ParallelImporter::SetPropertyMatrix(const char *szName, const aiMatrix4x4 &sValue) {
+    return SetGenericProperty<aiMatrix4x4>(mPimpl->properties.matrices, szName, sValue);
+}
+
+// ------------------------------------------------------------------------------------------------
+std::future<ImportResult> ParallelImporter::ReadFileAsync(const std::string &pFile, unsigned int pFlags) {
+    ParallelImporterPimpl *pimpl = mPimpl;
+    {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        std::lock_guard<std::mutex> lock(pimpl->mutex);
+#endif
+        ++pimpl->pending;
+    }
+
+    return pimpl->pool.Enqueue([pimpl, pFile, pFlags, props = pimpl->properties]() {
+        RequestGuard guard(pimpl);
+        return pimpl->Import(pFile, pFlags, props);
+    });
+}
+
+// ------------------------------------------------------------------------------------------------
+void ParallelImporter::ReadFileAsync(const std::string &pFile, unsigned int pFlags, Callback callback) {
+    ParallelImporterPimpl *pimpl = mPimpl;
+    {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        std::lock_guard<std::mutex> lock(pimpl->mutex);
+#endif
+        ++pimpl->pending;
+    }
+
+    pimpl->pool.Enqueue([pimpl, pFile, pFlags, props = pimpl->properties, callback = std::move(callback)]() {
+        RequestGuard guard(pimpl);
+        ImportResult result = pimpl->Import(pFile, pFlags, props);
+        if (callback) {
+            callback(std::move(result));
+        }
+    });
+}
+
+// ------------------------------------------------------------------------------------------------
+void ParallelImporter::WaitAll() {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    std::unique_lock<std::mutex> lock(mPimpl->mutex);
+    mPimpl->finished.wait(lock, [this]() { return 0 == mPimpl->pending; });
+#endif
+}
+
+} // namespace Assimp
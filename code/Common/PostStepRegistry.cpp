@@ -88,6 +88,10 @@ corresponding preprocessor flag to selectively disable steps.
 #endif
 #ifndef ASSIMP_BUILD_NO_IMPROVECACHELOCALITY_PROCESS
 #   include "PostProcessing/ImproveCacheLocality.h"
+#   include "PostProcessing/OptimizeOverdraw.h"
+#   include "PostProcessing/GenLODs.h"
+#   include "PostProcessing/GenMeshlets.h"
+#   include "PostProcessing/OptimizeVertexFetch.h"
 #endif
 #ifndef ASSIMP_BUILD_NO_FIXINFACINGNORMALS_PROCESS
 #   include "PostProcessing/FixNormalsStep.h"
@@ -256,6 +260,11 @@ void GetPostProcessingStepInstanceList(std::vector< BaseProcess* >& out)
 #endif
 #if (!defined ASSIMP_BUILD_NO_IMPROVECACHELOCALITY_PROCESS)
     out.push_back( new ImproveCacheLocalityProcess());
+    // all work on the output of the cache optimization, the vertices are reordered last
+    out.push_back( new GenLODsProcess());
+    out.push_back( new OptimizeOverdrawProcess());
+    out.push_back( new GenMeshletsProcess());
+    out.push_back( new OptimizeVertexFetchProcess());
 #endif
 #if (!defined ASSIMP_BUILD_NO_GENBOUNDINGBOXES_PROCESS)
     out.push_back(new GenBoundingBoxesProcess);
@@ -0,0 +1,253 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ProbingIOSystem.h
+ *  Implements an IOSystem wrapper used while searching an importer for a file.
+ */
+#pragma once
+#ifndef AI_PROBINGIOSYSTEM_H_INC
+#define AI_PROBINGIOSYSTEM_H_INC
+
+#include <assimp/IOSystem.hpp>
+#include <assimp/IOStream.hpp>
+#include <assimp/MemoryIOWrapper.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief IOSystem wrapper handed to BaseImporter::CanRead() during format
+ *  detection.
+ *
+ *  The head of the probed file is read once and shared by all signature
+ *  checks (BaseImporter::SearchFileHeaderForToken, BaseImporter::CheckMagicToken),
+ *  so asking every registered importer doesn't open and read the file again
+ *  each time. If the whole file fits into the header buffer, opening it for
+ *  reading is served from memory as well. Everything else is forwarded.
+ *
+ *  Streams served from memory may be closed through Close() or deleted
+ *  directly, but must not outlive the ProbingIOSystem as they read from
+ *  its header buffer.
+ */
+class ProbingIOSystem : public IOSystem {
+public:
+    /** Number of bytes cached from the head of the file */
+    static constexpr size_t HeaderSize = 4096;
+
+    // -------------------------------------------------------------------
+    /** Constructor.
+     *  @param file The file being probed.
+     *  @param wrapped The IOSystem to forward all calls to. */
+    ProbingIOSystem(const std::string &file, IOSystem *wrapped) :
+            mWrapped(wrapped),
+            mFile(file),
+            mLoaded(false),
+            mValid(false),
+            mComplete(false) {
+        ai_assert(nullptr != mWrapped);
+    }
+
+    /** Destructor. */
+    ~ProbingIOSystem() override {
+        for (HeaderStream *stream : mStreams) {
+            stream->mOwner = nullptr;
+        }
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the cached head of the given file.
+     *  @param file The file name as passed to CanRead().
+     *  @param size Receives the number of cached bytes.
+     *  @param complete Receives whether the cache holds the entire file.
+     *  @return nullptr if the file is not the probed one or can't be read. */
+    const char *GetHeader(const std::string &file, size_t &size, bool &complete) {
+        if (file != mFile || !Load()) {
+            return nullptr;
+        }
+        size = mHeader.size();
+        complete = mComplete;
+        return mHeader.data();
+    }
+
+    // -------------------------------------------------------------------
+    /** Tests for the existence of a file at the given path. */
+    bool Exists(const char *pFile) const override {
+        return mWrapped->Exists(pFile);
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the directory separator. */
+    char getOsSeparator() const override {
+        return mWrapped->getOsSeparator();
+    }
+
+    // -------------------------------------------------------------------
+    /** Open a new file with a given path. Small probed files are served
+     *  from the header cache. */
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        ai_assert(nullptr != pFile);
+        ai_assert(nullptr != pMode);
+        if (mFile == pFile && nullptr == ::strpbrk(pMode, "wa+") && Load() && mComplete) {
+            mStreams.emplace_back(new HeaderStream(this));
+            return mStreams.back();
+        }
+        return mWrapped->Open(pFile, pMode);
+    }
+
+    // -------------------------------------------------------------------
+    /** Closes the given file and releases all resources associated with it. */
+    void Close(IOStream *pFile) override {
+        if (std::find(mStreams.begin(), mStreams.end(), pFile) != mStreams.end()) {
+            // unregisters itself
+            delete pFile;
+            return;
+        }
+        mWrapped->Close(pFile);
+    }
+
+    // -------------------------------------------------------------------
+    /** Compare two paths */
+    bool ComparePaths(const char *one, const char *second) const override {
+        return mWrapped->ComparePaths(one, second);
+    }
+
+    // -------------------------------------------------------------------
+    /** Pushes a new directory onto the directory stack. */
+    bool PushDirectory(const std::string &path) override {
+        return mWrapped->PushDirectory(path);
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the top directory from the stack. */
+    const std::string &CurrentDirectory() const override {
+        return mWrapped->CurrentDirectory();
+    }
+
+    // -------------------------------------------------------------------
+    /** Returns the number of directories stored on the stack. */
+    size_t StackSize() const override {
+        return mWrapped->StackSize();
+    }
+
+    // -------------------------------------------------------------------
+    /** Pops the top directory from the stack. */
+    bool PopDirectory() override {
+        return mWrapped->PopDirectory();
+    }
+
+    // -------------------------------------------------------------------
+    /** Creates an new directory at the given path. */
+    bool CreateDirectory(const std::string &path) override {
+        return mWrapped->CreateDirectory(path);
+    }
+
+    // -------------------------------------------------------------------
+    /** Will change the current directory to the given path. */
+    bool ChangeDirectory(const std::string &path) override {
+        return mWrapped->ChangeDirectory(path);
+    }
+
+    // -------------------------------------------------------------------
+    /** Delete file. */
+    bool DeleteFile(const std::string &file) override {
+        return mWrapped->DeleteFile(file);
+    }
+
+private:
+    // -------------------------------------------------------------------
+    /** Stream on the header buffer, removed from the list of open streams
+     *  when it is deleted, whether through Close() or not. */
+    class HeaderStream : public MemoryIOStream {
+    public:
+        explicit HeaderStream(ProbingIOSystem *owner) :
+                MemoryIOStream(reinterpret_cast<const uint8_t *>(owner->mHeader.data()), owner->mHeader.size()),
+                mOwner(owner) {
+            // empty
+        }
+
+        ~HeaderStream() override {
+            if (nullptr != mOwner) {
+                std::vector<HeaderStream *> &streams = mOwner->mStreams;
+                streams.erase(std::find(streams.begin(), streams.end(), this));
+            }
+        }
+
+        ProbingIOSystem *mOwner;
+    };
+
+    // -------------------------------------------------------------------
+    /** Reads the head of the probed file on first use. */
+    bool Load() {
+        if (!mLoaded) {
+            mLoaded = true;
+            std::unique_ptr<IOStream> stream(mWrapped->Open(mFile.c_str(), "rb"));
+            if (!stream) {
+                return false;
+            }
+            const size_t fileSize = stream->FileSize();
+            mHeader.resize(std::min(fileSize, HeaderSize));
+            if (!mHeader.empty()) {
+                mHeader.resize(stream->Read(mHeader.data(), 1, mHeader.size()));
+            }
+            mComplete = mHeader.size() == fileSize;
+            mValid = true;
+        }
+        return mValid;
+    }
+
+private:
+    IOSystem *mWrapped;
+    std::string mFile;
+    std::vector<char> mHeader;
+    std::vector<HeaderStream *> mStreams;
+    bool mLoaded;
+    bool mValid;
+    bool mComplete;
+};
+
+} // Namespace Assimp
+
+#endif // AI_PROBINGIOSYSTEM_H_INC
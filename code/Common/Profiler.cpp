@@ -0,0 +1,257 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file  Profiler.cpp
+ *  @brief Implementation of the hierarchical import profiler
+ */
+
+#include <assimp/Profiler.h>
+
+#include <iomanip>
+#include <ostream>
+
+#if defined(_WIN32)
+#   ifndef PSAPI_VERSION
+#       define PSAPI_VERSION 2
+#   endif
+#   include <windows.h>
+#   include <psapi.h>
+#elif defined(__APPLE__)
+#   include <mach/mach.h>
+#   include <sys/resource.h>
+#   include <ctime>
+#else
+#   include <sys/resource.h>
+#   include <unistd.h>
+#   include <cstdio>
+#   include <ctime>
+#endif
+
+namespace Assimp::Profiling {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// CPU time consumed by the process so far, in seconds
+double GetCpuTime() {
+#if defined(_WIN32)
+    FILETIME creation, exit, kernel, user;
+    if (::GetProcessTimes(::GetCurrentProcess(), &creation, &exit, &kernel, &user)) {
+        const auto toTicks = [](const FILETIME &time) {
+            return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+        };
+        return static_cast<double>(toTicks(kernel) + toTicks(user)) * 1e-7;
+    }
+    return 0.0;
+#else
+    return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+// Current resident memory of the process in bytes, 0 if unknown
+uint64_t GetResidentMemory() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.WorkingSetSize;
+    }
+#elif defined(__APPLE__)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (KERN_SUCCESS == ::task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count)) {
+        return info.resident_size;
+    }
+#elif defined(__linux__)
+    if (FILE *file = ::fopen("/proc/self/statm", "r")) {
+        long pages = 0;
+        const int read = ::fscanf(file, "%*s %ld", &pages);
+        ::fclose(file);
+        if (1 == read) {
+            return static_cast<uint64_t>(pages) * static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+        }
+    }
+#endif
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Peak resident memory of the process in bytes, 0 if unknown
+uint64_t GetPeakResidentMemory() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (0 != ::getrusage(RUSAGE_SELF, &usage)) {
+        return 0;
+    }
+#   if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#   else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024u;
+#   endif
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteJsonString(std::ostream &out, const std::string &str) {
+    out << '"';
+    for (const char c : str) {
+        if ('"' == c || '\\' == c) {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteTraceEvents(std::ostream &out, const ProfileRegion &region, bool &first) {
+    for (const ProfileRegion &child : region.mChildren) {
+        out << (first ? "\n" : ",\n");
+        first = false;
+        out << "{\"name\":";
+        WriteJsonString(out, child.mName);
+        out << ",\"cat\":\"assimp\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+            << ",\"ts\":" << child.mStartTime * 1e6
+            << ",\"dur\":" << child.mWallTime * 1e6
+            << ",\"args\":{\"cpu_ms\":" << child.mCpuTime * 1e3
+            << ",\"memory_delta\":" << child.mMemoryDelta
+            << ",\"peak_memory\":" << child.mPeakMemory << "}}";
+        WriteTraceEvents(out, child, first);
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+Profiler::Profiler() :
+        mCreated(std::chrono::steady_clock::now()) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::BeginRegion(const std::string &region) {
+    ProfileRegion &parent = mOpen.empty() ? mRoot : *mOpen.back().mRegion;
+    const auto now = std::chrono::steady_clock::now();
+
+    parent.mChildren.emplace_back();
+    ProfileRegion &current = parent.mChildren.back();
+    current.mName = region;
+    current.mStartTime = std::chrono::duration<double>(now - mCreated).count();
+
+    // Only the innermost region gets new children, so the pointer stays valid while it's open
+    mOpen.push_back({ &current, now, GetCpuTime(), GetResidentMemory() });
+    ASSIMP_LOG_DEBUG("START `", region, "`");
+}
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::EndRegion(const std::string &region) {
+    size_t index = mOpen.size();
+    while (index > 0 && mOpen[index - 1].mRegion->mName != region) {
+        --index;
+    }
+    if (0 == index) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    const double cpu = GetCpuTime();
+    const uint64_t memory = GetResidentMemory();
+    const uint64_t peak = GetPeakResidentMemory();
+    while (mOpen.size() >= index) {
+        const OpenRegion &open = mOpen.back();
+        ProfileRegion &current = *open.mRegion;
+        current.mWallTime = std::chrono::duration<double>(now - open.mStart).count();
+        current.mCpuTime = cpu - open.mCpuStart;
+        current.mMemoryDelta = static_cast<int64_t>(memory) - static_cast<int64_t>(open.mMemoryStart);
+        current.mPeakMemory = peak;
+        ASSIMP_LOG_DEBUG("END   `", current.mName, "`, dt= ", current.mWallTime, " s");
+        mOpen.pop_back();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+const ProfileRegion *Profiler::FindRegion(const std::string &path) const {
+    const ProfileRegion *current = &mRoot;
+    std::string::size_type begin = 0;
+    while (nullptr != current && begin <= path.length()) {
+        std::string::size_type end = path.find('/', begin);
+        if (std::string::npos == end) {
+            end = path.length();
+        }
+        const std::string name = path.substr(begin, end - begin);
+        const ProfileRegion *next = nullptr;
+        for (auto child = current->mChildren.rbegin(); child != current->mChildren.rend(); ++child) {
+            if (child->mName == name) {
+                next = &*child;
+                break;
+            }
+        }
+        current = next;
+        begin = end + 1;
+    }
+    return current;
+}
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::WriteChromeTrace(std::ostream &out) const {
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    bool first = true;
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    WriteTraceEvents(out, mRoot, first);
+    out << "\n]}\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+} // namespace Assimp::Profiling
@@ -52,6 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
   */
 // ----------------------------------------------------------------------------
 #include "ScenePrivate.h"
+#include "Material/MaterialSystem.h"
 #include <assimp/Hash.h>
 #include <assimp/SceneCombiner.h>
 #include <assimp/StringUtils.h>
@@ -92,6 +93,43 @@ inline void PrefixString(aiString &string, const char *prefix, unsigned int len)
     string.length += len;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Keep only the first of each set of identical materials and remap the meshes to it
+inline void MergeEqualMaterials(aiScene *dest) {
+    std::vector<uint32_t> hashes(dest->mNumMaterials);
+    for (unsigned int i = 0; i < dest->mNumMaterials; ++i) {
+        hashes[i] = ComputeMaterialHash(dest->mMaterials[i]);
+    }
+    std::vector<unsigned int> firstEqual;
+    FindEqualMaterials(dest->mMaterials, hashes.data(), dest->mNumMaterials, firstEqual);
+
+    std::vector<unsigned int> remap(dest->mNumMaterials);
+    unsigned int num = 0;
+    for (unsigned int i = 0; i < dest->mNumMaterials; ++i) {
+        if (firstEqual[i] == i) {
+            remap[i] = num;
+            dest->mMaterials[num++] = dest->mMaterials[i];
+        } else {
+            remap[i] = remap[firstEqual[i]];
+            delete dest->mMaterials[i];
+        }
+    }
+    if (num == dest->mNumMaterials) {
+        return;
+    }
+    for (unsigned int i = num; i < dest->mNumMaterials; ++i) {
+        dest->mMaterials[i] = nullptr;
+    }
+    ASSIMP_LOG_DEBUG("SceneCombiner: Merged ", dest->mNumMaterials - num, " identical materials");
+    dest->mNumMaterials = num;
+
+    for (unsigned int i = 0; i < dest->mNumMeshes; ++i) {
+        if (dest->mMeshes[i] != nullptr && dest->mMeshes[i]->mMaterialIndex < remap.size()) {
+            dest->mMeshes[i]->mMaterialIndex = remap[dest->mMeshes[i]->mMaterialIndex];
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Add node identifiers to a hashing set
 void SceneCombiner::AddNodeHashes(aiNode *node, std::set<unsigned int> &hashes) {
@@ -485,6 +523,11 @@ void SceneCombiner::MergeScenes(aiScene **_dest, aiScene *master, std::vector<At
         }
     }
 
+    // store identical materials of all scenes only once
+    if (flags & AI_INT_MERGE_SCENE_DEDUP_MATERIALS && dest->mNumMaterials > 1) {
+        MergeEqualMaterials(dest);
+    }
+
     std::vector<NodeAttachmentInfo> nodes;
     nodes.reserve(srcList.size());
 
@@ -1118,6 +1161,14 @@ void SceneCombiner::Copy(aiMesh **_dest, const aiMesh *src) {
     // make a deep copy of all blend shapes
     CopyPtrArray(dest->mAnimMeshes, dest->mAnimMeshes, dest->mNumAnimMeshes);
 
+    // make a deep copy of the meshlets
+    GetArrayCopy(dest->mMeshlets, dest->mNumMeshlets);
+    GetArrayCopy(dest->mMeshletVertices, dest->mNumMeshletVertices);
+    GetArrayCopy(dest->mMeshletTriangles, dest->mNumFaces * 3);
+
+    // make a deep copy of all LODs
+    CopyPtrArray(dest->mLODs, dest->mLODs, dest->mNumLODs);
+
     // make a deep copy of all texture coordinate names
     if (src->mTextureCoordsNames != nullptr) {
         dest->mTextureCoordsNames = new aiString *[AI_MAX_NUMBER_OF_TEXTURECOORDS] {};
@@ -1127,6 +1178,21 @@ void SceneCombiner::Copy(aiMesh **_dest, const aiMesh *src) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+void SceneCombiner::Copy(aiMeshLOD **_dest, const aiMeshLOD *src) {
+    if (nullptr == _dest || nullptr == src) {
+        return;
+    }
+
+    aiMeshLOD *dest = *_dest = new aiMeshLOD();
+
+    // get a flat copy
+    *dest = *src;
+
+    // and reallocate the faces
+    GetArrayCopy(dest->mFaces, dest->mNumFaces);
+}
+
 // ------------------------------------------------------------------------------------------------
 void SceneCombiner::Copy(aiAnimMesh **_dest, const aiAnimMesh *src) {
     if (nullptr == _dest || nullptr == src) {
@@ -0,0 +1,137 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  SimdAVX.cpp
+ *  @brief The AVX variants of the batch vector kernels.
+ *
+ *  This file is the only one built with AVX code generation, see
+ *  code/CMakeLists.txt. It must not include anything which instantiates
+ *  inline functions shared with the rest of the library, simd.cpp only
+ *  calls into it after checking the CPU.
+ */
+#include "SimdKernels.h"
+
+#if defined(__AVX__)
+#   include <immintrin.h>
+#endif
+
+namespace Assimp {
+namespace SIMD {
+
+#if defined(__AVX__)
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Eight positions per step. The 256 bit shuffles work on both 128 bit halves
+// independently, so each half gets four positions and the SSE2 shuffle
+// sequence is reused as it is.
+struct AVX {
+    using V = __m256;
+    static constexpr size_t Width = 8;
+
+    static V Set1(float f) { return _mm256_set1_ps(f); }
+    static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+    static V Sub(V a, V b) { return _mm256_sub_ps(a, b); }
+    static V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+    static V Div(V a, V b) { return _mm256_div_ps(a, b); }
+    static V Sqrt(V a) { return _mm256_sqrt_ps(a); }
+    static V And(V a, V b) { return _mm256_and_ps(a, b); }
+    // b where mask is clear, 0 where it is set
+    static V AndNot(V mask, V b) { return _mm256_andnot_ps(mask, b); }
+    static V CmpEq(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    // a < b ? a : b, so a NaN in a is skipped
+    static V Min(V a, V b) { return _mm256_min_ps(a, b); }
+    static V Max(V a, V b) { return _mm256_max_ps(a, b); }
+    static bool AnyGreaterEqual(V a, V b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ)) != 0; }
+    static V Load(const float *p) { return _mm256_loadu_ps(p); }
+    static void Store(float *p, V v) { _mm256_storeu_ps(p, v); }
+
+    static V Load2(const float *lo, const float *hi) {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);
+    }
+
+    static void Store2(float *lo, float *hi, V v) {
+        _mm_storeu_ps(lo, _mm256_castps256_ps128(v));
+        _mm_storeu_ps(hi, _mm256_extractf128_ps(v, 1));
+    }
+
+    static void Load3(const float *p, V &x, V &y, V &z) {
+        const V q0 = Load2(p, p + 12), q1 = Load2(p + 4, p + 16), q2 = Load2(p + 8, p + 20);
+        x = _mm256_shuffle_ps(q0, _mm256_shuffle_ps(q1, q2, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm256_shuffle_ps(_mm256_shuffle_ps(q0, q1, _MM_SHUFFLE(0, 0, 1, 1)),
+                _mm256_shuffle_ps(q1, q2, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm256_shuffle_ps(_mm256_shuffle_ps(q0, q1, _MM_SHUFFLE(1, 1, 2, 2)), q2, _MM_SHUFFLE(3, 0, 2, 0));
+    }
+
+    static void Store3(float *p, V x, V y, V z) {
+        const V q0 = _mm256_shuffle_ps(_mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+                _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const V q1 = _mm256_shuffle_ps(_mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+                _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const V q2 = _mm256_shuffle_ps(_mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+                _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        Store2(p, p + 12, q0);
+        Store2(p + 4, p + 16, q1);
+        Store2(p + 8, p + 20, q2);
+    }
+};
+
+} // Namespace
+
+// ------------------------------------------------------------------------------------------------
+const KernelTable *GetAVXKernels() {
+    static const KernelTable table = MakeKernelTable<AVX>();
+    return &table;
+}
+
+#else
+
+// ------------------------------------------------------------------------------------------------
+const KernelTable *GetAVXKernels() {
+    return nullptr;
+}
+
+#endif // __AVX__
+
+} // Namespace SIMD
+} // Namespace Assimp
@@ -0,0 +1,336 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  SimdKernels.h
+ *  @brief Batch vector kernels, written once and instantiated per instruction set.
+ *
+ *  Internal header, only to be included by simd.cpp and SimdAVX.cpp. The
+ *  latter is compiled with different code generation flags, which is why all
+ *  kernels live in an anonymous namespace: the instantiations of both
+ *  translation units must never be merged by the linker.
+ *
+ *  The vectorized kernels evaluate exactly the same expressions in the same
+ *  order as the scalar ones (no fused multiply-add), so every instruction set
+ *  produces bit-identical results.
+ */
+#pragma once
+#ifndef AI_SIMD_KERNELS_H_INC
+#define AI_SIMD_KERNELS_H_INC
+
+#include <cstddef>
+#include <math.h>
+
+namespace Assimp {
+namespace SIMD {
+
+/// Kernel entry points for one instruction set. Vectors are tightly packed
+/// xyz triples, matrices are given row-major (3x4 for positions, 3x3 for
+/// directions).
+struct KernelTable {
+    void (*transformPositions)(const float *mat, const float *in, float *out, size_t count);
+    void (*transformDirections)(const float *mat, const float *in, float *out, size_t count, bool normalize);
+    void (*scaleVectors)(float *data, size_t count, const float *scale);
+    void (*extendBounds)(const float *in, size_t count, float *min, float *max);
+    bool (*compareVectors)(const float *a, const float *b, size_t count, float epsilon);
+    void (*interpolateLinear)(const float *a, const float *b, const float *num, const float *den, float *out, size_t count);
+};
+
+/// Returns the AVX kernels, or nullptr if the build does not contain them.
+const KernelTable *GetAVXKernels();
+
+namespace {
+
+// Deliberately the C functions: an inline std::sqrt instantiated with AVX code
+// generation could end up being used by the rest of the library.
+inline float ScalarSqrt(float v) {
+    return ::sqrtf(v);
+}
+
+inline double ScalarSqrt(double v) {
+    return ::sqrt(v);
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename TReal>
+void ScalarTransformPositions(const TReal *m, const TReal *in, TReal *out, size_t count) {
+    for (size_t i = 0; i < count; ++i, in += 3, out += 3) {
+        const TReal x = in[0], y = in[1], z = in[2];
+        out[0] = m[0] * x + m[1] * y + m[2] * z + m[3];
+        out[1] = m[4] * x + m[5] * y + m[6] * z + m[7];
+        out[2] = m[8] * x + m[9] * y + m[10] * z + m[11];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename TReal>
+void ScalarTransformDirections(const TReal *m, const TReal *in, TReal *out, size_t count, bool normalize) {
+    for (size_t i = 0; i < count; ++i, in += 3, out += 3) {
+        const TReal x = in[0], y = in[1], z = in[2];
+        TReal rx = m[0] * x + m[1] * y + m[2] * z;
+        TReal ry = m[3] * x + m[4] * y + m[5] * z;
+        TReal rz = m[6] * x + m[7] * y + m[8] * z;
+        if (normalize) {
+            // same as aiVector3D::Normalize(), zero vectors stay untouched
+            const TReal l = ScalarSqrt(rx * rx + ry * ry + rz * rz);
+            if (l != 0) {
+                const TReal inv = TReal(1.0) / l;
+                rx *= inv;
+                ry *= inv;
+                rz *= inv;
+            }
+        }
+        out[0] = rx;
+        out[1] = ry;
+        out[2] = rz;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename TReal>
+void ScalarScaleVectors(TReal *data, size_t count, const TReal *scale) {
+    for (size_t i = 0; i < count; ++i, data += 3) {
+        data[0] *= scale[0];
+        data[1] *= scale[1];
+        data[2] *= scale[2];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename TReal>
+void ScalarExtendBounds(const TReal *in, size_t count, TReal *min, TReal *max) {
+    for (size_t i = 0; i < count; ++i, in += 3) {
+        for (unsigned int c = 0; c < 3; ++c) {
+            if (in[c] < min[c]) {
+                min[c] = in[c];
+            }
+            if (in[c] > max[c]) {
+                max[c] = in[c];
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename TReal>
+bool ScalarCompareVectors(const TReal *a, const TReal *b, size_t count, TReal epsilon) {
+    for (size_t i = 0; i < count; ++i, a += 3, b += 3) {
+        const TReal dx = a[0] - b[0], dy = a[1] - b[1], dz = a[2] - b[2];
+        if (dx * dx + dy * dy + dz * dz >= epsilon) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename TReal>
+void ScalarInterpolateLinear(const TReal *a, const TReal *b, const TReal *num, const TReal *den, TReal *out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const TReal factor = den[i] == TReal(0) ? TReal(0) : num[i] / den[i];
+        out[i] = a[i] + (b[i] - a[i]) * factor;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// The vectorized kernels. Isa provides a vector type V holding Width floats,
+// the arithmetic on it, Load() / Store() of Width consecutive floats and
+// Load3() / Store3() which convert Width packed xyz triples from and to one
+// vector per component.
+// ------------------------------------------------------------------------------------------------
+template <class Isa>
+void TransformPositionsKernel(const float *m, const float *in, float *out, size_t count) {
+    using V = typename Isa::V;
+    V r[12];
+    for (unsigned int k = 0; k < 12; ++k) {
+        r[k] = Isa::Set1(m[k]);
+    }
+
+    size_t i = 0;
+    for (; i + Isa::Width <= count; i += Isa::Width) {
+        V x, y, z;
+        Isa::Load3(in + 3 * i, x, y, z);
+        const V rx = Isa::Add(Isa::Add(Isa::Add(Isa::Mul(r[0], x), Isa::Mul(r[1], y)), Isa::Mul(r[2], z)), r[3]);
+        const V ry = Isa::Add(Isa::Add(Isa::Add(Isa::Mul(r[4], x), Isa::Mul(r[5], y)), Isa::Mul(r[6], z)), r[7]);
+        const V rz = Isa::Add(Isa::Add(Isa::Add(Isa::Mul(r[8], x), Isa::Mul(r[9], y)), Isa::Mul(r[10], z)), r[11]);
+        Isa::Store3(out + 3 * i, rx, ry, rz);
+    }
+    ScalarTransformPositions(m, in + 3 * i, out + 3 * i, count - i);
+}
+
+// ------------------------------------------------------------------------------------------------
+template <class Isa>
+void TransformDirectionsKernel(const float *m, const float *in, float *out, size_t count, bool normalize) {
+    using V = typename Isa::V;
+    V r[9];
+    for (unsigned int k = 0; k < 9; ++k) {
+        r[k] = Isa::Set1(m[k]);
+    }
+    const V zero = Isa::Set1(0.f), one = Isa::Set1(1.f);
+
+    size_t i = 0;
+    for (; i + Isa::Width <= count; i += Isa::Width) {
+        V x, y, z;
+        Isa::Load3(in + 3 * i, x, y, z);
+        V rx = Isa::Add(Isa::Add(Isa::Mul(r[0], x), Isa::Mul(r[1], y)), Isa::Mul(r[2], z));
+        V ry = Isa::Add(Isa::Add(Isa::Mul(r[3], x), Isa::Mul(r[4], y)), Isa::Mul(r[5], z));
+        V rz = Isa::Add(Isa::Add(Isa::Mul(r[6], x), Isa::Mul(r[7], y)), Isa::Mul(r[8], z));
+        if (normalize) {
+            V l = Isa::Sqrt(Isa::Add(Isa::Add(Isa::Mul(rx, rx), Isa::Mul(ry, ry)), Isa::Mul(rz, rz)));
+            // zero length: divide by one instead, which keeps the vector as it is
+            l = Isa::Add(l, Isa::And(Isa::CmpEq(l, zero), one));
+            const V inv = Isa::Div(one, l);
+            rx = Isa::Mul(rx, inv);
+            ry = Isa::Mul(ry, inv);
+            rz = Isa::Mul(rz, inv);
+        }
+        Isa::Store3(out + 3 * i, rx, ry, rz);
+    }
+    ScalarTransformDirections(m, in + 3 * i, out + 3 * i, count - i, normalize);
+}
+
+// ------------------------------------------------------------------------------------------------
+template <class Isa>
+void ScaleVectorsKernel(float *data, size_t count, const float *scale) {
+    using V = typename Isa::V;
+    const V sx = Isa::Set1(scale[0]), sy = Isa::Set1(scale[1]), sz = Isa::Set1(scale[2]);
+
+    size_t i = 0;
+    for (; i + Isa::Width <= count; i += Isa::Width) {
+        V x, y, z;
+        Isa::Load3(data + 3 * i, x, y, z);
+        Isa::Store3(data + 3 * i, Isa::Mul(x, sx), Isa::Mul(y, sy), Isa::Mul(z, sz));
+    }
+    ScalarScaleVectors(data + 3 * i, count - i, scale);
+}
+
+// ------------------------------------------------------------------------------------------------
+template <class Isa>
+void ExtendBoundsKernel(const float *in, size_t count, float *min, float *max) {
+    using V = typename Isa::V;
+    V minX = Isa::Set1(min[0]), minY = Isa::Set1(min[1]), minZ = Isa::Set1(min[2]);
+    V maxX = Isa::Set1(max[0]), maxY = Isa::Set1(max[1]), maxZ = Isa::Set1(max[2]);
+
+    size_t i = 0;
+    for (; i + Isa::Width <= count; i += Isa::Width) {
+        V x, y, z;
+        Isa::Load3(in + 3 * i, x, y, z);
+        minX = Isa::Min(x, minX);
+        minY = Isa::Min(y, minY);
+        minZ = Isa::Min(z, minZ);
+        maxX = Isa::Max(x, maxX);
+        maxY = Isa::Max(y, maxY);
+        maxZ = Isa::Max(z, maxZ);
+    }
+
+    // fold the lanes back into the scalar bounds
+    float minLanes[3 * Isa::Width], maxLanes[3 * Isa::Width];
+    Isa::Store3(minLanes, minX, minY, minZ);
+    Isa::Store3(maxLanes, maxX, maxY, maxZ);
+    for (size_t k = 0; k < 3 * Isa::Width; ++k) {
+        if (minLanes[k] < min[k % 3]) {
+            min[k % 3] = minLanes[k];
+        }
+        if (maxLanes[k] > max[k % 3]) {
+            max[k % 3] = maxLanes[k];
+        }
+    }
+    ScalarExtendBounds(in + 3 * i, count - i, min, max);
+}
+
+// ------------------------------------------------------------------------------------------------
+template <class Isa>
+bool CompareVectorsKernel(const float *a, const float *b, size_t count, float epsilon) {
+    using V = typename Isa::V;
+    const V e = Isa::Set1(epsilon);
+
+    size_t i = 0;
+    for (; i + Isa::Width <= count; i += Isa::Width) {
+        V ax, ay, az, bx, by, bz;
+        Isa::Load3(a + 3 * i, ax, ay, az);
+        Isa::Load3(b + 3 * i, bx, by, bz);
+        const V dx = Isa::Sub(ax, bx), dy = Isa::Sub(ay, by), dz = Isa::Sub(az, bz);
+        const V d = Isa::Add(Isa::Add(Isa::Mul(dx, dx), Isa::Mul(dy, dy)), Isa::Mul(dz, dz));
+        if (Isa::AnyGreaterEqual(d, e)) {
+            return false;
+        }
+    }
+    return ScalarCompareVectors(a + 3 * i, b + 3 * i, count - i, epsilon);
+}
+
+// ------------------------------------------------------------------------------------------------
+template <class Isa>
+void InterpolateLinearKernel(const float *a, const float *b, const float *num, const float *den, float *out, size_t count) {
+    using V = typename Isa::V;
+    const V zero = Isa::Set1(0.f), one = Isa::Set1(1.f);
+
+    size_t i = 0;
+    for (; i + Isa::Width <= count; i += Isa::Width) {
+        const V va = Isa::Load(a + i), vb = Isa::Load(b + i);
+        V n = Isa::Load(num + i), d = Isa::Load(den + i);
+        // zero span: 0 / 1 instead, which gives the factor of the scalar code. The numerator is
+        // masked rather than subtracted from itself, which would turn an infinite one into NaN.
+        const V isZero = Isa::CmpEq(d, zero);
+        n = Isa::AndNot(isZero, n);
+        d = Isa::Add(d, Isa::And(isZero, one));
+        Isa::Store(out + i, Isa::Add(va, Isa::Mul(Isa::Sub(vb, va), Isa::Div(n, d))));
+    }
+    ScalarInterpolateLinear(a + i, b + i, num + i, den + i, out + i, count - i);
+}
+
+// ------------------------------------------------------------------------------------------------
+template <class Isa>
+KernelTable MakeKernelTable() {
+    return KernelTable{
+        &TransformPositionsKernel<Isa>,
+        &TransformDirectionsKernel<Isa>,
+        &ScaleVectorsKernel<Isa>,
+        &ExtendBoundsKernel<Isa>,
+        &CompareVectorsKernel<Isa>,
+        &InterpolateLinearKernel<Isa>
+    };
+}
+
+} // Namespace
+} // Namespace SIMD
+} // Namespace Assimp
+
+#endif // AI_SIMD_KERNELS_H_INC
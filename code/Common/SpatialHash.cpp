@@ -0,0 +1,346 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file Implementation of the grid-based helper class to quickly find vertices close to a given position */
+
+#include <assimp/SpatialHash.h>
+#include <assimp/ai_assert.h>
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
+using namespace Assimp;
+
+namespace {
+
+// Keeps cell coordinates far away from integer overflow when they are combined
+const ai_real MaxCellCoord = ai_real(1 << 20);
+
+// --------------------------------------------------------------------------------------------
+// Signed-integer representation of a floating-point value, see SpatialSort.cpp for details.
+ai_int ToBinary(const ai_real &pValue) {
+    static_assert(sizeof(ai_int) >= sizeof(ai_real), "sizeof(ai_int) >= sizeof(ai_real)");
+    ai_int binValue = 0;
+    ::memcpy(&binValue, &pValue, sizeof(pValue));
+
+    const ai_int mask = ai_int(1) << (CHAR_BIT * sizeof(ai_int) - 1);
+    if (binValue & mask) {
+        return mask - binValue;
+    }
+    return binValue;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+SpatialHash::SpatialHash() :
+        mOrigin(),
+        mMaxCell{ 0, 0, 0 },
+        mCellSize(1),
+        mInvCellSize(1),
+        mRequestedCellSize(0),
+        mFinalized(false) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+SpatialHash::SpatialHash(const aiVector3D *pPositions, unsigned int pNumPositions, unsigned int pElementOffset) :
+        SpatialHash() {
+    Fill(pPositions, pNumPositions, pElementOffset);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialHash::Fill(const aiVector3D *pPositions, unsigned int pNumPositions,
+        unsigned int pElementOffset,
+        bool pFinalize /*= true */) {
+    mPositions.clear();
+    mBucketStart.clear();
+    mFinalized = false;
+    Append(pPositions, pNumPositions, pElementOffset, pFinalize);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialHash::Append(const aiVector3D *pPositions, unsigned int pNumPositions,
+        unsigned int pElementOffset,
+        bool pFinalize /*= true */) {
+    ai_assert(!mFinalized && "You cannot add positions to the SpatialHash object after it has been finalized.");
+    const size_t initial = mPositions.size();
+    mPositions.reserve(initial + pNumPositions);
+    for (unsigned int a = 0; a < pNumPositions; a++) {
+        const char *tempPointer = reinterpret_cast<const char *>(pPositions);
+        const aiVector3D *vec = reinterpret_cast<const aiVector3D *>(tempPointer + a * pElementOffset);
+        mPositions.emplace_back(static_cast<unsigned int>(a + initial), *vec);
+    }
+
+    if (pFinalize) {
+        Finalize();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialHash::Finalize() {
+    const size_t count = mPositions.size();
+
+    // bounding box of all finite positions, computed per chunk and merged afterwards
+    const ai_real inf = std::numeric_limits<ai_real>::infinity();
+    std::mutex mergeMutex;
+    aiVector3D vMin(inf, inf, inf), vMax(-inf, -inf, -inf);
+    ForEachRange(count, [&](size_t begin, size_t end) {
+        aiVector3D localMin(inf, inf, inf), localMax(-inf, -inf, -inf);
+        for (size_t i = begin; i < end; ++i) {
+            const aiVector3D &p = mPositions[i].mPosition;
+            if (std::isfinite(p.x) && std::isfinite(p.y) && std::isfinite(p.z)) {
+                localMin = aiVector3D(std::min(localMin.x, p.x), std::min(localMin.y, p.y), std::min(localMin.z, p.z));
+                localMax = aiVector3D(std::max(localMax.x, p.x), std::max(localMax.y, p.y), std::max(localMax.z, p.z));
+            }
+        }
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        vMin = aiVector3D(std::min(vMin.x, localMin.x), std::min(vMin.y, localMin.y), std::min(vMin.z, localMin.z));
+        vMax = aiVector3D(std::max(vMax.x, localMax.x), std::max(vMax.y, localMax.y), std::max(vMax.z, localMax.z));
+    });
+    if (vMin.x > vMax.x) {
+        // no finite position at all
+        vMin = vMax = aiVector3D();
+    }
+
+    // Vertices of meshes are spread over surfaces rather than volumes, so n vertices need
+    // about sqrt(n) cells along the largest extent to end up with a few vertices per cell.
+    const aiVector3D extent = vMax - vMin;
+    const ai_real maxExtent = std::max(extent.x, std::max(extent.y, extent.z));
+    mCellSize = mRequestedCellSize;
+    if (mCellSize <= ai_real(0)) {
+        mCellSize = maxExtent / std::sqrt(static_cast<ai_real>(std::max(count, size_t(1))));
+    }
+    mCellSize = std::max(mCellSize, maxExtent / MaxCellCoord);
+    if (!(mCellSize > ai_real(0)) || !std::isfinite(mCellSize)) {
+        mCellSize = ai_real(1);
+    }
+    mInvCellSize = ai_real(1) / mCellSize;
+    mOrigin = vMin;
+    mMaxCell[0] = mMaxCell[1] = mMaxCell[2] = static_cast<int>(MaxCellCoord);
+    GetCell(vMax, mMaxCell);
+
+    // one bucket per position, rounded up to a power of two
+    unsigned int numBuckets = 1;
+    while (numBuckets < count && numBuckets < (1u << 31)) {
+        numBuckets <<= 1;
+    }
+    mBucketStart.assign(static_cast<size_t>(numBuckets) + 1, 0);
+
+    std::vector<unsigned int> buckets(count);
+    ForEachRange(count, [&](size_t begin, size_t end) {
+        int cell[3];
+        for (size_t i = begin; i < end; ++i) {
+            GetCell(mPositions[i].mPosition, cell);
+            buckets[i] = GetBucket(cell);
+        }
+    });
+
+    // counting sort by bucket, stable to keep the entries of a bucket in index order
+    for (size_t i = 0; i < count; ++i) {
+        ++mBucketStart[buckets[i] + 1];
+    }
+    for (size_t i = 1; i < mBucketStart.size(); ++i) {
+        mBucketStart[i] += mBucketStart[i - 1];
+    }
+    std::vector<unsigned int> next(mBucketStart.begin(), mBucketStart.end() - 1);
+    std::vector<Entry> sorted(count);
+    for (size_t i = 0; i < count; ++i) {
+        sorted[next[buckets[i]]++] = mPositions[i];
+    }
+    mPositions.swap(sorted);
+    mFinalized = true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialHash::ForEachRange(size_t pCount, const std::function<void(size_t, size_t)> &pFunc) const {
+    pFunc(size_t(0), pCount);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialHash::GetCell(const aiVector3D &pPosition, int *pCell) const {
+    for (unsigned int i = 0; i < 3; ++i) {
+        ai_real c = (pPosition[i] - mOrigin[i]) * mInvCellSize;
+        // also maps NaN to the first cell
+        c = c >= ai_real(0) ? std::min(c, static_cast<ai_real>(mMaxCell[i])) : ai_real(0);
+        pCell[i] = static_cast<int>(c);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int SpatialHash::GetBucket(const int *pCell) const {
+    const unsigned int h = static_cast<unsigned int>(pCell[0]) * 73856093u ^
+                           static_cast<unsigned int>(pCell[1]) * 19349663u ^
+                           static_cast<unsigned int>(pCell[2]) * 83492791u;
+    return h & static_cast<unsigned int>(mBucketStart.size() - 2);
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename Accept>
+void SpatialHash::Query(const aiVector3D &pPosition, ai_real pRadius, Accept pAccept,
+        std::vector<unsigned int> &poResults) const {
+    // clear the array in this strange fashion because a simple clear() would also deallocate
+    // the array which we want to avoid
+    poResults.resize(0);
+    if (mPositions.empty()) {
+        return;
+    }
+
+    // cells overlapping the search radius, nothing to do if it does not touch the grid at all
+    const aiVector3D vRadius(pRadius, pRadius, pRadius);
+    const aiVector3D lo = pPosition - vRadius, hi = pPosition + vRadius;
+    for (unsigned int i = 0; i < 3; ++i) {
+        if (hi[i] < mOrigin[i] || (lo[i] - mOrigin[i]) * mInvCellSize > static_cast<ai_real>(mMaxCell[i] + 1)) {
+            return;
+        }
+    }
+    int cellLo[3], cellHi[3];
+    GetCell(lo, cellLo);
+    GetCell(hi, cellHi);
+
+    const size_t numCells = size_t(cellHi[0] - cellLo[0] + 1) * size_t(cellHi[1] - cellLo[1] + 1) *
+                            size_t(cellHi[2] - cellLo[2] + 1);
+    if (numCells >= mPositions.size()) {
+        // the radius is huge compared to the cells, just test everything
+        for (const Entry &e : mPositions) {
+            if (pAccept(e.mPosition)) {
+                poResults.push_back(e.mIndex);
+            }
+        }
+        return;
+    }
+
+    // Different cells may share a bucket, each bucket must only be visited once. Queries
+    // usually touch a handful of cells, so a small array is the fastest set.
+    static const size_t MaxLocalBuckets = 64;
+    unsigned int localBuckets[MaxLocalBuckets];
+    std::vector<unsigned int> moreBuckets;
+    size_t numBuckets = 0;
+
+    int cell[3];
+    for (cell[2] = cellLo[2]; cell[2] <= cellHi[2]; ++cell[2]) {
+        for (cell[1] = cellLo[1]; cell[1] <= cellHi[1]; ++cell[1]) {
+            for (cell[0] = cellLo[0]; cell[0] <= cellHi[0]; ++cell[0]) {
+                const unsigned int bucket = GetBucket(cell);
+                if (numCells <= MaxLocalBuckets) {
+                    if (std::find(localBuckets, localBuckets + numBuckets, bucket) != localBuckets + numBuckets) {
+                        continue;
+                    }
+                    localBuckets[numBuckets++] = bucket;
+                } else {
+                    moreBuckets.push_back(bucket);
+                    continue;
+                }
+
+                for (unsigned int i = mBucketStart[bucket]; i < mBucketStart[bucket + 1]; ++i) {
+                    if (pAccept(mPositions[i].mPosition)) {
+                        poResults.push_back(mPositions[i].mIndex);
+                    }
+                }
+            }
+        }
+    }
+
+    if (!moreBuckets.empty()) {
+        std::sort(moreBuckets.begin(), moreBuckets.end());
+        moreBuckets.erase(std::unique(moreBuckets.begin(), moreBuckets.end()), moreBuckets.end());
+        for (const unsigned int bucket : moreBuckets) {
+            for (unsigned int i = mBucketStart[bucket]; i < mBucketStart[bucket + 1]; ++i) {
+                if (pAccept(mPositions[i].mPosition)) {
+                    poResults.push_back(mPositions[i].mIndex);
+                }
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialHash::FindPositions(const aiVector3D &pPosition,
+        ai_real pRadius, std::vector<unsigned int> &poResults) const {
+    ai_assert(mFinalized && "The SpatialHash object must be finalized before FindPositions can be called.");
+    const ai_real pSquared = pRadius * pRadius;
+    Query(pPosition, pRadius, [&pPosition, pSquared](const aiVector3D &p) {
+        return (p - pPosition).SquareLength() < pSquared;
+    }, poResults);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialHash::FindIdenticalPositions(const aiVector3D &pPosition, std::vector<unsigned int> &poResults) const {
+    ai_assert(mFinalized && "The SpatialHash object must be finalized before FindIdenticalPositions can be called.");
+    // same tolerance as SpatialSort::FindIdenticalPositions, the squared distance of two
+    // positions may be off by a few ULPs from zero
+    static const int distance3DToleranceInULPs = 6;
+
+    // positions this close may still fall into a neighbouring cell
+    const ai_real magnitude = std::max(std::abs(pPosition.x), std::max(std::abs(pPosition.y), std::abs(pPosition.z)));
+    const ai_real margin = (magnitude + ai_real(1)) * std::numeric_limits<ai_real>::epsilon() * 4;
+    Query(pPosition, margin, [&pPosition](const aiVector3D &p) {
+        return distance3DToleranceInULPs >= ToBinary((p - pPosition).SquareLength());
+    }, poResults);
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int SpatialHash::GenerateMappingTable(std::vector<unsigned int> &fill, ai_real pRadius) const {
+    ai_assert(mFinalized && "The SpatialHash object must be finalized before GenerateMappingTable can be called.");
+    fill.assign(mPositions.size(), UINT_MAX);
+
+    std::vector<unsigned int> found;
+    unsigned int t = 0;
+    for (const Entry &e : mPositions) {
+        if (fill[e.mIndex] != UINT_MAX) {
+            continue;
+        }
+        fill[e.mIndex] = t;
+        FindPositions(e.mPosition, pRadius, found);
+        for (const unsigned int index : found) {
+            if (fill[index] == UINT_MAX) {
+                fill[index] = t;
+            }
+        }
+        ++t;
+    }
+    return t;
+}
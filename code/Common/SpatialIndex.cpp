@@ -0,0 +1,72 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file SpatialIndex.cpp
+ *  @brief Implementation of the threaded SpatialHash.
+ */
+
+#include "Common/SpatialIndex.h"
+#include "Common/ThreadPool.h"
+
+#include <algorithm>
+
+using namespace Assimp;
+
+namespace {
+
+// Data sets smaller than this are always hashed on the calling thread
+const size_t ParallelThreshold = 1 << 16;
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+void ThreadedSpatialHash::ForEachRange(size_t pCount, const std::function<void(size_t, size_t)> &pFunc) const {
+    if (nullptr == mThreadPool || 0 == mThreadPool->GetNumWorkers() || pCount < ParallelThreshold) {
+        pFunc(size_t(0), pCount);
+        return;
+    }
+    const size_t numChunks = static_cast<size_t>(mThreadPool->GetNumWorkers()) + 1;
+    const size_t chunkSize = (pCount + numChunks - 1) / numChunks;
+    mThreadPool->ParallelFor(numChunks, [&](size_t chunk) {
+        const size_t begin = std::min(pCount, chunk * chunkSize);
+        pFunc(begin, std::min(pCount, begin + chunkSize));
+    });
+}
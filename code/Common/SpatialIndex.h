@@ -0,0 +1,130 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file SpatialIndex.h
+ *  @brief Internal helpers to find the vertices close to a position with
+ *  either a SpatialSort or a SpatialHash.
+ */
+#pragma once
+#ifndef AI_SPATIALINDEX_H_INC
+#define AI_SPATIALINDEX_H_INC
+
+#include <assimp/SpatialHash.h>
+#include <assimp/SpatialSort.h>
+
+namespace Assimp {
+
+class ThreadPool;
+
+// ---------------------------------------------------------------------------
+/** @brief A SpatialHash which builds the grid of large data sets on a
+ *  ThreadPool.
+ */
+class ASSIMP_API ThreadedSpatialHash : public SpatialHash {
+public:
+    // -------------------------------------------------------------------
+    /** @param pPool May be nullptr to build the grid on the calling thread. */
+    explicit ThreadedSpatialHash(ThreadPool *pPool = nullptr) :
+            mThreadPool(pPool) {
+        // empty
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Assigns the pool used by the next call to #Finalize(). */
+    void SetThreadPool(ThreadPool *pPool) {
+        mThreadPool = pPool;
+    }
+
+protected:
+    void ForEachRange(size_t pCount, const std::function<void(size_t, size_t)> &pFunc) const override;
+
+private:
+    ThreadPool *mThreadPool;
+};
+
+// ---------------------------------------------------------------------------
+/** @brief The spatial index shared by the normal and tangent generation
+ *  steps. Uses a SpatialSort unless #AI_CONFIG_PP_USE_SPATIAL_HASH asks
+ *  for a SpatialHash.
+ */
+class SpatialIndex {
+public:
+    SpatialIndex() :
+            mUseHash(false) {
+        // empty
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Builds the index over a tightly packed position array.
+     *  @param pUseHash Use a SpatialHash instead of a SpatialSort.
+     *  @param pPool Pool to build a SpatialHash on, may be nullptr.
+     */
+    void Fill(const aiVector3D *pPositions, unsigned int pNumPositions, bool pUseHash, ThreadPool *pPool) {
+        mUseHash = pUseHash;
+        if (mUseHash) {
+            mHash.SetThreadPool(pPool);
+            mHash.Fill(pPositions, pNumPositions, sizeof(aiVector3D));
+            mHash.SetThreadPool(nullptr);
+        } else {
+            mSort.Fill(pPositions, pNumPositions, sizeof(aiVector3D));
+        }
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Same as SpatialSort::FindPositions(). */
+    void FindPositions(const aiVector3D &pPosition, ai_real pRadius,
+            std::vector<unsigned int> &poResults) const {
+        if (mUseHash) {
+            mHash.FindPositions(pPosition, pRadius, poResults);
+        } else {
+            mSort.FindPositions(pPosition, pRadius, poResults);
+        }
+    }
+
+private:
+    SpatialSort mSort;
+    ThreadedSpatialHash mHash;
+    bool mUseHash;
+};
+
+} // namespace Assimp
+
+#endif // AI_SPATIALINDEX_H_INC
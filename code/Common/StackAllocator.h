@@ -86,6 +86,48 @@ private:
     std::vector<uint8_t *> m_storageBlocks;  // A list of blocks
 };
 
+/** @brief Standard library allocator which takes its memory from a StackAllocator,
+ *      so containers of parsed data do not allocate from the heap per element.
+ *      deallocate() is a no-op, the memory is released with the StackAllocator.
+*/
+template <typename T>
+class StackAllocatorAdapter {
+public:
+    using value_type = T;
+
+    /// @brief Constructs the adapter, the allocator must outlive all containers using it
+    explicit StackAllocatorAdapter(StackAllocator &allocator) noexcept :
+            m_allocator(&allocator) {}
+
+    template <typename U>
+    StackAllocatorAdapter(const StackAllocatorAdapter<U> &other) noexcept :
+            m_allocator(other.m_allocator) {}
+
+    T *allocate(size_t n) {
+        return static_cast<T *>(m_allocator->Allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *, size_t) noexcept {
+        // memory is owned by the StackAllocator
+    }
+
+    template <typename U>
+    bool operator==(const StackAllocatorAdapter<U> &other) const noexcept {
+        return m_allocator == other.m_allocator;
+    }
+
+    template <typename U>
+    bool operator!=(const StackAllocatorAdapter<U> &other) const noexcept {
+        return m_allocator != other.m_allocator;
+    }
+
+private:
+    template <typename U>
+    friend class StackAllocatorAdapter;
+
+    StackAllocator *m_allocator;
+};
+
 } // namespace Assimp
 
 /// @brief Fixes an undefined reference error when linking in certain build environments.
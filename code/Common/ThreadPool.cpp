@@ -0,0 +1,218 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ThreadPool.cpp
+ *  @brief Implementation of the ThreadPool class.
+ */
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+ThreadPool::ThreadPool(unsigned int numWorkers)
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+        : mWorkers(), mTasks(), mMutex(), mCondition(), mStop(false) {
+    mWorkers.reserve(numWorkers);
+    for (unsigned int i = 0; i < numWorkers; ++i) {
+        mWorkers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+#else
+{
+    (void)numWorkers;
+}
+#endif
+
+// ------------------------------------------------------------------------------------------------
+ThreadPool::~ThreadPool() {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mCondition.notify_all();
+    for (std::thread &worker : mWorkers) {
+        worker.join();
+    }
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ThreadPool::GetNumWorkers() const {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    return static_cast<unsigned int>(mWorkers.size());
+#else
+    return 0;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ThreadPool::GetHardwareConcurrency() {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    const unsigned int num = std::thread::hardware_concurrency();
+    return num > 0 ? num : 1;
+#else
+    return 1;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::Push(std::function<void()> task) {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    if (!mWorkers.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mTasks.push_back(std::move(task));
+        }
+        mCondition.notify_one();
+        return;
+    }
+#endif
+    task();
+}
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::WorkerLoop() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this]() { return mStop || !mTasks.empty(); });
+
+            // pending tasks are still run on shutdown so no future is left dangling
+            if (mTasks.empty()) {
+                return;
+            }
+            task = std::move(mTasks.front());
+            mTasks.pop_front();
+        }
+        task();
+    }
+}
+#endif
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Bookkeeping shared between the caller of ParallelFor and the helper tasks. Helpers may be
+// dequeued after ParallelFor has returned, so the state is reference counted.
+struct ParallelForState {
+    std::atomic<size_t> next{ 0 };
+    std::atomic<size_t> done{ 0 };
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    std::mutex mutex;
+    std::condition_variable finished;
+#endif
+    size_t failedIndex = std::numeric_limits<size_t>::max();
+    std::exception_ptr error;
+};
+
+// ------------------------------------------------------------------------------------------------
+void RunIterations(ParallelForState &state, size_t count, const std::function<void(size_t)> &fn) {
+    for (;;) {
+        const size_t i = state.next.fetch_add(1);
+        if (i >= count) {
+            return;
+        }
+
+        try {
+            fn(i);
+        } catch (...) {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+            std::lock_guard<std::mutex> lock(state.mutex);
+#endif
+            if (i < state.failedIndex) {
+                state.failedIndex = i;
+                state.error = std::current_exception();
+            }
+        }
+
+        if (state.done.fetch_add(1) + 1 == count) {
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.finished.notify_all();
+#endif
+        }
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)> &fn) {
+    if (count == 0) {
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>();
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    // the calling thread does its share of the work, so we need at most count-1 helpers
+    const size_t numHelpers = std::min(mWorkers.size(), count - 1);
+    for (size_t i = 0; i < numHelpers; ++i) {
+        Push([state, count, &fn]() {
+            RunIterations(*state, count, fn);
+        });
+    }
+#endif
+
+    RunIterations(*state, count, fn);
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finished.wait(lock, [&state, count]() { return state->done.load() == count; });
+    }
+#endif
+
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+} // Namespace Assimp
@@ -0,0 +1,141 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ThreadPool.h
+ *  @brief A small worker pool used to run independent pieces of work
+ *  (e.g. per-mesh post-processing) concurrently.
+ */
+#pragma once
+#ifndef AI_THREADPOOL_H_INC
+#define AI_THREADPOOL_H_INC
+
+#include <assimp/defs.h>
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+#   include <condition_variable>
+#   include <deque>
+#   include <mutex>
+#   include <thread>
+#endif
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief A fixed-size pool of worker threads.
+ *
+ *  Tasks are executed in FIFO order. A pool without workers (or a build with
+ *  ASSIMP_BUILD_SINGLETHREADED defined) runs every task inline on the calling
+ *  thread, so callers never need a separate serial code path.
+ */
+class ASSIMP_API ThreadPool {
+public:
+    // -------------------------------------------------------------------
+    /** @brief Creates the pool and starts the worker threads.
+     *  @param numWorkers Number of worker threads to spawn. 0 means that
+     *    all work is done on the calling thread.
+     */
+    explicit ThreadPool(unsigned int numWorkers);
+
+    // -------------------------------------------------------------------
+    /** @brief Runs all pending tasks, then joins the worker threads. */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the number of worker threads owned by the pool. */
+    unsigned int GetNumWorkers() const;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the number of hardware threads, at least 1. */
+    static unsigned int GetHardwareConcurrency();
+
+    // -------------------------------------------------------------------
+    /** @brief Schedules a task for execution.
+     *  @param func Callable without arguments.
+     *  @return A future holding the result or the exception thrown by
+     *    the task.
+     */
+    template <typename Func>
+    auto Enqueue(Func &&func) -> std::future<decltype(func())> {
+        using ResultType = decltype(func());
+        auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<Func>(func));
+        std::future<ResultType> result = task->get_future();
+        Push([task]() { (*task)(); });
+        return result;
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Calls fn(i) for every i in [0, count) and waits for all
+     *  calls to finish.
+     *
+     *  The calling thread takes part in the work, so it is safe to nest
+     *  ParallelFor calls inside tasks of the same pool. If one or more
+     *  calls throw, the exception of the lowest index is rethrown once
+     *  all calls have finished, which keeps error reporting deterministic.
+     *  @param count Number of iterations.
+     *  @param fn    Function to invoke for each iteration.
+     */
+    void ParallelFor(size_t count, const std::function<void(size_t)> &fn);
+
+private:
+    void Push(std::function<void()> task);
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    void WorkerLoop();
+
+    std::vector<std::thread> mWorkers;
+    std::deque<std::function<void()>> mTasks;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStop;
+#endif
+};
+
+} // Namespace Assimp
+
+#endif // AI_THREADPOOL_H_INC
@@ -90,6 +90,8 @@ ASSIMP_API unsigned int aiGetCompileFlags() {
 #endif
 #ifdef ASSIMP_BUILD_SINGLETHREADED
     flags |= ASSIMP_CFLAGS_SINGLETHREADED;
+#else
+    flags |= ASSIMP_CFLAGS_MULTITHREADED;
 #endif
 #ifdef ASSIMP_BUILD_DEBUG
     flags |= ASSIMP_CFLAGS_DEBUG;
@@ -39,6 +39,27 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ---------------------------------------------------------------------------
 */
 #include "simd.h"
+#include "SimdKernels.h"
+
+#include <atomic>
+#include <initializer_list>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define AI_SIMD_HAS_SSE2
+#   include <emmintrin.h>
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#   define AI_SIMD_HAS_NEON
+#   include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#   include <cpuid.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#   include <intrin.h>
+#   include <immintrin.h>
+#endif
 
 namespace Assimp {
 
@@ -73,5 +94,294 @@ bool CPUSupportsSSE2() {
 #endif
 }
 
+bool CPUSupportsAVX() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    unsigned int a, b, c, d;
+    if (!__get_cpuid(1, &a, &b, &c, &d)) {
+        return false;
+    }
+    // the CPU needs AVX, the OS must have enabled XSAVE ...
+    if ((c & (1u << 27)) == 0 || (c & (1u << 28)) == 0) {
+        return false;
+    }
+    // ... and save the upper halves of the YMM registers
+    unsigned int lo, hi;
+    __asm__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return (lo & 0x6) == 0x6;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4];
+    __cpuid(info, 1);
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) {
+        return false;
+    }
+    return (_xgetbv(0) & 0x6) == 0x6;
+#else
+    return false;
+#endif
+}
+
+namespace SIMD {
+
+namespace {
+
+#ifdef AI_SIMD_HAS_SSE2
+// ------------------------------------------------------------------------------------------------
+// Four positions per step: three unaligned loads, then shuffled to one register per component.
+struct SSE2 {
+    using V = __m128;
+    static constexpr size_t Width = 4;
+
+    static V Set1(float f) { return _mm_set1_ps(f); }
+    static V Add(V a, V b) { return _mm_add_ps(a, b); }
+    static V Sub(V a, V b) { return _mm_sub_ps(a, b); }
+    static V Mul(V a, V b) { return _mm_mul_ps(a, b); }
+    static V Div(V a, V b) { return _mm_div_ps(a, b); }
+    static V Sqrt(V a) { return _mm_sqrt_ps(a); }
+    static V And(V a, V b) { return _mm_and_ps(a, b); }
+    // b where mask is clear, 0 where it is set
+    static V AndNot(V mask, V b) { return _mm_andnot_ps(mask, b); }
+    static V CmpEq(V a, V b) { return _mm_cmpeq_ps(a, b); }
+    // a < b ? a : b, so a NaN in a is skipped
+    static V Min(V a, V b) { return _mm_min_ps(a, b); }
+    static V Max(V a, V b) { return _mm_max_ps(a, b); }
+    static bool AnyGreaterEqual(V a, V b) { return _mm_movemask_ps(_mm_cmpge_ps(a, b)) != 0; }
+    static V Load(const float *p) { return _mm_loadu_ps(p); }
+    static void Store(float *p, V v) { _mm_storeu_ps(p, v); }
+
+    static void Load3(const float *p, V &x, V &y, V &z) {
+        // q0 = x0 y0 z0 x1, q1 = y1 z1 x2 y2, q2 = z2 x3 y3 z3
+        const V q0 = _mm_loadu_ps(p), q1 = _mm_loadu_ps(p + 4), q2 = _mm_loadu_ps(p + 8);
+        x = _mm_shuffle_ps(q0, _mm_shuffle_ps(q1, q2, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm_shuffle_ps(_mm_shuffle_ps(q0, q1, _MM_SHUFFLE(0, 0, 1, 1)),
+                _mm_shuffle_ps(q1, q2, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm_shuffle_ps(_mm_shuffle_ps(q0, q1, _MM_SHUFFLE(1, 1, 2, 2)), q2, _MM_SHUFFLE(3, 0, 2, 0));
+    }
+
+    static void Store3(float *p, V x, V y, V z) {
+        const V q0 = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+                _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const V q1 = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+                _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const V q2 = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+                _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        _mm_storeu_ps(p, q0);
+        _mm_storeu_ps(p + 4, q1);
+        _mm_storeu_ps(p + 8, q2);
+    }
+};
+#endif // AI_SIMD_HAS_SSE2
+
+#ifdef AI_SIMD_HAS_NEON
+// ------------------------------------------------------------------------------------------------
+// AArch64 only, vld3q / vst3q do the component split in hardware.
+struct NEON {
+    using V = float32x4_t;
+    static constexpr size_t Width = 4;
+
+    static V Set1(float f) { return vdupq_n_f32(f); }
+    static V Add(V a, V b) { return vaddq_f32(a, b); }
+    static V Sub(V a, V b) { return vsubq_f32(a, b); }
+    static V Mul(V a, V b) { return vmulq_f32(a, b); }
+    static V Div(V a, V b) { return vdivq_f32(a, b); }
+    static V Sqrt(V a) { return vsqrtq_f32(a); }
+    static V And(V a, V b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+    static V AndNot(V mask, V b) { return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(b), vreinterpretq_u32_f32(mask))); }
+    static V CmpEq(V a, V b) { return vreinterpretq_f32_u32(vceqq_f32(a, b)); }
+    // the NaN-ignoring variants, like the scalar code
+    static V Min(V a, V b) { return vminnmq_f32(a, b); }
+    static V Max(V a, V b) { return vmaxnmq_f32(a, b); }
+    static bool AnyGreaterEqual(V a, V b) { return vmaxvq_u32(vcgeq_f32(a, b)) != 0; }
+    static V Load(const float *p) { return vld1q_f32(p); }
+    static void Store(float *p, V v) { vst1q_f32(p, v); }
+
+    static void Load3(const float *p, V &x, V &y, V &z) {
+        const float32x4x3_t v = vld3q_f32(p);
+        x = v.val[0];
+        y = v.val[1];
+        z = v.val[2];
+    }
+
+    static void Store3(float *p, V x, V y, V z) {
+        float32x4x3_t v;
+        v.val[0] = x;
+        v.val[1] = y;
+        v.val[2] = z;
+        vst3q_f32(p, v);
+    }
+};
+#endif // AI_SIMD_HAS_NEON
+
+#ifndef ASSIMP_DOUBLE_PRECISION
+// ------------------------------------------------------------------------------------------------
+// Kernel tables by instruction set, nullptr if not available. Resolved once, the
+// CPU feature checks are too slow to run per call.
+struct Backends {
+    const KernelTable *tables[4] = {};
+
+    Backends() {
+#ifdef AI_SIMD_HAS_SSE2
+        static const KernelTable sse2 = MakeKernelTable<SSE2>();
+        if (CPUSupportsSSE2()) {
+            tables[static_cast<int>(InstructionSet::SSE2)] = &sse2;
+        }
+#endif
+        if (CPUSupportsAVX()) {
+            tables[static_cast<int>(InstructionSet::AVX)] = GetAVXKernels();
+        }
+#ifdef AI_SIMD_HAS_NEON
+        static const KernelTable neon = MakeKernelTable<NEON>();
+        tables[static_cast<int>(InstructionSet::NEON)] = &neon;
+#endif
+    }
+};
+
+const Backends &GetBackends() {
+    static const Backends backends;
+    return backends;
+}
+#endif // ASSIMP_DOUBLE_PRECISION
+
+// ------------------------------------------------------------------------------------------------
+InstructionSet SelectBestInstructionSet() {
+    for (InstructionSet set : { InstructionSet::AVX, InstructionSet::SSE2, InstructionSet::NEON }) {
+        if (IsInstructionSetSupported(set)) {
+            return set;
+        }
+    }
+    return InstructionSet::Scalar;
+}
+
+std::atomic<InstructionSet> &ActiveInstructionSet() {
+    static std::atomic<InstructionSet> active(SelectBestInstructionSet());
+    return active;
+}
+
+#ifndef ASSIMP_DOUBLE_PRECISION
+const KernelTable *ActiveKernels() {
+    return GetBackends().tables[static_cast<int>(ActiveInstructionSet().load(std::memory_order_relaxed))];
+}
+#endif
+
+inline const ai_real *Data(const aiVector3D *v) {
+    return &v->x;
+}
+
+inline ai_real *Data(aiVector3D *v) {
+    return &v->x;
+}
+
+} // Namespace
+
+static_assert(sizeof(aiVector3D) == 3 * sizeof(ai_real), "aiVector3D must be tightly packed");
+
+// ------------------------------------------------------------------------------------------------
+InstructionSet GetInstructionSet() {
+    return ActiveInstructionSet().load(std::memory_order_relaxed);
+}
+
+// ------------------------------------------------------------------------------------------------
+InstructionSet SetInstructionSet(InstructionSet set) {
+    if (!IsInstructionSetSupported(set)) {
+        set = InstructionSet::Scalar;
+    }
+    ActiveInstructionSet().store(set, std::memory_order_relaxed);
+    return set;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool IsInstructionSetSupported(InstructionSet set) {
+    if (set == InstructionSet::Scalar) {
+        return true;
+    }
+#ifdef ASSIMP_DOUBLE_PRECISION
+    // the vector kernels are single precision only
+    return false;
+#else
+    const int index = static_cast<int>(set);
+    return index >= 0 && index < 4 && GetBackends().tables[index] != nullptr;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+const char *GetInstructionSetName(InstructionSet set) {
+    switch (set) {
+    case InstructionSet::Scalar:
+        return "Scalar";
+    case InstructionSet::SSE2:
+        return "SSE2";
+    case InstructionSet::AVX:
+        return "AVX";
+    case InstructionSet::NEON:
+        return "NEON";
+    }
+    return "<unknown>";
+}
+
+// ------------------------------------------------------------------------------------------------
+void TransformPositions(const aiMatrix4x4 &mat, const aiVector3D *in, aiVector3D *out, size_t count) {
+#ifndef ASSIMP_DOUBLE_PRECISION
+    if (const KernelTable *kernels = ActiveKernels()) {
+        kernels->transformPositions(&mat.a1, Data(in), Data(out), count);
+        return;
+    }
+#endif
+    ScalarTransformPositions(&mat.a1, Data(in), Data(out), count);
+}
+
+// ------------------------------------------------------------------------------------------------
+void TransformDirections(const aiMatrix3x3 &mat, const aiVector3D *in, aiVector3D *out, size_t count, bool normalize) {
+#ifndef ASSIMP_DOUBLE_PRECISION
+    if (const KernelTable *kernels = ActiveKernels()) {
+        kernels->transformDirections(&mat.a1, Data(in), Data(out), count, normalize);
+        return;
+    }
+#endif
+    ScalarTransformDirections(&mat.a1, Data(in), Data(out), count, normalize);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ScaleVectors(aiVector3D *data, size_t count, const aiVector3D &scale) {
+#ifndef ASSIMP_DOUBLE_PRECISION
+    if (const KernelTable *kernels = ActiveKernels()) {
+        kernels->scaleVectors(Data(data), count, Data(&scale));
+        return;
+    }
+#endif
+    ScalarScaleVectors(Data(data), count, Data(&scale));
+}
+
+// ------------------------------------------------------------------------------------------------
+void ExtendBounds(const aiVector3D *in, size_t count, aiVector3D &min, aiVector3D &max) {
+#ifndef ASSIMP_DOUBLE_PRECISION
+    if (const KernelTable *kernels = ActiveKernels()) {
+        kernels->extendBounds(Data(in), count, Data(&min), Data(&max));
+        return;
+    }
+#endif
+    ScalarExtendBounds(Data(in), count, Data(&min), Data(&max));
+}
+
+// ------------------------------------------------------------------------------------------------
+bool CompareVectors(const aiVector3D *a, const aiVector3D *b, size_t count, ai_real epsilon) {
+#ifndef ASSIMP_DOUBLE_PRECISION
+    if (const KernelTable *kernels = ActiveKernels()) {
+        return kernels->compareVectors(Data(a), Data(b), count, epsilon);
+    }
+#endif
+    return ScalarCompareVectors(Data(a), Data(b), count, epsilon);
+}
+
+// ------------------------------------------------------------------------------------------------
+void InterpolateLinear(const ai_real *a, const ai_real *b, const ai_real *num, const ai_real *den,
+        ai_real *out, size_t count) {
+#ifndef ASSIMP_DOUBLE_PRECISION
+    if (const KernelTable *kernels = ActiveKernels()) {
+        kernels->interpolateLinear(a, b, num, den, out, count);
+        return;
+    }
+#endif
+    ScalarInterpolateLinear(a, b, num, den, out, count);
+}
 
+} // Namespace SIMD
 } // Namespace Assimp
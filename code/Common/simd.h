@@ -41,6 +41,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <assimp/defs.h>
+#include <assimp/vector3.h>
+#include <assimp/matrix3x3.h>
+#include <assimp/matrix4x4.h>
+
+#include <cstddef>
 
 namespace Assimp {
 
@@ -48,4 +53,62 @@ namespace Assimp {
 /// @return true, if SSE2 is supported. false if SSE2 is not supported.
 bool ASSIMP_API CPUSupportsSSE2();
 
+/// @brief  Checks if the platform supports AVX optimization
+/// @return true, if the CPU and the operating system support AVX.
+bool ASSIMP_API CPUSupportsAVX();
+
+namespace SIMD {
+
+/// @brief  The instruction sets the batch kernels below can run on.
+enum class InstructionSet {
+    Scalar,
+    SSE2,
+    AVX,
+    NEON
+};
+
+/// @brief  Returns the instruction set the batch kernels currently use.
+///
+/// The best supported one is selected on first use.
+ASSIMP_API InstructionSet GetInstructionSet();
+
+/// @brief  Selects the instruction set for the batch kernels.
+///
+/// Meant for tests and benchmarks. Falls back to the scalar kernels if
+/// the requested set is not available on this CPU or in this build.
+/// @return The instruction set which is actually in use afterwards.
+ASSIMP_API InstructionSet SetInstructionSet(InstructionSet set);
+
+/// @brief  Returns true if the given instruction set can be selected.
+ASSIMP_API bool IsInstructionSetSupported(InstructionSet set);
+
+/// @brief  Returns a readable name for an instruction set.
+ASSIMP_API const char *GetInstructionSetName(InstructionSet set);
+
+// All kernels produce the same results as the scalar aiVector3D / aiMatrix
+// operators they replace. In and out arrays may be identical, but must not
+// overlap partially.
+
+/// @brief  out[i] = mat * in[i] for count positions.
+ASSIMP_API void TransformPositions(const aiMatrix4x4 &mat, const aiVector3D *in, aiVector3D *out, size_t count);
+
+/// @brief  out[i] = mat * in[i] for count directions, optionally followed
+///         by aiVector3D::Normalize(). Pass the inverse transpose for normals.
+ASSIMP_API void TransformDirections(const aiMatrix3x3 &mat, const aiVector3D *in, aiVector3D *out, size_t count, bool normalize);
+
+/// @brief  Component-wise multiplication of count vectors by scale, in place.
+ASSIMP_API void ScaleVectors(aiVector3D *data, size_t count, const aiVector3D &scale);
+
+/// @brief  Grows the box [min, max] to enclose count positions. NaNs are ignored.
+ASSIMP_API void ExtendBounds(const aiVector3D *in, size_t count, aiVector3D &min, aiVector3D &max);
+
+/// @brief  Returns true if (a[i] - b[i]).SquareLength() < epsilon for all i.
+ASSIMP_API bool CompareVectors(const aiVector3D *a, const aiVector3D *b, size_t count, ai_real epsilon);
+
+/// @brief  out[i] = a[i] + (b[i] - a[i]) * (num[i] / den[i]) for count values,
+///         with a factor of zero where den[i] is zero.
+ASSIMP_API void InterpolateLinear(const ai_real *a, const ai_real *b, const ai_real *num, const ai_real *den,
+        ai_real *out, size_t count);
+
+} // Namespace SIMD
 } // Namespace Assimp
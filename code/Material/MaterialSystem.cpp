@@ -52,6 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <memory>
 #include <cstring>
+#include <unordered_map>
 
 using namespace Assimp;
 
@@ -606,6 +607,66 @@ uint32_t Assimp::ComputeMaterialHash(const aiMaterial *mat, bool includeMatName
     return hash;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool Assimp::CompareMaterials(const aiMaterial *a, const aiMaterial *b, bool includeMatName /*= false*/) {
+    // walk both property lists in step, skipping the same properties ComputeMaterialHash() skips
+    auto skip = [includeMatName](const aiMaterialProperty *prop) {
+        return nullptr == prop || (!includeMatName && prop->mKey.data[0] == '?');
+    };
+    unsigned int i = 0, k = 0;
+    for (;; ++i, ++k) {
+        while (i < a->mNumProperties && skip(a->mProperties[i])) {
+            ++i;
+        }
+        while (k < b->mNumProperties && skip(b->mProperties[k])) {
+            ++k;
+        }
+        if (i == a->mNumProperties || k == b->mNumProperties) {
+            break;
+        }
+        const aiMaterialProperty *pa = a->mProperties[i], *pb = b->mProperties[k];
+        if (pa->mKey != pb->mKey || pa->mSemantic != pb->mSemantic || pa->mIndex != pb->mIndex ||
+                pa->mType != pb->mType || pa->mDataLength != pb->mDataLength ||
+                0 != ::memcmp(pa->mData, pb->mData, pa->mDataLength)) {
+            return false;
+        }
+    }
+    return i == a->mNumProperties && k == b->mNumProperties;
+}
+
+// ------------------------------------------------------------------------------------------------
+void Assimp::FindEqualMaterials(const aiMaterial *const *mats, const uint32_t *hashes, unsigned int num,
+        std::vector<unsigned int> &firstEqual) {
+    firstEqual.resize(num);
+
+    // the first material with each hash, further distinct materials with the same hash are chained
+    std::unordered_map<uint32_t, unsigned int> firstWithHash;
+    firstWithHash.reserve(num);
+    std::vector<unsigned int> nextWithHash(num, UINT_MAX);
+    for (unsigned int i = 0; i < num; ++i) {
+        firstEqual[i] = i;
+        if (nullptr == mats[i]) {
+            continue;
+        }
+        auto it = firstWithHash.emplace(hashes[i], i);
+        if (it.second) {
+            continue;
+        }
+        unsigned int a = it.first->second;
+        for (;;) {
+            if (CompareMaterials(mats[a], mats[i])) {
+                firstEqual[i] = a;
+                break;
+            }
+            if (nextWithHash[a] == UINT_MAX) {
+                nextWithHash[a] = i;
+                break;
+            }
+            a = nextWithHash[a];
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 void aiMaterial::CopyPropertyList(aiMaterial *const pcDest,
         const aiMaterial *pcSrc) {
@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_MATERIALSYSTEM_H_INC
 
 #include <stdint.h>
+#include <vector>
 
 struct aiMaterial;
 
@@ -65,6 +66,31 @@ namespace Assimp {
  */
 uint32_t ComputeMaterialHash(const aiMaterial* mat, bool includeMatName = false);
 
+// ------------------------------------------------------------------------------
+/** Checks whether two materials have exactly the same properties.
+ *  The properties are compared in order, by key, semantic, index, type and
+ *  data. Materials which compare equal have the same ComputeMaterialHash().
+ *
+ *  @param  includeMatName Set to 'true' to take all properties with
+ *    '?' as initial character in their name into account.
+ *  @return true if the materials are equal
+ */
+bool CompareMaterials(const aiMaterial* a, const aiMaterial* b, bool includeMatName = false);
+
+// ------------------------------------------------------------------------------
+/** Finds the equal materials in a list of materials.
+ *  The materials are looked up by their hash, materials with the same hash are
+ *  checked with CompareMaterials(), so hash collisions are never merged.
+ *
+ *  @param  mats The materials, nullptr entries are skipped.
+ *  @param  hashes ComputeMaterialHash() of each material.
+ *  @param  num Number of materials.
+ *  @param  firstEqual Receives for each material the index of the first
+ *    material equal to it, which is its own index for the first one.
+ */
+void FindEqualMaterials(const aiMaterial* const* mats, const uint32_t* hashes, unsigned int num,
+        std::vector<unsigned int>& firstEqual);
+
 
 } // ! namespace Assimp
 
@@ -91,16 +91,17 @@ namespace Assimp {
 
 void ExportScenePbrt(const char *pFile, IOSystem *pIOSystem, const aiScene *pScene,
         const ExportProperties *) {
-    std::string path = DefaultIOSystem::absolutePath(std::string(pFile));
     std::string file = DefaultIOSystem::completeBaseName(std::string(pFile));
-    std::string texturesPath = path;
-    if (!texturesPath.empty()) {
+    std::string texturesPath;
+    // absolutePath returns a bare file name unchanged, it has no directory
+    if (std::string(pFile).find_last_of("\\/") != std::string::npos) {
+        texturesPath = DefaultIOSystem::absolutePath(std::string(pFile));
         texturesPath+=pIOSystem->getOsSeparator(); 
     }
     texturesPath+="textures";
     
     // initialize the exporter
-    PbrtExporter exporter(pScene, pIOSystem, path, file, texturesPath);
+    PbrtExporter exporter(pScene, pIOSystem, pFile, file, texturesPath);
 }
 
 } // end of namespace Assimp
@@ -117,10 +118,10 @@ static void create_embedded_textures_folder(const aiScene *scene, IOSystem *pIOS
 
 PbrtExporter::PbrtExporter(
         const aiScene *pScene, IOSystem *pIOSystem,
-        const std::string &path, const std::string &file, const std::string &texturesPath) :
+        const std::string &outputFile, const std::string &file, const std::string &texturesPath) :
         mScene(pScene),
         mIOSystem(pIOSystem),
-        mPath(path),
+        mOutputFile(outputFile),
         mFile(file),
         mTexturesPath(texturesPath),
         mRootTransform(
@@ -179,14 +180,8 @@ PbrtExporter::PbrtExporter(
     WriteCameras();
     WriteWorldDefinition();
 
-    // And write the file to disk...
-    std::string outputFilePath = mPath;
-    if (!outputFilePath.empty()) {
-        outputFilePath = outputFilePath + mIOSystem->getOsSeparator();
-    }
-    outputFilePath = outputFilePath + mFile +".pbrt";
-
-    std::unique_ptr<IOStream> outfile(mIOSystem->Open(outputFilePath,"wt"));
+    // And write the file to disk, under the name the caller asked for
+    std::unique_ptr<IOStream> outfile(mIOSystem->Open(mOutputFile,"wt"));
     if (!outfile) {
         throw DeadlyExportError("could not open output .pbrt file: " + std::string(mFile));
     }
@@ -198,6 +193,9 @@ void PbrtExporter::WriteMetaData() {
     mOutput << "# Scene metadata:\n";
 
     aiMetadata* pMetaData = mScene->mMetaData;
+    if (pMetaData == nullptr) {
+        return;
+    }
     for (unsigned int i = 0; i < pMetaData->mNumProperties; i++) {
         mOutput << "# - ";
         mOutput << pMetaData->mKeys[i].C_Str() << " :";
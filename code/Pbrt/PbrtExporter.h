@@ -74,7 +74,7 @@ class PbrtExporter {
 public:
     /// Constructor for a specific scene to export
     PbrtExporter(const aiScene *pScene, IOSystem *pIOSystem,
-            const std::string &path, const std::string &file, const std::string &texturesPath);
+            const std::string &outputFile, const std::string &file, const std::string &texturesPath);
 
     /// Destructor
     virtual ~PbrtExporter() = default;
@@ -108,8 +108,8 @@ private:
     /// The IOSystem for output
     IOSystem* mIOSystem;
 
-    /// Path of the directory where the scene will be exported
-    const std::string mPath;
+    /// Path of the file the scene is written to
+    const std::string mOutputFile;
 
     /// Name of the file (without extension) where the scene will be exported
     const std::string mFile;
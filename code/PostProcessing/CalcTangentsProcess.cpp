@@ -47,16 +47,19 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // internal headers
 #include "CalcTangentsProcess.h"
+#include "MikkTSpace.h"
 #include "ProcessHelper.h"
 #include <assimp/TinyFormatter.h>
 #include <assimp/qnan.h>
 
+#include <atomic>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 CalcTangentsProcess::CalcTangentsProcess() :
-        configMaxAngle(float(AI_DEG_TO_RAD(45.f))), configSourceUV(0) {
+        configMaxAngle(float(AI_DEG_TO_RAD(45.f))), configSourceUV(0), configMikkTSpace(false), configSpatialHash(false) {
     // nothing to do here
 }
 
@@ -66,6 +69,12 @@ bool CalcTangentsProcess::IsActive(unsigned int pFlags) const {
     return (pFlags & aiProcess_CalcTangentSpace) != 0;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently from each other.
+bool CalcTangentsProcess::IsMeshLocal() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void CalcTangentsProcess::SetupProperties(const Importer *pImp) {
@@ -77,6 +86,8 @@ void CalcTangentsProcess::SetupProperties(const Importer *pImp) {
     configMaxAngle = AI_DEG_TO_RAD(configMaxAngle);
 
     configSourceUV = pImp->GetPropertyInteger(AI_CONFIG_PP_CT_TEXTURE_CHANNEL_INDEX, 0);
+    configMikkTSpace = pImp->GetPropertyBool(AI_CONFIG_PP_CT_MIKKTSPACE, false);
+    configSpatialHash = pImp->GetPropertyBool(AI_CONFIG_PP_USE_SPATIAL_HASH, false);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -86,10 +97,12 @@ void CalcTangentsProcess::Execute(aiScene *pScene) {
 
     ASSIMP_LOG_DEBUG("CalcTangentsProcess begin");
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; a++) {
-        if (ProcessMesh(pScene->mMeshes[a], a)) bHas = true;
-    }
+    std::atomic<bool> bHas(false);
+    ForEachMesh(pScene, [this, pScene, &bHas](unsigned int a) {
+        if (ProcessMesh(pScene->mMeshes[a], a)) {
+            bHas = true;
+        }
+    });
 
     if (bHas) {
         ASSIMP_LOG_INFO("CalcTangentsProcess finished. Tangents have been calculated");
@@ -127,6 +140,11 @@ bool CalcTangentsProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshIndex) {
         return false;
     }
 
+    // MikkTSpace welds the vertices itself and doesn't need the smoothing pass below
+    if (configMikkTSpace) {
+        return ComputeMikkTSpace(pMesh, configSourceUV, threadPool);
+    }
+
     const float angleEpsilon = 0.9999f;
 
     std::vector<bool> vertexDone(pMesh->mNumVertices, false);
@@ -221,21 +239,21 @@ bool CalcTangentsProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshIndex) {
     }
 
     // create a helper to quickly find locally close vertices among the vertex array
-    // FIX: check whether we can reuse the SpatialSort of a previous step
-    SpatialSort *vertexFinder = nullptr;
-    SpatialSort _vertexFinder;
-    float posEpsilon = 10e-6f;
+    // check whether we can reuse the SpatialSort of a previous step
+    SpatialIndex *vertexFinder = nullptr;
+    SpatialIndex _vertexFinder;
+    ai_real posEpsilon = ai_real(10e-6);
     if (shared) {
-        std::vector<std::pair<SpatialSort, float>> *avf;
+        std::vector<std::pair<SpatialIndex, ai_real>> *avf;
         shared->GetProperty(AI_SPP_SPATIAL_SORT, avf);
         if (avf) {
-            std::pair<SpatialSort, float> &blubb = avf->operator[](meshIndex);
+            std::pair<SpatialIndex, ai_real> &blubb = avf->operator[](meshIndex);
             vertexFinder = &blubb.first;
             posEpsilon = blubb.second;
         }
     }
     if (!vertexFinder) {
-        _vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, sizeof(aiVector3D));
+        _vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, configSpatialHash, threadPool);
         vertexFinder = &_vertexFinder;
         posEpsilon = ComputePositionEpsilon(pMesh);
     }
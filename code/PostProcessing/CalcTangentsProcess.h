@@ -58,7 +58,7 @@ namespace Assimp
  * because the joining of vertices also considers tangents and bitangents for
  * uniqueness.
  */
-class ASSIMP_API_WINONLY CalcTangentsProcess final : public BaseProcess {
+class ASSIMP_API CalcTangentsProcess final : public BaseProcess {
 public:
     CalcTangentsProcess();
     ~CalcTangentsProcess() override = default;
@@ -72,6 +72,12 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** The step only works on one mesh at a time, so meshes may be
+    *  processed concurrently.
+    */
+    bool IsMeshLocal() const override;
+
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
     * The function is a request to the process to update its configuration
@@ -84,6 +90,16 @@ public:
         configMaxAngle =f;
     }
 
+    // setter for configMikkTSpace
+    void SetMikkTSpace(bool enable) {
+        configMikkTSpace = enable;
+    }
+
+    // setter for configSpatialHash
+    void SetSpatialHash(bool enable) {
+        configSpatialHash = enable;
+    }
+
 protected:
     // -------------------------------------------------------------------
     /** Calculates tangents and bitangents for a specific mesh.
@@ -102,6 +118,12 @@ private:
     /** Configuration option: maximum smoothing angle, in radians*/
     float configMaxAngle;
     unsigned int configSourceUV;
+
+    /** Configuration option: compute the tangent space like MikkTSpace does */
+    bool configMikkTSpace;
+
+    /** Configuration option: find close vertices with a SpatialHash */
+    bool configSpatialHash;
 };
 
 } // end of namespace Assimp
@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
 #include "ConvertToLHProcess.h"
+#include "Common/simd.h"
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
@@ -150,28 +151,30 @@ void MakeLeftHandedProcess::ProcessMesh(aiMesh *pMesh) {
         return;
     }
     // mirror positions, normals and stuff along the Z axis
-    for (size_t a = 0; a < pMesh->mNumVertices; ++a) {
-        pMesh->mVertices[a].z *= -1.0f;
-        if (pMesh->HasNormals()) {
-            pMesh->mNormals[a].z *= -1.0f;
-        }
-        if (pMesh->HasTangentsAndBitangents()) {
-            pMesh->mTangents[a].z *= -1.0f;
-            pMesh->mBitangents[a].z *= -1.0f;
-        }
+    const aiVector3D mirrorZ(1.0f, 1.0f, -1.0f);
+    SIMD::ScaleVectors(pMesh->mVertices, pMesh->mNumVertices, mirrorZ);
+    if (pMesh->HasNormals()) {
+        SIMD::ScaleVectors(pMesh->mNormals, pMesh->mNumVertices, mirrorZ);
+    }
+    if (pMesh->HasTangentsAndBitangents()) {
+        SIMD::ScaleVectors(pMesh->mTangents, pMesh->mNumVertices, mirrorZ);
+        // mirror bitangents as well as they're derived from the texture coords,
+        // combined with the Z mirroring into a single pass
+        SIMD::ScaleVectors(pMesh->mBitangents, pMesh->mNumVertices, aiVector3D(-1.0f, -1.0f, 1.0f));
     }
 
     // mirror anim meshes positions, normals and stuff along the Z axis
     for (size_t m = 0; m < pMesh->mNumAnimMeshes; ++m) {
-        for (size_t a = 0; a < pMesh->mAnimMeshes[m]->mNumVertices; ++a) {
-            pMesh->mAnimMeshes[m]->mVertices[a].z *= -1.0f;
-            if (pMesh->mAnimMeshes[m]->HasNormals()) {
-                pMesh->mAnimMeshes[m]->mNormals[a].z *= -1.0f;
-            }
-            if (pMesh->mAnimMeshes[m]->HasTangentsAndBitangents()) {
-                pMesh->mAnimMeshes[m]->mTangents[a].z *= -1.0f;
-                pMesh->mAnimMeshes[m]->mBitangents[a].z *= -1.0f;
-            }
+        aiAnimMesh *animMesh = pMesh->mAnimMeshes[m];
+        if (animMesh->HasPositions()) {
+            SIMD::ScaleVectors(animMesh->mVertices, animMesh->mNumVertices, mirrorZ);
+        }
+        if (animMesh->HasNormals()) {
+            SIMD::ScaleVectors(animMesh->mNormals, animMesh->mNumVertices, mirrorZ);
+        }
+        if (animMesh->HasTangentsAndBitangents()) {
+            SIMD::ScaleVectors(animMesh->mTangents, animMesh->mNumVertices, mirrorZ);
+            SIMD::ScaleVectors(animMesh->mBitangents, animMesh->mNumVertices, mirrorZ);
         }
     }
 
@@ -185,12 +188,6 @@ void MakeLeftHandedProcess::ProcessMesh(aiMesh *pMesh) {
         bone->mOffsetMatrix.c2 = -bone->mOffsetMatrix.c2;
         bone->mOffsetMatrix.c4 = -bone->mOffsetMatrix.c4;
     }
-
-    // mirror bitangents as well as they're derived from the texture coords
-    if (pMesh->HasTangentsAndBitangents()) {
-        for (unsigned int a = 0; a < pMesh->mNumVertices; a++)
-            pMesh->mBitangents[a] *= -1.0f;
-    }
 }
 
 // ------------------------------------------------------------------------------------------------
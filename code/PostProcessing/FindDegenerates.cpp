@@ -50,6 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exceptional.h>
 
 #include <unordered_map>
+#include <vector>
 
 using namespace Assimp;
 
@@ -70,6 +71,12 @@ bool FindDegeneratesProcess::IsActive(unsigned int pFlags) const {
     return 0 != (pFlags & aiProcess_FindDegenerates);
 }
 
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently from each other.
+bool FindDegeneratesProcess::IsMeshLocal() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Setup import configuration
 void FindDegeneratesProcess::SetupProperties(const Importer *pImp) {
@@ -89,11 +96,19 @@ void FindDegeneratesProcess::Execute(aiScene *pScene) {
     std::unordered_map<unsigned int, unsigned int> meshMap;
     meshMap.reserve(pScene->mNumMeshes);
 
+    // Find the degenerated meshes first, then compact the mesh array in order
+    std::vector<char> removeMesh(pScene->mNumMeshes, 0);
+    ForEachMesh(pScene, [this, pScene, &removeMesh](unsigned int i) {
+        // Do not process point cloud, ExecuteOnMesh works only with faces data
+        if (pScene->mMeshes[i]->mPrimitiveTypes != aiPrimitiveType::aiPrimitiveType_POINT) {
+            removeMesh[i] = ExecuteOnMesh(pScene->mMeshes[i]);
+        }
+    });
+
     const unsigned int originalNumMeshes = pScene->mNumMeshes;
     unsigned int targetIndex = 0;
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
-        // Do not process point cloud, ExecuteOnMesh works only with faces data
-        if ((pScene->mMeshes[i]->mPrimitiveTypes != aiPrimitiveType::aiPrimitiveType_POINT) && ExecuteOnMesh(pScene->mMeshes[i])) {
+        if (removeMesh[i]) {
             delete pScene->mMeshes[i];
             // Not strictly required, but clean:
             pScene->mMeshes[i] = nullptr;
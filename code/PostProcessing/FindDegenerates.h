@@ -64,6 +64,10 @@ public:
     // Check whether step is active
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    // Meshes are processed independently from each other
+    bool IsMeshLocal() const override;
+
     // -------------------------------------------------------------------
     // Execute step on a given scene
     void Execute( aiScene* pScene) override;
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_FINDINSTANCES_H_INC
 
 #include "Common/BaseProcess.h"
+#include "Common/simd.h"
 #include "PostProcessing/ProcessHelper.h"
 
 class FindInstancesProcessTest;
@@ -84,11 +85,7 @@ inline uint64_t GetMeshHash(aiMesh* in) {
  */
 inline bool CompareArrays(const aiVector3D* first, const aiVector3D* second,
         unsigned int size, float e) {
-    for (const aiVector3D* end = first+size; first != end; ++first,++second) {
-        if ( (*first - *second).SquareLength() >= e)
-            return false;
-    }
-    return true;
+    return SIMD::CompareVectors(first, second, size, e);
 }
 
 // and the same for colors ...
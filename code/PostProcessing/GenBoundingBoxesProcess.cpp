@@ -42,6 +42,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_GENBOUNDINGBOXES_PROCESS
 
 #include "PostProcessing/GenBoundingBoxesProcess.h"
+#include "Common/simd.h"
 
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
@@ -61,28 +62,7 @@ void checkMesh(aiMesh* mesh, aiVector3D& min, aiVector3D& max) {
         return;
     }
 
-    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
-        const aiVector3D &pos = mesh->mVertices[i];
-        if (pos.x < min.x) {
-            min.x = pos.x;
-        }
-        if (pos.y < min.y) {
-            min.y = pos.y;
-        }
-        if (pos.z < min.z) {
-            min.z = pos.z;
-        }
-
-        if (pos.x > max.x) {
-            max.x = pos.x;
-        }
-        if (pos.y > max.y) {
-            max.y = pos.y;
-        }
-        if (pos.z > max.z) {
-            max.z = pos.z;
-        }
-    }
+    SIMD::ExtendBounds(mesh->mVertices, mesh->mNumVertices, min, max);
 }
 
 void GenBoundingBoxesProcess::Execute(aiScene* pScene) {
@@ -0,0 +1,690 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post processing step to generate simplified
+ *  LODs of meshes.
+ */
+
+#include "PostProcessing/GenLODs.h"
+#include "Common/VertexTriangleAdjacency.h"
+
+#include <assimp/ParsingUtils.h>
+#include <assimp/SpatialSort.h>
+#include <assimp/fast_atof.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+
+namespace Assimp {
+namespace {
+    // Topology of a vertex, which decides where it may be collapsed to
+    enum VertexKind : unsigned char {
+        Kind_Manifold, // inner vertex, collapses onto any neighbour
+        Kind_Border,   // vertex of an open border, collapses along the border
+        Kind_Seam,     // vertex with a twin of different attributes, collapses along the seam with it
+        Kind_Locked    // any other vertex, never collapses
+    };
+
+    // Whether a vertex of the first kind may be collapsed onto a vertex of the second
+    const bool CanCollapse[4][4] = {
+        { true, true, true, true },
+        { false, true, false, true },
+        { false, false, true, true },
+        { false, false, false, false },
+    };
+
+    // Open edges are weighted stronger than faces to keep borders and seams in place
+    constexpr double BorderWeight = 10.0;
+
+    // A vertex with completely different bone weights than a neighbour costs as much
+    // to remove as a deviation of a tenth of the mesh extent
+    constexpr double BoneWeightError = 0.1;
+
+    // Faces shrinking below this squared ratio of their area count as degenerate
+    constexpr double DegenerateArea = 1e-8;
+
+    constexpr unsigned int NoVertex = ~0u;
+
+    // Error quadric of a set of weighted planes
+    struct Quadric {
+        double a00 = 0, a11 = 0, a22 = 0, a10 = 0, a20 = 0, a21 = 0;
+        double b0 = 0, b1 = 0, b2 = 0, c = 0, w = 0;
+
+        Quadric() = default;
+
+        // The quadric of the plane n * p + d = 0
+        Quadric(const aiVector3d &n, double d, double weight) :
+                a00(n.x * n.x * weight), a11(n.y * n.y * weight), a22(n.z * n.z * weight),
+                a10(n.x * n.y * weight), a20(n.x * n.z * weight), a21(n.y * n.z * weight),
+                b0(n.x * d * weight), b1(n.y * d * weight), b2(n.z * d * weight), c(d * d * weight), w(weight) {
+            // empty
+        }
+
+        Quadric &operator+=(const Quadric &o) {
+            a00 += o.a00; a11 += o.a11; a22 += o.a22;
+            a10 += o.a10; a20 += o.a20; a21 += o.a21;
+            b0 += o.b0; b1 += o.b1; b2 += o.b2;
+            c += o.c; w += o.w;
+            return *this;
+        }
+
+        // The weighted mean of the squared distances of a point to the planes
+        double Error(const aiVector3d &p) const {
+            if (w <= 0) {
+                return 0;
+            }
+            const double r = a00 * p.x * p.x + a11 * p.y * p.y + a22 * p.z * p.z +
+                    2 * (a10 * p.x * p.y + a20 * p.x * p.z + a21 * p.y * p.z) +
+                    2 * (b0 * p.x + b1 * p.y + b2 * p.z) + c;
+            return std::fabs(r) / w;
+        }
+    };
+
+    // A candidate collapse of the vertex v0 onto v1
+    struct Collapse {
+        unsigned int v0, v1;
+        double error;
+    };
+
+    // ---------------------------------------------------------------------------
+    // Simplifies the faces of a mesh in passes of independent half edge collapses.
+    // The vertices never move, so the result is an index buffer of the mesh.
+    class Simplifier {
+    public:
+        explicit Simplifier(const aiMesh *pMesh);
+
+        // Collapses edges until targetFaces are left or the squared error would exceed maxError
+        void Simplify(unsigned int targetFaces, double maxError);
+
+        // Copies the current faces into a LOD
+        aiMeshLOD *CreateLOD() const;
+
+    private:
+        bool HasEdge(const VertexTriangleAdjacency &adj, unsigned int a, unsigned int b) const;
+        void ClassifyVertices(const VertexTriangleAdjacency &adj);
+        void ComputeQuadrics(const VertexTriangleAdjacency &adj);
+        double GetCollapseError(unsigned int v0, unsigned int v1, unsigned int &s1) const;
+        double GetBoneWeightDistance(unsigned int a, unsigned int b) const;
+        void ComputeBoneWeightSpread();
+        bool HasTriangleFlips(const VertexTriangleAdjacency &adj, unsigned int v0, unsigned int v1) const;
+        unsigned int CountCollapsedTriangles(const VertexTriangleAdjacency &adj, unsigned int v0, unsigned int v1) const;
+        void RemapEdgeLoop(std::vector<unsigned int> &loop) const;
+
+        unsigned int mNumVertices;
+        // positions scaled to the unit cube, so errors are relative to the mesh extent
+        std::vector<aiVector3d> mPositions;
+        // first vertex of each position, and the next vertex of the same position in a cycle
+        std::vector<unsigned int> mRemap, mWedge;
+        // the end of the open edge to and from each vertex, the vertex itself if ambiguous
+        std::vector<unsigned int> mOpenIn, mOpenOut;
+        std::vector<unsigned char> mKind;
+        // quadrics of the first vertex of each position
+        std::vector<Quadric> mQuadrics;
+        // bone weights of each vertex, sorted by bone, and their largest distance to the neighbours
+        std::vector<std::vector<std::pair<unsigned int, ai_real>>> mWeights;
+        std::vector<double> mWeightSpread;
+
+        std::unique_ptr<aiFace[]> mFaces;
+        unsigned int mNumFaces;
+        double mError;
+
+        std::vector<unsigned int> mCollapseRemap;
+        std::vector<bool> mCollapseLocked;
+    };
+
+    // ---------------------------------------------------------------------------
+    Simplifier::Simplifier(const aiMesh *pMesh) :
+            mNumVertices(pMesh->mNumVertices), mNumFaces(pMesh->mNumFaces), mError(0) {
+        aiVector3D min = pMesh->mVertices[0], max = min;
+        for (unsigned int v = 1; v < mNumVertices; ++v) {
+            const aiVector3D &p = pMesh->mVertices[v];
+            min = aiVector3D(std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z));
+            max = aiVector3D(std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z));
+        }
+        const double extent = std::max(max.x - min.x, std::max(max.y - min.y, max.z - min.z));
+        const double scale = extent > 0 ? 1.0 / extent : 1.0;
+        mPositions.resize(mNumVertices);
+        for (unsigned int v = 0; v < mNumVertices; ++v) {
+            const aiVector3D p = pMesh->mVertices[v] - min;
+            mPositions[v] = aiVector3d(p.x * scale, p.y * scale, p.z * scale);
+        }
+
+        // vertices of the same position are wedges of one corner, with differing normals, UVs or colors
+        mRemap.assign(mNumVertices, NoVertex);
+        mWedge.resize(mNumVertices);
+        SpatialSort sort(pMesh->mVertices, mNumVertices, sizeof(aiVector3D));
+        std::vector<unsigned int> identical;
+        for (unsigned int v = 0; v < mNumVertices; ++v) {
+            if (mRemap[v] != NoVertex) {
+                continue;
+            }
+            mRemap[v] = v;
+            unsigned int last = v;
+            sort.FindIdenticalPositions(pMesh->mVertices[v], identical);
+            for (const unsigned int i : identical) {
+                if (mRemap[i] == NoVertex) {
+                    mRemap[i] = v;
+                    mWedge[last] = i;
+                    last = i;
+                }
+            }
+            mWedge[last] = v;
+        }
+
+        if (pMesh->HasBones()) {
+            mWeights.resize(mNumVertices);
+            for (unsigned int b = 0; b < pMesh->mNumBones; ++b) {
+                const aiBone *bone = pMesh->mBones[b];
+                for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+                    mWeights[bone->mWeights[w].mVertexId].emplace_back(b, bone->mWeights[w].mWeight);
+                }
+            }
+        }
+
+        mFaces.reset(new aiFace[mNumFaces]);
+        std::copy(pMesh->mFaces, pMesh->mFaces + mNumFaces, mFaces.get());
+
+        VertexTriangleAdjacency adj(mFaces.get(), mNumFaces, mNumVertices, false);
+        ClassifyVertices(adj);
+        ComputeQuadrics(adj);
+
+        mCollapseRemap.resize(mNumVertices);
+        mCollapseLocked.resize(mNumVertices);
+    }
+
+    // ---------------------------------------------------------------------------
+    bool Simplifier::HasEdge(const VertexTriangleAdjacency &adj, unsigned int a, unsigned int b) const {
+        const unsigned int *triangles = adj.GetAdjacentTriangles(a);
+        const unsigned int numTriangles = adj.mOffsetTable[a + 1] - adj.mOffsetTable[a];
+        for (unsigned int t = 0; t < numTriangles; ++t) {
+            const unsigned int *idx = mFaces[triangles[t]].mIndices;
+            for (unsigned int c = 0; c < 3; ++c) {
+                if (idx[c] == a && idx[(c + 1) % 3] == b) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // ---------------------------------------------------------------------------
+    void Simplifier::ClassifyVertices(const VertexTriangleAdjacency &adj) {
+        // half edges without opposite are open, on a border or on a seam
+        mOpenIn.assign(mNumVertices, NoVertex);
+        mOpenOut.assign(mNumVertices, NoVertex);
+        for (unsigned int f = 0; f < mNumFaces; ++f) {
+            const unsigned int *idx = mFaces[f].mIndices;
+            for (unsigned int c = 0; c < 3; ++c) {
+                const unsigned int a = idx[c], b = idx[(c + 1) % 3];
+                if (!HasEdge(adj, b, a)) {
+                    mOpenOut[a] = mOpenOut[a] == NoVertex ? b : a;
+                    mOpenIn[b] = mOpenIn[b] == NoVertex ? a : b;
+                }
+            }
+        }
+
+        auto isOpen = [](unsigned int v, unsigned int end) {
+            return end != NoVertex && end != v;
+        };
+        mKind.assign(mNumVertices, Kind_Locked);
+        for (unsigned int v = 0; v < mNumVertices; ++v) {
+            if (mRemap[v] != v) {
+                continue;
+            }
+            if (mWedge[v] == v) {
+                if (mOpenIn[v] == NoVertex && mOpenOut[v] == NoVertex) {
+                    mKind[v] = Kind_Manifold;
+                } else if (isOpen(v, mOpenIn[v]) && isOpen(v, mOpenOut[v])) {
+                    mKind[v] = Kind_Border;
+                }
+            } else if (mWedge[mWedge[v]] == v) {
+                // both wedges must run along the same seam in opposite directions
+                const unsigned int w = mWedge[v];
+                if (isOpen(v, mOpenIn[v]) && isOpen(v, mOpenOut[v]) && isOpen(w, mOpenIn[w]) && isOpen(w, mOpenOut[w]) &&
+                        mRemap[mOpenIn[v]] == mRemap[mOpenOut[w]] && mRemap[mOpenOut[v]] == mRemap[mOpenIn[w]] &&
+                        mRemap[mOpenIn[v]] != mRemap[mOpenOut[v]]) {
+                    mKind[v] = Kind_Seam;
+                }
+            }
+        }
+        for (unsigned int v = 0; v < mNumVertices; ++v) {
+            mKind[v] = mKind[mRemap[v]];
+        }
+    }
+
+    // ---------------------------------------------------------------------------
+    void Simplifier::ComputeQuadrics(const VertexTriangleAdjacency &adj) {
+        mQuadrics.assign(mNumVertices, Quadric());
+        for (unsigned int f = 0; f < mNumFaces; ++f) {
+            const unsigned int *idx = mFaces[f].mIndices;
+            const aiVector3d &p0 = mPositions[idx[0]], &p1 = mPositions[idx[1]], &p2 = mPositions[idx[2]];
+            aiVector3d normal = (p1 - p0) ^ (p2 - p0);
+            const double area = normal.Length();
+            if (area > 0) {
+                normal /= area;
+            }
+            const Quadric face(normal, -(normal * p0), area);
+            for (unsigned int c = 0; c < 3; ++c) {
+                mQuadrics[mRemap[idx[c]]] += face;
+            }
+
+            // planes through the open edges, perpendicular to the face
+            for (unsigned int c = 0; c < 3; ++c) {
+                const unsigned int a = idx[c], b = idx[(c + 1) % 3];
+                if (HasEdge(adj, b, a)) {
+                    continue;
+                }
+                aiVector3d edge = mPositions[b] - mPositions[a];
+                const double length = edge.Length();
+                if (length <= 0) {
+                    continue;
+                }
+                edge /= length;
+                const aiVector3d toOther = mPositions[idx[(c + 2) % 3]] - mPositions[a];
+                aiVector3d perpendicular = toOther - edge * (toOther * edge);
+                const double distance = perpendicular.Length();
+                if (distance <= 0) {
+                    continue;
+                }
+                perpendicular /= distance;
+                const Quadric border(perpendicular, -(perpendicular * mPositions[a]), length * BorderWeight);
+                mQuadrics[mRemap[a]] += border;
+                mQuadrics[mRemap[b]] += border;
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------
+    // Returns a negative value if v0 may not be collapsed onto v1. For seam
+    // vertices s1 receives the vertex the twin of v0 is collapsed onto.
+    double Simplifier::GetCollapseError(unsigned int v0, unsigned int v1, unsigned int &s1) const {
+        const unsigned char k0 = mKind[v0];
+        if (!CanCollapse[k0][mKind[v1]] || mRemap[v0] == mRemap[v1]) {
+            return -1;
+        }
+        if ((k0 == Kind_Border || k0 == Kind_Seam) && mOpenOut[v0] != v1 && mOpenIn[v0] != v1) {
+            return -1;
+        }
+        if (k0 == Kind_Seam) {
+            const unsigned int w0 = mWedge[v0];
+            s1 = mOpenOut[v0] == v1 ? mOpenIn[w0] : mOpenOut[w0];
+            if (s1 == NoVertex || s1 == w0 || mRemap[s1] != mRemap[v1]) {
+                return -1;
+            }
+        }
+
+        // the skinning at the position of v0 becomes a blend of its neighbours
+        double error = mQuadrics[mRemap[v0]].Error(mPositions[v1]);
+        if (!mWeights.empty()) {
+            const double distance = mWeightSpread[v0] * BoneWeightError;
+            error += distance * distance;
+        }
+        return error;
+    }
+
+    // ---------------------------------------------------------------------------
+    // Half the L1 distance of the bone weights, 0 for equal and 1 for disjoint weights
+    double Simplifier::GetBoneWeightDistance(unsigned int a, unsigned int b) const {
+        const auto &wa = mWeights[a], &wb = mWeights[b];
+        double sum = 0;
+        size_t i = 0, j = 0;
+        while (i < wa.size() || j < wb.size()) {
+            if (j == wb.size() || (i < wa.size() && wa[i].first < wb[j].first)) {
+                sum += wa[i++].second;
+            } else if (i == wa.size() || wb[j].first < wa[i].first) {
+                sum += wb[j++].second;
+            } else {
+                sum += std::fabs(wa[i++].second - wb[j++].second);
+            }
+        }
+        return sum * 0.5;
+    }
+
+    // ---------------------------------------------------------------------------
+    void Simplifier::ComputeBoneWeightSpread() {
+        mWeightSpread.assign(mNumVertices, 0.0);
+        for (unsigned int f = 0; f < mNumFaces; ++f) {
+            const unsigned int *idx = mFaces[f].mIndices;
+            for (unsigned int c = 0; c < 3; ++c) {
+                const unsigned int a = idx[c], b = idx[(c + 1) % 3];
+                const double distance = GetBoneWeightDistance(a, b);
+                mWeightSpread[a] = std::max(mWeightSpread[a], distance);
+                mWeightSpread[b] = std::max(mWeightSpread[b], distance);
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------
+    bool Simplifier::HasTriangleFlips(const VertexTriangleAdjacency &adj, unsigned int v0, unsigned int v1) const {
+        const unsigned int *triangles = adj.GetAdjacentTriangles(v0);
+        const unsigned int numTriangles = adj.mOffsetTable[v0 + 1] - adj.mOffsetTable[v0];
+        const aiVector3d &p0 = mPositions[v0], &p1 = mPositions[v1];
+        for (unsigned int t = 0; t < numTriangles; ++t) {
+            const unsigned int *idx = mFaces[triangles[t]].mIndices;
+            const unsigned int c = idx[0] == v0 ? 0 : (idx[1] == v0 ? 1 : 2);
+            const unsigned int a = mCollapseRemap[idx[(c + 1) % 3]], b = mCollapseRemap[idx[(c + 2) % 3]];
+            // these triangles collapse
+            if (mRemap[a] == mRemap[v1] || mRemap[b] == mRemap[v1] || a == b) {
+                continue;
+            }
+            // the face must keep its orientation and not become degenerate
+            const aiVector3d before = (mPositions[a] - p0) ^ (mPositions[b] - p0);
+            const aiVector3d after = (mPositions[a] - p1) ^ (mPositions[b] - p1);
+            const double area = before.SquareLength();
+            if (area > 0 && (before * after <= 0 || after.SquareLength() <= DegenerateArea * area)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // ---------------------------------------------------------------------------
+    unsigned int Simplifier::CountCollapsedTriangles(const VertexTriangleAdjacency &adj, unsigned int v0, unsigned int v1) const {
+        const unsigned int *triangles = adj.GetAdjacentTriangles(v0);
+        const unsigned int numTriangles = adj.mOffsetTable[v0 + 1] - adj.mOffsetTable[v0];
+        unsigned int count = 0;
+        for (unsigned int t = 0; t < numTriangles; ++t) {
+            const unsigned int *idx = mFaces[triangles[t]].mIndices;
+            for (unsigned int c = 0; c < 3; ++c) {
+                if (mRemap[mCollapseRemap[idx[c]]] == mRemap[v1]) {
+                    ++count;
+                    break;
+                }
+            }
+        }
+        return count;
+    }
+
+    // ---------------------------------------------------------------------------
+    void Simplifier::RemapEdgeLoop(std::vector<unsigned int> &loop) const {
+        for (unsigned int v = 0; v < mNumVertices; ++v) {
+            if (loop[v] != NoVertex) {
+                const unsigned int end = loop[v];
+                const unsigned int target = mCollapseRemap[end];
+                // the end collapsed onto this vertex, the loop continues behind it
+                loop[v] = v == target ? loop[end] : target;
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------
+    void Simplifier::Simplify(unsigned int targetFaces, double maxError) {
+        std::vector<Collapse> collapses;
+        while (mNumFaces > targetFaces) {
+            VertexTriangleAdjacency adj(mFaces.get(), mNumFaces, mNumVertices, false);
+            if (!mWeights.empty()) {
+                ComputeBoneWeightSpread();
+            }
+
+            // the cheaper direction of each edge
+            collapses.clear();
+            unsigned int s1 = NoVertex;
+            for (unsigned int f = 0; f < mNumFaces; ++f) {
+                const unsigned int *idx = mFaces[f].mIndices;
+                for (unsigned int c = 0; c < 3; ++c) {
+                    const unsigned int a = idx[c], b = idx[(c + 1) % 3];
+                    const double ab = GetCollapseError(a, b, s1), ba = GetCollapseError(b, a, s1);
+                    if (ab >= 0 && (ba < 0 || ab <= ba)) {
+                        collapses.push_back({ a, b, ab });
+                    } else if (ba >= 0) {
+                        collapses.push_back({ b, a, ba });
+                    }
+                }
+            }
+            if (collapses.empty()) {
+                break;
+            }
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse &x, const Collapse &y) {
+                return x.error < y.error;
+            });
+
+            // each collapse removes about two faces, but don't take much worse ones for the last
+            const unsigned int faceGoal = mNumFaces - targetFaces;
+            const size_t edgeGoal = faceGoal / 2;
+            const double errorGoal = edgeGoal < collapses.size() ? collapses[edgeGoal].error * 1.5 : std::numeric_limits<double>::max();
+
+            std::iota(mCollapseRemap.begin(), mCollapseRemap.end(), 0u);
+            std::fill(mCollapseLocked.begin(), mCollapseLocked.end(), false);
+            unsigned int removed = 0, performed = 0;
+            for (const Collapse &collapse : collapses) {
+                if (collapse.error > maxError || collapse.error > errorGoal || removed >= faceGoal) {
+                    break;
+                }
+                const unsigned int r0 = mRemap[collapse.v0], r1 = mRemap[collapse.v1];
+                if (mCollapseLocked[r0] || mCollapseLocked[r1]) {
+                    continue;
+                }
+                GetCollapseError(collapse.v0, collapse.v1, s1);
+                const bool seam = mKind[collapse.v0] == Kind_Seam;
+                const unsigned int s0 = mWedge[collapse.v0];
+                if (HasTriangleFlips(adj, collapse.v0, collapse.v1) || (seam && HasTriangleFlips(adj, s0, s1))) {
+                    continue;
+                }
+
+                removed += CountCollapsedTriangles(adj, collapse.v0, collapse.v1);
+                mCollapseRemap[collapse.v0] = collapse.v1;
+                if (seam) {
+                    removed += CountCollapsedTriangles(adj, s0, s1);
+                    mCollapseRemap[s0] = s1;
+                }
+                mQuadrics[r1] += mQuadrics[r0];
+                mCollapseLocked[r0] = mCollapseLocked[r1] = true;
+                mError = std::max(mError, collapse.error);
+                ++performed;
+            }
+            if (!performed) {
+                break;
+            }
+
+            // apply the collapses and drop the collapsed faces, keeping the order of the others
+            unsigned int live = 0;
+            for (unsigned int f = 0; f < mNumFaces; ++f) {
+                unsigned int *idx = mFaces[f].mIndices;
+                for (unsigned int c = 0; c < 3; ++c) {
+                    idx[c] = mCollapseRemap[idx[c]];
+                }
+                if (idx[0] != idx[1] && idx[1] != idx[2] && idx[0] != idx[2]) {
+                    std::swap(mFaces[live].mIndices, mFaces[f].mIndices);
+                    ++live;
+                }
+            }
+            mNumFaces = live;
+            RemapEdgeLoop(mOpenOut);
+            RemapEdgeLoop(mOpenIn);
+        }
+    }
+
+    // ---------------------------------------------------------------------------
+    aiMeshLOD *Simplifier::CreateLOD() const {
+        aiMeshLOD *lod = new aiMeshLOD();
+        lod->mNumFaces = mNumFaces;
+        lod->mFaces = new aiFace[mNumFaces];
+        std::copy(mFaces.get(), mFaces.get() + mNumFaces, lod->mFaces);
+        lod->mError = static_cast<ai_real>(std::sqrt(mError));
+        return lod;
+    }
+
+    // ---------------------------------------------------------------------------
+    // LODs are only generated for meshes made of triangles alone
+    bool IsTriangleMesh(const aiMesh *mesh) {
+        return (mesh->mPrimitiveTypes & ~aiPrimitiveType_NGONEncodingFlag) == aiPrimitiveType_TRIANGLE;
+    }
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Constructor to be privately used by Importer
+GenLODsProcess::GenLODsProcess() : mMaxError(PP_ICL_LOD_MAX_ERROR) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether the processing step is present in the given flag field.
+bool GenLODsProcess::IsActive(unsigned int pFlags) const {
+    return (pFlags & aiProcess_ImproveCacheLocality) != 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently from each other.
+bool GenLODsProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+const char *GenLODsProcess::GetName(unsigned int /*pFlags*/) const {
+    return "GenLODs";
+}
+
+// ------------------------------------------------------------------------------------------------
+// Setup configuration
+void GenLODsProcess::SetupProperties(const Importer *pImp) {
+    const std::string list = pImp->GetPropertyString(AI_CONFIG_PP_ICL_LOD_RATIOS, "");
+    std::vector<ai_real> ratios;
+    const char *cur = list.c_str(), *end = cur + list.size();
+    while (SkipSpaces(&cur, end)) {
+        ai_real ratio = 0;
+        const char *next = fast_atoreal_move(cur, ratio);
+        if (next == cur) {
+            ASSIMP_LOG_WARN("GenLODsProcess: ignoring invalid LOD ratio list \"", list, "\"");
+            break;
+        }
+        ratios.push_back(ratio);
+        cur = next;
+    }
+    SetRatios(ratios, pImp->GetPropertyFloat(AI_CONFIG_PP_ICL_LOD_MAX_ERROR, PP_ICL_LOD_MAX_ERROR));
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsProcess::SetRatios(const std::vector<ai_real> &ratios, ai_real maxError) {
+    mRatios.clear();
+    for (const ai_real ratio : ratios) {
+        if (ratio > 0 && ratio < 1) {
+            mRatios.push_back(ratio);
+        } else {
+            ASSIMP_LOG_WARN("GenLODsProcess: ignoring LOD ratio ", ratio, ", it must be between 0 and 1");
+        }
+    }
+    std::sort(mRatios.begin(), mRatios.end(), std::greater<ai_real>());
+    mMaxError = maxError;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on the given imported data.
+void GenLODsProcess::Execute(aiScene *pScene) {
+    if (mRatios.empty()) {
+        return;
+    }
+    if (!pScene->mNumMeshes) {
+        ASSIMP_LOG_DEBUG("GenLODsProcess skipped; there are no meshes");
+        return;
+    }
+
+    ASSIMP_LOG_DEBUG("GenLODsProcess begin");
+
+    ForEachMesh(pScene, [this, pScene](unsigned int a) {
+        ProcessMesh(pScene->mMeshes[a]);
+    });
+
+    if (!DefaultLogger::isNullLogger()) {
+        // the face count of each LOD, summed over all meshes
+        std::vector<unsigned int> numf(mRatios.size(), 0);
+        unsigned int numIn = 0, numm = 0, numSkipped = 0;
+        for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+            const aiMesh *mesh = pScene->mMeshes[a];
+            if (mesh->HasLODs()) {
+                for (unsigned int l = 0; l < mesh->mNumLODs; ++l) {
+                    numf[l] += mesh->mLODs[l]->mNumFaces;
+                }
+                numIn += mesh->mNumFaces;
+                ++numm;
+            } else if (mesh->HasFaces() && mesh->HasPositions() && !IsTriangleMesh(mesh)) {
+                ++numSkipped;
+            }
+        }
+        if (numSkipped > 0) {
+            ASSIMP_LOG_WARN("GenLODsProcess: skipped ", numSkipped, " meshes, LODs can only be generated for triangle meshes");
+        }
+        if (numm > 0) {
+            for (size_t l = 0; l < numf.size(); ++l) {
+                ASSIMP_LOG_INFO("LOD ", l, " of ", numm, " meshes: ", numf[l], " of ", numIn, " faces (ratio ", mRatios[l], ")");
+            }
+        }
+        ASSIMP_LOG_DEBUG("GenLODsProcess finished. ");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Generates the LODs of a specific mesh
+unsigned int GenLODsProcess::ProcessMesh(aiMesh *pMesh) const {
+    ai_assert(nullptr != pMesh);
+
+    for (unsigned int l = 0; l < pMesh->mNumLODs; ++l) {
+        delete pMesh->mLODs[l];
+    }
+    delete[] pMesh->mLODs;
+    pMesh->mLODs = nullptr;
+    pMesh->mNumLODs = 0;
+
+    if (!pMesh->HasFaces() || !pMesh->HasPositions() || mRatios.empty()) {
+        return 0;
+    }
+    if (!IsTriangleMesh(pMesh)) {
+        ASSIMP_LOG_DEBUG("GenLODsProcess: skipping mesh ", pMesh->mName.C_Str(), ", it is not a triangle mesh");
+        return 0;
+    }
+
+    // each LOD continues the simplification of the previous one
+    Simplifier simplifier(pMesh);
+    pMesh->mLODs = new aiMeshLOD *[mRatios.size()];
+    for (const ai_real ratio : mRatios) {
+        simplifier.Simplify(static_cast<unsigned int>(ratio * pMesh->mNumFaces), static_cast<double>(mMaxError) * mMaxError);
+        pMesh->mLODs[pMesh->mNumLODs++] = simplifier.CreateLOD();
+    }
+    return pMesh->mNumLODs;
+}
+
+} // namespace Assimp
@@ -0,0 +1,345 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post processing step to partition meshes
+ *  into meshlets.
+ */
+
+#include "PostProcessing/GenMeshlets.h"
+#include "Common/VertexTriangleAdjacency.h"
+
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Assimp {
+namespace {
+    // Computes the bounding sphere and the normal cone of a meshlet
+    void ComputeBounds(const aiMesh *pMesh, aiMeshlet &meshlet, const unsigned int *vertices, const unsigned char *triangles) {
+        aiVector3D min = pMesh->mVertices[vertices[0]], max = min;
+        for (unsigned int i = 1; i < meshlet.mNumVertices; ++i) {
+            const aiVector3D &p = pMesh->mVertices[vertices[i]];
+            min = aiVector3D(std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z));
+            max = aiVector3D(std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z));
+        }
+        meshlet.mCenter = (min + max) * ai_real(0.5);
+        meshlet.mRadius = 0;
+        for (unsigned int i = 0; i < meshlet.mNumVertices; ++i) {
+            meshlet.mRadius = std::max(meshlet.mRadius, (pMesh->mVertices[vertices[i]] - meshlet.mCenter).Length());
+        }
+
+        // the cone axis is the average of the triangle normals, degenerate triangles don't count
+        std::vector<std::pair<aiVector3D, aiVector3D>> planes;
+        planes.reserve(meshlet.mNumTriangles);
+        aiVector3D axis;
+        for (unsigned int t = 0; t < meshlet.mNumTriangles; ++t) {
+            const aiVector3D &p0 = pMesh->mVertices[vertices[triangles[t * 3]]];
+            const aiVector3D &p1 = pMesh->mVertices[vertices[triangles[t * 3 + 1]]];
+            const aiVector3D &p2 = pMesh->mVertices[vertices[triangles[t * 3 + 2]]];
+            aiVector3D normal = (p1 - p0) ^ (p2 - p0);
+            const ai_real length = normal.Length();
+            if (length > ai_real(0)) {
+                normal /= length;
+                planes.emplace_back(p0, normal);
+                axis += normal;
+            }
+        }
+
+        meshlet.mConeApex = meshlet.mCenter;
+        meshlet.mConeCutoff = 1;
+        const ai_real axisLength = axis.Length();
+        if (axisLength <= ai_real(0)) {
+            meshlet.mConeAxis = aiVector3D();
+            return;
+        }
+        axis /= axisLength;
+        meshlet.mConeAxis = axis;
+
+        ai_real minDot = 1;
+        for (const auto &plane : planes) {
+            minDot = std::min(minDot, plane.second * axis);
+        }
+        // the normals spread too much for the cone to cull anything
+        if (minDot <= ai_real(0.1)) {
+            return;
+        }
+
+        // move the apex along the axis until it is behind all triangles
+        ai_real maxT = 0;
+        for (const auto &plane : planes) {
+            maxT = std::max(maxT, ((meshlet.mCenter - plane.first) * plane.second) / (axis * plane.second));
+        }
+        meshlet.mConeApex = meshlet.mCenter - axis * maxT;
+
+        // widen the normal cone by 90 degrees: cos(a + 90) = -sin(a)
+        meshlet.mConeCutoff = std::sqrt(ai_real(1) - minDot * minDot);
+    }
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Constructor to be privately used by Importer
+GenMeshletsProcess::GenMeshletsProcess() :
+        mEnabled(false), mMaxVertices(PP_ICL_MESHLET_VERTEX_LIMIT), mMaxTriangles(PP_ICL_MESHLET_TRIANGLE_LIMIT) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether the processing step is present in the given flag field.
+bool GenMeshletsProcess::IsActive(unsigned int pFlags) const {
+    return (pFlags & aiProcess_ImproveCacheLocality) != 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently from each other.
+bool GenMeshletsProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+const char *GenMeshletsProcess::GetName(unsigned int /*pFlags*/) const {
+    return "GenMeshlets";
+}
+
+// ------------------------------------------------------------------------------------------------
+// Setup configuration
+void GenMeshletsProcess::SetupProperties(const Importer *pImp) {
+    const bool enabled = pImp->GetPropertyBool(AI_CONFIG_PP_ICL_GEN_MESHLETS, false);
+    SetLimits(pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_MESHLET_VERTEX_LIMIT, PP_ICL_MESHLET_VERTEX_LIMIT),
+            pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_MESHLET_TRIANGLE_LIMIT, PP_ICL_MESHLET_TRIANGLE_LIMIT));
+    mEnabled = enabled;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenMeshletsProcess::SetLimits(unsigned int maxVertices, unsigned int maxTriangles) {
+    mEnabled = true;
+    mMaxVertices = maxVertices;
+    mMaxTriangles = maxTriangles;
+    if (mMaxVertices < 3 || mMaxVertices > 256) {
+        mMaxVertices = std::min(std::max(mMaxVertices, 3u), 256u);
+        ASSIMP_LOG_WARN("GenMeshletsProcess: the vertex limit must be between 3 and 256, using ", mMaxVertices);
+    }
+    if (mMaxTriangles < 1) {
+        mMaxTriangles = PP_ICL_MESHLET_TRIANGLE_LIMIT;
+        ASSIMP_LOG_WARN("GenMeshletsProcess: the triangle limit must not be 0, using ", mMaxTriangles);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on the given imported data.
+void GenMeshletsProcess::Execute(aiScene *pScene) {
+    if (!mEnabled) {
+        return;
+    }
+    if (!pScene->mNumMeshes) {
+        ASSIMP_LOG_DEBUG("GenMeshletsProcess skipped; there are no meshes");
+        return;
+    }
+
+    ASSIMP_LOG_DEBUG("GenMeshletsProcess begin");
+
+    std::vector<unsigned int> results(pScene->mNumMeshes);
+    ForEachMesh(pScene, [this, pScene, &results](unsigned int a) {
+        results[a] = ProcessMesh(pScene->mMeshes[a]);
+    });
+
+    if (!DefaultLogger::isNullLogger()) {
+        unsigned int numMeshlets = 0, numf = 0, numm = 0;
+        for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+            if (results[a]) {
+                numMeshlets += results[a];
+                numf += pScene->mMeshes[a]->mNumFaces;
+                ++numm;
+            }
+        }
+        if (numm > 0) {
+            ASSIMP_LOG_INFO("Generated ", numMeshlets, " meshlets for ", numm, " meshes (", numf, " faces)");
+        }
+        ASSIMP_LOG_DEBUG("GenMeshletsProcess finished. ");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Partitions a specific mesh into meshlets
+unsigned int GenMeshletsProcess::ProcessMesh(aiMesh *pMesh) const {
+    ai_assert(nullptr != pMesh);
+
+    delete[] pMesh->mMeshlets;
+    delete[] pMesh->mMeshletVertices;
+    delete[] pMesh->mMeshletTriangles;
+    pMesh->mMeshlets = nullptr;
+    pMesh->mMeshletVertices = nullptr;
+    pMesh->mMeshletTriangles = nullptr;
+    pMesh->mNumMeshlets = pMesh->mNumMeshletVertices = 0;
+
+    if (!pMesh->HasFaces() || !pMesh->HasPositions()) {
+        return 0;
+    }
+    if ((pMesh->mPrimitiveTypes & ~aiPrimitiveType_NGONEncodingFlag) != aiPrimitiveType_TRIANGLE) {
+        ASSIMP_LOG_WARN("GenMeshletsProcess: meshlets can only be built for triangle meshes");
+        return 0;
+    }
+
+    VertexTriangleAdjacency adj(pMesh->mFaces, pMesh->mNumFaces, pMesh->mNumVertices, false);
+
+    const unsigned int unassigned = ~0u;
+    std::vector<unsigned int> localIndex(pMesh->mNumVertices, unassigned);
+    std::vector<bool> emitted(pMesh->mNumFaces, false);
+    // the meshlet a triangle was last added to the candidates for, plus 1
+    std::vector<unsigned int> candidateOf(pMesh->mNumFaces, 0);
+    std::vector<unsigned int> candidates;
+
+    std::vector<aiMeshlet> meshlets;
+    std::vector<unsigned int> vertices;
+    std::vector<unsigned char> triangles;
+    std::vector<unsigned int> order;
+    triangles.reserve(pMesh->mNumFaces * 3);
+    order.reserve(pMesh->mNumFaces);
+
+    aiMeshlet meshlet;
+    unsigned int nextSeed = 0;
+    while (order.size() < pMesh->mNumFaces) {
+        // grow the meshlet by the adjacent triangle adding the fewest new vertices
+        unsigned int best = unassigned, bestNew = 4;
+        for (size_t i = 0; i < candidates.size();) {
+            const unsigned int t = candidates[i];
+            if (emitted[t]) {
+                candidates[i] = candidates.back();
+                candidates.pop_back();
+                continue;
+            }
+            const aiFace &face = pMesh->mFaces[t];
+            unsigned int numNew = 0;
+            for (unsigned int c = 0; c < 3; ++c) {
+                numNew += localIndex[face.mIndices[c]] == unassigned;
+            }
+            if (numNew < bestNew) {
+                best = t;
+                bestNew = numNew;
+                if (0 == numNew) {
+                    break;
+                }
+            }
+            ++i;
+        }
+
+        // nothing adjacent left: continue with the next triangle of the cache optimized order
+        if (best == unassigned) {
+            while (emitted[nextSeed]) {
+                ++nextSeed;
+            }
+            best = nextSeed;
+            const aiFace &face = pMesh->mFaces[best];
+            bestNew = 0;
+            for (unsigned int c = 0; c < 3; ++c) {
+                bestNew += localIndex[face.mIndices[c]] == unassigned;
+            }
+        }
+
+        // flush the meshlet if the triangle doesn't fit anymore
+        if (meshlet.mNumVertices + bestNew > mMaxVertices || meshlet.mNumTriangles + 1 > mMaxTriangles) {
+            ComputeBounds(pMesh, meshlet, &vertices[meshlet.mVertexOffset], &triangles[meshlet.mTriangleOffset * 3]);
+            for (unsigned int i = 0; i < meshlet.mNumVertices; ++i) {
+                localIndex[vertices[meshlet.mVertexOffset + i]] = unassigned;
+            }
+            meshlets.push_back(meshlet);
+            meshlet = aiMeshlet();
+            meshlet.mVertexOffset = static_cast<unsigned int>(vertices.size());
+            meshlet.mTriangleOffset = static_cast<unsigned int>(order.size());
+            candidates.clear();
+        }
+
+        emitted[best] = true;
+        order.push_back(best);
+        const aiFace &face = pMesh->mFaces[best];
+        for (unsigned int c = 0; c < 3; ++c) {
+            const unsigned int v = face.mIndices[c];
+            if (localIndex[v] == unassigned) {
+                localIndex[v] = meshlet.mNumVertices++;
+                vertices.push_back(v);
+
+                const unsigned int *adjacent = adj.GetAdjacentTriangles(v);
+                const unsigned int numAdjacent = adj.mOffsetTable[v + 1] - adj.mOffsetTable[v];
+                for (unsigned int n = 0; n < numAdjacent; ++n) {
+                    const unsigned int t = adjacent[n];
+                    if (!emitted[t] && candidateOf[t] != meshlets.size() + 1) {
+                        candidateOf[t] = static_cast<unsigned int>(meshlets.size() + 1);
+                        candidates.push_back(t);
+                    }
+                }
+            }
+            triangles.push_back(static_cast<unsigned char>(localIndex[v]));
+        }
+        ++meshlet.mNumTriangles;
+    }
+    ComputeBounds(pMesh, meshlet, &vertices[meshlet.mVertexOffset], &triangles[meshlet.mTriangleOffset * 3]);
+    meshlets.push_back(meshlet);
+
+    // reorder the faces so the triangles of each meshlet are contiguous
+    aiFace *faces = new aiFace[pMesh->mNumFaces];
+    for (unsigned int f = 0; f < pMesh->mNumFaces; ++f) {
+        aiFace &face = pMesh->mFaces[order[f]];
+        faces[f].mNumIndices = face.mNumIndices;
+        faces[f].mIndices = face.mIndices;
+        face.mIndices = nullptr;
+    }
+    delete[] pMesh->mFaces;
+    pMesh->mFaces = faces;
+
+    // the triangles of a polygon are no longer guaranteed to be consecutive
+    pMesh->mPrimitiveTypes &= ~aiPrimitiveType_NGONEncodingFlag;
+
+    pMesh->mNumMeshlets = static_cast<unsigned int>(meshlets.size());
+    pMesh->mMeshlets = new aiMeshlet[meshlets.size()];
+    std::copy(meshlets.begin(), meshlets.end(), pMesh->mMeshlets);
+    pMesh->mNumMeshletVertices = static_cast<unsigned int>(vertices.size());
+    pMesh->mMeshletVertices = new unsigned int[vertices.size()];
+    std::copy(vertices.begin(), vertices.end(), pMesh->mMeshletVertices);
+    pMesh->mMeshletTriangles = new unsigned char[triangles.size()];
+    std::copy(triangles.begin(), triangles.end(), pMesh->mMeshletTriangles);
+
+    return pMesh->mNumMeshlets;
+}
+
+} // namespace Assimp
@@ -49,12 +49,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exceptional.h>
 #include <assimp/qnan.h>
 
+#include <atomic>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 GenVertexNormalsProcess::GenVertexNormalsProcess() :
-        configMaxAngle(AI_DEG_TO_RAD(175.f)) {
+        configMaxAngle(AI_DEG_TO_RAD(175.f)), configSpatialHash(false) {
     // empty
 }
 
@@ -67,12 +69,19 @@ bool GenVertexNormalsProcess::IsActive(unsigned int pFlags) const {
     return (pFlags & aiProcess_GenSmoothNormals) != 0;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently from each other.
+bool GenVertexNormalsProcess::IsMeshLocal() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void GenVertexNormalsProcess::SetupProperties(const Importer *pImp) {
     // Get the current value of the AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE property
     configMaxAngle = pImp->GetPropertyFloat(AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE, (ai_real)175.0);
     configMaxAngle = AI_DEG_TO_RAD(std::max(std::min(configMaxAngle, (ai_real)175.0), (ai_real)0.0));
+    configSpatialHash = pImp->GetPropertyBool(AI_CONFIG_PP_USE_SPATIAL_HASH, false);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -84,11 +93,12 @@ void GenVertexNormalsProcess::Execute(aiScene *pScene) {
         throw DeadlyImportError("Post-processing order mismatch: expecting pseudo-indexed (\"verbose\") vertices here");
     }
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        if (GenMeshVertexNormals(pScene->mMeshes[a], a))
+    std::atomic<bool> bHas(false);
+    ForEachMesh(pScene, [this, pScene, &bHas](unsigned int a) {
+        if (GenMeshVertexNormals(pScene->mMeshes[a], a)) {
             bHas = true;
-    }
+        }
+    });
 
     if (bHas) {
         ASSIMP_LOG_INFO("GenVertexNormalsProcess finished. "
@@ -151,20 +161,20 @@ bool GenVertexNormalsProcess::GenMeshVertexNormals(aiMesh *pMesh, unsigned int m
 
     // Set up a SpatialSort to quickly find all vertices close to a given position
     // check whether we can reuse the SpatialSort of a previous step.
-    SpatialSort *vertexFinder = nullptr;
-    SpatialSort _vertexFinder;
+    SpatialIndex *vertexFinder = nullptr;
+    SpatialIndex _vertexFinder;
     ai_real posEpsilon = ai_real(1e-5);
     if (shared) {
-        std::vector<std::pair<SpatialSort, ai_real>> *avf;
+        std::vector<std::pair<SpatialIndex, ai_real>> *avf;
         shared->GetProperty(AI_SPP_SPATIAL_SORT, avf);
         if (avf) {
-            std::pair<SpatialSort, ai_real> &blubb = avf->operator[](meshIndex);
+            std::pair<SpatialIndex, ai_real> &blubb = avf->operator[](meshIndex);
             vertexFinder = &blubb.first;
             posEpsilon = blubb.second;
         }
     }
     if (!vertexFinder) {
-        _vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, sizeof(aiVector3D));
+        _vertexFinder.Fill(pMesh->mVertices, pMesh->mNumVertices, configSpatialHash, threadPool);
         vertexFinder = &_vertexFinder;
         posEpsilon = ComputePositionEpsilon(pMesh);
     }
@@ -73,6 +73,12 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** The step only works on one mesh at a time, so meshes may be
+    *  processed concurrently.
+    */
+    bool IsMeshLocal() const override;
+
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
     * The function is a request to the process to update its configuration
@@ -92,6 +98,11 @@ public:
         configMaxAngle =f;
     }
 
+    // setter for configSpatialHash
+    inline void SetSpatialHash(bool enable) {
+        configSpatialHash = enable;
+    }
+
     // -------------------------------------------------------------------
     /** Computes normals for a specific mesh
     *  @param pcMesh Mesh
@@ -103,6 +114,9 @@ public:
 private:
     /** Configuration option: maximum smoothing angle, in radians*/
     ai_real configMaxAngle;
+
+    /** Configuration option: find close vertices with a SpatialHash */
+    bool configSpatialHash;
     mutable bool force_ = false;
     mutable bool flippedWindingOrder_ = false;
     mutable bool leftHanded_ = false;
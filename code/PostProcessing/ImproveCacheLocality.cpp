@@ -43,7 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * <br>
  * The algorithm is roughly basing on this paper:
  * http://www.cs.princeton.edu/gfx/pubs/Sander_2007_%3ETR/tipsy.pdf
- *   .. although overdraw reduction isn't implemented yet ...
+ *   .. overdraw reduction is done by the OptimizeOverdrawProcess ...
  */
 
 // internal headers
@@ -116,6 +116,12 @@ bool ImproveCacheLocalityProcess::IsActive(unsigned int pFlags) const {
     return (pFlags & aiProcess_ImproveCacheLocality) != 0;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently from each other.
+bool ImproveCacheLocalityProcess::IsMeshLocal() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Setup configuration
 void ImproveCacheLocalityProcess::SetupProperties(const Importer *pImp) {
@@ -133,10 +139,16 @@ void ImproveCacheLocalityProcess::Execute(aiScene *pScene) {
 
     ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess begin");
 
+    // keep the per-mesh results so the statistics are summed up in a fixed order
+    std::vector<ai_real> results(pScene->mNumMeshes);
+    ForEachMesh(pScene, [this, pScene, &results](unsigned int a) {
+        results[a] = ProcessMesh(pScene->mMeshes[a], a);
+    });
+
     float out = 0.f;
     unsigned int numf = 0, numm = 0;
     for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        const float res = ProcessMesh(pScene->mMeshes[a], a);
+        const float res = results[a];
         if (res) {
             numf += pScene->mMeshes[a]->mNumFaces;
             out += res;
@@ -353,7 +365,7 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
     }
     ai_real fACMR2 = 0.0f;
     if (!DefaultLogger::isNullLogger()) {
-        fACMR2 = static_cast<ai_real>(iCacheMisses / pMesh->mNumFaces);
+        fACMR2 = static_cast<ai_real>(iCacheMisses) / pMesh->mNumFaces;
         const ai_real averageACMR = ((fACMR - fACMR2) / fACMR) * 100.f;
         // very intense verbose logging ... prepare for much text if there are many meshes
         if (DefaultLogger::get()->getLogSeverity() == Logger::VERBOSE) {
@@ -70,6 +70,10 @@ public:
     // Check whether the pp step is active
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    // Meshes are processed independently from each other
+    bool IsMeshLocal() const override;
+
     // -------------------------------------------------------------------
     // Executes the pp step on a given scene
     void Execute( aiScene* pScene) override;
@@ -47,14 +47,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "JoinVerticesProcess.h"
 #include "ProcessHelper.h"
-#include <assimp/Vertex.h>
+#include "Common/ThreadPool.h"
 #include <assimp/TinyFormatter.h>
 
 #include <stdio.h>
-#include <unordered_set>
-#include <unordered_map>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <memory>
-#include <map>
+#include <vector>
 
 using namespace Assimp;
 
@@ -63,6 +66,12 @@ using namespace Assimp;
 bool JoinVerticesProcess::IsActive( unsigned int pFlags) const {
     return (pFlags & aiProcess_JoinIdenticalVertices) != 0;
 }
+
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently from each other.
+bool JoinVerticesProcess::IsMeshLocal() const {
+    return true;
+}
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void JoinVerticesProcess::Execute( aiScene* pScene) {
@@ -77,10 +86,10 @@ void JoinVerticesProcess::Execute( aiScene* pScene) {
     }
 
     // execute the step
-    int iNumVertices = 0;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++) {
+    std::atomic<int> iNumVertices(0);
+    ForEachMesh(pScene, [this, pScene, &iNumVertices](unsigned int a) {
         iNumVertices += ProcessMesh( pScene->mMeshes[a],a);
-    }
+    });
 
     pScene->mFlags |= AI_SCENE_FLAGS_NON_VERBOSE_FORMAT;
 
@@ -100,64 +109,221 @@ void JoinVerticesProcess::Execute( aiScene* pScene) {
 
 namespace {
 
-struct CompareVerticesAlmostEqual {
-    bool operator () (const Vertex & a, const Vertex & b) const {
-        static const float epsilon = 1e-5f;
-        static const float squareEpsilon = epsilon * epsilon;
+// Meshes with fewer vertices are always joined on the calling thread
+const unsigned int ParallelThreshold = 1 << 16;
 
-        if ((a.position - b.position).SquareLength() > squareEpsilon) {
-            return false;
-        }
+// Number of top hash bits selecting the partition in parallel runs
+const unsigned int PartitionBits = 6;
 
-        // We just test the other attributes even if they're not present in the mesh.
-        // In this case they're initialized to 0 so the comparison succeeds.
-        // By this method the non-present attributes are effectively ignored in the comparison.
+// Marks empty table slots and the end of a chain
+const unsigned int NoVertex = 0xffffffff;
 
-        if ((a.normal - b.normal).SquareLength() > squareEpsilon) {
-            return false;
-        }
+// ------------------------------------------------------------------------------------------------
+// Bit pattern of a coordinate, -0 is folded into +0 just like std::hash<float> does.
+inline uint64_t CoordinateBits(ai_real v) {
+    if (v == ai_real(0.0)) {
+        return 0;
+    }
+    uint64_t bits = 0;
+    ::memcpy(&bits, &v, sizeof(v));
+    return bits;
+}
 
-        if ((a.tangent - b.tangent).SquareLength() > squareEpsilon) {
-            return false;
+// ------------------------------------------------------------------------------------------------
+inline uint32_t HashPosition(const aiVector3D &p) {
+    uint64_t h = CoordinateBits(p.x) * 0x9e3779b97f4a7c15ull;
+    h = (h ^ CoordinateBits(p.y)) * 0xc2b2ae3d27d4eb4full;
+    h = (h ^ CoordinateBits(p.z)) * 0x165667b19e3779f9ull;
+    return static_cast<uint32_t>(h ^ (h >> 32));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Compares two vertices of a mesh. Only the channels present in the mesh are looked at; the old
+// Vertex based comparison saw zeros for all others, which makes no difference.
+class VertexComparer {
+public:
+    explicit VertexComparer(const aiMesh *mesh) :
+            mPositions(mesh->mVertices) {
+        if (mesh->HasNormals()) {
+            mVectors.push_back(mesh->mNormals);
+        }
+        if (mesh->HasTangentsAndBitangents()) {
+            mVectors.push_back(mesh->mTangents);
+            mVectors.push_back(mesh->mBitangents);
+        }
+        // channels may have gaps, so look at every slot
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+            if (mesh->HasTextureCoords(i)) {
+                mVectors.push_back(mesh->mTextureCoords[i]);
+            }
         }
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+            if (mesh->HasVertexColors(i)) {
+                mColors.push_back(mesh->mColors[i]);
+            }
+        }
+    }
 
-        if ((a.bitangent - b.bitangent).SquareLength() > squareEpsilon) {
+    // Identical positions, which is what the old hash based lookup required
+    bool SamePosition(unsigned int a, unsigned int b) const {
+        const aiVector3D &pa = mPositions[a], &pb = mPositions[b];
+        return CoordinateBits(pa.x) == CoordinateBits(pb.x) &&
+               CoordinateBits(pa.y) == CoordinateBits(pb.y) &&
+               CoordinateBits(pa.z) == CoordinateBits(pb.z);
+    }
+
+    bool operator()(unsigned int a, unsigned int b) const {
+        static const float epsilon = 1e-5f;
+        static const float squareEpsilon = epsilon * epsilon;
+
+        if ((mPositions[a] - mPositions[b]).SquareLength() > squareEpsilon) {
             return false;
         }
-
-        for (uint32_t i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; i ++) {
-            if ((a.texcoords[i] - b.texcoords[i]).SquareLength() > squareEpsilon) {
+        for (const aiVector3D *channel : mVectors) {
+            if ((channel[a] - channel[b]).SquareLength() > squareEpsilon) {
                 return false;
             }
         }
-
-        for (uint32_t i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; i ++) {
-            if (GetColorDifference(a.colors[i], b.colors[i]) > squareEpsilon) {
+        for (const aiColor4D *channel : mColors) {
+            if (GetColorDifference(channel[a], channel[b]) > squareEpsilon) {
                 return false;
             }
         }
-
-        // If reached this point, they are ~equal
         return true;
     }
+
+private:
+    const aiVector3D *mPositions;
+    std::vector<const aiVector3D *> mVectors;
+    std::vector<const aiColor4D *> mColors;
 };
 
-struct HashVertex {
-    inline void hash_combine(std::size_t& seed, const ai_real& v) const {
-        std::hash<ai_real> hasher;
-        seed ^= hasher(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+// ------------------------------------------------------------------------------------------------
+inline size_t TableSize(size_t count) {
+    size_t size = 16;
+    while (size < 2 * count) {
+        size <<= 1;
     }
+    return size;
+}
 
-    size_t operator () (const Vertex & v) const {
-        size_t hash = 0;
-
-        hash_combine(hash, v.position.x);
-        hash_combine(hash, v.position.y);
-        hash_combine(hash, v.position.z);
-
-        return hash;
+// ------------------------------------------------------------------------------------------------
+// Determines for each used vertex the first vertex before it which it can be joined with, or the
+// vertex itself if there is none.
+//
+// Vertices are looked up by the hash of their exact position in flat open-addressing tables. The
+// unique vertices sharing one position are chained in index order, and the epsilon comparison
+// walks this chain, so the first match wins. For large meshes the vertices are split by the top
+// hash bits into partitions, which are then processed concurrently. Vertices with the same
+// position always end up in the same partition and each partition is visited in index order, so
+// the result does not depend on the number of threads.
+void FindRepresentatives(const aiMesh *mesh, const std::vector<bool> &used, ThreadPool *pool,
+        std::vector<unsigned int> &representative) {
+    const unsigned int numVertices = mesh->mNumVertices;
+    const bool parallel = nullptr != pool && pool->GetNumWorkers() > 0 && numVertices >= ParallelThreshold;
+    const unsigned int partitionBits = parallel ? PartitionBits : 0;
+    const size_t numPartitions = size_t(1) << partitionBits;
+    const size_t numChunks = parallel ? pool->GetNumWorkers() + 1 : 1;
+    const size_t chunkSize = (numVertices + numChunks - 1) / numChunks;
+
+    const auto forEach = [pool, parallel](size_t count, const std::function<void(size_t)> &fn) {
+        if (parallel) {
+            pool->ParallelFor(count, fn);
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                fn(i);
+            }
+        }
+    };
+    const auto partitionOf = [partitionBits](uint32_t hash) -> size_t {
+        return partitionBits ? hash >> (32 - partitionBits) : 0;
+    };
+
+    // hash all used positions and count them per chunk and partition
+    std::vector<uint32_t> hashes(numVertices);
+    std::vector<size_t> offsets(numChunks * numPartitions, 0);
+    forEach(numChunks, [&](size_t chunk) {
+        const size_t begin = std::min<size_t>(numVertices, chunk * chunkSize);
+        const size_t end = std::min<size_t>(numVertices, begin + chunkSize);
+        size_t *counts = &offsets[chunk * numPartitions];
+        for (size_t a = begin; a < end; ++a) {
+            if (used[a]) {
+                hashes[a] = HashPosition(mesh->mVertices[a]);
+                ++counts[partitionOf(hashes[a])];
+            }
+        }
+    });
+
+    // turn the counts into write offsets, chunk by chunk within each partition
+    std::vector<size_t> partitionStart(numPartitions + 1, 0), tableStart(numPartitions + 1, 0);
+    size_t numUsed = 0;
+    for (size_t p = 0; p < numPartitions; ++p) {
+        partitionStart[p] = numUsed;
+        for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+            const size_t count = offsets[chunk * numPartitions + p];
+            offsets[chunk * numPartitions + p] = numUsed;
+            numUsed += count;
+        }
+        const size_t count = numUsed - partitionStart[p];
+        tableStart[p + 1] = tableStart[p] + (count ? TableSize(count) : 0);
     }
-};
+    partitionStart[numPartitions] = numUsed;
+
+    // sort the used vertices by partition, keeping the index order within each
+    std::vector<unsigned int> order(numUsed);
+    forEach(numChunks, [&](size_t chunk) {
+        const size_t begin = std::min<size_t>(numVertices, chunk * chunkSize);
+        const size_t end = std::min<size_t>(numVertices, begin + chunkSize);
+        size_t *next = &offsets[chunk * numPartitions];
+        for (size_t a = begin; a < end; ++a) {
+            if (used[a]) {
+                order[next[partitionOf(hashes[a])]++] = static_cast<unsigned int>(a);
+            }
+        }
+    });
+
+    // join within each partition
+    const VertexComparer equal(mesh);
+    std::vector<unsigned int> table(tableStart[numPartitions]);
+    std::vector<unsigned int> nextSamePosition(numVertices);
+    forEach(numPartitions, [&](size_t p) {
+        if (partitionStart[p] == partitionStart[p + 1]) {
+            return;
+        }
+        unsigned int *slots = table.data() + tableStart[p];
+        const size_t mask = tableStart[p + 1] - tableStart[p] - 1;
+        std::fill(slots, slots + mask + 1, NoVertex);
+
+        for (size_t k = partitionStart[p]; k < partitionStart[p + 1]; ++k) {
+            const unsigned int a = order[k];
+            representative[a] = a;
+            for (size_t slot = hashes[a] & mask;; slot = (slot + 1) & mask) {
+                const unsigned int head = slots[slot];
+                if (head == NoVertex) {
+                    // first vertex at this position
+                    slots[slot] = a;
+                    nextSamePosition[a] = NoVertex;
+                    break;
+                }
+                if (hashes[head] != hashes[a] || !equal.SamePosition(head, a)) {
+                    continue;
+                }
+                unsigned int last = head;
+                for (unsigned int u = head; u != NoVertex; last = u, u = nextSamePosition[u]) {
+                    if (equal(u, a)) {
+                        representative[a] = u;
+                        break;
+                    }
+                }
+                if (representative[a] == a) {
+                    nextSamePosition[last] = a;
+                    nextSamePosition[a] = NoVertex;
+                }
+                break;
+            }
+        }
+    });
+}
 
 template<class XMesh>
 void updateXMeshVertices(XMesh *pMesh, std::vector<int> &uniqueVertices) {
@@ -200,14 +366,20 @@ void updateXMeshVertices(XMesh *pMesh, std::vector<int> &uniqueVertices) {
             pMesh->mBitangents[a] = oldBitangents[uniqueVertices[a]];
     }
     // Vertex colors
-    for (unsigned int a = 0; pMesh->HasVertexColors(a); a++) {
+    for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_COLOR_SETS; a++) {
+        if (!pMesh->HasVertexColors(a)) {
+            continue;
+        }
         std::unique_ptr<aiColor4D[]> oldColors(pMesh->mColors[a]);
         pMesh->mColors[a] = new aiColor4D[pMesh->mNumVertices];
         for (unsigned int b = 0; b < pMesh->mNumVertices; b++)
             pMesh->mColors[a][b] = oldColors[uniqueVertices[b]];
     }
     // Texture coords
-    for (unsigned int a = 0; pMesh->HasTextureCoords(a); a++) {
+    for (unsigned int a = 0; a < AI_MAX_NUMBER_OF_TEXTURECOORDS; a++) {
+        if (!pMesh->HasTextureCoords(a)) {
+            continue;
+        }
         std::unique_ptr<aiVector3D[]> oldTextureCoords(pMesh->mTextureCoords[a]);
         pMesh->mTextureCoords[a] = new aiVector3D[pMesh->mNumVertices];
         for (unsigned int b = 0; b < pMesh->mNumVertices; b++)
@@ -254,49 +426,25 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex) {
     static_assert(AI_MAX_VERTICES == 0x7fffffff, "AI_MAX_VERTICES == 0x7fffffff");
     std::vector<unsigned int> replaceIndex( pMesh->mNumVertices, 0xffffffff);
 
-    // Run an optimized code path if we don't have multiple UVs or vertex colors.
-    // This should yield false in more than 99% of all imports ...
-    const bool hasAnimMeshes = pMesh->mNumAnimMeshes > 0;
+    // find the vertex each vertex is joined with, this is the expensive part
+    std::vector<unsigned int> representative(pMesh->mNumVertices, NoVertex);
+    FindRepresentatives(pMesh, usedVertexIndicesMask, threadPool, representative);
 
-    // We'll never have more vertices afterwards.
-    std::vector<std::vector<int>> uniqueAnimatedVertices;
-    if (hasAnimMeshes) {
-        uniqueAnimatedVertices.resize(pMesh->mNumAnimMeshes);
-        for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
-            uniqueAnimatedVertices[animMeshIndex].reserve(pMesh->mNumVertices);
-        }
-    }
-    // a map that maps a vertex to its new index
-    std::unordered_map<Vertex, int, HashVertex, CompareVerticesAlmostEqual> vertex2Index = {};
-    // we can not end up with more vertices than we started with
-    // Now check each vertex if it brings something new to the table
+    // Now number the unique vertices in the order of their first use
     int newIndex = 0;
     for( unsigned int a = 0; a < pMesh->mNumVertices; a++)  {
         // if the vertex is unused Do nothing
         if (!usedVertexIndicesMask[a]) {
             continue;
         }
-        // collect the vertex data
-        Vertex v(pMesh,a);
-        // is the vertex already in the map?
-        auto it = vertex2Index.find(v);
-        // if the vertex is not in the map then it is a new vertex add it.
-        if (it == vertex2Index.end()) {
+        const unsigned int rep = representative[a];
+        if (rep == a) {
             // this is a new vertex give it a new index
-            vertex2Index.emplace(v, newIndex);
-            // keep track of its index and increment 1
             replaceIndex[a] = newIndex++;
-            // add the vertex to the unique vertices
             uniqueVertices.push_back(a);
-            if (hasAnimMeshes) {
-                for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
-                    uniqueAnimatedVertices[animMeshIndex].emplace_back(a);
-                }
-            }
-        } else{
-            // if the vertex is already there just find the replace index that is appropriate to it
-			// mark it with JOINED_VERTICES_MARK
-            replaceIndex[a] = it->second | JOINED_VERTICES_MARK;
+        } else {
+            // the vertex is already there, mark it with JOINED_VERTICES_MARK
+            replaceIndex[a] = replaceIndex[rep] | JOINED_VERTICES_MARK;
         }
     }
 
@@ -315,10 +463,9 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex) {
     }
 
     updateXMeshVertices(pMesh, uniqueVertices);
-    if (hasAnimMeshes) {
-        for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
-            updateXMeshVertices(pMesh->mAnimMeshes[animMeshIndex], uniqueAnimatedVertices[animMeshIndex]);
-        }
+    // the anim meshes keep the same vertices as the mesh itself
+    for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
+        updateXMeshVertices(pMesh->mAnimMeshes[animMeshIndex], uniqueVertices);
     }
 
     // adjust the indices in all faces
@@ -75,6 +75,12 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** The step only works on one mesh at a time, so meshes may be
+    *  processed concurrently.
+    */
+    bool IsMeshLocal() const override;
+
     // -------------------------------------------------------------------
     /** Executes the post processing step on the given imported data.
     * At the moment a process is not supposed to fail.
@@ -64,6 +64,12 @@ bool LimitBoneWeightsProcess::IsActive( unsigned int pFlags) const {
     return (pFlags & aiProcess_LimitBoneWeights) != 0;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently from each other.
+bool LimitBoneWeightsProcess::IsMeshLocal() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void LimitBoneWeightsProcess::Execute( aiScene* pScene) {
@@ -71,9 +77,9 @@ void LimitBoneWeightsProcess::Execute( aiScene* pScene) {
 
     ASSIMP_LOG_DEBUG("LimitBoneWeightsProcess begin");
 
-    for (unsigned int m = 0; m < pScene->mNumMeshes; ++m) {
+    ForEachMesh(pScene, [this, pScene](unsigned int m) {
         ProcessMesh(pScene->mMeshes[m]);
-    }
+    });
 
     ASSIMP_LOG_DEBUG("LimitBoneWeightsProcess end");
 }
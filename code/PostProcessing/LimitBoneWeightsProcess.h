@@ -87,6 +87,12 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** The step only works on one mesh at a time, so meshes may be
+    *  processed concurrently.
+    */
+    bool IsMeshLocal() const override;
+
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
     * The function is a request to the process to update its configuration
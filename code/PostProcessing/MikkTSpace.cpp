@@ -0,0 +1,999 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Implementation of the MikkTSpace tangent space generator.
+ *
+ *  The structure follows mikktspace.c: the faces are split into triangles,
+ *  the corners are welded by position, normal and texture coordinate, each
+ *  triangle gets its first order derivatives and its neighbours, and the
+ *  triangles around each welded vertex are grouped by the orientation of
+ *  their texture mapping. The tangent space of a group is the angle weighted
+ *  average of the derivatives of its triangles.
+ */
+
+#include "MikkTSpace.h"
+#include "Common/ThreadPool.h"
+
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/mesh.h>
+#include <assimp/qnan.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+
+// Below this number of triangles or groups everything runs on the calling thread
+const size_t ParallelThreshold = 1 << 12;
+
+// Triangle flags, the same as in mikktspace.c
+const int MarkDegenerate = 1;
+const int QuadOneDegenTri = 2;
+const int GroupWithAny = 4;
+const int OrientPreserving = 8;
+
+// --------------------------------------------------------------------------------------------
+// Runs fn(begin, end) on consecutive chunks of [0, count), on the pool if there is one.
+template <typename Func>
+void ForEachChunk(ThreadPool *pool, size_t count, Func fn) {
+    if (nullptr == pool || 0 == pool->GetNumWorkers() || count < ParallelThreshold) {
+        fn(size_t(0), count);
+        return;
+    }
+    const size_t numChunks = static_cast<size_t>(pool->GetNumWorkers()) + 1;
+    const size_t chunkSize = (count + numChunks - 1) / numChunks;
+    pool->ParallelFor(numChunks, [&](size_t chunk) {
+        const size_t begin = std::min(count, chunk * chunkSize);
+        fn(begin, std::min(count, begin + chunkSize));
+    });
+}
+
+// --------------------------------------------------------------------------------------------
+// The vector helpers of mikktspace.c. They are spelled out instead of using the operators of
+// aiVector3t, so every floating-point operation happens in the same order as there.
+using Vec = aiVector3f;
+
+inline bool NotZero(float f) {
+    return std::fabs(f) > std::numeric_limits<float>::min();
+}
+
+inline bool VNotZero(const Vec &v) {
+    return NotZero(v.x) || NotZero(v.y) || NotZero(v.z);
+}
+
+inline bool Equal(const Vec &a, const Vec &b) {
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+inline Vec Add(const Vec &a, const Vec &b) {
+    return Vec(a.x + b.x, a.y + b.y, a.z + b.z);
+}
+
+inline Vec Sub(const Vec &a, const Vec &b) {
+    return Vec(a.x - b.x, a.y - b.y, a.z - b.z);
+}
+
+inline Vec Scale(float s, const Vec &v) {
+    return Vec(s * v.x, s * v.y, s * v.z);
+}
+
+inline float Dot(const Vec &a, const Vec &b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+inline float Length(const Vec &v) {
+    return std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+}
+
+inline Vec Normalize(const Vec &v) {
+    return Scale(1 / Length(v), v);
+}
+
+// Removes the part of v along n and normalizes the rest, unless it is zero
+inline Vec Project(const Vec &n, const Vec &v) {
+    const Vec r = Sub(v, Scale(Dot(n, v), n));
+    return VNotZero(r) ? Normalize(r) : r;
+}
+
+// --------------------------------------------------------------------------------------------
+// A triangle of the algorithm
+struct TriInfo {
+    int mNeighbors[3];
+    int mGroup[3];
+    // normalized first order derivatives and their original magnitudes
+    Vec mOs, mOt;
+    float mMagS, mMagT;
+    int mOrgFace;
+    int mFlag;
+    int mTSpaceOffset;
+    unsigned char mVertNum[4];
+};
+
+// The triangles sharing a welded vertex and the orientation of their mapping
+struct Group {
+    int mNumFaces;
+    int mFaceOffset;
+    int mVertexRep;
+    bool mOrientPreserving;
+};
+
+// The tangent space of a face corner
+struct TSpace {
+    Vec mOs;
+    float mMagS;
+    Vec mOt;
+    float mMagT;
+    int mCounter;
+    bool mOrient;
+};
+
+// An edge of a triangle, between two welded corners
+struct Edge {
+    int mI0, mI1, mFace;
+
+    bool operator<(const Edge &o) const {
+        if (mI0 != o.mI0) {
+            return mI0 < o.mI0;
+        }
+        return mI1 != o.mI1 ? mI1 < o.mI1 : mFace < o.mFace;
+    }
+};
+
+// Position, normal and texture coordinate of a corner, for welding
+struct WeldKey {
+    float mData[8];
+
+    bool operator==(const WeldKey &o) const {
+        for (unsigned int i = 0; i < 8; ++i) {
+            if (!(mData[i] == o.mData[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+struct WeldKeyHash {
+    size_t operator()(const WeldKey &k) const {
+        size_t hash = 0;
+        for (float f : k.mData) {
+            // +0 and -0 compare equal and must hash alike
+            f += 0.0f;
+            uint32_t bits;
+            ::memcpy(&bits, &f, sizeof(bits));
+            hash = (hash ^ bits) * size_t(0x100000001b3);
+        }
+        return hash;
+    }
+};
+
+// --------------------------------------------------------------------------------------------
+class Generator {
+public:
+    Generator(const aiMesh *pMesh, unsigned int uvChannel, ThreadPool *pool);
+
+    // Computes the tangent space of every corner, returns false if there is no triangle
+    bool Run();
+
+    // Writes the tangents and bitangents into the mesh
+    void Store(aiMesh *pMesh) const;
+
+private:
+    const Vec &Position(int corner) const { return mPositions[mCornerVertex[corner]]; }
+    const Vec &Normal(int corner) const { return mNormals[mCornerVertex[corner]]; }
+    const Vec &TexCoord(int corner) const { return mTexCoords[mCornerVertex[corner]]; }
+
+    void GenerateInitialTriangles();
+    void WeldCorners();
+    void MarkDegenerates();
+    void DegenPrologue();
+    void InitTriInfo();
+    void BuildNeighbors();
+    void BuildGroups();
+    bool AssignToGroup(int face, int group);
+    void GenerateTSpaces();
+    TSpace EvalTSpace(const std::vector<int> &faces, int vertexRep) const;
+    void DegenEpilogue();
+
+    float CalcTexArea(int tri) const;
+
+private:
+    ThreadPool *mPool;
+    std::vector<Vec> mPositions, mNormals, mTexCoords;
+
+    // the faces of the algorithm: triangles, quads and the fan triangles of larger polygons
+    std::vector<unsigned int> mFaceStart;
+    std::vector<unsigned int> mCornerVertex;
+
+    int mNumTrianglesIn = 0;
+    int mTotalTriangles = 0;
+    std::vector<int> mTriList;
+    std::vector<TriInfo> mTris;
+    std::vector<Group> mGroups;
+    std::vector<int> mGroupFaces;
+    std::vector<TSpace> mSpaces;
+};
+
+// --------------------------------------------------------------------------------------------
+Generator::Generator(const aiMesh *pMesh, unsigned int uvChannel, ThreadPool *pool) :
+        mPool(pool) {
+    // MikkTSpace works on single precision, whatever the precision of the mesh
+    const aiVector3D *uv = pMesh->mTextureCoords[uvChannel];
+    mPositions.resize(pMesh->mNumVertices);
+    mNormals.resize(pMesh->mNumVertices);
+    mTexCoords.resize(pMesh->mNumVertices);
+    for (unsigned int i = 0; i < pMesh->mNumVertices; ++i) {
+        const aiVector3D &p = pMesh->mVertices[i], &n = pMesh->mNormals[i];
+        mPositions[i] = Vec(static_cast<float>(p.x), static_cast<float>(p.y), static_cast<float>(p.z));
+        mNormals[i] = Vec(static_cast<float>(n.x), static_cast<float>(n.y), static_cast<float>(n.z));
+        mTexCoords[i] = Vec(static_cast<float>(uv[i].x), static_cast<float>(uv[i].y), 1.0f);
+    }
+
+    mFaceStart.push_back(0);
+    for (unsigned int a = 0; a < pMesh->mNumFaces; ++a) {
+        const aiFace &face = pMesh->mFaces[a];
+        if (face.mNumIndices < 3) {
+            continue;
+        }
+        if (face.mNumIndices <= 4) {
+            mCornerVertex.insert(mCornerVertex.end(), face.mIndices, face.mIndices + face.mNumIndices);
+            mFaceStart.push_back(static_cast<unsigned int>(mCornerVertex.size()));
+            continue;
+        }
+        // larger polygons are not supported by MikkTSpace, they are handed over as a fan
+        for (unsigned int i = 2; i < face.mNumIndices; ++i) {
+            mCornerVertex.push_back(face.mIndices[0]);
+            mCornerVertex.push_back(face.mIndices[i - 1]);
+            mCornerVertex.push_back(face.mIndices[i]);
+            mFaceStart.push_back(static_cast<unsigned int>(mCornerVertex.size()));
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------
+bool Generator::Run() {
+    const size_t numFaces = mFaceStart.size() - 1;
+    for (size_t f = 0; f < numFaces; ++f) {
+        mTotalTriangles += mFaceStart[f + 1] - mFaceStart[f] == 3 ? 1 : 2;
+    }
+    if (mTotalTriangles <= 0) {
+        return false;
+    }
+
+    GenerateInitialTriangles();
+    WeldCorners();
+    MarkDegenerates();
+    DegenPrologue();
+    InitTriInfo();
+    BuildGroups();
+
+    TSpace def;
+    def.mOs = Vec(1.0f, 0.0f, 0.0f);
+    def.mMagS = 1.0f;
+    def.mOt = Vec(0.0f, 1.0f, 0.0f);
+    def.mMagT = 1.0f;
+    def.mCounter = 0;
+    def.mOrient = false;
+    mSpaces.assign(mCornerVertex.size(), def);
+
+    GenerateTSpaces();
+    DegenEpilogue();
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------
+// Splits the faces into triangles, quads along the shorter diagonal
+void Generator::GenerateInitialTriangles() {
+    mTris.resize(mTotalTriangles);
+    mTriList.resize(3 * mTotalTriangles);
+
+    int dst = 0;
+    for (size_t f = 0; f + 1 < mFaceStart.size(); ++f) {
+        const int offset = static_cast<int>(mFaceStart[f]);
+        const int verts = static_cast<int>(mFaceStart[f + 1]) - offset;
+        mTris[dst].mOrgFace = static_cast<int>(f);
+        mTris[dst].mTSpaceOffset = offset;
+        if (verts == 3) {
+            for (int i = 0; i < 3; ++i) {
+                mTris[dst].mVertNum[i] = static_cast<unsigned char>(i);
+                mTriList[dst * 3 + i] = offset + i;
+            }
+            ++dst;
+            continue;
+        }
+
+        mTris[dst + 1].mOrgFace = static_cast<int>(f);
+        mTris[dst + 1].mTSpaceOffset = offset;
+
+        // the split must not depend on the order of the corners, so it takes the shorter diagonal
+        const int i0 = offset, i1 = offset + 1, i2 = offset + 2, i3 = offset + 3;
+        const Vec t02 = Sub(TexCoord(i2), TexCoord(i0)), t13 = Sub(TexCoord(i3), TexCoord(i1));
+        const float distSq02 = Dot(t02, t02), distSq13 = Dot(t13, t13);
+        bool diagIs02;
+        if (distSq02 < distSq13) {
+            diagIs02 = true;
+        } else if (distSq13 < distSq02) {
+            diagIs02 = false;
+        } else {
+            const Vec p02 = Sub(Position(i2), Position(i0)), p13 = Sub(Position(i3), Position(i1));
+            diagIs02 = !(Dot(p13, p13) < Dot(p02, p02));
+        }
+
+        static const unsigned char split02[2][3] = { { 0, 1, 2 }, { 0, 2, 3 } };
+        static const unsigned char split13[2][3] = { { 0, 1, 3 }, { 1, 2, 3 } };
+        const unsigned char(*split)[3] = diagIs02 ? split02 : split13;
+        for (int t = 0; t < 2; ++t, ++dst) {
+            for (int i = 0; i < 3; ++i) {
+                mTris[dst].mVertNum[i] = split[t][i];
+                mTriList[dst * 3 + i] = offset + split[t][i];
+            }
+        }
+    }
+
+    for (TriInfo &tri : mTris) {
+        tri.mFlag = 0;
+    }
+}
+
+// --------------------------------------------------------------------------------------------
+// Replaces every corner by the first corner with the same position, normal and texture coordinate
+void Generator::WeldCorners() {
+    std::unordered_map<WeldKey, int, WeldKeyHash> firstCorner;
+    firstCorner.reserve(mTriList.size());
+    for (int &corner : mTriList) {
+        const Vec &p = Position(corner), &n = Normal(corner), &t = TexCoord(corner);
+        const WeldKey key = { { p.x, p.y, p.z, n.x, n.y, n.z, t.x, t.y } };
+        bool hasNaN = false;
+        for (float f : key.mData) {
+            hasNaN |= f != f;
+        }
+        // NaN never compares equal, so such corners are not welded with anything
+        if (!hasNaN) {
+            corner = firstCorner.emplace(key, corner).first->second;
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------
+void Generator::MarkDegenerates() {
+    int numDegenerates = 0;
+    for (int t = 0; t < mTotalTriangles; ++t) {
+        const Vec &p0 = Position(mTriList[t * 3]), &p1 = Position(mTriList[t * 3 + 1]), &p2 = Position(mTriList[t * 3 + 2]);
+        if (Equal(p0, p1) || Equal(p0, p2) || Equal(p1, p2)) {
+            mTris[t].mFlag |= MarkDegenerate;
+            ++numDegenerates;
+        }
+    }
+    mNumTrianglesIn = mTotalTriangles - numDegenerates;
+}
+
+// --------------------------------------------------------------------------------------------
+// Marks the quads with one degenerate triangle and moves all degenerate triangles to the end,
+// keeping the order of the good ones
+void Generator::DegenPrologue() {
+    for (int t = 0; t + 1 < mTotalTriangles;) {
+        if (mTris[t].mOrgFace != mTris[t + 1].mOrgFace) {
+            ++t;
+            continue;
+        }
+        const bool degA = (mTris[t].mFlag & MarkDegenerate) != 0;
+        const bool degB = (mTris[t + 1].mFlag & MarkDegenerate) != 0;
+        if (degA != degB) {
+            mTris[t].mFlag |= QuadOneDegenTri;
+            mTris[t + 1].mFlag |= QuadOneDegenTri;
+        }
+        t += 2;
+    }
+
+    if (mNumTrianglesIn == mTotalTriangles) {
+        return;
+    }
+    std::vector<int> order;
+    order.reserve(mTotalTriangles);
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int t = 0; t < mTotalTriangles; ++t) {
+            if (((mTris[t].mFlag & MarkDegenerate) != 0) == (pass != 0)) {
+                order.push_back(t);
+            }
+        }
+    }
+    std::vector<TriInfo> tris(mTotalTriangles);
+    std::vector<int> triList(mTriList.size());
+    for (int t = 0; t < mTotalTriangles; ++t) {
+        tris[t] = mTris[order[t]];
+        for (int i = 0; i < 3; ++i) {
+            triList[t * 3 + i] = mTriList[order[t] * 3 + i];
+        }
+    }
+    mTris.swap(tris);
+    mTriList.swap(triList);
+}
+
+// --------------------------------------------------------------------------------------------
+// Twice the texture space area of a triangle
+float Generator::CalcTexArea(int tri) const {
+    const Vec &t1 = TexCoord(mTriList[tri * 3]), &t2 = TexCoord(mTriList[tri * 3 + 1]), &t3 = TexCoord(mTriList[tri * 3 + 2]);
+    const float t21x = t2.x - t1.x, t21y = t2.y - t1.y;
+    const float t31x = t3.x - t1.x, t31y = t3.y - t1.y;
+    const float signedAreaSTx2 = t21x * t31y - t21y * t31x;
+    return signedAreaSTx2 < 0 ? -signedAreaSTx2 : signedAreaSTx2;
+}
+
+// --------------------------------------------------------------------------------------------
+// Evaluates the first order derivatives and the neighbours of the good triangles
+void Generator::InitTriInfo() {
+    ForEachChunk(mPool, static_cast<size_t>(mNumTrianglesIn), [&](size_t begin, size_t end) {
+        for (size_t f = begin; f < end; ++f) {
+            TriInfo &tri = mTris[f];
+            for (int i = 0; i < 3; ++i) {
+                tri.mNeighbors[i] = -1;
+                tri.mGroup[i] = -1;
+            }
+            tri.mOs = Vec(0.0f, 0.0f, 0.0f);
+            tri.mOt = Vec(0.0f, 0.0f, 0.0f);
+            tri.mMagS = 0;
+            tri.mMagT = 0;
+            // assumed bad
+            tri.mFlag |= GroupWithAny;
+
+            const int *corners = &mTriList[f * 3];
+            const Vec &v1 = Position(corners[0]), &v2 = Position(corners[1]), &v3 = Position(corners[2]);
+            const Vec &t1 = TexCoord(corners[0]), &t2 = TexCoord(corners[1]), &t3 = TexCoord(corners[2]);
+
+            const float t21x = t2.x - t1.x, t21y = t2.y - t1.y;
+            const float t31x = t3.x - t1.x, t31y = t3.y - t1.y;
+            const Vec d1 = Sub(v2, v1), d2 = Sub(v3, v1);
+
+            const float signedAreaSTx2 = t21x * t31y - t21y * t31x;
+            const Vec os = Sub(Scale(t31y, d1), Scale(t21y, d2));
+            const Vec ot = Add(Scale(-t31x, d1), Scale(t21x, d2));
+
+            tri.mFlag |= signedAreaSTx2 > 0 ? OrientPreserving : 0;
+            if (!NotZero(signedAreaSTx2)) {
+                continue;
+            }
+            const float absArea = std::fabs(signedAreaSTx2);
+            const float lenOs = Length(os), lenOt = Length(ot);
+            const float sign = (tri.mFlag & OrientPreserving) == 0 ? -1.0f : 1.0f;
+            if (NotZero(lenOs)) {
+                tri.mOs = Scale(sign / lenOs, os);
+            }
+            if (NotZero(lenOt)) {
+                tri.mOt = Scale(sign / lenOt, ot);
+            }
+
+            // magnitudes prior to the normalization of os and ot
+            tri.mMagS = lenOs / absArea;
+            tri.mMagT = lenOt / absArea;
+
+            if (NotZero(tri.mMagS) && NotZero(tri.mMagT)) {
+                tri.mFlag &= ~GroupWithAny;
+            }
+        }
+    });
+
+    // force otherwise healthy quads to a fixed orientation
+    for (int t = 0; t + 1 < mNumTrianglesIn;) {
+        if (mTris[t].mOrgFace != mTris[t + 1].mOrgFace) {
+            ++t;
+            continue;
+        }
+        const bool degA = (mTris[t].mFlag & MarkDegenerate) != 0;
+        const bool degB = (mTris[t + 1].mFlag & MarkDegenerate) != 0;
+        const bool orientA = (mTris[t].mFlag & OrientPreserving) != 0;
+        const bool orientB = (mTris[t + 1].mFlag & OrientPreserving) != 0;
+        // if this happens the quad has an extremely bad mapping
+        if (!degA && !degB && orientA != orientB) {
+            const bool chooseFirst = (mTris[t + 1].mFlag & GroupWithAny) != 0 || CalcTexArea(t) >= CalcTexArea(t + 1);
+            const int t0 = chooseFirst ? t : t + 1, t1 = chooseFirst ? t + 1 : t;
+            mTris[t1].mFlag &= ~OrientPreserving;
+            mTris[t1].mFlag |= mTris[t0].mFlag & OrientPreserving;
+        }
+        t += 2;
+    }
+
+    BuildNeighbors();
+}
+
+// --------------------------------------------------------------------------------------------
+// Resolves which edge of a triangle (i0, i1) is and returns its corners in triangle order
+void GetEdge(int &i0Out, int &i1Out, int &edgeOut, const int *corners, int i0, int i1) {
+    if (corners[0] == i0 || corners[0] == i1) {
+        if (corners[1] == i0 || corners[1] == i1) {
+            edgeOut = 0;
+            i0Out = corners[0];
+            i1Out = corners[1];
+        } else {
+            edgeOut = 2;
+            i0Out = corners[2];
+            i1Out = corners[0];
+        }
+    } else {
+        edgeOut = 1;
+        i0Out = corners[1];
+        i1Out = corners[2];
+    }
+}
+
+// --------------------------------------------------------------------------------------------
+// Pairs up the triangles sharing an edge in opposite directions. If more than two triangles
+// use an edge, they are paired in the order of their index
+void Generator::BuildNeighbors() {
+    std::vector<Edge> edges(static_cast<size_t>(mNumTrianglesIn) * 3);
+    for (int f = 0; f < mNumTrianglesIn; ++f) {
+        for (int i = 0; i < 3; ++i) {
+            const int i0 = mTriList[f * 3 + i];
+            const int i1 = mTriList[f * 3 + (i < 2 ? i + 1 : 0)];
+            edges[f * 3 + i] = { std::min(i0, i1), std::max(i0, i1), f };
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    for (size_t i = 0; i < edges.size(); ++i) {
+        const Edge &edge = edges[i];
+        int i0A, i1A, edgeA;
+        GetEdge(i0A, i1A, edgeA, &mTriList[edge.mFace * 3], edge.mI0, edge.mI1);
+        if (mTris[edge.mFace].mNeighbors[edgeA] != -1) {
+            continue;
+        }
+        for (size_t j = i + 1; j < edges.size() && edges[j].mI0 == edge.mI0 && edges[j].mI1 == edge.mI1; ++j) {
+            const int t = edges[j].mFace;
+            int i0B, i1B, edgeB;
+            // flipped, the neighbour runs along the edge the other way round
+            GetEdge(i1B, i0B, edgeB, &mTriList[t * 3], edges[j].mI0, edges[j].mI1);
+            if (i0A == i0B && i1A == i1B && mTris[t].mNeighbors[edgeB] == -1) {
+                mTris[edge.mFace].mNeighbors[edgeA] = t;
+                mTris[t].mNeighbors[edgeB] = edge.mFace;
+                break;
+            }
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------
+// Groups the triangles around each welded vertex by connectivity and the orientation of their
+// mapping, the four rules of MikkTSpace
+void Generator::BuildGroups() {
+    mGroupFaces.reserve(static_cast<size_t>(mNumTrianglesIn) * 3);
+    std::vector<int> stack;
+    for (int f = 0; f < mNumTrianglesIn; ++f) {
+        for (int i = 0; i < 3; ++i) {
+            TriInfo &tri = mTris[f];
+            if ((tri.mFlag & GroupWithAny) != 0 || tri.mGroup[i] != -1) {
+                continue;
+            }
+            const int g = static_cast<int>(mGroups.size());
+            Group group;
+            group.mNumFaces = 1;
+            group.mFaceOffset = static_cast<int>(mGroupFaces.size());
+            group.mVertexRep = mTriList[f * 3 + i];
+            group.mOrientPreserving = (tri.mFlag & OrientPreserving) != 0;
+            mGroups.push_back(group);
+            mGroupFaces.push_back(f);
+            tri.mGroup[i] = g;
+
+            // walk around the vertex in both directions, the left neighbour first
+            stack.clear();
+            const int *neighbors = tri.mNeighbors;
+            for (int n : { neighbors[i > 0 ? i - 1 : 2], neighbors[i] }) {
+                if (n >= 0) {
+                    stack.push_back(n);
+                }
+            }
+            while (!stack.empty()) {
+                const int t = stack.back();
+                stack.pop_back();
+                if (!AssignToGroup(t, g)) {
+                    continue;
+                }
+                const int k = mTris[t].mGroup[0] == g ? 0 : (mTris[t].mGroup[1] == g ? 1 : 2);
+                for (int n : { mTris[t].mNeighbors[k > 0 ? k - 1 : 2], mTris[t].mNeighbors[k] }) {
+                    if (n >= 0) {
+                        stack.push_back(n);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------
+// Adds a triangle to a group unless it is in there already or its mapping is oriented the other way
+bool Generator::AssignToGroup(int face, int g) {
+    TriInfo &tri = mTris[face];
+    Group &group = mGroups[g];
+    const int *corners = &mTriList[face * 3];
+    const int i = corners[0] == group.mVertexRep ? 0 : (corners[1] == group.mVertexRep ? 1 : (corners[2] == group.mVertexRep ? 2 : -1));
+    if (i < 0 || tri.mGroup[i] != -1) {
+        return false;
+    }
+
+    // the first group to take a triangle without a proper mapping determines its orientation
+    if ((tri.mFlag & GroupWithAny) != 0 && tri.mGroup[0] == -1 && tri.mGroup[1] == -1 && tri.mGroup[2] == -1) {
+        tri.mFlag &= ~OrientPreserving;
+        tri.mFlag |= group.mOrientPreserving ? OrientPreserving : 0;
+    }
+    if (((tri.mFlag & OrientPreserving) != 0) != group.mOrientPreserving) {
+        return false;
+    }
+
+    mGroupFaces.push_back(face);
+    ++group.mNumFaces;
+    tri.mGroup[i] = g;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------
+// Averages the projected derivatives of the triangles around a vertex, weighted by the angle
+// of each triangle at the vertex
+TSpace Generator::EvalTSpace(const std::vector<int> &faces, int vertexRep) const {
+    TSpace res;
+    res.mOs = Vec(0.0f, 0.0f, 0.0f);
+    res.mOt = Vec(0.0f, 0.0f, 0.0f);
+    res.mMagS = 0;
+    res.mMagT = 0;
+    res.mCounter = 0;
+    res.mOrient = false;
+    float angleSum = 0;
+
+    for (int f : faces) {
+        const TriInfo &tri = mTris[f];
+        // only valid triangles contribute
+        if ((tri.mFlag & GroupWithAny) != 0) {
+            continue;
+        }
+        const int *corners = &mTriList[f * 3];
+        const int i = corners[0] == vertexRep ? 0 : (corners[1] == vertexRep ? 1 : 2);
+
+        const Vec &n = Normal(corners[i]);
+        const Vec os = Project(n, tri.mOs), ot = Project(n, tri.mOt);
+
+        const Vec &p0 = Position(corners[i > 0 ? i - 1 : 2]);
+        const Vec &p1 = Position(corners[i]);
+        const Vec &p2 = Position(corners[i < 2 ? i + 1 : 0]);
+        const Vec v1 = Project(n, Sub(p0, p1)), v2 = Project(n, Sub(p2, p1));
+
+        // weight the contribution by the angle between the two edges
+        float cosine = Dot(v1, v2);
+        cosine = cosine > 1 ? 1 : (cosine < -1 ? -1 : cosine);
+        const float angle = static_cast<float>(std::acos(static_cast<double>(cosine)));
+
+        res.mOs = Add(res.mOs, Scale(angle, os));
+        res.mOt = Add(res.mOt, Scale(angle, ot));
+        res.mMagS += angle * tri.mMagS;
+        res.mMagT += angle * tri.mMagT;
+        angleSum += angle;
+    }
+
+    if (VNotZero(res.mOs)) {
+        res.mOs = Normalize(res.mOs);
+    }
+    if (VNotZero(res.mOt)) {
+        res.mOt = Normalize(res.mOt);
+    }
+    if (angleSum > 0) {
+        res.mMagS /= angleSum;
+        res.mMagT /= angleSum;
+    }
+    return res;
+}
+
+// --------------------------------------------------------------------------------------------
+// Merges the tangent spaces a quad corner gets from its two triangles
+TSpace AvgTSpace(const TSpace &ts0, const TSpace &ts1) {
+    // averaging two equal spaces would change them slightly, which splits them later on
+    if (ts0.mMagS == ts1.mMagS && ts0.mMagT == ts1.mMagT && Equal(ts0.mOs, ts1.mOs) && Equal(ts0.mOt, ts1.mOt)) {
+        return ts0;
+    }
+    TSpace res = ts0;
+    res.mMagS = 0.5f * (ts0.mMagS + ts1.mMagS);
+    res.mMagT = 0.5f * (ts0.mMagT + ts1.mMagT);
+    res.mOs = Add(ts0.mOs, ts1.mOs);
+    res.mOt = Add(ts0.mOt, ts1.mOt);
+    if (VNotZero(res.mOs)) {
+        res.mOs = Normalize(res.mOs);
+    }
+    if (VNotZero(res.mOt)) {
+        res.mOt = Normalize(res.mOt);
+    }
+    return res;
+}
+
+// --------------------------------------------------------------------------------------------
+// Computes the tangent space of every corner of the good triangles. The groups are evaluated
+// concurrently, then the results are written to the corners in group order.
+void Generator::GenerateTSpaces() {
+    // MikkTSpace's default angular threshold of 180 degrees, evaluated the way it does it
+    const float thresCos = static_cast<float>(std::cos(static_cast<double>((180.0f * static_cast<float>(AI_MATH_PI)) / 180.0f)));
+
+    // the tangent space of each triangle of each group, laid out like mGroupFaces
+    std::vector<TSpace> results(mGroupFaces.size());
+    ForEachChunk(mPool, mGroups.size(), [&](size_t begin, size_t end) {
+        std::vector<std::vector<int>> subGroups;
+        std::vector<TSpace> subSpaces;
+        std::vector<int> members;
+        for (size_t g = begin; g < end; ++g) {
+            const Group &group = mGroups[g];
+            const int *faces = &mGroupFaces[group.mFaceOffset];
+            const Vec &n = Normal(group.mVertexRep);
+            subGroups.clear();
+            subSpaces.clear();
+            for (int i = 0; i < group.mNumFaces; ++i) {
+                const TriInfo &tri = mTris[faces[i]];
+                const Vec os = Project(n, tri.mOs), ot = Project(n, tri.mOt);
+
+                members.clear();
+                for (int j = 0; j < group.mNumFaces; ++j) {
+                    const TriInfo &other = mTris[faces[j]];
+                    const Vec os2 = Project(n, other.mOs), ot2 = Project(n, other.mOt);
+                    const bool any = ((tri.mFlag | other.mFlag) & GroupWithAny) != 0;
+                    // triangles of the same quad are always joined
+                    const bool sameOrgFace = tri.mOrgFace == other.mOrgFace;
+                    if (any || sameOrgFace || (Dot(os, os2) > thresCos && Dot(ot, ot2) > thresCos)) {
+                        members.push_back(faces[j]);
+                    }
+                }
+                std::sort(members.begin(), members.end());
+
+                const size_t l = std::find(subGroups.begin(), subGroups.end(), members) - subGroups.begin();
+                if (l == subGroups.size()) {
+                    subGroups.push_back(members);
+                    subSpaces.push_back(EvalTSpace(members, group.mVertexRep));
+                }
+                results[group.mFaceOffset + i] = subSpaces[l];
+            }
+        }
+    });
+
+    for (size_t g = 0; g < mGroups.size(); ++g) {
+        const Group &group = mGroups[g];
+        for (int i = 0; i < group.mNumFaces; ++i) {
+            const TriInfo &tri = mTris[mGroupFaces[group.mFaceOffset + i]];
+            const int index = tri.mGroup[0] == static_cast<int>(g) ? 0 : (tri.mGroup[1] == static_cast<int>(g) ? 1 : 2);
+            TSpace &out = mSpaces[tri.mTSpaceOffset + tri.mVertNum[index]];
+            const TSpace &res = results[group.mFaceOffset + i];
+            if (out.mCounter == 1) {
+                out = AvgTSpace(out, res);
+                out.mCounter = 2;
+            } else {
+                out = res;
+                out.mCounter = 1;
+            }
+            out.mOrient = group.mOrientPreserving;
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------
+// Degenerate triangles take the tangent space of the first good corner with the same welded
+// vertex, degenerate quads with one good triangle copy it within the quad
+void Generator::DegenEpilogue() {
+    std::vector<int> firstGood(mCornerVertex.size(), -1);
+    for (int j = 0; j < 3 * mNumTrianglesIn; ++j) {
+        if (firstGood[mTriList[j]] == -1) {
+            firstGood[mTriList[j]] = j;
+        }
+    }
+
+    for (int t = mNumTrianglesIn; t < mTotalTriangles; ++t) {
+        // degenerate triangles of a quad with one good triangle are done below
+        if ((mTris[t].mFlag & QuadOneDegenTri) != 0) {
+            continue;
+        }
+        for (int i = 0; i < 3; ++i) {
+            const int j = firstGood[mTriList[t * 3 + i]];
+            if (j >= 0) {
+                const TriInfo &src = mTris[j / 3];
+                mSpaces[mTris[t].mTSpaceOffset + mTris[t].mVertNum[i]] = mSpaces[src.mTSpaceOffset + src.mVertNum[j % 3]];
+            }
+        }
+    }
+
+    for (int t = 0; t < mNumTrianglesIn; ++t) {
+        const TriInfo &tri = mTris[t];
+        if ((tri.mFlag & QuadOneDegenTri) == 0) {
+            continue;
+        }
+        const int verts = (1 << tri.mVertNum[0]) | (1 << tri.mVertNum[1]) | (1 << tri.mVertNum[2]);
+        const int missing = (verts & 2) == 0 ? 1 : ((verts & 4) == 0 ? 2 : ((verts & 8) == 0 ? 3 : 0));
+        const Vec &dst = Position(tri.mTSpaceOffset + missing);
+        for (int i = 0; i < 3; ++i) {
+            if (Equal(Position(tri.mTSpaceOffset + tri.mVertNum[i]), dst)) {
+                mSpaces[tri.mTSpaceOffset + missing] = mSpaces[tri.mTSpaceOffset + tri.mVertNum[i]];
+                break;
+            }
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------
+// Appends copies of the given vertices to an array of per-vertex data
+template <typename T>
+void AppendCopies(T *&data, unsigned int numVertices, const std::vector<unsigned int> &copyOf) {
+    if (nullptr == data) {
+        return;
+    }
+    T *grown = new T[numVertices + copyOf.size()];
+    std::copy(data, data + numVertices, grown);
+    for (size_t i = 0; i < copyOf.size(); ++i) {
+        grown[numVertices + i] = data[copyOf[i]];
+    }
+    delete[] data;
+    data = grown;
+}
+
+template <typename MeshT>
+void AppendVertexCopies(MeshT *pMesh, const std::vector<unsigned int> &copyOf) {
+    const unsigned int numVertices = pMesh->mNumVertices;
+    AppendCopies(pMesh->mVertices, numVertices, copyOf);
+    AppendCopies(pMesh->mNormals, numVertices, copyOf);
+    AppendCopies(pMesh->mTangents, numVertices, copyOf);
+    AppendCopies(pMesh->mBitangents, numVertices, copyOf);
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+        AppendCopies(pMesh->mColors[i], numVertices, copyOf);
+    }
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+        AppendCopies(pMesh->mTextureCoords[i], numVertices, copyOf);
+    }
+    pMesh->mNumVertices = numVertices + static_cast<unsigned int>(copyOf.size());
+}
+
+// --------------------------------------------------------------------------------------------
+void Generator::Store(aiMesh *pMesh) const {
+    const unsigned int numVertices = pMesh->mNumVertices;
+
+    // The corner whose tangent space each vertex takes. A vertex whose corners got different
+    // tangent spaces is split, its copies are chained through nextCopy.
+    std::vector<int> spaceOf(numVertices, -1);
+    std::vector<int> nextCopy(numVertices, -1);
+    std::vector<unsigned int> copyOf;
+    auto assign = [&](unsigned int &index, size_t corner) {
+        const TSpace &ts = mSpaces[corner];
+        unsigned int v = index;
+        while (spaceOf[v] >= 0) {
+            const TSpace &other = mSpaces[spaceOf[v]];
+            if (other.mOrient == ts.mOrient && other.mOs.x == ts.mOs.x && other.mOs.y == ts.mOs.y && other.mOs.z == ts.mOs.z) {
+                index = v;
+                return;
+            }
+            if (nextCopy[v] < 0) {
+                nextCopy[v] = static_cast<int>(spaceOf.size());
+                spaceOf.push_back(-1);
+                nextCopy.push_back(-1);
+                copyOf.push_back(index);
+            }
+            v = static_cast<unsigned int>(nextCopy[v]);
+        }
+        spaceOf[v] = static_cast<int>(corner);
+        index = v;
+    };
+
+    // walk the faces the way the constructor built the corners, the corners of a larger
+    // polygon are those of the first fan triangle using them
+    size_t c = 0;
+    for (unsigned int a = 0; a < pMesh->mNumFaces; ++a) {
+        aiFace &face = pMesh->mFaces[a];
+        if (face.mNumIndices < 3) {
+            continue;
+        }
+        if (face.mNumIndices <= 4) {
+            for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+                assign(face.mIndices[i], c + i);
+            }
+            c += face.mNumIndices;
+            continue;
+        }
+        assign(face.mIndices[0], c);
+        assign(face.mIndices[1], c + 1);
+        for (unsigned int i = 2; i < face.mNumIndices; ++i) {
+            assign(face.mIndices[i], c + 3 * (i - 2) + 2);
+        }
+        c += 3 * (face.mNumIndices - 2);
+    }
+
+    if (!copyOf.empty()) {
+        AppendVertexCopies(pMesh, copyOf);
+        for (unsigned int a = 0; a < pMesh->mNumAnimMeshes; ++a) {
+            if (pMesh->mAnimMeshes[a]->mNumVertices == numVertices) {
+                AppendVertexCopies(pMesh->mAnimMeshes[a], copyOf);
+            }
+        }
+        for (unsigned int a = 0; a < pMesh->mNumBones; ++a) {
+            aiBone *bone = pMesh->mBones[a];
+            std::vector<aiVertexWeight> weights(bone->mWeights, bone->mWeights + bone->mNumWeights);
+            for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+                const aiVertexWeight &weight = bone->mWeights[w];
+                for (int v = weight.mVertexId < numVertices ? nextCopy[weight.mVertexId] : -1; v >= 0; v = nextCopy[v]) {
+                    weights.emplace_back(static_cast<unsigned int>(v), weight.mWeight);
+                }
+            }
+            if (weights.size() != bone->mNumWeights) {
+                delete[] bone->mWeights;
+                bone->mNumWeights = static_cast<unsigned int>(weights.size());
+                bone->mWeights = new aiVertexWeight[weights.size()];
+                std::copy(weights.begin(), weights.end(), bone->mWeights);
+            }
+        }
+        ASSIMP_LOG_DEBUG("MikkTSpace split ", copyOf.size(), " vertices with more than one tangent space");
+    }
+
+    const float qnan = get_qnan();
+    pMesh->mTangents = new aiVector3D[pMesh->mNumVertices];
+    pMesh->mBitangents = new aiVector3D[pMesh->mNumVertices];
+
+    // points and lines have no tangent space
+    for (unsigned int a = 0; a < pMesh->mNumFaces; ++a) {
+        const aiFace &face = pMesh->mFaces[a];
+        for (unsigned int i = 0; face.mNumIndices < 3 && i < face.mNumIndices; ++i) {
+            pMesh->mTangents[face.mIndices[i]] = aiVector3D(qnan);
+            pMesh->mBitangents[face.mIndices[i]] = aiVector3D(qnan);
+        }
+    }
+
+    for (unsigned int v = 0; v < pMesh->mNumVertices; ++v) {
+        if (spaceOf[v] < 0) {
+            continue;
+        }
+        const TSpace &ts = mSpaces[spaceOf[v]];
+        const aiVector3D tangent(ts.mOs.x, ts.mOs.y, ts.mOs.z);
+        pMesh->mTangents[v] = tangent;
+        pMesh->mBitangents[v] = (pMesh->mNormals[v] ^ tangent) * (ts.mOrient ? ai_real(1.0) : ai_real(-1.0));
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+bool Assimp::ComputeMikkTSpace(aiMesh *pMesh, unsigned int uvChannel, ThreadPool *pool) {
+    Generator generator(pMesh, uvChannel, pool);
+    if (!generator.Run()) {
+        return false;
+    }
+    generator.Store(pMesh);
+    return true;
+}
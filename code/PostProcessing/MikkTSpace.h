@@ -0,0 +1,79 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Declares the MikkTSpace tangent space generator used by the
+ *  CalcTangentsProcess */
+#ifndef AI_MIKKTSPACE_H_INC
+#define AI_MIKKTSPACE_H_INC
+
+struct aiMesh;
+
+namespace Assimp {
+
+class ThreadPool;
+
+// ---------------------------------------------------------------------------
+/** Computes tangents and bitangents the way Morten S. Mikkelsen's MikkTSpace
+ *  reference implementation (mikktspace.c) does, with its default angular
+ *  threshold. All floating-point operations are done in single precision and
+ *  in the same order as there, so the tangents are bit-identical to what a
+ *  baker using MikkTSpace sees for the same triangles.
+ *
+ *  Triangles and quads are passed to the algorithm as they are, larger
+ *  polygons as a triangle fan. Vertices whose corners end up with different
+ *  tangent spaces are split, the copies are appended to the mesh and take
+ *  over all vertex channels, bone weights and animation mesh data of the
+ *  original. The bitangent is stored as cross(normal, tangent) times the
+ *  handedness sign.
+ *
+ *  The evaluation of faces and vertex groups runs on the given pool.
+ *
+ *  @param pMesh The mesh, it must have normals and no tangents yet. Its
+ *    number of vertices may grow.
+ *  @param uvChannel The texture coordinate channel to use.
+ *  @param pool The thread pool to use, may be nullptr.
+ *  @return false if the mesh contains no face the algorithm can use.
+ */
+bool ComputeMikkTSpace(aiMesh *pMesh, unsigned int uvChannel, ThreadPool *pool);
+
+} // end of namespace Assimp
+
+#endif // AI_MIKKTSPACE_H_INC
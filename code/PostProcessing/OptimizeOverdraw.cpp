@@ -0,0 +1,305 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post processing step to reorder the faces
+ *  of a mesh for less overdraw.
+ * <br>
+ * The clustering follows the overdraw part of the paper the cache
+ * optimization is based on:
+ * http://www.cs.princeton.edu/gfx/pubs/Sander_2007_%3ETR/tipsy.pdf
+ */
+
+#include "PostProcessing/OptimizeOverdraw.h"
+
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace Assimp {
+namespace {
+    // Simulates a FIFO vertex cache for one triangle, returns the number of cache misses
+    inline unsigned int UpdateCache(const unsigned int *tri, unsigned int cacheDepth,
+            std::vector<unsigned int> &stamps, unsigned int &stamp) {
+        unsigned int misses = 0;
+        for (unsigned int i = 0; i < 3; ++i) {
+            if (stamp - stamps[tri[i]] > cacheDepth) {
+                stamps[tri[i]] = stamp++;
+                ++misses;
+            }
+        }
+        return misses;
+    }
+
+    unsigned int CountCacheMisses(const std::vector<unsigned int> &indices, unsigned int numVertices, unsigned int cacheDepth) {
+        std::vector<unsigned int> stamps(numVertices, 0);
+        unsigned int stamp = cacheDepth + 1;
+        unsigned int misses = 0;
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            misses += UpdateCache(&indices[i], cacheDepth, stamps, stamp);
+        }
+        return misses;
+    }
+
+    // A triangle which misses the cache with all its vertices starts a new
+    // patch of the mesh, the order can be changed here at no cost
+    std::vector<unsigned int> FindHardBoundaries(const std::vector<unsigned int> &indices, unsigned int numVertices, unsigned int cacheDepth) {
+        std::vector<unsigned int> stamps(numVertices, 0);
+        unsigned int stamp = cacheDepth + 1;
+        std::vector<unsigned int> boundaries;
+        const unsigned int numFaces = static_cast<unsigned int>(indices.size() / 3);
+        for (unsigned int f = 0; f < numFaces; ++f) {
+            if (UpdateCache(&indices[f * 3], cacheDepth, stamps, stamp) == 3 || f == 0) {
+                boundaries.push_back(f);
+            }
+        }
+        return boundaries;
+    }
+
+    // Splits the patches further as soon as the ACMR of the triangles so far is
+    // good enough, measured against the ACMR of the whole patch
+    std::vector<unsigned int> FindSoftBoundaries(const std::vector<unsigned int> &indices, unsigned int numVertices,
+            const std::vector<unsigned int> &patches, unsigned int cacheDepth, float threshold) {
+        std::vector<unsigned int> stamps(numVertices, 0);
+        unsigned int stamp = 0;
+        std::vector<unsigned int> boundaries;
+        const unsigned int numFaces = static_cast<unsigned int>(indices.size() / 3);
+        for (size_t p = 0; p < patches.size(); ++p) {
+            const unsigned int begin = patches[p];
+            const unsigned int end = p + 1 < patches.size() ? patches[p + 1] : numFaces;
+
+            // flush the cache and measure the patch
+            stamp += cacheDepth + 1;
+            unsigned int patchMisses = 0;
+            for (unsigned int f = begin; f < end; ++f) {
+                patchMisses += UpdateCache(&indices[f * 3], cacheDepth, stamps, stamp);
+            }
+            const float patchThreshold = threshold * static_cast<float>(patchMisses) / static_cast<float>(end - begin);
+
+            boundaries.push_back(begin);
+            stamp += cacheDepth + 1;
+            unsigned int misses = 0, faces = 0;
+            for (unsigned int f = begin; f < end; ++f) {
+                misses += UpdateCache(&indices[f * 3], cacheDepth, stamps, stamp);
+                ++faces;
+                if (static_cast<float>(misses) / static_cast<float>(faces) <= patchThreshold) {
+                    boundaries.push_back(f + 1);
+                    stamp += cacheDepth + 1;
+                    misses = faces = 0;
+                }
+            }
+
+            // the last cluster is empty if the last triangle closed it
+            if (boundaries.back() == end) {
+                boundaries.pop_back();
+            }
+        }
+        return boundaries;
+    }
+
+    // The clusters facing away from the center are the likely occluders,
+    // returns the sort key for each cluster
+    std::vector<ai_real> ComputeClusterKeys(const aiMesh *pMesh, const std::vector<unsigned int> &indices,
+            const std::vector<unsigned int> &clusters) {
+        aiVector3D meshCenter;
+        for (unsigned int idx : indices) {
+            meshCenter += pMesh->mVertices[idx];
+        }
+        meshCenter /= static_cast<ai_real>(indices.size());
+
+        std::vector<ai_real> keys(clusters.size());
+        const unsigned int numFaces = static_cast<unsigned int>(indices.size() / 3);
+        for (size_t c = 0; c < clusters.size(); ++c) {
+            const unsigned int end = c + 1 < clusters.size() ? clusters[c + 1] : numFaces;
+            aiVector3D center, normal;
+            ai_real area = 0;
+            for (unsigned int f = clusters[c]; f < end; ++f) {
+                const aiVector3D &p0 = pMesh->mVertices[indices[f * 3]];
+                const aiVector3D &p1 = pMesh->mVertices[indices[f * 3 + 1]];
+                const aiVector3D &p2 = pMesh->mVertices[indices[f * 3 + 2]];
+                const aiVector3D faceNormal = (p1 - p0) ^ (p2 - p0);
+                const ai_real faceArea = faceNormal.Length();
+                center += (p0 + p1 + p2) * (faceArea / 3);
+                normal += faceNormal;
+                area += faceArea;
+            }
+            if (area > 0) {
+                center /= area;
+            }
+            const ai_real normalLength = normal.Length();
+            if (normalLength > 0) {
+                normal /= normalLength;
+            }
+            keys[c] = (center - meshCenter) * normal;
+        }
+        return keys;
+    }
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Constructor to be privately used by Importer
+OptimizeOverdrawProcess::OptimizeOverdrawProcess() :
+        mEnabled(false), mConfigCacheDepth(PP_ICL_PTCACHE_SIZE), mConfigThreshold(PP_ICL_OVERDRAW_THRESHOLD) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether the processing step is present in the given flag field.
+bool OptimizeOverdrawProcess::IsActive(unsigned int pFlags) const {
+    return (pFlags & aiProcess_ImproveCacheLocality) != 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently from each other.
+bool OptimizeOverdrawProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+const char *OptimizeOverdrawProcess::GetName(unsigned int /*pFlags*/) const {
+    return "OptimizeOverdraw";
+}
+
+// ------------------------------------------------------------------------------------------------
+// Setup configuration
+void OptimizeOverdrawProcess::SetupProperties(const Importer *pImp) {
+    mEnabled = pImp->GetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_OVERDRAW, false);
+    mConfigCacheDepth = pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_PTCACHE_SIZE, PP_ICL_PTCACHE_SIZE);
+    mConfigThreshold = pImp->GetPropertyFloat(AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD, PP_ICL_OVERDRAW_THRESHOLD);
+}
+
+// ------------------------------------------------------------------------------------------------
+void OptimizeOverdrawProcess::SetParameters(unsigned int cacheDepth, float threshold) {
+    mEnabled = true;
+    mConfigCacheDepth = cacheDepth;
+    mConfigThreshold = threshold;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on the given imported data.
+void OptimizeOverdrawProcess::Execute(aiScene *pScene) {
+    if (!mEnabled) {
+        return;
+    }
+    if (!pScene->mNumMeshes) {
+        ASSIMP_LOG_DEBUG("OptimizeOverdrawProcess skipped; there are no meshes");
+        return;
+    }
+
+    ASSIMP_LOG_DEBUG("OptimizeOverdrawProcess begin");
+
+    std::vector<std::pair<ai_real, ai_real>> results(pScene->mNumMeshes);
+    ForEachMesh(pScene, [this, pScene, &results](unsigned int a) {
+        results[a] = ProcessMesh(pScene->mMeshes[a]);
+    });
+
+    if (!DefaultLogger::isNullLogger()) {
+        // sum up the cache misses for the averages over all processed meshes
+        ai_real missesIn = 0, missesOut = 0;
+        unsigned int numf = 0, numv = 0, numm = 0;
+        for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+            if (results[a].first > 0) {
+                const aiMesh *mesh = pScene->mMeshes[a];
+                missesIn += results[a].first * mesh->mNumFaces;
+                missesOut += results[a].second * mesh->mNumFaces;
+                numf += mesh->mNumFaces;
+                numv += mesh->mNumVertices;
+                ++numm;
+            }
+        }
+        if (numf > 0) {
+            ASSIMP_LOG_INFO("Overdraw optimized ", numm, " meshes (", numf, " faces). ACMR in: ", missesIn / numf,
+                    " out: ", missesOut / numf, " | ATVR in: ", missesIn / numv, " out: ", missesOut / numv);
+        }
+        ASSIMP_LOG_DEBUG("OptimizeOverdrawProcess finished. ");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reorders the clusters of a specific mesh
+std::pair<ai_real, ai_real> OptimizeOverdrawProcess::ProcessMesh(aiMesh *pMesh) const {
+    ai_assert(nullptr != pMesh);
+
+    const std::pair<ai_real, ai_real> skipped(static_cast<ai_real>(0.f), static_cast<ai_real>(0.f));
+    if (!pMesh->HasFaces() || !pMesh->HasPositions() || pMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE) {
+        return skipped;
+    }
+
+    std::vector<unsigned int> indices(pMesh->mNumFaces * 3);
+    for (unsigned int f = 0; f < pMesh->mNumFaces; ++f) {
+        std::copy(pMesh->mFaces[f].mIndices, pMesh->mFaces[f].mIndices + 3, &indices[f * 3]);
+    }
+
+    const std::vector<unsigned int> patches = FindHardBoundaries(indices, pMesh->mNumVertices, mConfigCacheDepth);
+    const std::vector<unsigned int> clusters = FindSoftBoundaries(indices, pMesh->mNumVertices, patches, mConfigCacheDepth, mConfigThreshold);
+    if (clusters.size() < 2) {
+        return skipped;
+    }
+    const std::vector<ai_real> keys = ComputeClusterKeys(pMesh, indices, clusters);
+
+    std::vector<unsigned int> order(clusters.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&keys](unsigned int a, unsigned int b) {
+        return keys[a] > keys[b];
+    });
+
+    // write the clusters back in their new order
+    unsigned int out = 0;
+    for (unsigned int c : order) {
+        const unsigned int end = c + 1 < clusters.size() ? clusters[c + 1] : pMesh->mNumFaces;
+        for (unsigned int f = clusters[c]; f < end; ++f, ++out) {
+            std::copy(&indices[f * 3], &indices[f * 3] + 3, pMesh->mFaces[out].mIndices);
+        }
+    }
+
+    std::vector<unsigned int> reordered(indices.size());
+    for (unsigned int f = 0; f < pMesh->mNumFaces; ++f) {
+        std::copy(pMesh->mFaces[f].mIndices, pMesh->mFaces[f].mIndices + 3, &reordered[f * 3]);
+    }
+    const ai_real acmrIn = static_cast<ai_real>(CountCacheMisses(indices, pMesh->mNumVertices, mConfigCacheDepth)) / pMesh->mNumFaces;
+    const ai_real acmrOut = static_cast<ai_real>(CountCacheMisses(reordered, pMesh->mNumVertices, mConfigCacheDepth)) / pMesh->mNumFaces;
+    return std::make_pair(acmrIn, acmrOut);
+}
+
+} // namespace Assimp
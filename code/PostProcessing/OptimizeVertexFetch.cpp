@@ -0,0 +1,271 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post processing step to reorder the vertices
+ *  of a mesh to the order of their first use.
+ */
+
+#include "PostProcessing/OptimizeVertexFetch.h"
+
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <vector>
+
+namespace Assimp {
+namespace {
+    // The simulated fetch cache, 16 KiB in lines of 64 bytes
+    constexpr size_t FetchCacheLineSize = 64;
+    constexpr unsigned int FetchCacheLines = 256;
+
+    // Size of a vertex in an interleaved buffer holding all channels of the mesh
+    size_t GetVertexSize(const aiMesh *pMesh) {
+        size_t size = 0;
+        size += pMesh->HasPositions() ? sizeof(aiVector3D) : 0;
+        size += pMesh->HasNormals() ? sizeof(aiVector3D) : 0;
+        size += pMesh->HasTangentsAndBitangents() ? 2 * sizeof(aiVector3D) : 0;
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+            size += pMesh->HasVertexColors(i) ? sizeof(aiColor4D) : 0;
+        }
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+            size += pMesh->HasTextureCoords(i) ? pMesh->mNumUVComponents[i] * sizeof(ai_real) : 0;
+        }
+        return size;
+    }
+
+    template <typename T>
+    void Reorder(T *&data, const std::vector<unsigned int> &remap) {
+        if (nullptr == data) {
+            return;
+        }
+        T *reordered = new T[remap.size()];
+        for (size_t v = 0; v < remap.size(); ++v) {
+            reordered[remap[v]] = data[v];
+        }
+        delete[] data;
+        data = reordered;
+    }
+
+    template <typename MeshT>
+    void ReorderChannels(MeshT *pMesh, const std::vector<unsigned int> &remap) {
+        Reorder(pMesh->mVertices, remap);
+        Reorder(pMesh->mNormals, remap);
+        Reorder(pMesh->mTangents, remap);
+        Reorder(pMesh->mBitangents, remap);
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+            Reorder(pMesh->mColors[i], remap);
+        }
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+            Reorder(pMesh->mTextureCoords[i], remap);
+        }
+    }
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Constructor to be privately used by Importer
+OptimizeVertexFetchProcess::OptimizeVertexFetchProcess() : mEnabled(false) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether the processing step is present in the given flag field.
+bool OptimizeVertexFetchProcess::IsActive(unsigned int pFlags) const {
+    return (pFlags & aiProcess_ImproveCacheLocality) != 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently from each other.
+bool OptimizeVertexFetchProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+const char *OptimizeVertexFetchProcess::GetName(unsigned int /*pFlags*/) const {
+    return "OptimizeVertexFetch";
+}
+
+// ------------------------------------------------------------------------------------------------
+// Setup configuration
+void OptimizeVertexFetchProcess::SetupProperties(const Importer *pImp) {
+    mEnabled = pImp->GetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_VERTEX_FETCH, false);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Executes the post processing step on the given imported data.
+void OptimizeVertexFetchProcess::Execute(aiScene *pScene) {
+    if (!mEnabled) {
+        return;
+    }
+    if (!pScene->mNumMeshes) {
+        ASSIMP_LOG_DEBUG("OptimizeVertexFetchProcess skipped; there are no meshes");
+        return;
+    }
+
+    ASSIMP_LOG_DEBUG("OptimizeVertexFetchProcess begin");
+
+    std::vector<std::pair<ai_real, ai_real>> results(pScene->mNumMeshes);
+    ForEachMesh(pScene, [this, pScene, &results](unsigned int a) {
+        results[a] = ProcessMesh(pScene->mMeshes[a]);
+    });
+
+    if (!DefaultLogger::isNullLogger()) {
+        // weight the overfetch of each mesh by its number of vertices
+        ai_real in = 0, out = 0;
+        unsigned int numv = 0, numm = 0;
+        for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+            if (results[a].first > 0) {
+                const unsigned int n = pScene->mMeshes[a]->mNumVertices;
+                in += results[a].first * n;
+                out += results[a].second * n;
+                numv += n;
+                ++numm;
+            }
+        }
+        if (numv > 0) {
+            ASSIMP_LOG_INFO("Vertex fetch optimized ", numm, " meshes (", numv, " vertices). Overfetch in: ", in / numv, " out: ", out / numv);
+        }
+        ASSIMP_LOG_DEBUG("OptimizeVertexFetchProcess finished. ");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+ai_real OptimizeVertexFetchProcess::ComputeOverfetch(const aiMesh *pMesh) {
+    const size_t vertexSize = GetVertexSize(pMesh);
+    if (!pMesh->HasFaces() || 0 == vertexSize) {
+        return static_cast<ai_real>(0.f);
+    }
+
+    std::vector<unsigned int> stamps((pMesh->mNumVertices * vertexSize + FetchCacheLineSize - 1) / FetchCacheLineSize, 0);
+    std::vector<bool> used(pMesh->mNumVertices, false);
+    unsigned int stamp = FetchCacheLines + 1;
+    size_t fetched = 0, numUsed = 0;
+    for (unsigned int f = 0; f < pMesh->mNumFaces; ++f) {
+        const aiFace &face = pMesh->mFaces[f];
+        for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+            const unsigned int v = face.mIndices[i];
+            if (!used[v]) {
+                used[v] = true;
+                ++numUsed;
+            }
+            const size_t first = v * vertexSize / FetchCacheLineSize;
+            const size_t last = (v * vertexSize + vertexSize - 1) / FetchCacheLineSize;
+            for (size_t line = first; line <= last; ++line) {
+                if (stamp - stamps[line] > FetchCacheLines) {
+                    stamps[line] = stamp++;
+                    fetched += FetchCacheLineSize;
+                }
+            }
+        }
+    }
+    return static_cast<ai_real>(fetched) / static_cast<ai_real>(numUsed * vertexSize);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reorders the vertices of a specific mesh
+std::pair<ai_real, ai_real> OptimizeVertexFetchProcess::ProcessMesh(aiMesh *pMesh) const {
+    ai_assert(nullptr != pMesh);
+
+    if (!pMesh->HasFaces() || !pMesh->HasPositions()) {
+        return std::make_pair(static_cast<ai_real>(0.f), static_cast<ai_real>(0.f));
+    }
+    const ai_real overfetchIn = ComputeOverfetch(pMesh);
+
+    // number the vertices in the order the faces use them, then the unused ones
+    const unsigned int unassigned = ~0u;
+    std::vector<unsigned int> remap(pMesh->mNumVertices, unassigned);
+    unsigned int next = 0;
+    bool identity = true;
+    for (unsigned int f = 0; f < pMesh->mNumFaces; ++f) {
+        const aiFace &face = pMesh->mFaces[f];
+        for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+            unsigned int &target = remap[face.mIndices[i]];
+            if (target == unassigned) {
+                identity = identity && face.mIndices[i] == next;
+                target = next++;
+            }
+        }
+    }
+    for (unsigned int v = 0; v < pMesh->mNumVertices; ++v) {
+        if (remap[v] == unassigned) {
+            identity = identity && v == next;
+            remap[v] = next++;
+        }
+    }
+    if (identity) {
+        return std::make_pair(overfetchIn, overfetchIn);
+    }
+
+    ReorderChannels(pMesh, remap);
+    for (unsigned int a = 0; a < pMesh->mNumAnimMeshes; ++a) {
+        if (pMesh->mAnimMeshes[a]->mNumVertices == pMesh->mNumVertices) {
+            ReorderChannels(pMesh->mAnimMeshes[a], remap);
+        }
+    }
+    for (unsigned int b = 0; b < pMesh->mNumBones; ++b) {
+        aiBone *bone = pMesh->mBones[b];
+        for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+            bone->mWeights[w].mVertexId = remap[bone->mWeights[w].mVertexId];
+        }
+    }
+    for (unsigned int f = 0; f < pMesh->mNumFaces; ++f) {
+        aiFace &face = pMesh->mFaces[f];
+        for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+            face.mIndices[i] = remap[face.mIndices[i]];
+        }
+    }
+    for (unsigned int i = 0; i < pMesh->mNumMeshletVertices; ++i) {
+        pMesh->mMeshletVertices[i] = remap[pMesh->mMeshletVertices[i]];
+    }
+    for (unsigned int l = 0; l < pMesh->mNumLODs; ++l) {
+        const aiMeshLOD *lod = pMesh->mLODs[l];
+        for (unsigned int f = 0; f < lod->mNumFaces; ++f) {
+            aiFace &face = lod->mFaces[f];
+            for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+                face.mIndices[i] = remap[face.mIndices[i]];
+            }
+        }
+    }
+
+    return std::make_pair(overfetchIn, ComputeOverfetch(pMesh));
+}
+
+} // namespace Assimp
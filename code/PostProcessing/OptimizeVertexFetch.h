@@ -0,0 +1,114 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file Defines a post processing step to reorder vertices for a better
+ *  locality of the vertex fetch */
+#ifndef AI_OPTIMIZEVERTEXFETCH_H_INC
+#define AI_OPTIMIZEVERTEXFETCH_H_INC
+
+#include "Common/BaseProcess.h"
+
+#include <assimp/types.h>
+
+struct aiMesh;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** The OptimizeVertexFetchProcess reorders the vertices of a mesh to the
+ *  order in which its faces use them first. All vertex channels, the bone
+ *  weights and the anim meshes are reordered alike, vertices which are not
+ *  used by any face are moved to the end.
+ *
+ *  The step runs as part of #aiProcess_ImproveCacheLocality if
+ *  #AI_CONFIG_PP_ICL_OPTIMIZE_VERTEX_FETCH is set.
+ */
+class ASSIMP_API OptimizeVertexFetchProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    OptimizeVertexFetchProcess();
+    ~OptimizeVertexFetchProcess() override = default;
+
+    // -------------------------------------------------------------------
+    // Check whether the pp step is active
+    bool IsActive( unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    // Meshes are processed independently from each other
+    bool IsMeshLocal() const override;
+
+    // -------------------------------------------------------------------
+    // The step has no process flag of its own
+    const char *GetName(unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    // Executes the pp step on a given scene
+    void Execute( aiScene* pScene) override;
+
+    // -------------------------------------------------------------------
+    // Configures the pp step
+    void SetupProperties(const Importer* pImp) override;
+
+    // -------------------------------------------------------------------
+    /** Enables the step, as SetupProperties() does if the property is set */
+    void Enable() { mEnabled = true; }
+
+    // -------------------------------------------------------------------
+    /** Reorders the vertices of a mesh
+     * @param pMesh The mesh to process.
+     * @return The overfetch of the mesh before and after, that is the
+     *   number of bytes read for an interleaved vertex buffer through a
+     *   simulated cache divided by the size of the used vertices. */
+    std::pair<ai_real, ai_real> ProcessMesh(aiMesh* pMesh) const;
+
+    // -------------------------------------------------------------------
+    /** Computes the overfetch of a mesh in its current vertex order */
+    static ai_real ComputeOverfetch(const aiMesh* pMesh);
+
+private:
+    //! Configuration parameter: whether the step is enabled
+    bool mEnabled;
+};
+
+} // end of namespace Assimp
+
+#endif // AI_OPTIMIZEVERTEXFETCH_H_INC
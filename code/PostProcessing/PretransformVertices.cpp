@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PretransformVertices.h"
 #include "ConvertToLHProcess.h"
 #include "ProcessHelper.h"
+#include "Common/simd.h"
 #include <assimp/Exceptional.h>
 #include <assimp/SceneCombiner.h>
 
@@ -182,9 +183,8 @@ void PretransformVertices::CollectData(const aiScene *pcScene, const aiNode *pcN
 				}
 			} else {
 				// copy positions, transform them to worldspace
-				for (unsigned int n = 0; n < pcMesh->mNumVertices; ++n) {
-					pcMeshOut->mVertices[aiCurrent[AI_PTVS_VERTEX] + n] = pcNode->mTransformation * pcMesh->mVertices[n];
-				}
+				SIMD::TransformPositions(pcNode->mTransformation, pcMesh->mVertices,
+						pcMeshOut->mVertices + aiCurrent[AI_PTVS_VERTEX], pcMesh->mNumVertices);
 				aiMatrix4x4 mWorldIT = pcNode->mTransformation;
 				mWorldIT.Inverse().Transpose();
 
@@ -193,17 +193,15 @@ void PretransformVertices::CollectData(const aiScene *pcScene, const aiNode *pcN
 
 				if (iVFormat & 0x2) {
 					// copy normals, transform them to worldspace
-					for (unsigned int n = 0; n < pcMesh->mNumVertices; ++n) {
-						pcMeshOut->mNormals[aiCurrent[AI_PTVS_VERTEX] + n] =
-								(m * pcMesh->mNormals[n]).Normalize();
-					}
+					SIMD::TransformDirections(m, pcMesh->mNormals,
+							pcMeshOut->mNormals + aiCurrent[AI_PTVS_VERTEX], pcMesh->mNumVertices, true);
 				}
 				if (iVFormat & 0x4) {
 					// copy tangents and bitangents, transform them to worldspace
-					for (unsigned int n = 0; n < pcMesh->mNumVertices; ++n) {
-						pcMeshOut->mTangents[aiCurrent[AI_PTVS_VERTEX] + n] = (m * pcMesh->mTangents[n]).Normalize();
-						pcMeshOut->mBitangents[aiCurrent[AI_PTVS_VERTEX] + n] = (m * pcMesh->mBitangents[n]).Normalize();
-					}
+					SIMD::TransformDirections(m, pcMesh->mTangents,
+							pcMeshOut->mTangents + aiCurrent[AI_PTVS_VERTEX], pcMesh->mNumVertices, true);
+					SIMD::TransformDirections(m, pcMesh->mBitangents,
+							pcMeshOut->mBitangents + aiCurrent[AI_PTVS_VERTEX], pcMesh->mNumVertices, true);
 				}
 			}
 			unsigned int p = 0;
@@ -306,9 +304,7 @@ void PretransformVertices::ApplyTransform(aiMesh *mesh, const aiMatrix4x4 &mat)
 
 	// Update positions
 	if (mesh->HasPositions()) {
-		for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
-			mesh->mVertices[i] = mat * mesh->mVertices[i];
-		}
+		SIMD::TransformPositions(mat, mesh->mVertices, mesh->mVertices, mesh->mNumVertices);
 	}
 
 	// Update normals and tangents
@@ -316,16 +312,12 @@ void PretransformVertices::ApplyTransform(aiMesh *mesh, const aiMatrix4x4 &mat)
 		const aiMatrix3x3 m = aiMatrix3x3(mat).Inverse().Transpose();
 
 		if (mesh->HasNormals()) {
-			for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
-                mesh->mNormals[i] = (m * mesh->mNormals[i]).Normalize();
-            }
+			SIMD::TransformDirections(m, mesh->mNormals, mesh->mNormals, mesh->mNumVertices, true);
 		}
 
 		if (mesh->HasTangentsAndBitangents()) {
-			for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
-				mesh->mTangents[i] = (m * mesh->mTangents[i]).Normalize();
-				mesh->mBitangents[i] = (m * mesh->mBitangents[i]).Normalize();
-			}
+			SIMD::TransformDirections(m, mesh->mTangents, mesh->mTangents, mesh->mNumVertices, true);
+			SIMD::TransformDirections(m, mesh->mBitangents, mesh->mBitangents, mesh->mNumVertices, true);
 		}
 	}
 }
@@ -659,16 +651,14 @@ void PretransformVertices::Execute(aiScene *pScene) {
 
 		for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
 			aiMesh *m = pScene->mMeshes[a];
-			for (unsigned int i = 0; i < m->mNumVertices; ++i) {
-				min = std::min(m->mVertices[i], min);
-				max = std::max(m->mVertices[i], max);
-			}
+			SIMD::ExtendBounds(m->mVertices, m->mNumVertices, min, max);
 		}
 
 		// find the dominant axis
 		aiVector3D d = max - min;
 		const ai_real div = std::max(d.x, std::max(d.y, d.z)) * ai_real(0.5);
 
+		// a matrix would compute v * (1 / div) - d / div, which rounds differently
 		d = min + d * (ai_real)0.5;
 		for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
 			aiMesh *m = pScene->mMeshes[a];
@@ -50,6 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 
 #include "Common/BaseProcess.h"
+#include "Common/SpatialIndex.h"
 #include <assimp/ParsingUtils.h>
 #include <assimp/SpatialSort.h>
 
@@ -339,22 +340,31 @@ class ComputeSpatialSortProcess : public BaseProcess {
                                                            aiProcess_GenNormals | aiProcess_JoinIdenticalVertices));
     }
 
+    bool IsMeshLocal() const {
+        return true;
+    }
+
+    void SetupProperties(const Importer *pImp) {
+        useSpatialHash = pImp->GetPropertyBool(AI_CONFIG_PP_USE_SPATIAL_HASH, false);
+    }
+
     void Execute(aiScene *pScene) {
-        typedef std::pair<SpatialSort, ai_real> _Type;
+        typedef std::pair<SpatialIndex, ai_real> _Type;
         ASSIMP_LOG_DEBUG("Generate spatially-sorted vertex cache");
 
         std::vector<_Type> *p = new std::vector<_Type>(pScene->mNumMeshes);
-        std::vector<_Type>::iterator it = p->begin();
 
-        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i, ++it) {
+        ForEachMesh(pScene, [this, pScene, p](unsigned int i) {
             aiMesh *mesh = pScene->mMeshes[i];
-            _Type &blubb = *it;
-            blubb.first.Fill(mesh->mVertices, mesh->mNumVertices, sizeof(aiVector3D));
+            _Type &blubb = (*p)[i];
+            blubb.first.Fill(mesh->mVertices, mesh->mNumVertices, useSpatialHash, threadPool);
             blubb.second = ComputePositionEpsilon(mesh);
-        }
+        });
 
         shared->AddProperty(AI_SPP_SPATIAL_SORT, p);
     }
+
+    bool useSpatialHash = false;
 };
 
 // -------------------------------------------------------------------------------
@@ -47,11 +47,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ParsingUtils.h>
 #include "ProcessHelper.h"
 #include "Material/MaterialSystem.h"
+#include "Common/ThreadPool.h"
 #include <assimp/Exceptional.h>
 #include <stdio.h>
 
+#include <algorithm>
+#include <vector>
+
 using namespace Assimp;
 
+// Below this number of materials the hashes are computed on the calling thread
+static const unsigned int ParallelThreshold = 1024;
+
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 RemoveRedundantMatsProcess::RemoveRedundantMatsProcess() : mConfigFixedMaterials() {}
@@ -121,43 +128,59 @@ void RemoveRedundantMatsProcess::Execute( aiScene* pScene) {
     }
     unsigned int iNewNum = 0;
 
-    // Iterate through all materials and calculate a hash for them
-    // store all hashes in a list and so a quick search whether
-    // we do already have a specific hash. This allows us to
-    // determine which materials are identical.
-    uint32_t *aiHashes = new uint32_t[ pScene->mNumMaterials ];
+    // No mesh is referencing these materials, remove them.
     for (unsigned int i = 0; i < pScene->mNumMaterials;++i) {
-        // No mesh is referencing this material, remove it.
         if (!abReferenced[i]) {
             ++unreferencedRemoved;
             delete pScene->mMaterials[i];
             pScene->mMaterials[i] = nullptr;
-            continue;
         }
+    }
 
-        // Check all previously mapped materials for a matching hash.
-        // On a match we can delete this material and just make it ref to the same index.
-        uint32_t me = aiHashes[i] = ComputeMaterialHash(pScene->mMaterials[i]);
-        for (unsigned int a = 0; a < i;++a) {
-            if (abReferenced[a] && me == aiHashes[a]) {
-                ++redundantRemoved;
-                me = 0;
-                aiMappingTable[i] = aiMappingTable[a];
-                delete pScene->mMaterials[i];
-                pScene->mMaterials[i] = nullptr;
-                break;
+    // Calculate a hash for all remaining materials, on the thread pool if
+    // there are enough of them. Materials with equal hashes are compared
+    // property by property to determine which materials are identical.
+    std::vector<uint32_t> hashes(pScene->mNumMaterials, 0);
+    auto hashRange = [pScene, &hashes](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (pScene->mMaterials[i]) {
+                hashes[i] = ComputeMaterialHash(pScene->mMaterials[i]);
             }
         }
+    };
+    if (nullptr == threadPool || 0 == threadPool->GetNumWorkers() || pScene->mNumMaterials < ParallelThreshold) {
+        hashRange(0, pScene->mNumMaterials);
+    } else {
+        const size_t numChunks = static_cast<size_t>(threadPool->GetNumWorkers()) + 1;
+        const size_t chunkSize = (pScene->mNumMaterials + numChunks - 1) / numChunks;
+        threadPool->ParallelFor(numChunks, [&](size_t chunk) {
+            const size_t begin = std::min<size_t>(pScene->mNumMaterials, chunk * chunkSize);
+            hashRange(begin, std::min<size_t>(pScene->mNumMaterials, begin + chunkSize));
+        });
+    }
+    std::vector<unsigned int> firstEqual;
+    FindEqualMaterials(pScene->mMaterials, hashes.data(), pScene->mNumMaterials, firstEqual);
+
+    for (unsigned int i = 0; i < pScene->mNumMaterials;++i) {
+        if (!abReferenced[i]) {
+            continue;
+        }
         // This is a new material that is referenced, add to the map.
-        if (me) {
+        if (firstEqual[i] == i) {
             aiMappingTable[i] = iNewNum++;
+            continue;
         }
+        // An identical material was mapped before, we can delete this
+        // material and just make it ref to the same index.
+        ++redundantRemoved;
+        aiMappingTable[i] = aiMappingTable[firstEqual[i]];
+        delete pScene->mMaterials[i];
+        pScene->mMaterials[i] = nullptr;
     }
     // If the new material count differs from the original,
     // we need to rebuild the material list and remap mesh material indexes.
     if (iNewNum < 1) {
         delete [] aiMappingTable;
-        delete [] aiHashes;
         pScene->mNumMaterials = 0;
         return;
     }
@@ -195,7 +218,6 @@ void RemoveRedundantMatsProcess::Execute( aiScene* pScene) {
         pScene->mNumMaterials = iNewNum;
     }
     // delete temporary storage
-    delete[] aiHashes;
     delete[] aiMappingTable;
 
     if (redundantRemoved == 0 && unreferencedRemoved == 0) {
@@ -39,6 +39,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ----------------------------------------------------------------------
 */
 #include "ScaleProcess.h"
+#include "Common/simd.h"
 
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
@@ -115,10 +116,7 @@ void ScaleProcess::Execute( aiScene* pScene ) {
         aiMesh *mesh = pScene->mMeshes[meshID];
 
         // Reconstruct mesh vertices to the new unit system
-        for( unsigned int vertexID = 0; vertexID < mesh->mNumVertices; vertexID++) {
-            aiVector3D& vertex = mesh->mVertices[vertexID];
-            vertex *= mScale;
-        }
+        SIMD::ScaleVectors(mesh->mVertices, mesh->mNumVertices, aiVector3D(mScale));
 
         // bone placement / scaling
         for( unsigned int boneID = 0; boneID < mesh->mNumBones; boneID++) {
@@ -150,10 +148,7 @@ void ScaleProcess::Execute( aiScene* pScene ) {
         for( unsigned int animMeshID = 0; animMeshID < mesh->mNumAnimMeshes; animMeshID++) {
             aiAnimMesh * animMesh = mesh->mAnimMeshes[animMeshID];
 
-            for( unsigned int vertexID = 0; vertexID < animMesh->mNumVertices; vertexID++) {
-                aiVector3D& vertex = animMesh->mVertices[vertexID];
-                vertex *= mScale;
-            }
+            SIMD::ScaleVectors(animMesh->mVertices, animMesh->mNumVertices, aiVector3D(mScale));
         }
     }
 
@@ -432,6 +432,76 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
     } else if (pMesh->mBones) {
         ReportError("aiMesh::mBones is non-null although there are no bones");
     }
+
+    // and the meshlets, which must cover all faces in order
+    if (pMesh->mNumMeshlets) {
+        if (!pMesh->mMeshlets || !pMesh->mMeshletVertices || !pMesh->mMeshletTriangles) {
+            ReportError("aiMesh::mMeshlets, mMeshletVertices or mMeshletTriangles is nullptr (aiMesh::mNumMeshlets is %i)",
+                    pMesh->mNumMeshlets);
+        }
+        unsigned int numTriangles = 0;
+        for (unsigned int i = 0; i < pMesh->mNumMeshlets; ++i) {
+            const aiMeshlet &meshlet = pMesh->mMeshlets[i];
+            if (meshlet.mTriangleOffset != numTriangles) {
+                ReportError("aiMesh::mMeshlets[%i]::mTriangleOffset is %i, but the previous meshlets end at %i",
+                        i, meshlet.mTriangleOffset, numTriangles);
+            }
+            if (meshlet.mVertexOffset + meshlet.mNumVertices > pMesh->mNumMeshletVertices) {
+                ReportError("aiMesh::mMeshlets[%i] exceeds aiMesh::mMeshletVertices (%i entries)",
+                        i, pMesh->mNumMeshletVertices);
+            }
+            numTriangles += meshlet.mNumTriangles;
+            if (numTriangles > pMesh->mNumFaces) {
+                ReportError("aiMesh::mMeshlets[%i] exceeds aiMesh::mFaces (%i entries)", i, pMesh->mNumFaces);
+            }
+            for (unsigned int t = meshlet.mTriangleOffset * 3; t < numTriangles * 3; ++t) {
+                if (pMesh->mMeshletTriangles[t] >= meshlet.mNumVertices) {
+                    ReportError("aiMesh::mMeshletTriangles[%i] is out of range (aiMesh::mMeshlets[%i] has %i vertices)",
+                            t, i, meshlet.mNumVertices);
+                }
+            }
+        }
+        if (numTriangles != pMesh->mNumFaces) {
+            ReportError("The meshlets of the mesh cover %i faces, but there are %i", numTriangles, pMesh->mNumFaces);
+        }
+        for (unsigned int i = 0; i < pMesh->mNumMeshletVertices; ++i) {
+            if (pMesh->mMeshletVertices[i] >= pMesh->mNumVertices) {
+                ReportError("aiMesh::mMeshletVertices[%i] is out of range", i);
+            }
+        }
+    } else if (pMesh->mMeshlets) {
+        ReportError("aiMesh::mMeshlets is non-null although there are no meshlets");
+    }
+
+    // and the LODs, whose faces are triangles of the mesh vertices
+    if (pMesh->mNumLODs) {
+        if (!pMesh->mLODs) {
+            ReportError("aiMesh::mLODs is nullptr (aiMesh::mNumLODs is %i)", pMesh->mNumLODs);
+        }
+        for (unsigned int i = 0; i < pMesh->mNumLODs; ++i) {
+            const aiMeshLOD *lod = pMesh->mLODs[i];
+            if (!lod) {
+                ReportError("aiMesh::mLODs[%i] is nullptr (aiMesh::mNumLODs is %i)", i, pMesh->mNumLODs);
+            }
+            if (lod->mNumFaces && !lod->mFaces) {
+                ReportError("aiMesh::mLODs[%i]::mFaces is nullptr (aiMesh::mLODs[%i]::mNumFaces is %i)",
+                        i, i, lod->mNumFaces);
+            }
+            for (unsigned int f = 0; f < lod->mNumFaces; ++f) {
+                const aiFace &face = lod->mFaces[f];
+                if (3 != face.mNumIndices) {
+                    ReportError("aiMesh::mLODs[%i]::mFaces[%i] is not a triangle", i, f);
+                }
+                for (unsigned int a = 0; a < face.mNumIndices; ++a) {
+                    if (face.mIndices[a] >= pMesh->mNumVertices) {
+                        ReportError("aiMesh::mLODs[%i]::mFaces[%i]::mIndices[%i] is out of range", i, f, a);
+                    }
+                }
+            }
+        }
+    } else if (pMesh->mLODs) {
+        ReportError("aiMesh::mLODs is non-null although there are no LODs");
+    }
 }
 
 // ------------------------------------------------------------------------------------------------
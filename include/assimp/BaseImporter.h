@@ -69,6 +69,11 @@ class IOSystem;
 class BaseProcess;
 class SharedPostProcessInfo;
 class IOStream;
+class ThreadPool;
+
+namespace Profiling {
+class Profiler;
+} // namespace Profiling
 
 /// @def   AI_MAKE_MAGIC
 /// @brief Utility to do char4 to uint32 in a portable manner
@@ -406,6 +411,12 @@ protected:
     std::exception_ptr m_Exception;
     /// Currently set progress handler.
     ProgressHandler *m_progress;
+    /// Profiler of the running import, nullptr if profiling is disabled.
+    /// Use Profiling::ScopedRegion to break down the import into phases.
+    Profiling::Profiler *m_profiler;
+    /// Worker pool of the running import, nullptr if the import runs on the
+    /// calling thread only (see #AI_CONFIG_IMPORT_NUM_THREADS).
+    ThreadPool *m_threadPool;
 };
 
 } // end of namespace Assimp
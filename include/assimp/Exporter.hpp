@@ -62,6 +62,10 @@ class ExporterPimpl;
 class IOSystem;
 class ProgressHandler;
 
+namespace Profiling {
+class Profiler;
+} // namespace Profiling
+
 // ----------------------------------------------------------------------------------
 /** CPP-API: The Exporter class forms an C++ interface to the export functionality
  * of the Open Asset Import Library. Note that the export interface is available
@@ -245,6 +249,16 @@ public:
      * following methods is called: #Export, #ExportToBlob, #FreeBlob */
     const char *GetErrorString() const;
 
+    // -------------------------------------------------------------------
+    /** Returns the timings of the last call to #Export or #ExportToBlob.
+     *
+     * Profiling is enabled by setting #AI_CONFIG_GLOB_MEASURE_TIME in the
+     * ExportProperties passed to the export. The profile covers copying
+     * the scene, every post-processing step and writing the file.
+     * @return The profiler holding the region tree, nullptr if profiling
+     *   was disabled. The pointer stays valid until the next export. */
+    const Profiling::Profiler *GetProfile() const;
+
     // -------------------------------------------------------------------
     /** Return the blob obtained from the last call to #ExportToBlob */
     const aiExportDataBlob *GetBlob() const;
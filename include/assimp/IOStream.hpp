@@ -124,6 +124,19 @@ public:
      *  See fflush() for more details.
      */
     virtual void Flush() = 0;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns a pointer to the whole file contents, if available.
+     *
+     *  Streams which keep the complete file in memory (memory buffers,
+     *  memory-mapped files) can hand out a read-only view of it, so
+     *  loaders can parse the data in place instead of copying it into
+     *  a temporary buffer first. The view covers FileSize() bytes, is
+     *  not zero-terminated and stays valid until the stream is closed.
+     *  @return nullptr if the stream has no such view (default). */
+    virtual const uint8_t *GetMappedPointer() const {
+        return nullptr;
+    }
 }; //! class IOStream
 
 } //!namespace Assimp
@@ -81,6 +81,10 @@ class BatchLoader;
 // =======================================================================
 // Holy stuff, only for members of the high council of the Jedi.
 class ImporterPimpl;
+
+namespace Profiling {
+class Profiler;
+} // namespace Profiling
 } // namespace Assimp
 
 #define AI_PROPERTY_WAS_NOT_EXISTING 0xffffffff
@@ -642,6 +646,18 @@ public:
      *   is (naturally) not included.*/
     void GetMemoryRequirements(aiMemoryInfo &in) const;
 
+    // -------------------------------------------------------------------
+    /** Returns the timings of the last call to #ReadFile().
+     *
+     * Profiling is enabled by setting #AI_CONFIG_GLOB_MEASURE_TIME. The
+     * profile covers format detection, the import itself (broken down
+     * further by importers which support it), the scene preprocessing
+     * and every post-processing step, including later calls to
+     * #ApplyPostProcessing().
+     * @return The profiler holding the region tree, nullptr if profiling
+     *   was disabled. The pointer stays valid until the next #ReadFile(). */
+    const Profiling::Profiler *GetProfile() const;
+
     // -------------------------------------------------------------------
     /** Enables "extra verbose" mode.
      *
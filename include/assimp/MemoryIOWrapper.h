@@ -129,6 +129,10 @@ public:
         ai_assert(false); // won't be needed
     }
 
+    const uint8_t *GetMappedPointer() const override {
+        return buffer;
+    }
+
 private:
     const uint8_t* buffer;
     size_t length,pos;
@@ -0,0 +1,152 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file MemoryMappedIOSystem.h
+ *  @brief IOSystem implementation which maps files into memory for reading.
+ */
+#pragma once
+#ifndef AI_MEMORYMAPPEDIOSYSTEM_H_INC
+#define AI_MEMORYMAPPEDIOSYSTEM_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/IOStream.hpp>
+
+namespace Assimp {
+
+// ----------------------------------------------------------------------------------
+/** @brief Read-only IOStream on top of a memory-mapped file.
+ *
+ *  The file contents are exposed through GetMappedPointer(), so loaders
+ *  supporting it can parse the file in place without an extra copy.
+ *  Instances are created by MemoryMappedIOSystem::Open().
+ */
+// ----------------------------------------------------------------------------------
+class ASSIMP_API MemoryMappedIOStream : public IOStream {
+    friend class MemoryMappedIOSystem;
+
+protected:
+    /** Constructor protected, use MemoryMappedIOSystem::Open() to create an instance. */
+    MemoryMappedIOStream(const uint8_t *data, size_t length) AI_NO_EXCEPT;
+
+public:
+    /** Destructor, unmaps the file. */
+    ~MemoryMappedIOStream() override;
+
+    // -------------------------------------------------------------------
+    /// Read from the mapped file, see fread() for more details.
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override;
+
+    // -------------------------------------------------------------------
+    /// Not supported, the mapping is read-only.
+    size_t Write(const void *pvBuffer, size_t pSize, size_t pCount) override;
+
+    // -------------------------------------------------------------------
+    /// Set the read cursor of the file.
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override;
+
+    // -------------------------------------------------------------------
+    /// Get the current position of the read cursor.
+    size_t Tell() const override;
+
+    // -------------------------------------------------------------------
+    /// Get the size of the file.
+    size_t FileSize() const override;
+
+    // -------------------------------------------------------------------
+    /// Nothing to flush for a read-only mapping.
+    void Flush() override;
+
+    // -------------------------------------------------------------------
+    /// Returns the start of the mapped file.
+    const uint8_t *GetMappedPointer() const override;
+
+private:
+    const uint8_t *mData;
+    size_t mLength;
+    size_t mPos;
+};
+
+// ---------------------------------------------------------------------------
+/** @brief IOSystem which memory-maps files opened for reading.
+ *
+ *  Files opened in a read-only mode are mapped into the address space
+ *  instead of being read through a stdio buffer. Binary loaders (STL, FBX,
+ *  glTF2 binary) then parse directly from the mapping, which keeps peak
+ *  memory usage close to the size of the imported scene for large files.
+ *  Files opened for writing, empty files and files which cannot be mapped
+ *  are handled exactly like the DefaultIOSystem does.
+ *
+ *  Usage:
+ *  @code
+ *  Assimp::Importer importer;
+ *  importer.SetIOHandler(new Assimp::MemoryMappedIOSystem());
+ *  const aiScene *scene = importer.ReadFile("huge_scan.stl", 0);
+ *  @endcode
+ */
+class ASSIMP_API MemoryMappedIOSystem : public IOSystem {
+public:
+    /** Tests for the existence of a file at the given path. */
+    bool Exists(const char *pFile) const override;
+
+    /** Returns the directory separator. */
+    char getOsSeparator() const override;
+
+    /** Open a new file with a given path, mapping it if opened for reading. */
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override;
+
+    /** Closes the given file and releases all resources associated with it. */
+    void Close(IOStream *pFile) override;
+
+    /** Compare two paths */
+    bool ComparePaths(const char *one, const char *second) const override;
+
+private:
+    DefaultIOSystem mDefault;
+};
+
+} // Namespace Assimp
+
+#endif // AI_MEMORYMAPPEDIOSYSTEM_H_INC
@@ -0,0 +1,190 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  ParallelImporter.hpp
+ *  @brief Defines a C++-API to import several files concurrently.
+ */
+#pragma once
+#ifndef AI_PARALLELIMPORTER_HPP_INC
+#define AI_PARALLELIMPORTER_HPP_INC
+
+#ifdef __GNUC__
+#pragma GCC system_header
+#endif
+
+#ifndef __cplusplus
+#error This header requires C++ to be used. Use assimp.h for plain C.
+#endif // __cplusplus
+
+#include <assimp/types.h>
+#include <assimp/scene.h>
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace Assimp {
+
+class IOSystem;
+struct ParallelImporterPimpl;
+
+// ----------------------------------------------------------------------------------
+/** Result of a single import request issued via ParallelImporter. */
+struct ImportResult {
+    /** The requested file name. */
+    std::string mFile;
+
+    /** The imported scene, nullptr if the import failed. The caller owns it. */
+    std::unique_ptr<aiScene> mScene;
+
+    /** Error description if the import failed, otherwise empty. */
+    std::string mErrorString;
+};
+
+// ----------------------------------------------------------------------------------
+/** CPP-API: Imports many files concurrently.
+ *
+ * The class owns a pool of worker threads and one Importer instance per worker.
+ * Importer instances are reused across requests, so the setup cost of the
+ * importer and post-processing registries is paid once per worker only.
+ *
+ * Configuration properties are copied into each request when it is issued,
+ * changing them afterwards does not affect requests already queued. Workers
+ * never share a property store.
+ *
+ * If a custom IOSystem is supplied via SetIOHandler() it is used by all workers
+ * at the same time and must be thread-safe. DefaultIOSystem is. Without a
+ * custom handler every worker uses its own DefaultIOSystem.
+ *
+ * Log messages of concurrent imports are interleaved in the log.
+ */
+class ASSIMP_API ParallelImporter {
+public:
+    /** Callback receiving the outcome of an import. It is invoked on a worker thread. */
+    using Callback = std::function<void(ImportResult &&)>;
+
+    // -------------------------------------------------------------------
+    /** Constructor.
+     * @param numThreads Number of worker threads, 0 uses one per hardware thread.
+     */
+    explicit ParallelImporter(unsigned int numThreads = 0);
+
+    // -------------------------------------------------------------------
+    /** Destructor. Finishes all pending imports first. */
+    ~ParallelImporter();
+
+    ParallelImporter(const ParallelImporter &) = delete;
+    ParallelImporter &operator=(const ParallelImporter &) = delete;
+
+    // -------------------------------------------------------------------
+    /** Returns the number of imports that may run at the same time. */
+    unsigned int GetNumThreads() const;
+
+    // -------------------------------------------------------------------
+    /** Supplies a custom IO handler shared by all workers.
+     *
+     * Must be called while no import is pending. The handler remains
+     * property of the caller.
+     * @param pIOHandler The IO handler to be used, nullptr to restore the default.
+     */
+    void SetIOHandler(IOSystem *pIOHandler);
+
+    // -------------------------------------------------------------------
+    /** Set an integer configuration property for all following requests.
+     * @see Importer::SetPropertyInteger()
+     */
+    bool SetPropertyInteger(const char *szName, int iValue);
+
+    // -------------------------------------------------------------------
+    /** Set a boolean configuration property for all following requests.
+     * @see Importer::SetPropertyBool()
+     */
+    bool SetPropertyBool(const char *szName, bool value) {
+        return SetPropertyInteger(szName, value);
+    }
+
+    // -------------------------------------------------------------------
+    /** Set a floating-point configuration property for all following requests.
+     * @see Importer::SetPropertyFloat()
+     */
+    bool SetPropertyFloat(const char *szName, ai_real fValue);
+
+    // -------------------------------------------------------------------
+    /** Set a string configuration property for all following requests.
+     * @see Importer::SetPropertyString()
+     */
+    bool SetPropertyString(const char *szName, const std::string &sValue);
+
+    // -------------------------------------------------------------------
+    /** Set a matrix configuration property for all following requests.
+     * @see Importer::SetPropertyMatrix()
+     */
+    bool SetPropertyMatrix(const char *szName, const aiMatrix4x4 &sValue);
+
+    // -------------------------------------------------------------------
+    /** Queues a file for import.
+     * @param pFile Path and filename of the file to be imported.
+     * @param pFlags Post processing steps to execute, see Importer::ReadFile().
+     * @return A future receiving the imported scene or the error description.
+     */
+    std::future<ImportResult> ReadFileAsync(const std::string &pFile, unsigned int pFlags);
+
+    // -------------------------------------------------------------------
+    /** Queues a file for import and reports the outcome via a callback.
+     * @param pFile Path and filename of the file to be imported.
+     * @param pFlags Post processing steps to execute, see Importer::ReadFile().
+     * @param callback Receives the result on a worker thread.
+     */
+    void ReadFileAsync(const std::string &pFile, unsigned int pFlags, Callback callback);
+
+    // -------------------------------------------------------------------
+    /** Blocks until all queued imports have finished. */
+    void WaitAll();
+
+private:
+    ParallelImporterPimpl *mPimpl;
+};
+
+} // namespace Assimp
+
+#endif // AI_PARALLELIMPORTER_HPP_INC
@@ -54,48 +54,119 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/TinyFormatter.h>
 
-#include <map>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
 
 namespace Assimp::Profiling {
 
 using namespace Formatter;
 
 // ------------------------------------------------------------------------------------------------
-/// @brief Simple wrapper around boost::timer to simplify reporting. 
+/// @brief Measurements of a single profiling region, see Profiler.
 ///
-/// Timings are automatically dumped to the log file.
-class Profiler {
+/// Memory figures are taken from the operating system (resident set size), so they
+/// cover all allocations of the process, not only those made by assimp.
+struct ProfileRegion {
+    /// The region name.
+    std::string mName;
+    /// Start of the region in seconds, relative to the creation of the profiler.
+    double mStartTime = 0.0;
+    /// Elapsed wall clock time in seconds.
+    double mWallTime = 0.0;
+    /// Process CPU time in seconds, summed over all threads.
+    double mCpuTime = 0.0;
+    /// Growth of the resident memory in bytes, negative if memory was released.
+    int64_t mMemoryDelta = 0;
+    /// Peak resident memory of the process in bytes when the region ended.
+    uint64_t mPeakMemory = 0;
+    /// Regions which were started while this one was open.
+    std::vector<ProfileRegion> mChildren;
+};
+
+// ------------------------------------------------------------------------------------------------
+/// @brief Hierarchical timer to measure the runtime of each import step.
+///
+/// Regions started while another region is open become its children. Timings are
+/// dumped to the log file and kept as a tree, which can be inspected via GetRoot()
+/// or written as a Chrome trace (chrome://tracing, Perfetto) via WriteChromeTrace().
+/// A profiler must only be used from one thread.
+class ASSIMP_API Profiler {
 public:
     /// @brief The class constructor.
-    Profiler() = default;
+    Profiler();
 
     /// @brief The class destructor.
     ~Profiler() = default;
 
-    /// @brief Starts a named timer.
+    /// @brief Starts a named timer, nested into the innermost open region.
     /// @param region    The profiling region name.
-    void BeginRegion(const std::string& region) {
-        mRegions[region] = std::chrono::system_clock::now();
-        ASSIMP_LOG_DEBUG("START `",region,"`");
-    }
+    void BeginRegion(const std::string& region);
 
-    /// @brief End a specific named timer and write its end time to the log.
+    /// @brief End a specific named timer and write its elapsed time to the log.
+    ///
+    /// Regions opened inside of it which are still open are ended as well.
     /// @param region    The profiling region name.
-    void EndRegion(const std::string& region) {
-        if (auto it = mRegions.find(region); it == mRegions.end()) {
-            return;
+    void EndRegion(const std::string& region);
+
+    /// @brief Returns the root of the region tree, its children are the outermost regions.
+    const ProfileRegion &GetRoot() const {
+        return mRoot;
+    }
+
+    /// @brief Looks up a region by its path, e.g. "total/import/tokenize".
+    /// @param path    Region names separated by '/', starting below the root.
+    /// @return The matching region or nullptr. If a region was entered several times,
+    ///         the most recent one is returned.
+    const ProfileRegion *FindRegion(const std::string &path) const;
+
+    /// @brief Writes all finished regions in the Chrome trace event JSON format.
+    /// @param out    The stream to write to.
+    void WriteChromeTrace(std::ostream &out) const;
+
+private:
+    struct OpenRegion {
+        ProfileRegion *mRegion;
+        std::chrono::steady_clock::time_point mStart;
+        double mCpuStart;
+        uint64_t mMemoryStart;
+    };
+
+    std::chrono::steady_clock::time_point mCreated;
+    ProfileRegion mRoot;
+    std::vector<OpenRegion> mOpen;
+};
+
+// ------------------------------------------------------------------------------------------------
+/// @brief Profiles the enclosing scope, does nothing if no profiler is given.
+class ScopedRegion {
+public:
+    /// @brief Starts the region.
+    /// @param profiler    The profiler to use, may be nullptr.
+    /// @param region      The profiling region name.
+    ScopedRegion(Profiler *profiler, const char *region) :
+            mProfiler(profiler), mRegion(region) {
+        if (nullptr != mProfiler) {
+            mProfiler->BeginRegion(mRegion);
         }
+    }
 
-        auto elapsedSeconds = std::chrono::system_clock::now() - mRegions[region];
-        ASSIMP_LOG_DEBUG("END   `",region,"`, dt= ", elapsedSeconds.count()," s");
+    /// @brief Ends the region.
+    ~ScopedRegion() {
+        if (nullptr != mProfiler) {
+            mProfiler->EndRegion(mRegion);
+        }
     }
 
+    ScopedRegion(const ScopedRegion &) = delete;
+    ScopedRegion &operator=(const ScopedRegion &) = delete;
+
 private:
-    using RegionMap = std::map<std::string,std::chrono::time_point<std::chrono::system_clock>>;
-    RegionMap mRegions{};
+    Profiler *mProfiler;
+    const char *mRegion;
 };
 
 } // namespace Assimp::Profiling
 
 #endif // AI_INCLUDED_PROFILER_H
-
@@ -69,6 +69,7 @@ struct aiMetadata;
 struct aiBone;
 struct aiMesh;
 struct aiAnimMesh;
+struct aiMeshLOD;
 struct aiAnimation;
 struct aiNodeAnim;
 struct aiMeshMorphAnim;
@@ -137,6 +138,13 @@ struct NodeAttachmentInfo {
  */
 #define AI_INT_MERGE_SCENE_GEN_UNIQUE_NAMES_IF_NECESSARY 0x10
 
+/** @def AI_INT_MERGE_SCENE_DEDUP_MATERIALS
+ * Store materials with identical properties only once, even if they
+ * come from different scenes. Material names are not compared, the
+ * first of the identical materials is kept.
+ */
+#define AI_INT_MERGE_SCENE_DEDUP_MATERIALS 0x20
+
 using BoneSrcIndex = std::pair<aiBone *, unsigned int> ;
 
 // ---------------------------------------------------------------------------
@@ -345,6 +353,7 @@ public:
 
     // similar to Copy():
     static void Copy(aiAnimMesh **dest, const aiAnimMesh *src);
+    static void Copy(aiMeshLOD **dest, const aiMeshLOD *src);
     static void Copy(aiMaterial **dest, const aiMaterial *src);
     static void Copy(aiTexture **dest, const aiTexture *src);
     static void Copy(aiAnimation **dest, const aiAnimation *src);
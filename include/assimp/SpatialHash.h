@@ -0,0 +1,218 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file SpatialHash.h
+ *  @brief Grid-based helper class to find vertices close to a given location.
+ */
+#pragma once
+#ifndef AI_SPATIALHASH_H_INC
+#define AI_SPATIALHASH_H_INC
+
+#ifdef __GNUC__
+#pragma GCC system_header
+#endif
+
+#include <assimp/types.h>
+#include <functional>
+#include <vector>
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+/** A drop-in alternative to #SpatialSort which puts the positions into a uniform grid of cells,
+ * stored in a hash table. A query only visits the cells overlapping its search radius, so it
+ * takes O(1) on average independent of how the vertices are distributed. SpatialSort in contrast
+ * degrades to O(n) if many vertices lay on a plane parallel to its sorting plane, as it is the
+ * case for terrain or CAD data. The interface is the same as the one of SpatialSort, so each
+ * use site can pick the one which fits its data best.
+ *
+ * The cell size is derived from the bounding box and the number of positions unless it was set
+ * explicitly. It should be larger than the radius of typical queries, queries with a radius
+ * spanning more cells than there are positions fall back to a linear scan. */
+// ------------------------------------------------------------------------------------------------
+class ASSIMP_API SpatialHash {
+public:
+    SpatialHash();
+
+    // ------------------------------------------------------------------------------------
+    /** Constructs a spatially hashed representation from the given position array.
+     * Supply the positions in its layout in memory, the class will only refer to them
+     * by index.
+     * @param pPositions Pointer to the first position vector of the array.
+     * @param pNumPositions Number of vectors to expect in that array.
+     * @param pElementOffset Offset in bytes from the beginning of one vector in memory
+     *   to the beginning of the next vector. */
+    SpatialHash(const aiVector3D *pPositions, unsigned int pNumPositions,
+            unsigned int pElementOffset);
+
+    /** Destructor */
+    virtual ~SpatialHash() = default;
+
+    // ------------------------------------------------------------------------------------
+    /** Sets the input data for the SpatialHash. This replaces existing data, if any.
+     *  The new data receives new indices in ascending order.
+     *
+     * @param pPositions Pointer to the first position vector of the array.
+     * @param pNumPositions Number of vectors to expect in that array.
+     * @param pElementOffset Offset in bytes from the beginning of one vector in memory
+     *   to the beginning of the next vector.
+     * @param pFinalize Specifies whether the SpatialHash's internal representation
+     *   is finalized after the new data has been added. Finalization is
+     *   required in order to use #FindPositions() or #GenerateMappingTable().
+     *   If you don't finalize yet, you can use #Append() to add data from
+     *   other sources.*/
+    void Fill(const aiVector3D *pPositions, unsigned int pNumPositions,
+            unsigned int pElementOffset,
+            bool pFinalize = true);
+
+    // ------------------------------------------------------------------------------------
+    /** Same as #Fill(), except the method appends to existing data in the #SpatialHash. */
+    void Append(const aiVector3D *pPositions, unsigned int pNumPositions,
+            unsigned int pElementOffset,
+            bool pFinalize = true);
+
+    // ------------------------------------------------------------------------------------
+    /** Builds the grid. This can be useful after multiple calls to #Append() with the
+     *  pFinalize parameter set to false. This is finally required before one of
+     *  #FindPositions() and #GenerateMappingTable() can be called to query the hash.*/
+    void Finalize();
+
+    // ------------------------------------------------------------------------------------
+    /** Returns all positions close to the given position.
+     * @param pPosition The position to look for vertices.
+     * @param pRadius Maximal distance from the position a vertex may have to be counted in.
+     * @param poResults The container to store the indices of the found positions.
+     *   Will be emptied by the call so it may contain anything.*/
+    void FindPositions(const aiVector3D &pPosition, ai_real pRadius,
+            std::vector<unsigned int> &poResults) const;
+
+    // ------------------------------------------------------------------------------------
+    /** Fills an array with indices of all positions identical to the given position. In
+     *  opposite to FindPositions(), not an epsilon is used but a (very low) tolerance of
+     *  four floating-point units, the same as in SpatialSort::FindIdenticalPositions().
+     * @param pPosition The position to look for vertices.
+     * @param poResults The container to store the indices of the found positions.
+     *   Will be emptied by the call so it may contain anything.*/
+    void FindIdenticalPositions(const aiVector3D &pPosition,
+            std::vector<unsigned int> &poResults) const;
+
+    // ------------------------------------------------------------------------------------
+    /** Compute a table that maps each vertex ID referring to a spatially close
+     *  enough position to the same output ID. Output IDs are assigned in ascending order
+     *  from 0...n.
+     * @param fill Will be filled with numPositions entries.
+     * @param pRadius Maximal distance from the position a vertex may have to
+     *   be counted in.
+     *  @return Number of unique vertices (n).  */
+    unsigned int GenerateMappingTable(std::vector<unsigned int> &fill,
+            ai_real pRadius) const;
+
+    // ------------------------------------------------------------------------------------
+    /** Sets the edge length of the grid cells, used by the next call to #Finalize().
+     * @param pCellSize The edge length, 0 to derive it from the data (default). */
+    void SetCellSize(ai_real pCellSize) {
+        mRequestedCellSize = pCellSize;
+    }
+
+    // ------------------------------------------------------------------------------------
+    /** Returns the edge length of the grid cells, valid after #Finalize(). */
+    ai_real GetCellSize() const {
+        return mCellSize;
+    }
+
+protected:
+    /** Runs pFunc(begin, end) on ranges covering [0, pCount), used by #Finalize().
+     *  The default runs a single range on the calling thread, derived classes may
+     *  spread the ranges over several threads. */
+    virtual void ForEachRange(size_t pCount, const std::function<void(size_t, size_t)> &pFunc) const;
+
+    /** Computes the cell coordinates of a position, clamped to the grid. */
+    void GetCell(const aiVector3D &pPosition, int *pCell) const;
+
+    /** Returns the hash table bucket of a cell. */
+    unsigned int GetBucket(const int *pCell) const;
+
+    /** Appends all positions within the radius to poResults, tested with pAccept. */
+    template <typename Accept>
+    void Query(const aiVector3D &pPosition, ai_real pRadius, Accept pAccept,
+            std::vector<unsigned int> &poResults) const;
+
+protected:
+    /** An entry in the position array. Consists of a vertex index and its position. */
+    struct Entry {
+        unsigned int mIndex; ///< The vertex referred by this entry
+        aiVector3D mPosition; ///< Position
+
+        Entry() AI_NO_EXCEPT : mIndex(0), mPosition() {
+            // empty
+        }
+        Entry(unsigned int pIndex, const aiVector3D &pPosition) :
+                mIndex(pIndex), mPosition(pPosition) {
+            // empty
+        }
+    };
+
+    /// All positions, grouped by their bucket after Finalize.
+    std::vector<Entry> mPositions;
+
+    /// Index of the first entry of each bucket in mPositions, plus one past the end.
+    std::vector<unsigned int> mBucketStart;
+
+    /// Origin of the grid, the minimum of the bounding box.
+    aiVector3D mOrigin;
+
+    /// The highest cell coordinate per axis.
+    int mMaxCell[3];
+
+    /// Edge length of the cells and its reciprocal.
+    ai_real mCellSize;
+    ai_real mInvCellSize;
+
+    /// Cell size requested by the user, 0 for automatic.
+    ai_real mRequestedCellSize;
+
+    /// false until the Finalize method is called.
+    bool mFinalized;
+};
+
+} // end of namespace Assimp
+
+#endif // AI_SPATIALHASH_H_INC
@@ -616,6 +616,97 @@ enum aiMorphingMethod {
 #endif
 }; //! enum aiMorphingMethod
 
+// ---------------------------------------------------------------------------
+/** @brief A meshlet is a small cluster of triangles of a mesh.
+ *
+ *  Meshlets are generated by #aiProcess_ImproveCacheLocality if the
+ *  #AI_CONFIG_PP_ICL_GEN_MESHLETS property is set. The triangles of a meshlet
+ *  are stored contiguously in #aiMesh::mFaces, starting at #mTriangleOffset.
+ *  The vertices they use are listed in #aiMesh::mMeshletVertices, starting at
+ *  #mVertexOffset, and #aiMesh::mMeshletTriangles holds the indices of the
+ *  triangle corners into this list.
+ *
+ *  The bounds allow a renderer to cull whole meshlets: a meshlet is outside
+ *  the view if its bounding sphere is, and it is back-facing if
+ *  dot(normalize(mConeApex - cameraPosition), mConeAxis) >= mConeCutoff.
+ */
+struct aiMeshlet {
+    /** Index of the first vertex of the meshlet in aiMesh::mMeshletVertices */
+    unsigned int mVertexOffset;
+
+    /** Number of vertices of the meshlet */
+    unsigned int mNumVertices;
+
+    /** Index of the first face of the meshlet in aiMesh::mFaces */
+    unsigned int mTriangleOffset;
+
+    /** Number of triangles of the meshlet */
+    unsigned int mNumTriangles;
+
+    /** Center of the bounding sphere */
+    C_STRUCT aiVector3D mCenter;
+
+    /** Radius of the bounding sphere */
+    ai_real mRadius;
+
+    /** Apex of the normal cone */
+    C_STRUCT aiVector3D mConeApex;
+
+    /** Axis of the normal cone */
+    C_STRUCT aiVector3D mConeAxis;
+
+    /** Sine of the half angle of the normal cone, 1 if the meshlet
+     *  can't be culled by its normals */
+    ai_real mConeCutoff;
+
+#ifdef __cplusplus
+    aiMeshlet() AI_NO_EXCEPT
+            : mVertexOffset(0),
+              mNumVertices(0),
+              mTriangleOffset(0),
+              mNumTriangles(0),
+              mCenter(),
+              mRadius(0),
+              mConeApex(),
+              mConeAxis(),
+              mConeCutoff(1) {
+        // empty
+    }
+#endif // __cplusplus
+};
+
+// ---------------------------------------------------------------------------
+/** @brief A level of detail of a mesh.
+ *
+ *  LODs are generated by #aiProcess_ImproveCacheLocality if the
+ *  #AI_CONFIG_PP_ICL_LOD_RATIOS property is set. A LOD is a simplified
+ *  index buffer of its mesh, its faces refer to the vertices of the mesh.
+ */
+struct aiMeshLOD {
+    /** The number of faces of the LOD */
+    unsigned int mNumFaces;
+
+    /** The faces of the LOD, triangles referring to the vertices of the mesh */
+    C_STRUCT aiFace *mFaces;
+
+    /** The largest deviation of the LOD from the mesh, relative to the
+     *  extent of the mesh */
+    ai_real mError;
+
+#ifdef __cplusplus
+    aiMeshLOD() AI_NO_EXCEPT
+            : mNumFaces(0),
+              mFaces(nullptr),
+              mError(0) {
+        // empty
+    }
+
+    ~aiMeshLOD() {
+        delete[] mFaces;
+    }
+#endif // __cplusplus
+};
+
 // ---------------------------------------------------------------------------
 /** @brief A mesh represents a geometry or model with a single material.
  *
@@ -826,6 +917,51 @@ struct aiMesh {
      */
     C_STRUCT aiString **mTextureCoordsNames;
 
+    /**
+     * The number of meshlets of this mesh, 0 if no meshlets were generated.
+     * @see aiMeshlet
+     * @note The meshlet members were added in 6.1 and changed the layout of
+     *   aiMesh, see CHANGES.md.
+     */
+    unsigned int mNumMeshlets;
+
+    /**
+     * The meshlets of this mesh. The array is mNumMeshlets in size.
+     */
+    C_STRUCT aiMeshlet *mMeshlets;
+
+    /**
+     * The number of entries in mMeshletVertices.
+     */
+    unsigned int mNumMeshletVertices;
+
+    /**
+     * The vertices of all meshlets, as indices into the vertex arrays of
+     * the mesh. The array is mNumMeshletVertices in size.
+     */
+    unsigned int *mMeshletVertices;
+
+    /**
+     * The corners of all meshlet triangles, as indices into the vertices of
+     * their meshlet. The array holds three entries for each face of the mesh
+     * and is only valid if mNumMeshlets is not 0.
+     */
+    unsigned char *mMeshletTriangles;
+
+    /**
+     * The number of LODs of this mesh, 0 if no LODs were generated.
+     * @see aiMeshLOD
+     * @note The LOD members were added in 6.1 and changed the layout of
+     *   aiMesh, see CHANGES.md.
+     */
+    unsigned int mNumLODs;
+
+    /**
+     * The LODs of this mesh, from the most to the least detailed one.
+     * The array is mNumLODs in size.
+     */
+    C_STRUCT aiMeshLOD **mLODs;
+
 #ifdef __cplusplus
 
     //! The default class constructor.
@@ -848,7 +984,14 @@ struct aiMesh {
               mAnimMeshes(nullptr),
               mMethod(aiMorphingMethod_UNKNOWN),
               mAABB(),
-              mTextureCoordsNames(nullptr) {
+              mTextureCoordsNames(nullptr),
+              mNumMeshlets(0),
+              mMeshlets(nullptr),
+              mNumMeshletVertices(0),
+              mMeshletVertices(nullptr),
+              mMeshletTriangles(nullptr),
+              mNumLODs(0),
+              mLODs(nullptr) {
         // empty
     }
 
@@ -895,6 +1038,16 @@ struct aiMesh {
         }
 
         delete[] mFaces;
+        delete[] mMeshlets;
+        delete[] mMeshletVertices;
+        delete[] mMeshletTriangles;
+
+        if (mNumLODs && mLODs) {
+            for (unsigned int a = 0; a < mNumLODs; a++) {
+                delete mLODs[a];
+            }
+            delete[] mLODs;
+        }
     }
 
     //! @brief Check whether the mesh contains positions. Provided no special
@@ -976,6 +1129,18 @@ struct aiMesh {
         return mBones != nullptr && mNumBones > 0;
     }
 
+    //! @brief Check whether the mesh contains meshlets.
+    //! @return true, if meshlets are stored, false if not.
+    bool HasMeshlets() const {
+        return mMeshlets != nullptr && mNumMeshlets > 0;
+    }
+
+    //! @brief Check whether the mesh contains LODs.
+    //! @return true, if LODs are stored, false if not.
+    bool HasLODs() const {
+        return mLODs != nullptr && mNumLODs > 0;
+    }
+
     //! @brief  Check whether the mesh contains a texture coordinate set name
     //! @param pIndex Index of the texture coordinates set
     //! @return true, if texture coordinates for the index exists.
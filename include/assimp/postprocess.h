@@ -79,7 +79,8 @@ enum aiPostProcessSteps
      * such as normal mapping  applied to the meshes. There's an importer property,
      * <tt>#AI_CONFIG_PP_CT_MAX_SMOOTHING_ANGLE</tt>, which allows you to specify
      * a maximum smoothing angle for the algorithm. However, usually you'll
-     * want to leave it at the default value.
+     * want to leave it at the default value. Set <tt>#AI_CONFIG_PP_CT_MIKKTSPACE</tt>
+     * to get the tangents MikkTSpace computes, as used by most bakers of normal maps.
      */
     aiProcess_CalcTangentSpace = 0x1,
 
@@ -287,6 +288,14 @@ enum aiPostProcessSteps
      * If you intend to render huge models in hardware, this step might
      * be of interest to you. The <tt>#AI_CONFIG_PP_ICL_PTCACHE_SIZE</tt>
      * importer property can be used to fine-tune the cache optimization.
+     * Set <tt>#AI_CONFIG_PP_ICL_OPTIMIZE_OVERDRAW</tt> to reorder the
+     * triangles for less overdraw afterwards and
+     * <tt>#AI_CONFIG_PP_ICL_OPTIMIZE_VERTEX_FETCH</tt> to reorder the
+     * vertices to the order in which the triangles use them.
+     * <tt>#AI_CONFIG_PP_ICL_GEN_MESHLETS</tt> partitions the meshes into
+     * meshlets with bounds for culling, see #aiMeshlet, and
+     * <tt>#AI_CONFIG_PP_ICL_LOD_RATIOS</tt> generates simplified LODs,
+     * see #aiMeshLOD.
      */
     aiProcess_ImproveCacheLocality = 0x800,
 
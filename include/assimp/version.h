@@ -107,6 +107,8 @@ ASSIMP_API const char *aiGetBranchName();
 #define ASSIMP_CFLAGS_SINGLETHREADED    0x10
 //! Assimp was compiled with ASSIMP_BUILD_SINGLETHREADED defined
 #define ASSIMP_CFLAGS_DOUBLE_SUPPORT 0x20
+//! Assimp was compiled without ASSIMP_BUILD_SINGLETHREADED, post processing may use worker threads
+#define ASSIMP_CFLAGS_MULTITHREADED  0x40
 
 // ---------------------------------------------------------------------------
 /** @brief Returns assimp's compile flags
@@ -621,6 +621,56 @@ class AnimMesh(Structure):
         ]
 
 
+class Meshlet(Structure):
+    """
+    See 'mesh.h' for details.
+    """
+
+    _fields_ = [
+            # Index of the first vertex of the meshlet in mMeshletVertices
+            ("mVertexOffset", c_uint),
+
+            # Number of vertices of the meshlet
+            ("mNumVertices", c_uint),
+
+            # Index of the first face of the meshlet in mFaces
+            ("mTriangleOffset", c_uint),
+
+            # Number of triangles of the meshlet
+            ("mNumTriangles", c_uint),
+
+            # Center of the bounding sphere
+            ("mCenter", Vector3D),
+
+            # Radius of the bounding sphere
+            ("mRadius", c_float),
+
+            # Apex of the normal cone
+            ("mConeApex", Vector3D),
+
+            # Axis of the normal cone
+            ("mConeAxis", Vector3D),
+
+            # Sine of the half angle of the normal cone
+            ("mConeCutoff", c_float),
+        ]
+
+class MeshLOD(Structure):
+    """
+    See 'mesh.h' for details.
+    """
+
+    _fields_ = [
+            # The number of faces of the LOD
+            ("mNumFaces", c_uint),
+
+            # The faces of the LOD, triangles referring to the vertices of the mesh
+            ("mFaces", POINTER(Face)),
+
+            # The largest deviation of the LOD from the mesh, relative to its extent
+            ("mError", c_float),
+        ]
+
 class Mesh(Structure):
     """
     See 'mesh.h' for details.
@@ -777,7 +827,29 @@ class Mesh(Structure):
             ("mAABB", 2 * Vector3D),
 
             # Vertex UV stream names. Pointer to array of size AI_MAX_NUMBER_OF_TEXTURECOORDS
-            ("mTextureCoordsNames", POINTER(POINTER(String)))
+            ("mTextureCoordsNames", POINTER(POINTER(String))),
+
+            # The number of meshlets of this mesh, 0 if no meshlets were generated.
+            ("mNumMeshlets", c_uint),
+
+            # The meshlets of this mesh. The array is mNumMeshlets in size.
+            ("mMeshlets", POINTER(Meshlet)),
+
+            # The number of entries in mMeshletVertices.
+            ("mNumMeshletVertices", c_uint),
+
+            # The vertices of all meshlets, as indices into the vertex arrays.
+            ("mMeshletVertices", POINTER(c_uint)),
+
+            # The corners of all meshlet triangles, as indices into the vertices
+            # of their meshlet. Three entries for each face of the mesh.
+            ("mMeshletTriangles", POINTER(c_ubyte)),
+
+            # The number of LODs of this mesh, 0 if no LODs were generated.
+            ("mNumLODs", c_uint),
+
+            # The LODs of this mesh, from the most to the least detailed one.
+            ("mLODs", POINTER(POINTER(MeshLOD)))
 
         ]
 
@@ -0,0 +1,237 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  BenchmarkRunner.cpp
+ *  @brief Implementation of the benchmark harness.
+ */
+#include "BenchmarkRunner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+#include <ostream>
+
+namespace {
+
+std::atomic<size_t> gAllocationCount(0);
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// The array and nothrow forms of the default operators forward to these two.
+void *operator new(size_t size) {
+    gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+// ------------------------------------------------------------------------------------------------
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
+// ------------------------------------------------------------------------------------------------
+void operator delete(void *p, size_t) noexcept {
+    free(p);
+}
+
+namespace Assimp {
+namespace Benchmark {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+void WriteJsonString(std::ostream &out, const std::string &str) {
+    out << '"';
+    for (const char c : str) {
+        switch (c) {
+        case '"':
+            out << "\\\"";
+            break;
+        case '\\':
+            out << "\\\\";
+            break;
+        case '\n':
+            out << "\\n";
+            break;
+        case '\t':
+            out << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buffer[8];
+                snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(c));
+                out << buffer;
+            } else {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+
+// ------------------------------------------------------------------------------------------------
+double Throughput(size_t amount, double seconds) {
+    return seconds > 0.0 ? static_cast<double>(amount) / seconds : 0.0;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+size_t GetAllocationCount() {
+    return gAllocationCount.load(std::memory_order_relaxed);
+}
+
+// ------------------------------------------------------------------------------------------------
+BenchmarkRunner::BenchmarkRunner(const std::string &filter, unsigned int repetitions) :
+        mFilter(filter), mRepetitions(std::max(1u, repetitions)) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool BenchmarkRunner::IsEnabled(const std::string &name) const {
+    return mFilter.empty() || name.find(mFilter) != std::string::npos;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BenchmarkRunner::Run(const std::string &group, const std::string &name, const Iteration &iteration) {
+    if (!IsEnabled(name)) {
+        return;
+    }
+
+    BenchmarkResult result;
+    result.mGroup = group;
+    result.mName = name;
+
+    std::vector<double> times;
+    times.reserve(mRepetitions);
+    for (unsigned int i = 0; i <= mRepetitions; ++i) {
+        BenchmarkState state;
+        if (!iteration(state)) {
+            result.mError = state.mError.empty() ? "failed" : state.mError;
+            break;
+        }
+        result.mBytes = state.mBytes;
+        result.mVertices = state.mVertices;
+        result.mAllocations = state.mAllocations;
+        // the first iteration only warms up the caches
+        if (i > 0) {
+            times.push_back(state.mElapsed);
+        }
+    }
+
+    if (result.mError.empty()) {
+        std::sort(times.begin(), times.end());
+        result.mIterations = static_cast<unsigned int>(times.size());
+        result.mMinTime = times.front();
+        for (const double t : times) {
+            result.mMeanTime += t;
+        }
+        result.mMeanTime /= static_cast<double>(times.size());
+        result.mMedianTime = times.size() % 2 ? times[times.size() / 2] :
+                0.5 * (times[times.size() / 2 - 1] + times[times.size() / 2]);
+
+        char bytes[32] = "-";
+        if (result.mBytes > 0) {
+            snprintf(bytes, sizeof(bytes), "%.2f", Throughput(result.mBytes, result.mMedianTime) / 1e6);
+        }
+        printf("%-64s %10.3f ms %10s MB/s %10.2f Mvert/s %10zu allocs\n", name.c_str(), result.mMedianTime * 1000.0, bytes,
+                Throughput(result.mVertices, result.mMedianTime) / 1e6, result.mAllocations);
+    } else {
+        printf("%-64s FAILED: %s\n", name.c_str(), result.mError.c_str());
+    }
+    fflush(stdout);
+
+    mResults.push_back(result);
+}
+
+// ------------------------------------------------------------------------------------------------
+void BenchmarkRunner::WriteJson(std::ostream &out, const std::vector<std::pair<std::string, std::string>> &context) const {
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(6);
+
+    out << "{\n  \"context\": {";
+    for (size_t i = 0; i < context.size(); ++i) {
+        out << (i ? ",\n    " : "\n    ");
+        WriteJsonString(out, context[i].first);
+        out << ": ";
+        WriteJsonString(out, context[i].second);
+    }
+    out << "\n  },\n  \"benchmarks\": [";
+    for (size_t i = 0; i < mResults.size(); ++i) {
+        const BenchmarkResult &result = mResults[i];
+        out << (i ? ",\n    {" : "\n    {");
+        out << "\"name\": ";
+        WriteJsonString(out, result.mName);
+        out << ", \"group\": ";
+        WriteJsonString(out, result.mGroup);
+        if (!result.mError.empty()) {
+            out << ", \"error\": ";
+            WriteJsonString(out, result.mError);
+            out << '}';
+            continue;
+        }
+        out << ", \"iterations\": " << result.mIterations
+            << ", \"bytes\": " << result.mBytes
+            << ", \"vertices\": " << result.mVertices
+            << ", \"allocations\": " << result.mAllocations
+            << ", \"min_ms\": " << result.mMinTime * 1000.0
+            << ", \"mean_ms\": " << result.mMeanTime * 1000.0
+            << ", \"median_ms\": " << result.mMedianTime * 1000.0
+            << ", \"mb_per_s\": " << Throughput(result.mBytes, result.mMedianTime) / 1e6
+            << ", \"vertices_per_s\": " << Throughput(result.mVertices, result.mMedianTime)
+            << '}';
+    }
+    out << "\n  ]\n}\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+} // namespace Benchmark
+} // namespace Assimp
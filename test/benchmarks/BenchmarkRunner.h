@@ -0,0 +1,163 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  BenchmarkRunner.h
+ *  @brief Minimal benchmark harness used by assimp_benchmarks.
+ */
+#pragma once
+#ifndef AI_BENCHMARK_RUNNER_H_INC
+#define AI_BENCHMARK_RUNNER_H_INC
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace Assimp {
+namespace Benchmark {
+
+// ------------------------------------------------------------------------------------------------
+/** @brief Returns the number of heap allocations made by the process so far.
+ *
+ *  Counted by the replacement of the global operator new of the benchmark
+ *  executable, so allocations through malloc() are not included. On
+ *  platforms where the library does not bind to the operator of the
+ *  executable (e.g. a Windows DLL), only the benchmark itself is counted. */
+size_t GetAllocationCount();
+
+// ------------------------------------------------------------------------------------------------
+/** @brief Passed to each iteration of a benchmark.
+ *
+ *  The iteration brackets the code to be measured with Start() and Stop(),
+ *  everything outside is setup and not accounted for. It also reports the
+ *  amount of data processed, which is used to compute the throughput. */
+class BenchmarkState {
+public:
+    /// @brief Starts the measurement.
+    void Start() {
+        mStartAllocations = GetAllocationCount();
+        mStart = std::chrono::steady_clock::now();
+    }
+
+    /// @brief Stops the measurement, the time and the allocations since Start() are added to the iteration.
+    void Stop() {
+        mElapsed += std::chrono::duration<double>(std::chrono::steady_clock::now() - mStart).count();
+        mAllocations += GetAllocationCount() - mStartAllocations;
+    }
+
+    /// Number of bytes read or written by one iteration.
+    size_t mBytes = 0;
+
+    /// Number of vertices processed by one iteration.
+    size_t mVertices = 0;
+
+    /// Reason of the failure, set by iterations returning false.
+    std::string mError;
+
+private:
+    friend class BenchmarkRunner;
+
+    std::chrono::steady_clock::time_point mStart;
+    double mElapsed = 0.0;
+    size_t mStartAllocations = 0;
+    size_t mAllocations = 0;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** @brief The measurements of one benchmark. */
+struct BenchmarkResult {
+    std::string mName;          ///< Unique name, e.g. "import/FBX/spider.fbx"
+    std::string mGroup;         ///< "import", "postprocess" or "export"
+    unsigned int mIterations = 0;
+    size_t mBytes = 0;          ///< Bytes per iteration, 0 if not applicable
+    size_t mVertices = 0;       ///< Vertices per iteration
+    size_t mAllocations = 0;    ///< Heap allocations of the measured part of one iteration
+    double mMinTime = 0.0;      ///< Fastest iteration in seconds
+    double mMeanTime = 0.0;     ///< Average iteration in seconds
+    double mMedianTime = 0.0;   ///< Median iteration in seconds
+    std::string mError;         ///< Empty if the benchmark succeeded
+};
+
+// ------------------------------------------------------------------------------------------------
+/** @brief Runs benchmarks and collects their results.
+ *
+ *  Every benchmark is run once to warm up the caches, followed by the
+ *  configured number of measured repetitions. Throughput figures are
+ *  derived from the median time. */
+class BenchmarkRunner {
+public:
+    /// @brief One iteration, returns false on failure.
+    using Iteration = std::function<bool(BenchmarkState &)>;
+
+    /// @brief The constructor.
+    /// @param filter       Only benchmarks whose name contains this string are run.
+    /// @param repetitions  Number of measured iterations per benchmark.
+    BenchmarkRunner(const std::string &filter, unsigned int repetitions);
+
+    /// @brief Returns true if a benchmark of the given name passes the filter.
+    bool IsEnabled(const std::string &name) const;
+
+    /// @brief Runs a benchmark unless it is filtered out and prints its result.
+    void Run(const std::string &group, const std::string &name, const Iteration &iteration);
+
+    /// @brief Returns the results collected so far.
+    const std::vector<BenchmarkResult> &GetResults() const {
+        return mResults;
+    }
+
+    /// @brief Writes all results as JSON.
+    /// @param out      The stream to write to.
+    /// @param context  Name/value pairs describing the run, written as "context" object.
+    void WriteJson(std::ostream &out, const std::vector<std::pair<std::string, std::string>> &context) const;
+
+private:
+    std::string mFilter;
+    unsigned int mRepetitions;
+    std::vector<BenchmarkResult> mResults;
+};
+
+} // namespace Benchmark
+} // namespace Assimp
+
+#endif // AI_BENCHMARK_RUNNER_H_INC
@@ -0,0 +1,562 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  Main.cpp
+ *  @brief main() function of assimp_benchmarks.
+ *
+ *  Measures the import of the test model corpus and of synthetic scenes per
+ *  format, every post-processing step in isolation and every exporter. The
+ *  results are printed as table and can be written as JSON to compare them
+ *  across releases.
+ */
+#include "BenchmarkRunner.h"
+#include "SyntheticScene.h"
+#include "Common/simd.h"
+
+#include <assimp/BlobIOSystem.h>
+#include <assimp/Exporter.hpp>
+#include <assimp/IOSystem.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/MemoryIOWrapper.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/StringComparison.h>
+#include <assimp/version.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <thread>
+
+using namespace Assimp;
+using namespace Assimp::Benchmark;
+
+namespace {
+
+constexpr char MSG_HELP[] =
+"assimp_benchmarks [options] [model files]\n\n"
+" options:\n"
+" \t--filter <text>      Only run benchmarks whose name contains <text>\n"
+" \t--repetitions <n>    Measured iterations per benchmark (default 5)\n"
+" \t--vertices <n>       Vertices of the synthetic scene (default 100000)\n"
+" \t--meshes <n>         Meshes of the synthetic scene (default 8)\n"
+" \t--threads <n>        Value of AI_CONFIG_IMPORT_NUM_THREADS and\n"
+"                        AI_CONFIG_PP_NUM_THREADS, 0 for all cores\n"
+" \t--simd <set>         Vector kernels to use: scalar, sse2, avx or neon\n"
+" \t--models <dir>       Root of the test model corpus\n"
+" \t--json <file>        Write the results as JSON, '-' for stdout\n"
+" \t--help               Print this text\n\n"
+" Model files given on the command line are benchmarked in addition to the\n"
+" corpus. Benchmark names are 'import/<file>', 'import/synthetic/<format>',\n"
+" 'postprocess/<step>' and 'export/<format>'.\n";
+
+// Representative files of the test model corpus, relative to its root
+const char *CorpusFiles[] = {
+    "3DS/fels.3ds",
+    "BLEND/box.blend",
+    "Collada/duck.dae",
+    "FBX/huesitos.fbx",
+    "FBX/spider.fbx",
+    "glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine.glb",
+    "glTF2/BoxTextured-glTF/BoxTextured.gltf",
+    "MD5/SimpleCube.md5mesh",
+    "OBJ/spider.obj",
+    "OBJ/WusonOBJ.obj",
+    "OFF/Wuson.off",
+    "PLY/Wuson.ply",
+    "STL/Spider_binary.stl",
+    "STL/Wuson.stl",
+    "X/BCN_Epileptic.X",
+};
+
+struct PostProcessStep {
+    unsigned int mFlags;
+    const char *mName;
+};
+
+// Every post-processing step on its own. The normal generation steps are
+// forced, the synthetic scene has normals already.
+const PostProcessStep PostProcessSteps[] = {
+    { aiProcess_CalcTangentSpace, "CalcTangentSpace" },
+    { aiProcess_JoinIdenticalVertices, "JoinIdenticalVertices" },
+    { aiProcess_MakeLeftHanded, "MakeLeftHanded" },
+    { aiProcess_Triangulate, "Triangulate" },
+    { aiProcess_RemoveComponent, "RemoveComponent" },
+    { aiProcess_GenNormals | aiProcess_ForceGenNormals, "GenNormals" },
+    { aiProcess_GenSmoothNormals | aiProcess_ForceGenNormals, "GenSmoothNormals" },
+    { aiProcess_SplitLargeMeshes, "SplitLargeMeshes" },
+    { aiProcess_PreTransformVertices, "PreTransformVertices" },
+    { aiProcess_LimitBoneWeights, "LimitBoneWeights" },
+    { aiProcess_ValidateDataStructure, "ValidateDataStructure" },
+    { aiProcess_ImproveCacheLocality, "ImproveCacheLocality" },
+    { aiProcess_RemoveRedundantMaterials, "RemoveRedundantMaterials" },
+    { aiProcess_FixInfacingNormals, "FixInfacingNormals" },
+    { aiProcess_PopulateArmatureData, "PopulateArmatureData" },
+    { aiProcess_SortByPType, "SortByPType" },
+    { aiProcess_FindDegenerates, "FindDegenerates" },
+    { aiProcess_FindInvalidData, "FindInvalidData" },
+    { aiProcess_GenUVCoords, "GenUVCoords" },
+    { aiProcess_TransformUVCoords, "TransformUVCoords" },
+    { aiProcess_FindInstances, "FindInstances" },
+    { aiProcess_OptimizeMeshes, "OptimizeMeshes" },
+    { aiProcess_OptimizeGraph, "OptimizeGraph" },
+    { aiProcess_FlipUVs, "FlipUVs" },
+    { aiProcess_FlipWindingOrder, "FlipWindingOrder" },
+    { aiProcess_SplitByBoneCount, "SplitByBoneCount" },
+    { aiProcess_Debone, "Debone" },
+    { aiProcess_GlobalScale, "GlobalScale" },
+    { aiProcess_EmbedTextures, "EmbedTextures" },
+    { aiProcess_DropNormals, "DropNormals" },
+    { aiProcess_GenBoundingBoxes, "GenBoundingBoxes" },
+};
+
+struct Exclusion {
+    const char *mId;
+    const char *mReason;
+};
+
+// Exporters whose output the importer for their file extension can't read back
+const Exclusion SyntheticImportExclusions[] = {
+    { "stp", "the STEP exporter writes AP214, the importer for .stp only reads IFC schemas" },
+};
+
+// Exporters that can't export to memory
+const Exclusion ExportExclusions[] = {
+    { "3mf", "the 3MF exporter writes its zip archive to disk, bypassing the IOSystem" },
+};
+
+struct Options {
+    std::string mFilter;
+    unsigned int mRepetitions = 5;
+    unsigned int mVertices = 100000;
+    unsigned int mMeshes = 8;
+    int mThreads = -1;
+    std::string mSimd;
+    std::string mModelsDir = ASSIMP_BENCHMARK_MODELS_DIR;
+    std::string mJsonFile;
+    std::vector<std::string> mFiles;
+};
+
+using BlobStore = std::map<std::string, std::vector<uint8_t>>;
+
+// ------------------------------------------------------------------------------------------------
+/** @brief Serves the files of an exported blob chain from memory.
+ *
+ *  Files are looked up by their name without directory, so references between
+ *  the blobs (e.g. .obj to .mtl) resolve no matter which base path the
+ *  importer prepends. */
+class BlobStoreIOSystem : public IOSystem {
+public:
+    explicit BlobStoreIOSystem(const BlobStore &store) :
+            mStore(store) {
+        // empty
+    }
+
+    bool Exists(const char *pFile) const override {
+        return mStore.find(BaseName(pFile)) != mStore.end();
+    }
+
+    char getOsSeparator() const override {
+        return '/';
+    }
+
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        if (strchr(pMode, 'w') || strchr(pMode, 'a')) {
+            return nullptr;
+        }
+        const BlobStore::const_iterator it = mStore.find(BaseName(pFile));
+        if (it == mStore.end()) {
+            return nullptr;
+        }
+        return new MemoryIOStream(it->second.data(), it->second.size());
+    }
+
+    void Close(IOStream *pFile) override {
+        delete pFile;
+    }
+
+private:
+    static std::string BaseName(const std::string &path) {
+        const std::string::size_type pos = path.find_last_of("/\\");
+        return pos == std::string::npos ? path : path.substr(pos + 1);
+    }
+
+    const BlobStore &mStore;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Returns why the format is left out of a group of benchmarks, nullptr if it isn't. */
+template <size_t N>
+const char *GetExclusionReason(const Exclusion (&exclusions)[N], const char *id) {
+    for (const Exclusion &exclusion : exclusions) {
+        if (0 == strcmp(exclusion.mId, id)) {
+            return exclusion.mReason;
+        }
+    }
+    return nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t GetFileSize(const std::string &path) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (nullptr == file) {
+        return 0;
+    }
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    fclose(file);
+    return size > 0 ? static_cast<size_t>(size) : 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ParseOptions(int argc, char *argv[], Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        } else if (arg == "--filter" && hasValue) {
+            options.mFilter = argv[++i];
+        } else if (arg == "--repetitions" && hasValue) {
+            options.mRepetitions = static_cast<unsigned int>(strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--vertices" && hasValue) {
+            options.mVertices = static_cast<unsigned int>(strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--meshes" && hasValue) {
+            options.mMeshes = static_cast<unsigned int>(strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--threads" && hasValue) {
+            options.mThreads = atoi(argv[++i]);
+        } else if (arg == "--simd" && hasValue) {
+            options.mSimd = argv[++i];
+        } else if (arg == "--models" && hasValue) {
+            options.mModelsDir = argv[++i];
+        } else if (arg == "--json" && hasValue) {
+            options.mJsonFile = argv[++i];
+        } else if (arg.compare(0, 2, "--") == 0) {
+            fprintf(stderr, "assimp_benchmarks: unknown or incomplete option %s\n", arg.c_str());
+            return false;
+        } else {
+            options.mFiles.push_back(arg);
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BenchmarkImportFile(BenchmarkRunner &runner, const Options &options, const std::string &name, const std::string &path) {
+    runner.Run("import", "import/" + name, [&](BenchmarkState &state) {
+        Importer importer;
+        if (options.mThreads >= 0) {
+            importer.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, options.mThreads);
+        }
+        state.Start();
+        const aiScene *scene = importer.ReadFile(path, 0);
+        state.Stop();
+        if (nullptr == scene) {
+            state.mError = importer.GetErrorString();
+            return false;
+        }
+        state.mBytes = GetFileSize(path);
+        state.mVertices = CountVertices(scene);
+        return true;
+    });
+}
+
+// ------------------------------------------------------------------------------------------------
+void BenchmarkImportCorpus(BenchmarkRunner &runner, const Options &options) {
+    for (const char *file : CorpusFiles) {
+        BenchmarkImportFile(runner, options, file, options.mModelsDir + "/" + file);
+    }
+    for (const std::string &file : options.mFiles) {
+        BenchmarkImportFile(runner, options, file, file);
+    }
+}
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+
+// ------------------------------------------------------------------------------------------------
+size_t GetBlobSize(const aiExportDataBlob *blob) {
+    size_t size = 0;
+    for (; nullptr != blob; blob = blob->next) {
+        size += blob->size;
+    }
+    return size;
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Exports a scene to memory and stores the blobs under the names the exporter
+ *  used for them, the primary file as "$blobfile.<extension>". */
+bool ExportToStore(Exporter &exporter, const aiScene *scene, const aiExportFormatDesc *format,
+        BlobStore &store, std::string &primary) {
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, format->id);
+    if (nullptr == blob) {
+        return false;
+    }
+    primary = std::string(AI_BLOBIO_MAGIC) + "." + format->fileExtension;
+    for (const aiExportDataBlob *cur = blob; nullptr != cur; cur = cur->next) {
+        const std::string name = cur == blob ? primary : std::string(AI_BLOBIO_MAGIC) + "." + cur->name.C_Str();
+        const uint8_t *data = static_cast<const uint8_t *>(cur->data);
+        store[name].assign(data, data + cur->size);
+    }
+    exporter.FreeBlob();
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BenchmarkImportSynthetic(BenchmarkRunner &runner, const Options &options, const aiScene *scene) {
+    Exporter exporter;
+    Importer probe;
+    for (size_t i = 0; i < exporter.GetExportFormatCount(); ++i) {
+        const aiExportFormatDesc *format = exporter.GetExportFormatDescription(i);
+        const std::string name = std::string("import/synthetic/") + format->id;
+        if (!runner.IsEnabled(name) || !probe.IsExtensionSupported(format->fileExtension)) {
+            continue;
+        }
+        if (const char *reason = GetExclusionReason(SyntheticImportExclusions, format->id)) {
+            printf("%s: skipped, %s\n", name.c_str(), reason);
+            continue;
+        }
+
+        BlobStore store;
+        std::string primary;
+        if (!ExportToStore(exporter, scene, format, store, primary)) {
+            continue;
+        }
+
+        size_t bytes = 0;
+        for (const BlobStore::value_type &file : store) {
+            bytes += file.second.size();
+        }
+        runner.Run("import", name, [&](BenchmarkState &state) {
+            Importer importer;
+            if (options.mThreads >= 0) {
+                importer.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, options.mThreads);
+            }
+            importer.SetIOHandler(new BlobStoreIOSystem(store));
+            state.Start();
+            const aiScene *result = importer.ReadFile(primary, 0);
+            state.Stop();
+            if (nullptr == result) {
+                state.mError = importer.GetErrorString();
+                return false;
+            }
+            state.mBytes = bytes;
+            state.mVertices = CountVertices(result);
+            return true;
+        });
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void BenchmarkPostProcessing(BenchmarkRunner &runner, const Options &options,
+        const aiScene *triangles, const aiScene *quads) {
+    // the steps run on a fresh copy of the scene each iteration, which is
+    // loaded from an assbin file kept in memory
+    Exporter exporter;
+    const aiExportFormatDesc *format = nullptr;
+    for (size_t i = 0; i < exporter.GetExportFormatCount(); ++i) {
+        if (0 == strcmp(exporter.GetExportFormatDescription(i)->id, "assbin")) {
+            format = exporter.GetExportFormatDescription(i);
+        }
+    }
+    if (nullptr == format) {
+        printf("postprocess: skipped, the assbin exporter is not available\n");
+        return;
+    }
+
+    BlobStore triangleStore, quadStore;
+    std::string primary;
+    if (!ExportToStore(exporter, triangles, format, triangleStore, primary) ||
+            !ExportToStore(exporter, quads, format, quadStore, primary)) {
+        printf("postprocess: skipped, %s\n", exporter.GetErrorString());
+        return;
+    }
+    const std::vector<uint8_t> &triangleData = triangleStore[primary];
+    const std::vector<uint8_t> &quadData = quadStore[primary];
+
+    for (const PostProcessStep &step : PostProcessSteps) {
+        // Triangulate needs polygons to do anything
+        const std::vector<uint8_t> &data = step.mFlags == aiProcess_Triangulate ? quadData : triangleData;
+        runner.Run("postprocess", std::string("postprocess/") + step.mName, [&](BenchmarkState &state) {
+            Importer importer;
+            if (options.mThreads >= 0) {
+                importer.SetPropertyInteger(AI_CONFIG_PP_NUM_THREADS, options.mThreads);
+            }
+            importer.SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS, aiComponent_TEXCOORDS);
+            const aiScene *scene = importer.ReadFileFromMemory(data.data(), data.size(), 0, "assbin");
+            if (nullptr == scene) {
+                state.mError = importer.GetErrorString();
+                return false;
+            }
+            state.mVertices = CountVertices(scene);
+            state.Start();
+            scene = importer.ApplyPostProcessing(step.mFlags);
+            state.Stop();
+            if (nullptr == scene) {
+                state.mError = importer.GetErrorString();
+                return false;
+            }
+            return true;
+        });
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void BenchmarkExport(BenchmarkRunner &runner, const aiScene *scene) {
+    Exporter exporter;
+    const size_t vertices = CountVertices(scene);
+    for (size_t i = 0; i < exporter.GetExportFormatCount(); ++i) {
+        const std::string id = exporter.GetExportFormatDescription(i)->id;
+        if (!runner.IsEnabled("export/" + id)) {
+            continue;
+        }
+        if (const char *reason = GetExclusionReason(ExportExclusions, id.c_str())) {
+            printf("export/%s: skipped, %s\n", id.c_str(), reason);
+            continue;
+        }
+        runner.Run("export", "export/" + id, [&](BenchmarkState &state) {
+            exporter.FreeBlob();
+            state.Start();
+            const aiExportDataBlob *blob = exporter.ExportToBlob(scene, id);
+            state.Stop();
+            if (nullptr == blob) {
+                state.mError = exporter.GetErrorString();
+                return false;
+            }
+            state.mBytes = GetBlobSize(blob);
+            state.mVertices = vertices;
+            return true;
+        });
+    }
+}
+
+#endif // ASSIMP_BUILD_NO_EXPORT
+
+// ------------------------------------------------------------------------------------------------
+std::vector<std::pair<std::string, std::string>> GetContext(const Options &options) {
+    char date[32] = {};
+    const time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    char revision[16] = {};
+    snprintf(revision, sizeof(revision), "%x", aiGetVersionRevision());
+
+    const unsigned int flags = aiGetCompileFlags();
+    return {
+        { "assimp_version", std::to_string(aiGetVersionMajor()) + "." + std::to_string(aiGetVersionMinor()) + "." +
+                std::to_string(aiGetVersionPatch()) },
+        { "revision", revision },
+        { "branch", aiGetBranchName() },
+        { "build", flags & ASSIMP_CFLAGS_DEBUG ? "debug" : "release" },
+        { "single_threaded", flags & ASSIMP_CFLAGS_SINGLETHREADED ? "true" : "false" },
+        { "double_precision", flags & ASSIMP_CFLAGS_DOUBLE_SUPPORT ? "true" : "false" },
+        { "hardware_threads", std::to_string(std::thread::hardware_concurrency()) },
+        { "pp_num_threads", options.mThreads >= 0 ? std::to_string(options.mThreads) : "default" },
+        { "simd", SIMD::GetInstructionSetName(SIMD::GetInstructionSet()) },
+        { "date", date },
+        { "repetitions", std::to_string(options.mRepetitions) },
+        { "synthetic_vertices", std::to_string(options.mVertices) },
+        { "synthetic_meshes", std::to_string(options.mMeshes) },
+    };
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        printf("%s", MSG_HELP);
+        return 1;
+    }
+
+    if (!options.mSimd.empty()) {
+        bool found = false;
+        for (SIMD::InstructionSet set : { SIMD::InstructionSet::Scalar, SIMD::InstructionSet::SSE2,
+                     SIMD::InstructionSet::AVX, SIMD::InstructionSet::NEON }) {
+            if (ASSIMP_stricmp(options.mSimd.c_str(), SIMD::GetInstructionSetName(set)) == 0) {
+                found = true;
+                if (SIMD::SetInstructionSet(set) != set) {
+                    fprintf(stderr, "assimp_benchmarks: %s is not supported here\n", options.mSimd.c_str());
+                    return 1;
+                }
+            }
+        }
+        if (!found) {
+            fprintf(stderr, "assimp_benchmarks: unknown instruction set %s\n", options.mSimd.c_str());
+            return 1;
+        }
+    }
+    printf("vector kernels: %s\n", SIMD::GetInstructionSetName(SIMD::GetInstructionSet()));
+
+    BenchmarkRunner runner(options.mFilter, options.mRepetitions);
+    BenchmarkImportCorpus(runner, options);
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+    std::unique_ptr<aiScene> triangles(CreateSyntheticScene(options.mVertices, options.mMeshes, true));
+    std::unique_ptr<aiScene> quads(CreateSyntheticScene(options.mVertices, options.mMeshes, false));
+    BenchmarkImportSynthetic(runner, options, triangles.get());
+    BenchmarkPostProcessing(runner, options, triangles.get(), quads.get());
+    BenchmarkExport(runner, triangles.get());
+#else
+    printf("synthetic scenes: skipped, assimp was built without export support\n");
+#endif
+
+    if (!options.mJsonFile.empty()) {
+        if (options.mJsonFile == "-") {
+            runner.WriteJson(std::cout, GetContext(options));
+        } else {
+            std::ofstream out(options.mJsonFile.c_str());
+            if (!out) {
+                fprintf(stderr, "assimp_benchmarks: unable to write %s\n", options.mJsonFile.c_str());
+                return 1;
+            }
+            runner.WriteJson(out, GetContext(options));
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  SyntheticScene.cpp
+ *  @brief Implementation of the synthetic benchmark scenes.
+ */
+#include "SyntheticScene.h"
+
+#include <assimp/material.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace Assimp {
+namespace Benchmark {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+aiVector3D SurfacePosition(float u, float v) {
+    return aiVector3D(u, 0.1f * std::sin(u * 12.0f) * std::cos(v * 9.0f), v);
+}
+
+// ------------------------------------------------------------------------------------------------
+aiVector3D SurfaceNormal(float u, float v) {
+    const float du = 1.2f * std::cos(u * 12.0f) * std::cos(v * 9.0f);
+    const float dv = -0.9f * std::sin(u * 12.0f) * std::sin(v * 9.0f);
+    return aiVector3D(-du, 1.0f, -dv).Normalize();
+}
+
+// ------------------------------------------------------------------------------------------------
+aiMesh *CreateStrip(unsigned int row, unsigned int numRows, unsigned int gridSize, bool triangles) {
+    const unsigned int cornersPerQuad = triangles ? 6 : 4;
+    const unsigned int numQuads = numRows * gridSize;
+
+    aiMesh *mesh = new aiMesh();
+    mesh->mName.Set("strip_" + std::to_string(row));
+    mesh->mPrimitiveTypes = triangles ? aiPrimitiveType_TRIANGLE : aiPrimitiveType_POLYGON;
+    mesh->mNumVertices = numQuads * cornersPerQuad;
+    mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+    mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+    mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+    mesh->mNumUVComponents[0] = 2;
+    mesh->mNumFaces = triangles ? numQuads * 2 : numQuads;
+    mesh->mFaces = new aiFace[mesh->mNumFaces];
+
+    // the corners of a quad, split into two triangles if requested
+    static const unsigned int QuadCorners[] = { 0, 1, 2, 3 };
+    static const unsigned int TriangleCorners[] = { 0, 1, 2, 0, 2, 3 };
+    const unsigned int *corners = triangles ? TriangleCorners : QuadCorners;
+
+    const float step = 1.0f / static_cast<float>(gridSize);
+    unsigned int vertex = 0, face = 0;
+    for (unsigned int y = row; y < row + numRows; ++y) {
+        for (unsigned int x = 0; x < gridSize; ++x) {
+            const float u[] = { x * step, (x + 1) * step, (x + 1) * step, x * step };
+            const float v[] = { y * step, y * step, (y + 1) * step, (y + 1) * step };
+
+            for (unsigned int i = 0; i < cornersPerQuad; i += (triangles ? 3 : 4)) {
+                aiFace &f = mesh->mFaces[face++];
+                f.mNumIndices = triangles ? 3 : 4;
+                f.mIndices = new unsigned int[f.mNumIndices];
+                for (unsigned int n = 0; n < f.mNumIndices; ++n) {
+                    const unsigned int c = corners[i + n];
+                    mesh->mVertices[vertex] = SurfacePosition(u[c], v[c]);
+                    mesh->mNormals[vertex] = SurfaceNormal(u[c], v[c]);
+                    mesh->mTextureCoords[0][vertex] = aiVector3D(u[c], v[c], 0.0f);
+                    f.mIndices[n] = vertex++;
+                }
+            }
+        }
+    }
+    return mesh;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+aiScene *CreateSyntheticScene(unsigned int numVertices, unsigned int numMeshes, bool triangles) {
+    const unsigned int cornersPerQuad = triangles ? 6 : 4;
+    const unsigned int gridSize = std::max(1u,
+            static_cast<unsigned int>(std::sqrt(static_cast<double>(numVertices) / cornersPerQuad)));
+    numMeshes = std::max(1u, std::min(numMeshes, gridSize));
+
+    aiScene *scene = new aiScene();
+    scene->mNumMaterials = 1;
+    scene->mMaterials = new aiMaterial *[1];
+    scene->mMaterials[0] = new aiMaterial();
+    const aiString materialName("surface");
+    scene->mMaterials[0]->AddProperty(&materialName, AI_MATKEY_NAME);
+    const aiColor3D diffuse(0.8f, 0.8f, 0.8f);
+    scene->mMaterials[0]->AddProperty(&diffuse, 1, AI_MATKEY_COLOR_DIFFUSE);
+
+    scene->mNumMeshes = numMeshes;
+    scene->mMeshes = new aiMesh *[numMeshes];
+    scene->mRootNode = new aiNode("root");
+    scene->mRootNode->mNumMeshes = numMeshes;
+    scene->mRootNode->mMeshes = new unsigned int[numMeshes];
+
+    // split the rows of the grid evenly across the meshes
+    unsigned int row = 0;
+    for (unsigned int i = 0; i < numMeshes; ++i) {
+        const unsigned int numRows = gridSize / numMeshes + (i < gridSize % numMeshes ? 1 : 0);
+        scene->mMeshes[i] = CreateStrip(row, numRows, gridSize, triangles);
+        scene->mRootNode->mMeshes[i] = i;
+        row += numRows;
+    }
+    return scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int CountVertices(const aiScene *scene) {
+    unsigned int count = 0;
+    for (unsigned int i = 0; nullptr != scene && i < scene->mNumMeshes; ++i) {
+        count += scene->mMeshes[i]->mNumVertices;
+    }
+    return count;
+}
+
+} // namespace Benchmark
+} // namespace Assimp
@@ -0,0 +1,75 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  SyntheticScene.h
+ *  @brief Generates test scenes of a configurable size for the benchmarks.
+ */
+#pragma once
+#ifndef AI_BENCHMARK_SYNTHETICSCENE_H_INC
+#define AI_BENCHMARK_SYNTHETICSCENE_H_INC
+
+struct aiScene;
+
+namespace Assimp {
+namespace Benchmark {
+
+// ------------------------------------------------------------------------------------------------
+/** @brief Creates a scene made of a wavy surface split into several meshes.
+ *
+ *  Every face owns its vertices, which is the layout importers hand over to
+ *  the post-processing steps, so steps like JoinIdenticalVertices have real
+ *  work to do. Each mesh has positions, normals and one UV channel, all
+ *  meshes share a single material.
+ *  @param numVertices  Approximate total number of vertices.
+ *  @param numMeshes    Number of meshes the surface is split into.
+ *  @param triangles    true to emit triangles, false to emit quads.
+ *  @return The new scene, to be released with delete. */
+aiScene *CreateSyntheticScene(unsigned int numVertices, unsigned int numMeshes, bool triangles);
+
+// ------------------------------------------------------------------------------------------------
+/** @brief Returns the number of vertices of all meshes of a scene. */
+unsigned int CountVertices(const aiScene *scene);
+
+} // namespace Benchmark
+} // namespace Assimp
+
+#endif // AI_BENCHMARK_SYNTHETICSCENE_H_INC
@@ -0,0 +1,219 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "Common/SpatialIndex.h"
+#include "Common/ThreadPool.h"
+#include <assimp/Importer.hpp>
+#include <assimp/SpatialHash.h>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+
+using namespace Assimp;
+
+class utSpatialHash : public ::testing::Test {
+public:
+    // Brute force reference for FindPositions
+    static std::vector<unsigned int> FindInRadius(const std::vector<aiVector3D> &positions, const aiVector3D &p, ai_real radius) {
+        std::vector<unsigned int> result;
+        for (unsigned int i = 0; i < positions.size(); ++i) {
+            if ((positions[i] - p).SquareLength() < radius * radius) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    static std::vector<unsigned int> Sorted(std::vector<unsigned int> indices) {
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    }
+};
+
+TEST_F(utSpatialHash, findIdenticalsTest) {
+    std::vector<aiVector3D> positions;
+    for (unsigned int i = 0; i < 100; ++i) {
+        positions.emplace_back(ai_real(i % 7), ai_real(i % 5), ai_real(i % 3));
+    }
+    SpatialHash hash;
+    hash.Fill(positions.data(), static_cast<unsigned int>(positions.size()), sizeof(aiVector3D));
+
+    std::vector<unsigned int> indices;
+    hash.FindIdenticalPositions(positions[0], indices);
+    // i % 105 == 0 is the only other vertex at the origin, and there is none below 100
+    EXPECT_EQ(1u, indices.size());
+
+    positions.push_back(positions[42]);
+    hash.Fill(positions.data(), static_cast<unsigned int>(positions.size()), sizeof(aiVector3D));
+    hash.FindIdenticalPositions(positions[42], indices);
+    EXPECT_EQ((std::vector<unsigned int>{ 42, 100 }), Sorted(indices));
+}
+
+TEST_F(utSpatialHash, findPositionsMatchesBruteForceTest) {
+    std::vector<aiVector3D> positions;
+    for (unsigned int i = 0; i < 2000; ++i) {
+        positions.emplace_back(ai_real((i * 37) % 101) * 0.1f, ai_real((i * 17) % 89) * 0.1f, ai_real((i * 13) % 53) * 0.1f);
+    }
+    SpatialHash hash(positions.data(), static_cast<unsigned int>(positions.size()), sizeof(aiVector3D));
+
+    std::vector<unsigned int> indices;
+    for (const ai_real radius : { ai_real(0.05), ai_real(0.5), ai_real(3.0), ai_real(100.0) }) {
+        for (unsigned int i = 0; i < positions.size(); i += 97) {
+            hash.FindPositions(positions[i], radius, indices);
+            EXPECT_EQ(FindInRadius(positions, positions[i], radius), Sorted(indices));
+        }
+    }
+
+    // far outside of the grid
+    hash.FindPositions(aiVector3D(-100, 0, 0), 1.0f, indices);
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST_F(utSpatialHash, planarPositionsTest) {
+    // All positions on one plane, the case SpatialSort degrades on
+    constexpr unsigned int verticesPerAxis = 100;
+    constexpr ai_real step = 0.01f;
+    std::vector<aiVector3D> positions;
+    for (unsigned int x = 0; x < verticesPerAxis; ++x) {
+        for (unsigned int y = 0; y < verticesPerAxis; ++y) {
+            positions.emplace_back(5000.0f + x * step, 5000.0f + y * step, 0.0f);
+        }
+    }
+    SpatialHash hash(positions.data(), static_cast<unsigned int>(positions.size()), sizeof(aiVector3D));
+
+    // Enough to find a point and its 4 immediate neighbors, but not any other point.
+    std::vector<unsigned int> indices;
+    for (unsigned int x = 1; x < verticesPerAxis - 1; ++x) {
+        for (unsigned int y = 1; y < verticesPerAxis - 1; ++y) {
+            hash.FindPositions(positions[x * verticesPerAxis + y], 1.1f * step, indices);
+            ASSERT_EQ(5u, indices.size());
+        }
+    }
+}
+
+TEST_F(utSpatialHash, generateMappingTableTest) {
+    std::vector<aiVector3D> positions;
+    for (unsigned int i = 0; i < 300; ++i) {
+        // every position three times
+        positions.emplace_back(ai_real(i % 100), ai_real(i % 100) * 2.0f, 1.0f);
+    }
+    SpatialHash hash(positions.data(), static_cast<unsigned int>(positions.size()), sizeof(aiVector3D));
+
+    std::vector<unsigned int> table;
+    EXPECT_EQ(100u, hash.GenerateMappingTable(table, 0.01f));
+    ASSERT_EQ(300u, table.size());
+    for (unsigned int i = 0; i < 300; ++i) {
+        EXPECT_EQ(table[i % 100], table[i]);
+        EXPECT_LT(table[i], 100u);
+    }
+}
+
+TEST_F(utSpatialHash, appendTest) {
+    const aiVector3D first[] = { aiVector3D(0, 0, 0), aiVector3D(1, 0, 0) };
+    const aiVector3D second[] = { aiVector3D(0, 0, 0), aiVector3D(0, 1, 0) };
+    SpatialHash hash;
+    hash.Append(first, 2, sizeof(aiVector3D), false);
+    hash.Append(second, 2, sizeof(aiVector3D), false);
+    hash.Finalize();
+
+    std::vector<unsigned int> indices;
+    hash.FindPositions(aiVector3D(0, 0, 0), 0.1f, indices);
+    EXPECT_EQ((std::vector<unsigned int>{ 0, 2 }), Sorted(indices));
+}
+
+TEST_F(utSpatialHash, parallelFinalizeTest) {
+    std::vector<aiVector3D> positions;
+    for (unsigned int i = 0; i < 200000; ++i) {
+        positions.emplace_back(ai_real(i % 499), ai_real((i / 499) % 401), ai_real(i % 3));
+    }
+
+    SpatialHash serial(positions.data(), static_cast<unsigned int>(positions.size()), sizeof(aiVector3D));
+    ThreadPool pool(3);
+    ThreadedSpatialHash parallel(&pool);
+    parallel.Fill(positions.data(), static_cast<unsigned int>(positions.size()), sizeof(aiVector3D));
+    EXPECT_EQ(serial.GetCellSize(), parallel.GetCellSize());
+
+    std::vector<unsigned int> a, b;
+    for (unsigned int i = 0; i < positions.size(); i += 5003) {
+        serial.FindPositions(positions[i], 1.5f, a);
+        parallel.FindPositions(positions[i], 1.5f, b);
+        EXPECT_EQ(a, b);
+        EXPECT_EQ(FindInRadius(positions, positions[i], 1.5f), Sorted(b));
+    }
+}
+
+TEST_F(utSpatialHash, nonFinitePositionsTest) {
+    const ai_real inf = std::numeric_limits<ai_real>::infinity();
+    const aiVector3D positions[] = { aiVector3D(0, 0, 0), aiVector3D(inf, 0, 0), aiVector3D(1, 1, 1) };
+    SpatialHash hash(positions, 3, sizeof(aiVector3D));
+
+    std::vector<unsigned int> indices;
+    hash.FindPositions(aiVector3D(1, 1, 1), 0.1f, indices);
+    EXPECT_EQ((std::vector<unsigned int>{ 2 }), indices);
+}
+
+TEST_F(utSpatialHash, spatialIndexPropertyTest) {
+    // both spatial indices must smooth the same vertices
+    const unsigned int flags = aiProcess_ForceGenNormals | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace;
+    Importer sortImporter, hashImporter;
+    hashImporter.SetPropertyBool(AI_CONFIG_PP_USE_SPATIAL_HASH, true);
+    const aiScene *sortScene = sortImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    const aiScene *hashScene = hashImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, sortScene);
+    ASSERT_NE(nullptr, hashScene);
+    ASSERT_EQ(sortScene->mNumMeshes, hashScene->mNumMeshes);
+
+    for (unsigned int m = 0; m < sortScene->mNumMeshes; ++m) {
+        const aiMesh *a = sortScene->mMeshes[m];
+        const aiMesh *b = hashScene->mMeshes[m];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        for (unsigned int i = 0; i < a->mNumVertices; ++i) {
+            // the close vertices may be summed up in a different order
+            EXPECT_TRUE(a->mNormals[i].Equal(b->mNormals[i], 1e-4f));
+            if (a->HasTangentsAndBitangents()) {
+                EXPECT_TRUE(a->mTangents[i].Equal(b->mTangents[i], 1e-4f));
+            }
+        }
+    }
+}
@@ -0,0 +1,112 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include "Common/ThreadPool.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace Assimp;
+
+class utThreadPool : public ::testing::Test {
+    // empty
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utThreadPool, enqueueReturnsResultTest) {
+    ThreadPool pool(2);
+    std::future<int> result = pool.Enqueue([]() { return 42; });
+    EXPECT_EQ(42, result.get());
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utThreadPool, enqueueWithoutWorkersRunsInlineTest) {
+    ThreadPool pool(0);
+    EXPECT_EQ(0u, pool.GetNumWorkers());
+    bool called = false;
+    pool.Enqueue([&called]() { called = true; });
+    EXPECT_TRUE(called);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utThreadPool, parallelForVisitsEachIndexOnceTest) {
+    ThreadPool pool(3);
+    std::vector<int> visited(1000, 0);
+    pool.ParallelFor(visited.size(), [&visited](size_t i) {
+        ++visited[i];
+    });
+    for (int count : visited) {
+        EXPECT_EQ(1, count);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utThreadPool, parallelForRethrowsLowestIndexTest) {
+    ThreadPool pool(3);
+    std::atomic<size_t> calls(0);
+    try {
+        pool.ParallelFor(64, [&calls](size_t i) {
+            ++calls;
+            if (i == 10 || i == 20) {
+                throw std::runtime_error(std::to_string(i));
+            }
+        });
+        FAIL() << "expected an exception";
+    } catch (const std::runtime_error &e) {
+        EXPECT_STREQ("10", e.what());
+    }
+    EXPECT_EQ(64u, calls.load());
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utThreadPool, nestedParallelForTest) {
+    ThreadPool pool(2);
+    std::atomic<int> sum(0);
+    pool.ParallelFor(8, [&pool, &sum](size_t) {
+        pool.ParallelFor(8, [&sum](size_t j) {
+            sum += static_cast<int>(j);
+        });
+    });
+    EXPECT_EQ(8 * 28, sum.load());
+}
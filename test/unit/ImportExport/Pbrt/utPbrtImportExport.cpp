@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/Importer.hpp>
 #include <assimp/Exporter.hpp>
+#include <assimp/cexport.h>
 
 using namespace Assimp;
 
@@ -67,4 +68,31 @@ TEST_F(utPbrtImportExport, exportTest_Success) {
     EXPECT_TRUE(exporterTest());
 }
 
+TEST_F(utPbrtImportExport, exportToBlobTest) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    ::Assimp::Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "pbrt");
+    ASSERT_NE(nullptr, blob);
+    EXPECT_LT(0u, blob->size);
+}
+
+TEST_F(utPbrtImportExport, exportWithoutMetaDataTest) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    aiScene *copy = nullptr;
+    aiCopyScene(scene, &copy);
+    ASSERT_NE(nullptr, copy);
+    delete copy->mMetaData;
+    copy->mMetaData = nullptr;
+
+    ::Assimp::Exporter exporter;
+    EXPECT_EQ(AI_SUCCESS, exporter.Export(copy, "pbrt", ASSIMP_TEST_MODELS_DIR "/OBJ/spider_out.pbrt"));
+    aiFreeScene(copy);
+}
+
 #endif // ASSIMP_BUILD_NO_EXPORT
@@ -44,6 +44,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Common/Importer.h"
 #include "TestIOSystem.h"
 
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/scene.h>
+
 using namespace ::Assimp;
 
 class BatchLoaderTest : public ::testing::Test {
@@ -79,3 +82,33 @@ TEST_F( BatchLoaderTest, validateAccessTest ) {
     BatchLoader loader2( m_io, true );
     EXPECT_TRUE( loader2.getValidation() );
 }
+
+TEST_F( BatchLoaderTest, numThreadsAccessTest ) {
+    BatchLoader loader( m_io );
+    EXPECT_EQ( 1u, loader.getNumThreads() );
+    loader.setNumThreads( 4 );
+    EXPECT_EQ( 4u, loader.getNumThreads() );
+    loader.setNumThreads( 0 );
+    EXPECT_LE( 1u, loader.getNumThreads() );
+}
+
+TEST_F( BatchLoaderTest, concurrentLoadTest ) {
+    DefaultIOSystem io;
+    BatchLoader loader( &io );
+    loader.setNumThreads( 3 );
+
+    const unsigned int box = loader.AddLoadRequest( ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj" );
+    const unsigned int spider = loader.AddLoadRequest( ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj" );
+    const unsigned int missing = loader.AddLoadRequest( ASSIMP_TEST_MODELS_DIR "/OBJ/does_not_exist.obj" );
+    const unsigned int stl = loader.AddLoadRequest( ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl" );
+    loader.LoadAll();
+
+    std::unique_ptr<aiScene> boxScene( loader.GetImport( box ) );
+    std::unique_ptr<aiScene> spiderScene( loader.GetImport( spider ) );
+    std::unique_ptr<aiScene> missingScene( loader.GetImport( missing ) );
+    std::unique_ptr<aiScene> stlScene( loader.GetImport( stl ) );
+    EXPECT_NE( nullptr, boxScene );
+    EXPECT_NE( nullptr, spiderScene );
+    EXPECT_EQ( nullptr, missingScene );
+    EXPECT_NE( nullptr, stlScene );
+}
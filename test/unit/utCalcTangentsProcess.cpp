@@ -0,0 +1,391 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "Common/ThreadPool.h"
+#include "PostProcessing/CalcTangentsProcess.h"
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/mesh.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+    // A grid of cells on a cylinder around the y axis, or flat in the xy plane. Each face has
+    // its own vertices, every cell is a quad or two triangles.
+    aiMesh *CreateGrid(unsigned int size, bool curved, bool quads, bool mirrorU) {
+        aiMesh *mesh = new aiMesh();
+        mesh->mPrimitiveTypes = quads ? aiPrimitiveType_POLYGON : aiPrimitiveType_TRIANGLE;
+        mesh->mNumFaces = size * size * (quads ? 1 : 2);
+        mesh->mFaces = new aiFace[mesh->mNumFaces];
+        mesh->mNumVertices = size * size * (quads ? 4 : 6);
+        mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+        mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+        mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+        mesh->mNumUVComponents[0] = 2;
+
+        static const unsigned int quadCorners[4][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+        static const unsigned int triCorners[6] = { 0, 1, 2, 0, 2, 3 };
+        unsigned int vertex = 0, face = 0;
+        for (unsigned int y = 0; y < size; ++y) {
+            for (unsigned int x = 0; x < size; ++x) {
+                const unsigned int numFaces = quads ? 1 : 2, numIndices = quads ? 4 : 3;
+                for (unsigned int f = 0; f < numFaces; ++f, ++face) {
+                    aiFace &out = mesh->mFaces[face];
+                    out.mIndices = new unsigned int[out.mNumIndices = numIndices];
+                    for (unsigned int i = 0; i < numIndices; ++i, ++vertex) {
+                        const unsigned int *c = quadCorners[quads ? i : triCorners[f * 3 + i]];
+                        const float u = float(x + c[0]) / size, v = float(y + c[1]) / size;
+                        if (curved) {
+                            mesh->mVertices[vertex] = aiVector3D(std::sin(u), v, std::cos(u));
+                            mesh->mNormals[vertex] = aiVector3D(std::sin(u), 0.f, std::cos(u));
+                        } else {
+                            mesh->mVertices[vertex] = aiVector3D(u, v, 0.f);
+                            mesh->mNormals[vertex] = aiVector3D(0.f, 0.f, 1.f);
+                        }
+                        mesh->mTextureCoords[0][vertex] = aiVector3D(mirrorU ? 1.f - u : u, v, 0.f);
+                        out.mIndices[i] = vertex;
+                    }
+                }
+            }
+        }
+        return mesh;
+    }
+
+    void ExpectVectorEq(const aiVector3D &expected, const aiVector3D &actual) {
+        EXPECT_FLOAT_EQ(expected.x, actual.x);
+        EXPECT_FLOAT_EQ(expected.y, actual.y);
+        EXPECT_FLOAT_EQ(expected.z, actual.z);
+    }
+
+    void ExpectVectorNear(const aiVector3D &expected, const aiVector3D &actual) {
+        EXPECT_NEAR(expected.x, actual.x, 1e-6f);
+        EXPECT_NEAR(expected.y, actual.y, 1e-6f);
+        EXPECT_NEAR(expected.z, actual.z, 1e-6f);
+    }
+
+    // Two quads side by side in the xy plane, sharing the vertices at x = 1 (and x = 0 if
+    // shifted), with the given texture coordinates for the six vertices
+    aiMesh *CreateStrip(float shift, const aiVector3D (&uv)[6]) {
+        aiMesh *mesh = new aiMesh();
+        mesh->mPrimitiveTypes = aiPrimitiveType_POLYGON;
+        mesh->mNumVertices = 6;
+        mesh->mVertices = new aiVector3D[6];
+        mesh->mNormals = new aiVector3D[6];
+        mesh->mTextureCoords[0] = new aiVector3D[6];
+        mesh->mNumUVComponents[0] = 2;
+        for (unsigned int i = 0; i < 6; ++i) {
+            mesh->mVertices[i] = aiVector3D(float(i % 3) - shift, float(i / 3), 0.f);
+            mesh->mNormals[i] = aiVector3D(0.f, 0.f, 1.f);
+            mesh->mTextureCoords[0][i] = uv[i];
+        }
+        static const unsigned int indices[2][4] = { { 0, 1, 4, 3 }, { 1, 2, 5, 4 } };
+        mesh->mNumFaces = 2;
+        mesh->mFaces = new aiFace[2];
+        for (unsigned int f = 0; f < 2; ++f) {
+            mesh->mFaces[f].mIndices = new unsigned int[mesh->mFaces[f].mNumIndices = 4];
+            std::copy(indices[f], indices[f] + 4, mesh->mFaces[f].mIndices);
+        }
+        return mesh;
+    }
+} // namespace
+
+class utCalcTangentsProcess : public ::testing::Test {
+public:
+    utCalcTangentsProcess() :
+            Test(), mProcess(nullptr), mScene(nullptr) {
+        // empty
+    }
+
+    void SetUp() override {
+        mProcess = new CalcTangentsProcess;
+        mProcess->SetMikkTSpace(true);
+        mScene = new aiScene();
+        mScene->mNumMeshes = 1;
+        mScene->mMeshes = new aiMesh *[1];
+        mScene->mMeshes[0] = nullptr;
+    }
+
+    void TearDown() override {
+        delete mProcess;
+        delete mScene;
+    }
+
+    // Runs the step on the mesh, the scene takes it over
+    aiMesh *Process(aiMesh *mesh) {
+        delete mScene->mMeshes[0];
+        mScene->mMeshes[0] = mesh;
+        static_cast<BaseProcess *>(mProcess)->Execute(mScene);
+        return mesh;
+    }
+
+protected:
+    CalcTangentsProcess *mProcess;
+    aiScene *mScene;
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utCalcTangentsProcess, mikkTSpacePlaneTest) {
+    const aiMesh *mesh = Process(CreateGrid(4, false, false, false));
+    ASSERT_TRUE(mesh->HasTangentsAndBitangents());
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        ExpectVectorEq(aiVector3D(1.f, 0.f, 0.f), mesh->mTangents[i]);
+        ExpectVectorEq(aiVector3D(0.f, 1.f, 0.f), mesh->mBitangents[i]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utCalcTangentsProcess, mikkTSpaceMirroredTest) {
+    // the tangent follows u, the handedness keeps the bitangent along v
+    const aiMesh *mesh = Process(CreateGrid(4, false, true, true));
+    ASSERT_TRUE(mesh->HasTangentsAndBitangents());
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        ExpectVectorEq(aiVector3D(-1.f, 0.f, 0.f), mesh->mTangents[i]);
+        ExpectVectorEq(aiVector3D(0.f, 1.f, 0.f), mesh->mBitangents[i]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utCalcTangentsProcess, mikkTSpaceWeldTest) {
+    for (bool quads : { false, true }) {
+        const aiMesh *mesh = Process(CreateGrid(8, true, quads, false));
+        ASSERT_TRUE(mesh->HasTangentsAndBitangents());
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            const aiVector3D &n = mesh->mNormals[i], &t = mesh->mTangents[i];
+            EXPECT_NEAR(1.f, t.Length(), 1e-5f);
+            EXPECT_NEAR(0.f, t * n, 1e-5f);
+            EXPECT_LT(0.f, mesh->mBitangents[i].y);
+
+            // the corners of a welded vertex share their tangent space exactly
+            for (unsigned int j = 0; j < i; ++j) {
+                if (mesh->mVertices[j] == mesh->mVertices[i] && mesh->mNormals[j] == n &&
+                        mesh->mTextureCoords[0][j] == mesh->mTextureCoords[0][i]) {
+                    EXPECT_EQ(t, mesh->mTangents[j]);
+                    EXPECT_EQ(mesh->mBitangents[i], mesh->mBitangents[j]);
+                }
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utCalcTangentsProcess, mikkTSpaceParallelTest) {
+    // enough triangles and vertex groups to be split over the workers
+    const aiMesh *mesh = Process(CreateGrid(64, true, false, false));
+    ASSERT_TRUE(mesh->HasTangentsAndBitangents());
+    std::vector<aiVector3D> tangents(mesh->mTangents, mesh->mTangents + mesh->mNumVertices);
+    std::vector<aiVector3D> bitangents(mesh->mBitangents, mesh->mBitangents + mesh->mNumVertices);
+
+    ThreadPool pool(4);
+    mProcess->SetThreadPool(&pool);
+    mesh = Process(CreateGrid(64, true, false, false));
+    mProcess->SetThreadPool(nullptr);
+
+    ASSERT_TRUE(mesh->HasTangentsAndBitangents());
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        EXPECT_EQ(tangents[i], mesh->mTangents[i]);
+        EXPECT_EQ(bitangents[i], mesh->mBitangents[i]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utCalcTangentsProcess, mikkTSpaceImportTest) {
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_PP_CT_MIKKTSPACE, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+            aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace |
+                    aiProcess_JoinIdenticalVertices | aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    unsigned int numChecked = 0;
+    for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
+        const aiMesh *mesh = scene->mMeshes[m];
+        ASSERT_TRUE(mesh->HasTangentsAndBitangents());
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            const aiVector3D &n = mesh->mNormals[i], &t = mesh->mTangents[i], &b = mesh->mBitangents[i];
+            // like MikkTSpace, vertices without a usable texture mapping keep the default tangent
+            if (t == aiVector3D(1.f, 0.f, 0.f)) {
+                continue;
+            }
+            ++numChecked;
+            EXPECT_NEAR(1.f, t.Length(), 1e-4f);
+            EXPECT_NEAR(1.f, b.Length(), 1e-4f);
+            EXPECT_NEAR(0.f, t * n, 1e-4f);
+            EXPECT_NEAR(0.f, b * n, 1e-4f);
+        }
+    }
+    EXPECT_LT(0u, numChecked);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utCalcTangentsProcess, mikkTSpaceGoldenQuadTest) {
+    // The second quad is mapped with a shear, so its tangent is (1,-1,0)/sqrt(2). mikktspace.c
+    // weights the faces at the shared vertices by their corner angles, pi/2 on each side, which
+    // puts the tangent there on the bisector, at -22.5 degrees.
+    const aiVector3D uv[6] = { { 0.f, 0.f, 0.f }, { 1.f, 0.f, 0.f }, { 2.f, 1.f, 0.f },
+        { 0.f, 1.f, 0.f }, { 1.f, 1.f, 0.f }, { 2.f, 2.f, 0.f } };
+    const aiMesh *mesh = Process(CreateStrip(0.f, uv));
+    ASSERT_TRUE(mesh->HasTangentsAndBitangents());
+    ASSERT_EQ(6u, mesh->mNumVertices);
+
+    const float c = 0.92387953f, s = 0.38268343f, h = 0.70710678f;
+    const aiVector3D tangents[3] = { { 1.f, 0.f, 0.f }, { c, -s, 0.f }, { h, -h, 0.f } };
+    const aiVector3D bitangents[3] = { { 0.f, 1.f, 0.f }, { s, c, 0.f }, { h, h, 0.f } };
+    for (unsigned int i = 0; i < 6; ++i) {
+        ExpectVectorNear(tangents[i % 3], mesh->mTangents[i]);
+        ExpectVectorNear(bitangents[i % 3], mesh->mBitangents[i]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utCalcTangentsProcess, mikkTSpaceGoldenMirrorSeamTest) {
+    // u = |x|, the vertices on the seam get one tangent space from each side
+    const aiVector3D uv[6] = { { 1.f, 0.f, 0.f }, { 0.f, 0.f, 0.f }, { 1.f, 0.f, 0.f },
+        { 1.f, 1.f, 0.f }, { 0.f, 1.f, 0.f }, { 1.f, 1.f, 0.f } };
+    aiMesh *mesh = CreateStrip(1.f, uv);
+    mesh->mColors[0] = new aiColor4D[6];
+    mesh->mNumBones = 1;
+    mesh->mBones = new aiBone *[1];
+    mesh->mBones[0] = new aiBone();
+    mesh->mBones[0]->mNumWeights = 6;
+    mesh->mBones[0]->mWeights = new aiVertexWeight[6];
+    mesh->mNumAnimMeshes = 1;
+    mesh->mAnimMeshes = new aiAnimMesh *[1];
+    mesh->mAnimMeshes[0] = new aiAnimMesh();
+    mesh->mAnimMeshes[0]->mNumVertices = 6;
+    mesh->mAnimMeshes[0]->mVertices = new aiVector3D[6];
+    for (unsigned int i = 0; i < 6; ++i) {
+        mesh->mColors[0][i] = aiColor4D(float(i), 0.f, 0.f, 1.f);
+        mesh->mBones[0]->mWeights[i] = aiVertexWeight(i, float(i) / 8.f);
+        mesh->mAnimMeshes[0]->mVertices[i] = mesh->mVertices[i] + aiVector3D(0.f, 0.f, 1.f);
+    }
+
+    Process(mesh);
+    ASSERT_TRUE(mesh->HasTangentsAndBitangents());
+    ASSERT_EQ(8u, mesh->mNumVertices);
+    ASSERT_EQ(8u, mesh->mAnimMeshes[0]->mNumVertices);
+    ASSERT_EQ(8u, mesh->mBones[0]->mNumWeights);
+
+    static const unsigned int original[2][4] = { { 0, 1, 4, 3 }, { 1, 2, 5, 4 } };
+    std::vector<float> weights(mesh->mNumVertices, -1.f);
+    for (unsigned int w = 0; w < mesh->mBones[0]->mNumWeights; ++w) {
+        weights[mesh->mBones[0]->mWeights[w].mVertexId] = mesh->mBones[0]->mWeights[w].mWeight;
+    }
+    for (unsigned int f = 0; f < 2; ++f) {
+        const aiVector3D tangent(f == 0 ? -1.f : 1.f, 0.f, 0.f);
+        for (unsigned int i = 0; i < 4; ++i) {
+            const unsigned int v = mesh->mFaces[f].mIndices[i], o = original[f][i];
+            ExpectVectorEq(tangent, mesh->mTangents[v]);
+            ExpectVectorEq(aiVector3D(0.f, 1.f, 0.f), mesh->mBitangents[v]);
+
+            // a copy carries all the data of its original
+            EXPECT_EQ(aiVector3D(float(o % 3) - 1.f, float(o / 3), 0.f), mesh->mVertices[v]);
+            EXPECT_EQ(uv[o], mesh->mTextureCoords[0][v]);
+            EXPECT_EQ(aiColor4D(float(o), 0.f, 0.f, 1.f), mesh->mColors[0][v]);
+            EXPECT_EQ(float(o) / 8.f, weights[v]);
+            EXPECT_EQ(mesh->mVertices[v] + aiVector3D(0.f, 0.f, 1.f), mesh->mAnimMeshes[0]->mVertices[v]);
+        }
+    }
+    EXPECT_NE(mesh->mFaces[0].mIndices[1], mesh->mFaces[1].mIndices[0]);
+    EXPECT_NE(mesh->mFaces[0].mIndices[2], mesh->mFaces[1].mIndices[3]);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utCalcTangentsProcess, mikkTSpaceGoldenDegenerateTest) {
+    // A strip of four quads from x = -2 to 2 mapped with u = |x|, so the vertices at x = 0 are
+    // on a mirrored seam. The last quad repeats its corner at (2,1), which leaves it one good
+    // triangle, and a triangle with two corners at (1,0) has no area at all.
+    //
+    // The expected values were worked out by hand from the rules of mikktspace.c, they were not
+    // produced by a run of the reference implementation: the tangent is dP/du on each side of the
+    // seam, with the bitangent kept along v by the sign. The missing corner of the quad copies
+    // the corner at the same position, and each corner of the flat triangle takes the tangent
+    // space of the first good triangle using its welded vertex, which for (0,0) is the second
+    // quad, left of the seam.
+    aiMesh *mesh = new aiMesh();
+    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE | aiPrimitiveType_POLYGON;
+    mesh->mNumVertices = 12;
+    mesh->mVertices = new aiVector3D[12];
+    mesh->mNormals = new aiVector3D[12];
+    mesh->mTextureCoords[0] = new aiVector3D[12];
+    mesh->mNumUVComponents[0] = 2;
+    for (unsigned int i = 0; i < 10; ++i) {
+        mesh->mVertices[i] = aiVector3D(float(i % 5) - 2.f, float(i / 5), 0.f);
+    }
+    mesh->mVertices[10] = mesh->mVertices[9];
+    mesh->mVertices[11] = mesh->mVertices[3];
+    for (unsigned int i = 0; i < 12; ++i) {
+        mesh->mNormals[i] = aiVector3D(0.f, 0.f, 1.f);
+        mesh->mTextureCoords[0][i] = aiVector3D(std::fabs(mesh->mVertices[i].x), mesh->mVertices[i].y, 0.f);
+    }
+    static const unsigned int indices[5][4] = { { 0, 1, 6, 5 }, { 1, 2, 7, 6 }, { 2, 3, 8, 7 }, { 3, 4, 9, 10 }, { 2, 3, 11 } };
+    mesh->mNumFaces = 5;
+    mesh->mFaces = new aiFace[5];
+    for (unsigned int f = 0; f < 5; ++f) {
+        mesh->mFaces[f].mIndices = new unsigned int[mesh->mFaces[f].mNumIndices = f < 4 ? 4 : 3];
+        std::copy(indices[f], indices[f] + mesh->mFaces[f].mNumIndices, mesh->mFaces[f].mIndices);
+    }
+
+    Process(mesh);
+    ASSERT_TRUE(mesh->HasTangentsAndBitangents());
+    // only the two seam vertices are split
+    ASSERT_EQ(14u, mesh->mNumVertices);
+
+    for (unsigned int f = 0; f < 5; ++f) {
+        const aiFace &face = mesh->mFaces[f];
+        for (unsigned int i = 0; i < face.mNumIndices; ++i) {
+            const unsigned int v = face.mIndices[i];
+            const bool left = f < 2 || (f == 4 && i == 0);
+            ExpectVectorEq(aiVector3D(left ? -1.f : 1.f, 0.f, 0.f), mesh->mTangents[v]);
+            ExpectVectorEq(aiVector3D(0.f, 1.f, 0.f), mesh->mBitangents[v]);
+            EXPECT_EQ(mesh->mVertices[indices[f][i]], mesh->mVertices[v]);
+        }
+    }
+    EXPECT_EQ(mesh->mFaces[1].mIndices[1], mesh->mFaces[4].mIndices[0]);
+    EXPECT_NE(mesh->mFaces[2].mIndices[0], mesh->mFaces[4].mIndices[0]);
+    EXPECT_EQ(mesh->mFaces[2].mIndices[1], mesh->mFaces[4].mIndices[1]);
+}
@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AbstractImportExportBase.h"
 #include "UnitTestPCH.h"
+#include "Common/simd.h"
 
 #include <assimp/commonMetaData.h>
 #include <assimp/material.h>
@@ -461,3 +462,199 @@ TEST_F(utFBXImporterExporter, importSkeletonTest) {
     ASSERT_NE(nullptr, scene);
     ASSERT_TRUE(scene->mRootNode);
 }
+
+static void ExpectEqualMeshes(const aiScene *expected, const aiScene *scene) {
+    ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        const aiMesh *expectedMesh = expected->mMeshes[i];
+        const aiMesh *mesh = scene->mMeshes[i];
+        EXPECT_STREQ(expectedMesh->mName.C_Str(), mesh->mName.C_Str());
+        EXPECT_EQ(expectedMesh->mMaterialIndex, mesh->mMaterialIndex);
+        ASSERT_EQ(expectedMesh->mNumVertices, mesh->mNumVertices);
+        ASSERT_EQ(expectedMesh->mNumFaces, mesh->mNumFaces);
+        ASSERT_EQ(expectedMesh->HasNormals(), mesh->HasNormals());
+        ASSERT_EQ(expectedMesh->HasTextureCoords(0), mesh->HasTextureCoords(0));
+        ASSERT_EQ(expectedMesh->mNumBones, mesh->mNumBones);
+        for (unsigned int v = 0; v < mesh->mNumVertices; ++v) {
+            EXPECT_EQ(expectedMesh->mVertices[v], mesh->mVertices[v]);
+            if (mesh->HasNormals()) {
+                EXPECT_EQ(expectedMesh->mNormals[v], mesh->mNormals[v]);
+            }
+            if (mesh->HasTextureCoords(0)) {
+                EXPECT_EQ(expectedMesh->mTextureCoords[0][v], mesh->mTextureCoords[0][v]);
+            }
+        }
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            ASSERT_EQ(expectedMesh->mFaces[f].mNumIndices, mesh->mFaces[f].mNumIndices);
+            for (unsigned int j = 0; j < mesh->mFaces[f].mNumIndices; ++j) {
+                EXPECT_EQ(expectedMesh->mFaces[f].mIndices[j], mesh->mFaces[f].mIndices[j]);
+            }
+        }
+        for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+            EXPECT_STREQ(expectedMesh->mBones[b]->mName.C_Str(), mesh->mBones[b]->mName.C_Str());
+            ASSERT_EQ(expectedMesh->mBones[b]->mNumWeights, mesh->mBones[b]->mNumWeights);
+            for (unsigned int w = 0; w < mesh->mBones[b]->mNumWeights; ++w) {
+                EXPECT_EQ(expectedMesh->mBones[b]->mWeights[w].mVertexId, mesh->mBones[b]->mWeights[w].mVertexId);
+                EXPECT_EQ(expectedMesh->mBones[b]->mWeights[w].mWeight, mesh->mBones[b]->mWeights[w].mWeight);
+            }
+        }
+    }
+}
+
+TEST_F(utFBXImporterExporter, importBinaryWithThreadsTest) {
+    static const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx",
+        ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx",
+        ASSIMP_TEST_MODELS_DIR "/FBX/boxWithCompressedCTypeArray.FBX"
+    };
+    for (const char *file : files) {
+        Assimp::Importer serialImporter;
+        const aiScene *expected = serialImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, expected);
+
+        Assimp::Importer parallelImporter;
+        parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 4);
+        const aiScene *scene = parallelImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scene);
+        ExpectEqualMeshes(expected, scene);
+    }
+}
+
+TEST_F(utFBXImporterExporter, convertMeshesWithThreadsTest) {
+    static const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/FBX/cubes_with_names.fbx",
+        ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx",
+        ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx"
+    };
+    for (const char *file : files) {
+        for (bool useSkeleton : { false, true }) {
+            Assimp::Importer serialImporter;
+            serialImporter.SetPropertyBool(AI_CONFIG_FBX_USE_SKELETON_BONE_CONTAINER, useSkeleton);
+            const aiScene *expected = serialImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+            ASSERT_NE(nullptr, expected);
+
+            Assimp::Importer parallelImporter;
+            parallelImporter.SetPropertyBool(AI_CONFIG_FBX_USE_SKELETON_BONE_CONTAINER, useSkeleton);
+            parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 4);
+            const aiScene *scene = parallelImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+            ASSERT_NE(nullptr, scene);
+            EXPECT_EQ(expected->mNumMaterials, scene->mNumMaterials);
+            EXPECT_EQ(expected->mNumSkeletons, scene->mNumSkeletons);
+            ExpectEqualMeshes(expected, scene);
+        }
+    }
+}
+
+TEST_F(utFBXImporterExporter, importSkipsExcludedObjectsTest) {
+    static const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx",
+        ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx"
+    };
+    for (const char *file : files) {
+        Assimp::Importer fullImporter;
+        const aiScene *expected = fullImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, expected);
+        EXPECT_LT(0u, expected->mNumAnimations);
+
+        Assimp::Importer importer;
+        importer.SetPropertyBool(AI_CONFIG_IMPORT_FBX_READ_ANIMATIONS, false);
+        importer.SetPropertyBool(AI_CONFIG_IMPORT_FBX_READ_WEIGHTS, false);
+        importer.SetPropertyBool(AI_CONFIG_IMPORT_FBX_READ_MATERIALS, false);
+        importer.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 4);
+        const aiScene *scene = importer.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scene);
+        EXPECT_EQ(0u, scene->mNumAnimations);
+        ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *mesh = scene->mMeshes[i];
+            EXPECT_EQ(0u, mesh->mNumBones);
+            ASSERT_EQ(expected->mMeshes[i]->mNumVertices, mesh->mNumVertices);
+            EXPECT_EQ(expected->mMeshes[i]->mNumFaces, mesh->mNumFaces);
+            for (unsigned int v = 0; v < mesh->mNumVertices; ++v) {
+                EXPECT_EQ(expected->mMeshes[i]->mVertices[v], mesh->mVertices[v]);
+            }
+        }
+    }
+}
+
+static unsigned int CountNodes(const aiNode *node) {
+    unsigned int count = 1;
+    for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+        count += CountNodes(node->mChildren[i]);
+    }
+    return count;
+}
+
+// Expects the animations of both scenes to match bit for bit
+static void ExpectSameAnimations(const aiScene *expected, const aiScene *scene) {
+    ASSERT_EQ(expected->mNumAnimations, scene->mNumAnimations);
+    for (unsigned int a = 0; a < scene->mNumAnimations; ++a) {
+        const aiAnimation *expectedAnim = expected->mAnimations[a];
+        const aiAnimation *anim = scene->mAnimations[a];
+        EXPECT_EQ(expectedAnim->mDuration, anim->mDuration);
+        ASSERT_EQ(expectedAnim->mNumChannels, anim->mNumChannels);
+        for (unsigned int c = 0; c < anim->mNumChannels; ++c) {
+            const aiNodeAnim *expectedChannel = expectedAnim->mChannels[c];
+            const aiNodeAnim *channel = anim->mChannels[c];
+            EXPECT_STREQ(expectedChannel->mNodeName.C_Str(), channel->mNodeName.C_Str());
+            ASSERT_EQ(expectedChannel->mNumPositionKeys, channel->mNumPositionKeys);
+            ASSERT_EQ(expectedChannel->mNumRotationKeys, channel->mNumRotationKeys);
+            ASSERT_EQ(expectedChannel->mNumScalingKeys, channel->mNumScalingKeys);
+            for (unsigned int k = 0; k < channel->mNumPositionKeys; ++k) {
+                EXPECT_EQ(expectedChannel->mPositionKeys[k].mTime, channel->mPositionKeys[k].mTime);
+                EXPECT_EQ(expectedChannel->mPositionKeys[k].mValue, channel->mPositionKeys[k].mValue);
+            }
+            for (unsigned int k = 0; k < channel->mNumRotationKeys; ++k) {
+                EXPECT_EQ(expectedChannel->mRotationKeys[k].mValue, channel->mRotationKeys[k].mValue);
+            }
+            for (unsigned int k = 0; k < channel->mNumScalingKeys; ++k) {
+                EXPECT_EQ(expectedChannel->mScalingKeys[k].mValue, channel->mScalingKeys[k].mValue);
+            }
+        }
+    }
+}
+
+static const char *AnimatedFiles[] = {
+    ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx",
+    ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx",
+    ASSIMP_TEST_MODELS_DIR "/FBX/cubes_with_mirroring_and_pivot.fbx"
+};
+
+TEST_F(utFBXImporterExporter, convertAnimationsWithThreadsTest) {
+    for (const char *file : AnimatedFiles) {
+        Assimp::Importer serialImporter;
+        const aiScene *expected = serialImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, expected);
+
+        Assimp::Importer parallelImporter;
+        parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 4);
+        const aiScene *scene = parallelImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scene);
+        EXPECT_EQ(CountNodes(expected->mRootNode), CountNodes(scene->mRootNode));
+        ExpectSameAnimations(expected, scene);
+    }
+}
+
+TEST_F(utFBXImporterExporter, convertAnimationsWithVectorKernelsTest) {
+    // the keys are blended in batches, every instruction set must give the scalar results
+    const SIMD::InstructionSet defaultSet = SIMD::GetInstructionSet();
+    for (const char *file : AnimatedFiles) {
+        SIMD::SetInstructionSet(SIMD::InstructionSet::Scalar);
+        Assimp::Importer scalarImporter;
+        const aiScene *expected = scalarImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, expected);
+
+        for (SIMD::InstructionSet set : { SIMD::InstructionSet::SSE2, SIMD::InstructionSet::AVX, SIMD::InstructionSet::NEON }) {
+            if (!SIMD::IsInstructionSetSupported(set)) {
+                continue;
+            }
+            SIMD::SetInstructionSet(set);
+            Assimp::Importer importer;
+            const aiScene *scene = importer.ReadFile(file, aiProcess_ValidateDataStructure);
+            ASSERT_NE(nullptr, scene);
+            SCOPED_TRACE(SIMD::GetInstructionSetName(set));
+            ExpectSameAnimations(expected, scene);
+        }
+    }
+    SIMD::SetInstructionSet(defaultSet);
+}
@@ -0,0 +1,302 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+#include "UTLogStream.h"
+
+#include "PostProcessing/GenLODs.h"
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/SceneCombiner.h>
+#include <assimp/config.h>
+#include <assimp/mesh.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <vector>
+
+using namespace Assimp;
+
+class utGenLODs : public ::testing::Test {
+public:
+    utGenLODs() :
+            Test(), mProcess(nullptr), mMesh(nullptr), mScene(nullptr) {
+        // empty
+    }
+
+    static constexpr unsigned int Size = 32;
+    static constexpr unsigned int SeamColumn = 16;
+
+    void SetUp() override {
+        mProcess = new GenLODsProcess;
+        mScene = new aiScene();
+        mScene->mNumMeshes = 1;
+        mScene->mMeshes = new aiMesh *[1];
+        mScene->mMeshes[0] = mMesh = CreateGrid(false);
+    }
+
+    void TearDown() override {
+        delete mProcess;
+        delete mScene;
+    }
+
+    // A flat grid of quads facing +z. With a seam, the vertices of the seam
+    // column have a twin with different UVs for the quads right of it.
+    static aiMesh *CreateGrid(bool seam) {
+        aiMesh *mesh = new aiMesh();
+        mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mesh->mNumVertices = Size * Size + (seam ? Size : 0);
+        mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+        mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+        mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+        mesh->mNumUVComponents[0] = 2;
+        for (unsigned int y = 0; y < Size; ++y) {
+            for (unsigned int x = 0; x < Size; ++x) {
+                mesh->mVertices[y * Size + x] = aiVector3D((ai_real)x, (ai_real)y, 0);
+                mesh->mTextureCoords[0][y * Size + x] = aiVector3D((ai_real)x / Size, (ai_real)y / Size, 0);
+            }
+            if (seam) {
+                mesh->mVertices[Size * Size + y] = aiVector3D((ai_real)SeamColumn, (ai_real)y, 0);
+                mesh->mTextureCoords[0][Size * Size + y] = aiVector3D(0, (ai_real)y / Size, 0);
+            }
+        }
+        for (unsigned int v = 0; v < mesh->mNumVertices; ++v) {
+            mesh->mNormals[v] = aiVector3D(0, 0, 1);
+        }
+
+        auto index = [seam](unsigned int x, unsigned int y, unsigned int quadX) {
+            return seam && x == SeamColumn && quadX == SeamColumn ? Size * Size + y : y * Size + x;
+        };
+        mesh->mNumFaces = (Size - 1) * (Size - 1) * 2;
+        mesh->mFaces = new aiFace[mesh->mNumFaces];
+        aiFace *face = mesh->mFaces;
+        for (unsigned int y = 0; y + 1 < Size; ++y) {
+            for (unsigned int x = 0; x + 1 < Size; ++x) {
+                const unsigned int corners[4] = { index(x, y, x), index(x + 1, y, x), index(x + 1, y + 1, x), index(x, y + 1, x) };
+                for (unsigned int t = 0; t < 2; ++t, ++face) {
+                    face->mNumIndices = 3;
+                    face->mIndices = new unsigned int[3]{ corners[0], corners[t + 1], corners[t + 2] };
+                }
+            }
+        }
+        return mesh;
+    }
+
+    // Checks the LOD is a flat cover of the whole grid without flipped faces
+    static void CheckCover(const aiMesh *mesh, const aiMeshLOD *lod) {
+        ai_real area = 0;
+        for (unsigned int f = 0; f < lod->mNumFaces; ++f) {
+            const aiFace &face = lod->mFaces[f];
+            ASSERT_EQ(3u, face.mNumIndices);
+            for (unsigned int i = 0; i < 3; ++i) {
+                ASSERT_LT(face.mIndices[i], mesh->mNumVertices);
+            }
+            const aiVector3D &p0 = mesh->mVertices[face.mIndices[0]];
+            const aiVector3D normal = (mesh->mVertices[face.mIndices[1]] - p0) ^ (mesh->mVertices[face.mIndices[2]] - p0);
+            EXPECT_GT(normal.z, 0.f);
+            area += normal.z / 2;
+        }
+        EXPECT_NEAR((Size - 1) * (Size - 1), area, 1e-3f);
+    }
+
+protected:
+    GenLODsProcess *mProcess;
+    aiMesh *mMesh;
+    aiScene *mScene;
+};
+
+TEST_F(utGenLODs, disabledTest) {
+    mProcess->Execute(mScene);
+    EXPECT_FALSE(mMesh->HasLODs());
+}
+
+TEST_F(utGenLODs, gridTest) {
+    mProcess->SetRatios({ 0.25f, 0.5f, 2.f }, 1e-3f);
+    mProcess->Execute(mScene);
+
+    ASSERT_EQ(2u, mMesh->mNumLODs);
+    EXPECT_LE(mMesh->mLODs[0]->mNumFaces, mMesh->mNumFaces / 2);
+    EXPECT_LE(mMesh->mLODs[1]->mNumFaces, mMesh->mNumFaces / 4);
+    for (unsigned int l = 0; l < mMesh->mNumLODs; ++l) {
+        EXPECT_NEAR(0.f, mMesh->mLODs[l]->mError, 1e-3f);
+        CheckCover(mMesh, mMesh->mLODs[l]);
+    }
+}
+
+TEST_F(utGenLODs, ngonEncodedTest) {
+    // triangulated polygons are still triangles
+    mMesh->mPrimitiveTypes |= aiPrimitiveType_NGONEncodingFlag;
+    mProcess->SetRatios({ 0.5f }, 1e-3f);
+    ASSERT_EQ(1u, mProcess->ProcessMesh(mMesh));
+    CheckCover(mMesh, mMesh->mLODs[0]);
+    EXPECT_NE(0u, mMesh->mPrimitiveTypes & aiPrimitiveType_NGONEncodingFlag);
+}
+
+TEST_F(utGenLODs, skippedMeshesTest) {
+    // meshes with other primitives are skipped with a single warning for the scene
+    delete mScene;
+    mScene = new aiScene();
+    mScene->mNumMeshes = 3;
+    mScene->mMeshes = new aiMesh *[3];
+    for (unsigned int m = 0; m < 3; ++m) {
+        mScene->mMeshes[m] = CreateGrid(false);
+        mScene->mMeshes[m]->mPrimitiveTypes |= aiPrimitiveType_LINE;
+    }
+    mMesh = nullptr;
+
+    UTLogStream stream;
+    DefaultLogger::get()->attachStream(&stream, Logger::Warn);
+    mProcess->SetRatios({ 0.5f }, 1e-3f);
+    mProcess->Execute(mScene);
+    DefaultLogger::get()->detachStream(&stream, Logger::Warn);
+
+    for (unsigned int m = 0; m < 3; ++m) {
+        EXPECT_FALSE(mScene->mMeshes[m]->HasLODs());
+    }
+    const size_t numWarnings = std::count_if(stream.m_messages.begin(), stream.m_messages.end(),
+            [](const std::string &message) { return message.find("GenLODsProcess") != std::string::npos; });
+    EXPECT_EQ(1u, numWarnings);
+}
+
+TEST_F(utGenLODs, maxErrorTest) {
+    // a spike in the middle of the grid can't be removed without a large error
+    const unsigned int spike = Size * Size / 2 + Size / 2;
+    mMesh->mVertices[spike].z = 4;
+    mProcess->SetRatios({ 0.001f }, 1e-3f);
+    ASSERT_EQ(1u, mProcess->ProcessMesh(mMesh));
+    const aiMeshLOD *lod = mMesh->mLODs[0];
+    EXPECT_GT(lod->mNumFaces, 2u);
+    EXPECT_LE(lod->mError, 1e-3f);
+    unsigned int uses = 0;
+    for (unsigned int f = 0; f < lod->mNumFaces; ++f) {
+        uses += std::count(lod->mFaces[f].mIndices, lod->mFaces[f].mIndices + 3, spike);
+    }
+    EXPECT_GT(uses, 0u);
+}
+
+TEST_F(utGenLODs, seamTest) {
+    std::unique_ptr<aiMesh> mesh(CreateGrid(true));
+    mProcess->SetRatios({ 0.25f }, 1e-3f);
+    ASSERT_EQ(1u, mProcess->ProcessMesh(mesh.get()));
+    const aiMeshLOD *lod = mesh->mLODs[0];
+    EXPECT_LE(lod->mNumFaces, mesh->mNumFaces / 4);
+    CheckCover(mesh.get(), lod);
+
+    // the faces stay on their side of the seam and both sides keep the same seam vertices
+    std::set<ai_real> left, right;
+    for (unsigned int f = 0; f < lod->mNumFaces; ++f) {
+        const unsigned int *idx = lod->mFaces[f].mIndices;
+        const bool rightSide = mesh->mVertices[idx[0]].x + mesh->mVertices[idx[1]].x + mesh->mVertices[idx[2]].x > 3 * SeamColumn;
+        for (unsigned int i = 0; i < 3; ++i) {
+            const aiVector3D &p = mesh->mVertices[idx[i]];
+            if (p.x == SeamColumn) {
+                EXPECT_EQ(rightSide, idx[i] >= Size * Size);
+                (rightSide ? right : left).insert(p.y);
+            }
+        }
+    }
+    EXPECT_EQ(left, right);
+    EXPECT_LT(left.size(), Size);
+}
+
+TEST_F(utGenLODs, boneWeightsTest) {
+    // the left half is bound to the first bone, the right half to the second one
+    mMesh->mNumBones = 2;
+    mMesh->mBones = new aiBone *[2];
+    for (unsigned int b = 0; b < 2; ++b) {
+        mMesh->mBones[b] = new aiBone();
+        mMesh->mBones[b]->mWeights = new aiVertexWeight[Size * Size];
+    }
+    for (unsigned int v = 0; v < mMesh->mNumVertices; ++v) {
+        aiBone *bone = mMesh->mBones[mMesh->mVertices[v].x < SeamColumn ? 0 : 1];
+        bone->mWeights[bone->mNumWeights++] = aiVertexWeight(v, 1.f);
+    }
+
+    mProcess->SetRatios({ 0.25f }, PP_ICL_LOD_MAX_ERROR);
+    ASSERT_EQ(1u, mProcess->ProcessMesh(mMesh));
+    const aiMeshLOD *lod = mMesh->mLODs[0];
+    EXPECT_LE(lod->mNumFaces, mMesh->mNumFaces / 4);
+
+    // faces spanning both bones still only span the original strip between them
+    for (unsigned int f = 0; f < lod->mNumFaces; ++f) {
+        const unsigned int *idx = lod->mFaces[f].mIndices;
+        ai_real min = Size, max = 0;
+        for (unsigned int i = 0; i < 3; ++i) {
+            min = std::min(min, mMesh->mVertices[idx[i]].x);
+            max = std::max(max, mMesh->mVertices[idx[i]].x);
+        }
+        if (min < SeamColumn && max >= SeamColumn) {
+            EXPECT_EQ(SeamColumn - 1, min);
+            EXPECT_EQ(SeamColumn, max);
+        }
+    }
+}
+
+TEST_F(utGenLODs, importTest) {
+    Assimp::Importer importer;
+    importer.SetPropertyString(AI_CONFIG_PP_ICL_LOD_RATIOS, "0.5 0.25");
+    importer.SetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_VERTEX_FETCH, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj",
+            aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_NE(nullptr, importer.ApplyPostProcessing(aiProcess_ValidateDataStructure));
+
+    aiScene *copy = nullptr;
+    SceneCombiner::CopyScene(&copy, scene);
+    std::unique_ptr<aiScene> owner(copy);
+    for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
+        const aiMesh *mesh = scene->mMeshes[m];
+        ASSERT_EQ(2u, mesh->mNumLODs);
+        EXPECT_LT(mesh->mLODs[0]->mNumFaces, mesh->mNumFaces);
+        EXPECT_LE(mesh->mLODs[1]->mNumFaces, mesh->mLODs[0]->mNumFaces);
+        EXPECT_LE(mesh->mLODs[1]->mError, PP_ICL_LOD_MAX_ERROR);
+
+        const aiMesh *meshCopy = copy->mMeshes[m];
+        ASSERT_EQ(mesh->mNumLODs, meshCopy->mNumLODs);
+        for (unsigned int l = 0; l < mesh->mNumLODs; ++l) {
+            ASSERT_EQ(mesh->mLODs[l]->mNumFaces, meshCopy->mLODs[l]->mNumFaces);
+            EXPECT_NE(mesh->mLODs[l]->mFaces, meshCopy->mLODs[l]->mFaces);
+            EXPECT_TRUE(std::equal(mesh->mLODs[l]->mFaces, mesh->mLODs[l]->mFaces + mesh->mLODs[l]->mNumFaces, meshCopy->mLODs[l]->mFaces));
+        }
+    }
+}
@@ -0,0 +1,273 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/GenMeshlets.h"
+#include "PostProcessing/OptimizeVertexFetch.h"
+#include <assimp/Importer.hpp>
+#include <assimp/SceneCombiner.h>
+#include <assimp/config.h>
+#include <assimp/mesh.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+    // The triangles of a mesh as sorted position triples, independent of the face order
+    std::vector<std::array<aiVector3D, 3>> GetTriangles(const aiMesh *mesh) {
+        std::vector<std::array<aiVector3D, 3>> triangles;
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            const unsigned int *idx = mesh->mFaces[f].mIndices;
+            std::array<aiVector3D, 3> t = { mesh->mVertices[idx[0]], mesh->mVertices[idx[1]], mesh->mVertices[idx[2]] };
+            std::sort(t.begin(), t.end());
+            triangles.push_back(t);
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+
+    // Checks the meshlets cover the faces in order, respect the limits and bound their vertices
+    void CheckMeshlets(const aiMesh *mesh, unsigned int maxVertices, unsigned int maxTriangles) {
+        ASSERT_TRUE(mesh->HasMeshlets());
+        unsigned int numTriangles = 0;
+        for (unsigned int m = 0; m < mesh->mNumMeshlets; ++m) {
+            const aiMeshlet &meshlet = mesh->mMeshlets[m];
+            EXPECT_EQ(numTriangles, meshlet.mTriangleOffset);
+            EXPECT_LE(meshlet.mNumVertices, maxVertices);
+            EXPECT_LE(meshlet.mNumTriangles, maxTriangles);
+            EXPECT_LE(meshlet.mVertexOffset + meshlet.mNumVertices, mesh->mNumMeshletVertices);
+
+            for (unsigned int t = 0; t < meshlet.mNumTriangles; ++t) {
+                const aiFace &face = mesh->mFaces[meshlet.mTriangleOffset + t];
+                for (unsigned int c = 0; c < 3; ++c) {
+                    const unsigned char local = mesh->mMeshletTriangles[(meshlet.mTriangleOffset + t) * 3 + c];
+                    ASSERT_LT(local, meshlet.mNumVertices);
+                    EXPECT_EQ(face.mIndices[c], mesh->mMeshletVertices[meshlet.mVertexOffset + local]);
+                }
+            }
+            for (unsigned int v = 0; v < meshlet.mNumVertices; ++v) {
+                const aiVector3D &p = mesh->mVertices[mesh->mMeshletVertices[meshlet.mVertexOffset + v]];
+                EXPECT_LE((p - meshlet.mCenter).Length(), meshlet.mRadius * 1.0001f);
+            }
+            numTriangles += meshlet.mNumTriangles;
+        }
+        EXPECT_EQ(mesh->mNumFaces, numTriangles);
+    }
+} // namespace
+
+class utGenMeshlets : public ::testing::Test {
+public:
+    utGenMeshlets() :
+            Test(), mProcess(nullptr), mMesh(nullptr), mScene(nullptr) {
+        // empty
+    }
+
+    void SetUp() override {
+        mProcess = new GenMeshletsProcess;
+
+        // a flat grid of quads facing +z
+        constexpr unsigned int Size = 32;
+        mMesh = new aiMesh();
+        mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mMesh->mNumVertices = Size * Size;
+        mMesh->mVertices = new aiVector3D[mMesh->mNumVertices];
+        for (unsigned int y = 0; y < Size; ++y) {
+            for (unsigned int x = 0; x < Size; ++x) {
+                mMesh->mVertices[y * Size + x] = aiVector3D((ai_real)x, (ai_real)y, 0);
+            }
+        }
+        mMesh->mNumFaces = (Size - 1) * (Size - 1) * 2;
+        mMesh->mFaces = new aiFace[mMesh->mNumFaces];
+        aiFace *face = mMesh->mFaces;
+        for (unsigned int y = 0; y + 1 < Size; ++y) {
+            for (unsigned int x = 0; x + 1 < Size; ++x) {
+                const unsigned int corners[4] = { y * Size + x, y * Size + x + 1, (y + 1) * Size + x + 1, (y + 1) * Size + x };
+                for (unsigned int t = 0; t < 2; ++t, ++face) {
+                    face->mNumIndices = 3;
+                    face->mIndices = new unsigned int[3]{ corners[0], corners[t + 1], corners[t + 2] };
+                }
+            }
+        }
+
+        mScene = new aiScene();
+        mScene->mNumMeshes = 1;
+        mScene->mMeshes = new aiMesh *[1];
+        mScene->mMeshes[0] = mMesh;
+    }
+
+    void TearDown() override {
+        delete mProcess;
+        delete mScene;
+    }
+
+protected:
+    GenMeshletsProcess *mProcess;
+    aiMesh *mMesh;
+    aiScene *mScene;
+};
+
+TEST_F(utGenMeshlets, disabledTest) {
+    mProcess->Execute(mScene);
+    EXPECT_FALSE(mMesh->HasMeshlets());
+}
+
+TEST_F(utGenMeshlets, partitionTest) {
+    const auto triangles = GetTriangles(mMesh);
+    mProcess->SetLimits(64, 124);
+    mProcess->Execute(mScene);
+
+    CheckMeshlets(mMesh, 64, 124);
+    EXPECT_EQ(triangles, GetTriangles(mMesh));
+
+    // the meshlets are compact patches of the grid
+    EXPECT_LE(mMesh->mNumMeshlets, mMesh->mNumFaces / 64);
+    for (unsigned int m = 0; m < mMesh->mNumMeshlets; ++m) {
+        const aiMeshlet &meshlet = mMesh->mMeshlets[m];
+        EXPECT_NEAR(1.f, meshlet.mConeAxis.z, 1e-5f);
+        EXPECT_NEAR(0.f, meshlet.mConeCutoff, 1e-3f);
+    }
+}
+
+TEST_F(utGenMeshlets, limitsTest) {
+    mProcess->SetLimits(16, 8);
+    EXPECT_GE(mProcess->ProcessMesh(mMesh), mMesh->mNumFaces / 8);
+    CheckMeshlets(mMesh, 16, 8);
+
+    // meshlets are replaced when the step runs again
+    mProcess->SetLimits(3, 124);
+    EXPECT_EQ(mMesh->mNumFaces, mProcess->ProcessMesh(mMesh));
+    CheckMeshlets(mMesh, 3, 1);
+}
+
+TEST_F(utGenMeshlets, ngonEncodedTest) {
+    // triangulated polygons are still triangles
+    mMesh->mPrimitiveTypes |= aiPrimitiveType_NGONEncodingFlag;
+    mProcess->SetLimits(64, 124);
+    EXPECT_GT(mProcess->ProcessMesh(mMesh), 0u);
+    CheckMeshlets(mMesh, 64, 124);
+
+    // the faces were reordered, so the encoding is dropped
+    EXPECT_EQ(static_cast<unsigned int>(aiPrimitiveType_TRIANGLE), mMesh->mPrimitiveTypes);
+}
+
+TEST_F(utGenMeshlets, coneTest) {
+    // a cube with separate vertices for each side
+    std::unique_ptr<aiMesh> cube(new aiMesh());
+    cube->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    cube->mNumVertices = 24;
+    cube->mVertices = new aiVector3D[24];
+    cube->mNumFaces = 12;
+    cube->mFaces = new aiFace[12];
+    const aiVector3D axes[3] = { aiVector3D(1, 0, 0), aiVector3D(0, 1, 0), aiVector3D(0, 0, 1) };
+    for (unsigned int s = 0; s < 6; ++s) {
+        const aiVector3D n = axes[s / 2] * (s % 2 ? -1.f : 1.f);
+        const aiVector3D u = axes[(s / 2 + 1) % 3], w = n ^ u;
+        const aiVector3D corners[4] = { n - u - w, n + u - w, n + u + w, n - u + w };
+        for (unsigned int c = 0; c < 4; ++c) {
+            cube->mVertices[s * 4 + c] = corners[c];
+        }
+        for (unsigned int t = 0; t < 2; ++t) {
+            cube->mFaces[s * 2 + t].mNumIndices = 3;
+            cube->mFaces[s * 2 + t].mIndices = new unsigned int[3]{ s * 4, s * 4 + t + 1, s * 4 + t + 2 };
+        }
+    }
+
+    mProcess->SetLimits(4, 124);
+    ASSERT_EQ(6u, mProcess->ProcessMesh(cube.get()));
+    CheckMeshlets(cube.get(), 4, 2);
+
+    const aiVector3D camera(0, 0, 5);
+    unsigned int culled = 0;
+    for (unsigned int m = 0; m < cube->mNumMeshlets; ++m) {
+        const aiMeshlet &meshlet = cube->mMeshlets[m];
+        const aiVector3D &normal = meshlet.mCenter;
+        EXPECT_NEAR(0.f, meshlet.mConeCutoff, 1e-5f);
+        EXPECT_NEAR(1.f, meshlet.mConeAxis * normal, 1e-5f);
+        EXPECT_NEAR(std::sqrt(2.f), meshlet.mRadius, 1e-5f);
+
+        // all sides but the one facing the camera are culled
+        const bool backFacing = (meshlet.mConeApex - camera).Normalize() * meshlet.mConeAxis >= meshlet.mConeCutoff;
+        EXPECT_EQ(normal.z <= 0, backFacing);
+        culled += backFacing;
+    }
+    EXPECT_EQ(5u, culled);
+}
+
+TEST_F(utGenMeshlets, vertexFetchTest) {
+    mProcess->SetLimits(64, 124);
+    mProcess->ProcessMesh(mMesh);
+
+    OptimizeVertexFetchProcess vertexFetch;
+    vertexFetch.ProcessMesh(mMesh);
+    CheckMeshlets(mMesh, 64, 124);
+}
+
+TEST_F(utGenMeshlets, importTest) {
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_PP_ICL_GEN_MESHLETS, true);
+    importer.SetPropertyInteger(AI_CONFIG_PP_ICL_MESHLET_VERTEX_LIMIT, 32);
+    importer.SetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_VERTEX_FETCH, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj",
+            aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_NE(nullptr, importer.ApplyPostProcessing(aiProcess_ValidateDataStructure));
+
+    aiScene *copy = nullptr;
+    SceneCombiner::CopyScene(&copy, scene);
+    std::unique_ptr<aiScene> owner(copy);
+    for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
+        const aiMesh *mesh = scene->mMeshes[m];
+        CheckMeshlets(mesh, 32, PP_ICL_MESHLET_TRIANGLE_LIMIT);
+
+        const aiMesh *meshCopy = copy->mMeshes[m];
+        ASSERT_EQ(mesh->mNumMeshlets, meshCopy->mNumMeshlets);
+        EXPECT_NE(mesh->mMeshlets, meshCopy->mMeshlets);
+        EXPECT_TRUE(std::equal(mesh->mMeshletVertices, mesh->mMeshletVertices + mesh->mNumMeshletVertices, meshCopy->mMeshletVertices));
+        EXPECT_TRUE(std::equal(mesh->mMeshletTriangles, mesh->mMeshletTriangles + mesh->mNumFaces * 3, meshCopy->mMeshletTriangles));
+    }
+}
@@ -42,6 +42,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "../../include/assimp/postprocess.h"
 #include "../../include/assimp/scene.h"
+#include "Common/ProbingIOSystem.h"
 #include "TestIOSystem.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
@@ -236,6 +237,106 @@ TEST_F(ImporterTest, testPluginInterface) {
     EXPECT_TRUE(false); // control shouldn't reach this point
 }
 
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testImporterIndexFollowsRegistration) {
+    TestPlugin *plugin = new TestPlugin();
+    pImp->RegisterLoader(plugin);
+    EXPECT_EQ(pImp->GetImporterCount() - 1, pImp->GetImporterIndex("apple"));
+    EXPECT_EQ(pImp->GetImporterCount() - 1, pImp->GetImporterIndex("*.WINDOWS"));
+    EXPECT_EQ(plugin, pImp->GetImporter(".linux"));
+
+    pImp->UnregisterLoader(plugin);
+    delete plugin;
+    EXPECT_EQ(static_cast<size_t>(-1), pImp->GetImporterIndex("apple"));
+    EXPECT_NE(static_cast<size_t>(-1), pImp->GetImporterIndex("obj"));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testRegistrationKeepsSharedExtensionIndex) {
+    // both importers start out with the shared extension table of the default importers
+    Importer other;
+    EXPECT_EQ(other.GetImporterIndex("obj"), pImp->GetImporterIndex("obj"));
+
+    TestPlugin *plugin = new TestPlugin();
+    pImp->RegisterLoader(plugin);
+    EXPECT_EQ(pImp->GetImporterCount() - 1, pImp->GetImporterIndex("apple"));
+    EXPECT_EQ(static_cast<size_t>(-1), other.GetImporterIndex("apple"));
+
+    Importer later;
+    EXPECT_EQ(static_cast<size_t>(-1), later.GetImporterIndex("apple"));
+    EXPECT_EQ(pImp->GetImporterIndex("obj"), later.GetImporterIndex("obj"));
+
+    pImp->UnregisterLoader(plugin);
+    delete plugin;
+}
+
+namespace {
+// Forwards to the default file system and counts how often a file is opened.
+class CountingIOSystem : public IOSystem {
+public:
+    bool Exists(const char *pFile) const override {
+        return mWrapped.Exists(pFile);
+    }
+
+    char getOsSeparator() const override {
+        return mWrapped.getOsSeparator();
+    }
+
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        ++mNumOpened;
+        return mWrapped.Open(pFile, pMode);
+    }
+
+    void Close(IOStream *pFile) override {
+        ++mNumClosed;
+        mWrapped.Close(pFile);
+    }
+
+    DefaultIOSystem mWrapped;
+    unsigned int mNumOpened = 0;
+    unsigned int mNumClosed = 0;
+};
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testSignatureDetectionSharesHeader) {
+    // The file has no extension, so every importer gets to look at its signature.
+    CountingIOSystem *io = new CountingIOSystem();
+    pImp->SetIOHandler(io);
+    const aiScene *scene = pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/formatDetection", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    // One read for all signature checks, one for the progress handler, one for the actual import
+    EXPECT_LE(io->mNumOpened, 3u);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testProbedStreamsMayBeDeleted) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/STL/formatDetection";
+    CountingIOSystem io;
+    ProbingIOSystem probe(file, &io);
+
+    // the file is small enough to be served from the header buffer
+    IOStream *stream = probe.Open(file);
+    ASSERT_NE(nullptr, stream);
+    EXPECT_EQ(1u, io.mNumOpened);
+    delete stream;
+
+    // streams of other files still go back to the wrapped system, whatever their address
+    for (int i = 0; i < 4; ++i) {
+        stream = probe.Open(ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl");
+        ASSERT_NE(nullptr, stream);
+        probe.Close(stream);
+    }
+    EXPECT_EQ(4u, io.mNumClosed);
+
+    stream = probe.Open(file);
+    ASSERT_NE(nullptr, stream);
+    probe.Close(stream);
+    EXPECT_EQ(5u, io.mNumOpened);
+    EXPECT_EQ(4u, io.mNumClosed);
+}
+
 // ------------------------------------------------------------------------------------------------
 TEST_F(ImporterTest, testExtensionCheck) {
     std::string s;
@@ -275,6 +376,51 @@ TEST_F(ImporterTest, testMultipleReads) {
     //EXPECT_TRUE(pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/X/dwarf.x",flags)); # is in nonbsd
 }
 
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testParallelPostProcessing) {
+    // Mesh-local steps running on a worker pool must produce exactly the same output
+    // as the serial pipeline.
+    const unsigned int flags =
+            aiProcess_Triangulate |
+            aiProcess_GenSmoothNormals |
+            aiProcess_CalcTangentSpace |
+            aiProcess_JoinIdenticalVertices |
+            aiProcess_ImproveCacheLocality |
+            aiProcess_LimitBoneWeights |
+            aiProcess_FindDegenerates;
+
+    Importer serial;
+    const aiScene *expected = serial.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, expected);
+
+    Importer parallel;
+    parallel.SetPropertyInteger(AI_CONFIG_PP_NUM_THREADS, 4);
+    const aiScene *actual = parallel.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, actual);
+
+    ASSERT_GT(expected->mNumMeshes, 1u);
+    ASSERT_EQ(expected->mNumMeshes, actual->mNumMeshes);
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        const aiMesh *a = expected->mMeshes[i];
+        const aiMesh *b = actual->mMeshes[i];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        ASSERT_EQ(a->HasNormals(), b->HasNormals());
+        for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+            EXPECT_EQ(a->mVertices[v], b->mVertices[v]);
+            if (a->HasNormals()) {
+                EXPECT_EQ(a->mNormals[v], b->mNormals[v]);
+            }
+        }
+        for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+            ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+            for (unsigned int k = 0; k < a->mFaces[f].mNumIndices; ++k) {
+                EXPECT_EQ(a->mFaces[f].mIndices[k], b->mFaces[f].mIndices[k]);
+            }
+        }
+    }
+}
+
 TEST_F(ImporterTest, SearchFileHeaderForTokenTest) {
     //DefaultIOSystem ioSystem;
     //    BaseImporter::SearchFileHeaderForToken( &ioSystem, assetPath, Token, 2 )
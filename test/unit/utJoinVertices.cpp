@@ -43,6 +43,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 
 #include "PostProcessing/JoinVerticesProcess.h"
+#include "Common/ThreadPool.h"
+
+#include <memory>
 
 using namespace std;
 using namespace Assimp;
@@ -140,3 +143,91 @@ TEST_F(utJoinVertices, testProcess) {
     }
     EXPECT_EQ(150.f * 299.f * 3.f, fSum); // gaussian sum equation
 }
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utJoinVertices, channelGapTest) {
+    // the copies of each position differ only in channels behind an unused one
+    pcMesh->mTextureCoords[2] = new aiVector3D[900];
+    pcMesh->mColors[1] = new aiColor4D[900];
+    for (unsigned int i = 0; i < 900; ++i) {
+        pcMesh->mTextureCoords[2][i] = aiVector3D(i / 300 == 2 ? 1.f : 0.f, 0.f, 0.f);
+        pcMesh->mColors[1][i] = aiColor4D(i / 300 == 1 ? 1.f : 0.f, 0.f, 0.f, 1.f);
+    }
+
+    piProcess->ProcessMesh(pcMesh, 0);
+    ASSERT_EQ(900U, pcMesh->mNumVertices);
+    for (unsigned int i = 0; i < 300; ++i) {
+        const aiFace &face = pcMesh->mFaces[i];
+        for (unsigned int a = 0; a < 3; ++a) {
+            EXPECT_EQ(i / 100 == 2 ? 1.f : 0.f, pcMesh->mTextureCoords[2][face.mIndices[a]].x);
+            EXPECT_EQ(i / 100 == 1 ? 1.f : 0.f, pcMesh->mColors[1][face.mIndices[a]].r);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// A large triangle soup, so the partitioned code path runs, with exact duplicates, duplicates
+// within the tolerance and vertices which only differ in their normal.
+static aiMesh *CreateSoup(unsigned int numCorners) {
+    aiMesh *mesh = new aiMesh();
+    mesh->mNumVertices = numCorners * 3;
+    mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+    mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+    for (unsigned int i = 0; i < numCorners; ++i) {
+        const aiVector3D pos((float)(i % 97), (float)(i / 97), i % 2 ? -0.f : 0.f);
+        for (unsigned int k = 0; k < 3; ++k) {
+            mesh->mVertices[i * 3 + k] = pos;
+            mesh->mNormals[i * 3 + k] = aiVector3D(0.f, 0.f, 1.f);
+        }
+        // same position, -0 vs +0, joined
+        mesh->mVertices[i * 3 + 1].z = -mesh->mVertices[i * 3 + 1].z;
+        // within the tolerance, joined
+        mesh->mNormals[i * 3 + 1].x = 1e-7f;
+        // a hard edge every other corner, kept
+        if (i % 2) {
+            mesh->mNormals[i * 3 + 2] = aiVector3D(1.f, 0.f, 0.f);
+        }
+    }
+
+    mesh->mNumFaces = numCorners;
+    mesh->mFaces = new aiFace[numCorners];
+    for (unsigned int i = 0; i < numCorners; ++i) {
+        aiFace &face = mesh->mFaces[i];
+        face.mIndices = new unsigned int[face.mNumIndices = 3];
+        for (unsigned int a = 0; a < 3; ++a) {
+            face.mIndices[a] = i * 3 + a;
+        }
+    }
+    return mesh;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utJoinVertices, parallelMatchesSerialTest) {
+    const unsigned int numCorners = 40000;
+    std::unique_ptr<aiMesh> serial(CreateSoup(numCorners));
+    std::unique_ptr<aiMesh> parallel(CreateSoup(numCorners));
+
+    piProcess->ProcessMesh(serial.get(), 0);
+
+    ThreadPool pool(4);
+    piProcess->SetThreadPool(&pool);
+    piProcess->ProcessMesh(parallel.get(), 0);
+    piProcess->SetThreadPool(nullptr);
+
+    // one vertex per corner, plus one for each hard edge
+    EXPECT_EQ(numCorners + numCorners / 2, serial->mNumVertices);
+    ASSERT_EQ(serial->mNumVertices, parallel->mNumVertices);
+    for (unsigned int i = 0; i < serial->mNumVertices; ++i) {
+        EXPECT_EQ(serial->mVertices[i], parallel->mVertices[i]);
+        EXPECT_EQ(serial->mNormals[i], parallel->mNormals[i]);
+    }
+    for (unsigned int i = 0; i < numCorners; ++i) {
+        const aiFace &a = serial->mFaces[i], &b = parallel->mFaces[i];
+        for (unsigned int k = 0; k < 3; ++k) {
+            EXPECT_EQ(a.mIndices[k], b.mIndices[k]);
+        }
+        // the first two corners are joined, the new indices follow the first use
+        EXPECT_EQ(a.mIndices[0], a.mIndices[1]);
+        EXPECT_EQ(i % 2 ? 1U : 0U, a.mIndices[2] - a.mIndices[0]);
+    }
+}
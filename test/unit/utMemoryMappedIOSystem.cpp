@@ -0,0 +1,133 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/MemoryMappedIOSystem.h>
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+#include <vector>
+
+using namespace Assimp;
+
+class utMemoryMappedIOSystem : public ::testing::Test {
+protected:
+    // Imports the file once through stdio and once through the mapping and compares the meshes
+    void CompareImports(const char *file) {
+        Importer reference;
+        const aiScene *expected = reference.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, expected);
+
+        Importer mapped;
+        mapped.SetIOHandler(new MemoryMappedIOSystem());
+        const aiScene *actual = mapped.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, actual);
+
+        ASSERT_EQ(expected->mNumMeshes, actual->mNumMeshes);
+        for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+            const aiMesh *a = expected->mMeshes[i];
+            const aiMesh *b = actual->mMeshes[i];
+            ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+            ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+            for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+                EXPECT_EQ(a->mVertices[v], b->mVertices[v]);
+            }
+        }
+    }
+};
+
+TEST_F(utMemoryMappedIOSystem, readOnlyFilesAreMapped) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl";
+    DefaultIOSystem stdio;
+    std::unique_ptr<IOStream> reference(stdio.Open(file, "rb"));
+    ASSERT_NE(nullptr, reference);
+    EXPECT_EQ(nullptr, reference->GetMappedPointer());
+
+    MemoryMappedIOSystem io;
+    std::unique_ptr<IOStream> stream(io.Open(file, "rb"));
+    ASSERT_NE(nullptr, stream);
+    ASSERT_NE(nullptr, stream->GetMappedPointer());
+    ASSERT_EQ(reference->FileSize(), stream->FileSize());
+
+    std::vector<uint8_t> expected(reference->FileSize());
+    ASSERT_EQ(1u, reference->Read(expected.data(), expected.size(), 1));
+    EXPECT_EQ(0, memcmp(expected.data(), stream->GetMappedPointer(), expected.size()));
+
+    // the stream interface works on the mapping as well
+    uint8_t header[80];
+    ASSERT_EQ(1u, stream->Read(header, sizeof(header), 1));
+    EXPECT_EQ(0, memcmp(expected.data(), header, sizeof(header)));
+    EXPECT_EQ(sizeof(header), stream->Tell());
+
+    EXPECT_EQ(aiReturn_SUCCESS, stream->Seek(4, aiOrigin_END));
+    EXPECT_EQ(expected.size() - 4, stream->Tell());
+    EXPECT_EQ(0u, stream->Read(header, 8, 1));
+    EXPECT_EQ(aiReturn_FAILURE, stream->Seek(expected.size() + 1, aiOrigin_SET));
+    EXPECT_EQ(aiReturn_SUCCESS, stream->Seek(0, aiOrigin_SET));
+    EXPECT_EQ(0u, stream->Tell());
+}
+
+TEST_F(utMemoryMappedIOSystem, missingFilesAreNotOpened) {
+    MemoryMappedIOSystem io;
+    EXPECT_FALSE(io.Exists(ASSIMP_TEST_MODELS_DIR "/STL/does_not_exist.stl"));
+    EXPECT_EQ(nullptr, io.Open(ASSIMP_TEST_MODELS_DIR "/STL/does_not_exist.stl", "rb"));
+}
+
+TEST_F(utMemoryMappedIOSystem, importBinarySTL) {
+    CompareImports(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl");
+}
+
+TEST_F(utMemoryMappedIOSystem, importAsciiSTL) {
+    CompareImports(ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl");
+}
+
+TEST_F(utMemoryMappedIOSystem, importBinaryFBX) {
+    CompareImports(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx");
+}
+
+TEST_F(utMemoryMappedIOSystem, importGLB) {
+    CompareImports(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb");
+}
@@ -539,3 +539,200 @@ TEST_F(utObjImportExport, issue2355_mtl_texture_prefix) {
     // The MTL file is in `folder`, the image path should have been prefixed with the folder
     EXPECT_STREQ("folder/image.jpg", texturePath.C_Str());
 }
+
+static std::string CreateChunkedObjModel() {
+    std::string model = "# many small patches\n";
+    const int numPatches = 600;
+    for (int patch = 0; patch < numPatches; ++patch) {
+        if (patch % 50 == 0) {
+            model += "o object" + std::to_string(patch / 50) + "\n";
+        }
+        model += "g patch" + std::to_string(patch % 70) + "\r\n";
+        model += "usemtl material" + std::to_string(patch % 3) + "\n";
+        for (int i = 0; i < 25; ++i) {
+            const std::string x = std::to_string(patch + i % 5 * 0.25), y = std::to_string(i / 5 * 0.25);
+            if (patch % 7 == 0) {
+                model += "v " + x + " " + y + " 0.5 0.1 0.2 0.3\n";
+            } else if (patch % 11 == 0) {
+                model += "v " + x + " \\\n " + y + " 1.0 2.0\n";
+            } else {
+                model += "v " + x + " " + y + " 0.5\n";
+            }
+            model += "vt " + std::to_string(i % 5 * 0.2) + " " + std::to_string(i / 5 * 0.2) + "\n";
+            model += "vn 0 0 1\n";
+        }
+        for (int i = 0; i < 16; ++i) {
+            const int corner = i % 4 + i / 4 * 5;
+            if (patch % 2 == 0) {
+                // relative indices
+                const int a = corner - 25, b = corner - 24, c = corner - 19;
+                model += "f " + std::to_string(a) + "/" + std::to_string(a) + "/" + std::to_string(a) + " " +
+                         std::to_string(b) + "/" + std::to_string(b) + "/" + std::to_string(b) + " " +
+                         std::to_string(c) + "/" + std::to_string(c) + "/" + std::to_string(c) + "\n";
+            } else {
+                const int a = patch * 25 + corner + 1, b = a + 1, c = a + 6, d = a + 5;
+                model += "f " + std::to_string(a) + "//" + std::to_string(a) + " " + std::to_string(b) + "//" + std::to_string(b) +
+                         " " + std::to_string(c) + "//" + std::to_string(c) + " " + std::to_string(d) + "//" + std::to_string(d) + "\n";
+            }
+        }
+        model += "s off\n";
+    }
+    model += "l 1 2 3";
+    return model;
+}
+
+static void ExpectEqualNodes(const aiNode *expected, const aiNode *node) {
+    ASSERT_NE(nullptr, node);
+    EXPECT_STREQ(expected->mName.C_Str(), node->mName.C_Str());
+    ASSERT_EQ(expected->mNumMeshes, node->mNumMeshes);
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        EXPECT_EQ(expected->mMeshes[i], node->mMeshes[i]);
+    }
+    ASSERT_EQ(expected->mNumChildren, node->mNumChildren);
+    for (unsigned int i = 0; i < expected->mNumChildren; ++i) {
+        ExpectEqualNodes(expected->mChildren[i], node->mChildren[i]);
+    }
+}
+
+// Imports the model with the line-by-line parser and with the chunked parser, both must create the same scene.
+static void ExpectChunkedImportMatchesSerial(const std::string &model) {
+    Assimp::Importer serialImporter;
+    const aiScene *expected = serialImporter.ReadFileFromMemory(model.c_str(), model.size(), 0, "obj");
+    ASSERT_NE(nullptr, expected);
+
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 4);
+    const aiScene *scene = parallelImporter.ReadFileFromMemory(model.c_str(), model.size(), 0, "obj");
+    ASSERT_NE(nullptr, scene);
+
+    EXPECT_EQ(expected->mNumMaterials, scene->mNumMaterials);
+    ExpectEqualNodes(expected->mRootNode, scene->mRootNode);
+    ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        const aiMesh *expectedMesh = expected->mMeshes[i];
+        const aiMesh *mesh = scene->mMeshes[i];
+        EXPECT_STREQ(expectedMesh->mName.C_Str(), mesh->mName.C_Str());
+        EXPECT_EQ(expectedMesh->mMaterialIndex, mesh->mMaterialIndex);
+        EXPECT_EQ(expectedMesh->mPrimitiveTypes, mesh->mPrimitiveTypes);
+        ASSERT_EQ(expectedMesh->mNumVertices, mesh->mNumVertices);
+        ASSERT_EQ(expectedMesh->HasNormals(), mesh->HasNormals());
+        ASSERT_EQ(expectedMesh->HasTextureCoords(0), mesh->HasTextureCoords(0));
+        ASSERT_EQ(expectedMesh->HasVertexColors(0), mesh->HasVertexColors(0));
+        for (unsigned int v = 0; v < mesh->mNumVertices; ++v) {
+            EXPECT_EQ(expectedMesh->mVertices[v], mesh->mVertices[v]);
+            if (mesh->HasNormals()) {
+                EXPECT_EQ(expectedMesh->mNormals[v], mesh->mNormals[v]);
+            }
+            if (mesh->HasTextureCoords(0)) {
+                EXPECT_EQ(expectedMesh->mTextureCoords[0][v], mesh->mTextureCoords[0][v]);
+            }
+            if (mesh->HasVertexColors(0)) {
+                EXPECT_EQ(expectedMesh->mColors[0][v], mesh->mColors[0][v]);
+            }
+        }
+        ASSERT_EQ(expectedMesh->mNumFaces, mesh->mNumFaces);
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            ASSERT_EQ(expectedMesh->mFaces[f].mNumIndices, mesh->mFaces[f].mNumIndices);
+            for (unsigned int j = 0; j < mesh->mFaces[f].mNumIndices; ++j) {
+                EXPECT_EQ(expectedMesh->mFaces[f].mIndices[j], mesh->mFaces[f].mIndices[j]);
+            }
+        }
+    }
+}
+
+// Repeats a model which only uses relative indices until the file is split into several chunks.
+static std::string RepeatObjModel(const std::string &model) {
+    std::string result;
+    while (result.size() < 1024 * 1024) {
+        result += model;
+    }
+    return result;
+}
+
+TEST_F(utObjImportExport, parallel_import_matches_serial_Test) {
+    ExpectChunkedImportMatchesSerial(CreateChunkedObjModel());
+}
+
+TEST_F(utObjImportExport, parallel_import_line_continuations_Test) {
+    const std::string model =
+            "o continued\n"
+            "v 0 0 \\\n"
+            "0\n"
+            "v 1 \\\n"
+            " 0 0\n"
+            "v 1 1 0 \\\r\n"
+            "\n"
+            "vt 0 0\n"
+            "vt 1 \\\n"
+            "0\n"
+            "vt 1 1\n"
+            "vn 0 0 1\n"
+            "f -3/-3/-1 \\\n"
+            "-2/-2/-1 -1/-1/-1\n"
+            "usemtl \\\n"
+            "mat\n"
+            "f -1 -2 -3\n";
+    ExpectChunkedImportMatchesSerial(model);
+    ExpectChunkedImportMatchesSerial(RepeatObjModel(model));
+}
+
+TEST_F(utObjImportExport, parallel_import_crlf_Test) {
+    const std::string model =
+            "o crlf\r\n"
+            "g group\r\n"
+            "v 0 0 0\r\n"
+            "v 1 0 0\r\n"
+            "v 1 1 0\r\n"
+            "vt 0.5 0.5\r\n"
+            "vn 0 0 1\r\n"
+            "usemtl red\r\n"
+            "f -3/-1/-1 -2/-1/-1 -1/-1/-1\r\n"
+            "s 1\r\n"
+            "# comment\r\n"
+            "l -3 -2\r\n";
+    ExpectChunkedImportMatchesSerial(model);
+    ExpectChunkedImportMatchesSerial(RepeatObjModel(model));
+}
+
+TEST_F(utObjImportExport, parallel_import_bom_Test) {
+    const std::string bom = "\xEF\xBB\xBF";
+    const std::string model =
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 1 1 0\n"
+            "f -3 -2 -1\n";
+    ExpectChunkedImportMatchesSerial(bom + model);
+    ExpectChunkedImportMatchesSerial(bom + RepeatObjModel(model));
+}
+
+TEST_F(utObjImportExport, parallel_import_vertex_colors_Test) {
+    const std::string model =
+            "v 0 0 0\n"
+            "v 1 0 0 1 0 0\n"
+            "v 1 1 0\n"
+            "v 0 2 0 2\n"
+            "v 0 1 0 0 0.5 1\n"
+            "f -5 -4 -3 -1\n"
+            "f -1 -2 -3\n"
+            "v 2 2 2\n"
+            "f -1 -2 -3\n";
+    ExpectChunkedImportMatchesSerial(model);
+    ExpectChunkedImportMatchesSerial(RepeatObjModel(model));
+}
+
+TEST_F(utObjImportExport, parallel_import_curves_Test) {
+    const std::string model =
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 1 1 0\n"
+            "v 0 1 0\n"
+            "f -4 -3 -2\n"
+            "cstype bspline\n"
+            "deg 3\n"
+            "curv 0.0 1.0 -4 -3 -2 -1\n"
+            "parm u 0 0 0 0 1 1 1 1\n"
+            "end\n"
+            "f -4 -2 -1\n";
+    ExpectChunkedImportMatchesSerial(model);
+    ExpectChunkedImportMatchesSerial(RepeatObjModel(model));
+}
@@ -0,0 +1,150 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/OptimizeOverdraw.h"
+#include <assimp/mesh.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <array>
+
+using namespace Assimp;
+
+class utOptimizeOverdraw : public ::testing::Test {
+public:
+    utOptimizeOverdraw() :
+            Test(), mProcess(nullptr), mMesh(nullptr), mScene(nullptr) {
+        // empty
+    }
+
+    void SetUp() override {
+        mProcess = new OptimizeOverdrawProcess;
+
+        // a small cube inside a large one, the small one is drawn first
+        mMesh = new aiMesh();
+        mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mMesh->mNumVertices = 2 * 24;
+        mMesh->mVertices = new aiVector3D[mMesh->mNumVertices];
+        mMesh->mNumFaces = 2 * 12;
+        mMesh->mFaces = new aiFace[mMesh->mNumFaces];
+        AddCube(0, 1);
+        AddCube(1, 10);
+
+        mScene = new aiScene();
+        mScene->mNumMeshes = 1;
+        mScene->mMeshes = new aiMesh *[1];
+        mScene->mMeshes[0] = mMesh;
+    }
+
+    void TearDown() override {
+        delete mProcess;
+        delete mScene;
+    }
+
+    // Adds an outward facing cube with flat shaded sides
+    void AddCube(unsigned int index, ai_real halfSize) {
+        aiVector3D *vertices = mMesh->mVertices + index * 24;
+        aiFace *faces = mMesh->mFaces + index * 12;
+        for (unsigned int side = 0; side < 6; ++side) {
+            aiVector3D normal, u, v;
+            normal[side / 2] = (side & 1) ? -halfSize : halfSize;
+            u[(side / 2 + 1) % 3] = halfSize;
+            v[(side / 2 + 2) % 3] = (side & 1) ? -halfSize : halfSize;
+            vertices[side * 4 + 0] = normal - u - v;
+            vertices[side * 4 + 1] = normal + u - v;
+            vertices[side * 4 + 2] = normal + u + v;
+            vertices[side * 4 + 3] = normal - u + v;
+
+            const unsigned int first = index * 24 + side * 4;
+            faces[side * 2].mNumIndices = 3;
+            faces[side * 2].mIndices = new unsigned int[3]{ first, first + 1, first + 2 };
+            faces[side * 2 + 1].mNumIndices = 3;
+            faces[side * 2 + 1].mIndices = new unsigned int[3]{ first, first + 2, first + 3 };
+        }
+    }
+
+    std::vector<std::array<unsigned int, 3>> GetTriangles() const {
+        std::vector<std::array<unsigned int, 3>> triangles(mMesh->mNumFaces);
+        for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+            std::copy(mMesh->mFaces[f].mIndices, mMesh->mFaces[f].mIndices + 3, triangles[f].begin());
+        }
+        return triangles;
+    }
+
+protected:
+    OptimizeOverdrawProcess *mProcess;
+    aiMesh *mMesh;
+    aiScene *mScene;
+};
+
+TEST_F(utOptimizeOverdraw, disabledTest) {
+    const std::vector<std::array<unsigned int, 3>> triangles = GetTriangles();
+    mProcess->Execute(mScene);
+    EXPECT_EQ(triangles, GetTriangles());
+}
+
+TEST_F(utOptimizeOverdraw, occludersFirstTest) {
+    std::vector<std::array<unsigned int, 3>> triangles = GetTriangles();
+
+    mProcess->SetParameters(12, 1.05f);
+    const std::pair<ai_real, ai_real> acmr = mProcess->ProcessMesh(mMesh);
+    EXPECT_FLOAT_EQ(2.0f, acmr.first);
+    EXPECT_FLOAT_EQ(2.0f, acmr.second);
+
+    // the triangles are only reordered, the large cube comes first
+    std::vector<std::array<unsigned int, 3>> reordered = GetTriangles();
+    for (unsigned int f = 0; f < 12; ++f) {
+        EXPECT_GE(reordered[f][0], 24u);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    std::sort(reordered.begin(), reordered.end());
+    EXPECT_EQ(triangles, reordered);
+}
+
+TEST_F(utOptimizeOverdraw, skipsNonTrianglesTest) {
+    mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE | aiPrimitiveType_POLYGON;
+    const std::vector<std::array<unsigned int, 3>> triangles = GetTriangles();
+
+    mProcess->SetParameters(12, 1.05f);
+    EXPECT_EQ(0.0f, mProcess->ProcessMesh(mMesh).first);
+    EXPECT_EQ(triangles, GetTriangles());
+}
@@ -0,0 +1,220 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/OptimizeVertexFetch.h"
+#include <assimp/CreateAnimMesh.h>
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/mesh.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+using namespace Assimp;
+
+class utOptimizeVertexFetch : public ::testing::Test {
+public:
+    utOptimizeVertexFetch() :
+            Test(), mProcess(nullptr), mMesh(nullptr), mScene(nullptr) {
+        // empty
+    }
+
+    void SetUp() override {
+        mProcess = new OptimizeVertexFetchProcess;
+
+        // a grid of quads whose vertices are stored in random order, plus one unused vertex
+        constexpr unsigned int Size = 64;
+        std::vector<unsigned int> shuffled(Size * Size);
+        std::iota(shuffled.begin(), shuffled.end(), 0u);
+        std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(42));
+
+        mMesh = new aiMesh();
+        mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mMesh->mNumVertices = Size * Size + 1;
+        mMesh->mVertices = new aiVector3D[mMesh->mNumVertices];
+        mMesh->mNormals = new aiVector3D[mMesh->mNumVertices];
+        mMesh->mTextureCoords[0] = new aiVector3D[mMesh->mNumVertices];
+        mMesh->mNumUVComponents[0] = 2;
+        for (unsigned int y = 0; y < Size; ++y) {
+            for (unsigned int x = 0; x < Size; ++x) {
+                const unsigned int v = shuffled[y * Size + x];
+                mMesh->mVertices[v] = aiVector3D((ai_real)x, (ai_real)y, 0);
+                mMesh->mNormals[v] = aiVector3D(0, 0, 1);
+                mMesh->mTextureCoords[0][v] = aiVector3D((ai_real)x / Size, (ai_real)y / Size, 0);
+            }
+        }
+        mMesh->mVertices[Size * Size] = aiVector3D(-1, -1, -1);
+
+        mMesh->mNumFaces = (Size - 1) * (Size - 1) * 2;
+        mMesh->mFaces = new aiFace[mMesh->mNumFaces];
+        aiFace *face = mMesh->mFaces;
+        for (unsigned int y = 0; y + 1 < Size; ++y) {
+            for (unsigned int x = 0; x + 1 < Size; ++x) {
+                const unsigned int corners[4] = { shuffled[y * Size + x], shuffled[y * Size + x + 1],
+                    shuffled[(y + 1) * Size + x + 1], shuffled[(y + 1) * Size + x] };
+                for (unsigned int t = 0; t < 2; ++t, ++face) {
+                    face->mNumIndices = 3;
+                    face->mIndices = new unsigned int[3]{ corners[0], corners[t + 1], corners[t + 2] };
+                }
+            }
+        }
+
+        // every vertex is weighted by its x coordinate
+        mMesh->mNumBones = 1;
+        mMesh->mBones = new aiBone *[1];
+        mMesh->mBones[0] = new aiBone();
+        mMesh->mBones[0]->mNumWeights = mMesh->mNumVertices;
+        mMesh->mBones[0]->mWeights = new aiVertexWeight[mMesh->mNumVertices];
+        for (unsigned int v = 0; v < mMesh->mNumVertices; ++v) {
+            mMesh->mBones[0]->mWeights[v] = aiVertexWeight(v, mMesh->mVertices[v].x);
+        }
+
+        // the target lifts every vertex by its y coordinate
+        mMesh->mNumAnimMeshes = 1;
+        mMesh->mAnimMeshes = new aiAnimMesh *[1];
+        mMesh->mAnimMeshes[0] = aiCreateAnimMesh(mMesh);
+        for (unsigned int v = 0; v < mMesh->mNumVertices; ++v) {
+            mMesh->mAnimMeshes[0]->mVertices[v].z = mMesh->mVertices[v].y;
+        }
+
+        mScene = new aiScene();
+        mScene->mNumMeshes = 1;
+        mScene->mMeshes = new aiMesh *[1];
+        mScene->mMeshes[0] = mMesh;
+    }
+
+    void TearDown() override {
+        delete mProcess;
+        delete mScene;
+    }
+
+    // Positions of all face corners in order
+    std::vector<aiVector3D> GetCorners() const {
+        std::vector<aiVector3D> corners;
+        for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+            for (unsigned int i = 0; i < mMesh->mFaces[f].mNumIndices; ++i) {
+                corners.push_back(mMesh->mVertices[mMesh->mFaces[f].mIndices[i]]);
+            }
+        }
+        return corners;
+    }
+
+protected:
+    OptimizeVertexFetchProcess *mProcess;
+    aiMesh *mMesh;
+    aiScene *mScene;
+};
+
+TEST_F(utOptimizeVertexFetch, disabledTest) {
+    const std::vector<aiVector3D> vertices(mMesh->mVertices, mMesh->mVertices + mMesh->mNumVertices);
+    mProcess->Execute(mScene);
+    EXPECT_TRUE(std::equal(vertices.begin(), vertices.end(), mMesh->mVertices));
+}
+
+TEST_F(utOptimizeVertexFetch, reorderTest) {
+    const std::vector<aiVector3D> corners = GetCorners();
+
+    const std::pair<ai_real, ai_real> overfetch = mProcess->ProcessMesh(mMesh);
+    EXPECT_GT(overfetch.first, 1.5f);
+    EXPECT_LT(overfetch.second, 1.1f);
+    EXPECT_FLOAT_EQ(overfetch.second, OptimizeVertexFetchProcess::ComputeOverfetch(mMesh));
+
+    // the faces are unchanged and use the vertices in ascending order
+    EXPECT_EQ(corners, GetCorners());
+    unsigned int next = 0;
+    for (unsigned int f = 0; f < mMesh->mNumFaces; ++f) {
+        for (unsigned int i = 0; i < 3; ++i) {
+            const unsigned int v = mMesh->mFaces[f].mIndices[i];
+            EXPECT_LE(v, next);
+            next = std::max(next, v + 1);
+        }
+    }
+    EXPECT_EQ(mMesh->mNumVertices - 1, next);
+    EXPECT_EQ(aiVector3D(-1, -1, -1), mMesh->mVertices[next]);
+
+    // the other channels moved along
+    for (unsigned int v = 0; v < mMesh->mNumVertices; ++v) {
+        const aiVector3D &p = mMesh->mVertices[v];
+        if (v < next) {
+            EXPECT_EQ(aiVector3D(p.x / 64, p.y / 64, 0), mMesh->mTextureCoords[0][v]);
+            EXPECT_EQ(aiVector3D(0, 0, 1), mMesh->mNormals[v]);
+        }
+        EXPECT_EQ(aiVector3D(p.x, p.y, p.y), mMesh->mAnimMeshes[0]->mVertices[v]);
+    }
+    const aiBone *bone = mMesh->mBones[0];
+    for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+        EXPECT_EQ(mMesh->mVertices[bone->mWeights[w].mVertexId].x, bone->mWeights[w].mWeight);
+    }
+}
+
+TEST_F(utOptimizeVertexFetch, alreadyOptimizedTest) {
+    mProcess->ProcessMesh(mMesh);
+    const std::vector<aiVector3D> vertices(mMesh->mVertices, mMesh->mVertices + mMesh->mNumVertices);
+
+    const std::pair<ai_real, ai_real> overfetch = mProcess->ProcessMesh(mMesh);
+    EXPECT_EQ(overfetch.first, overfetch.second);
+    EXPECT_TRUE(std::equal(vertices.begin(), vertices.end(), mMesh->mVertices));
+}
+
+TEST_F(utOptimizeVertexFetch, importTest) {
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_OVERDRAW, true);
+    importer.SetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_VERTEX_FETCH, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj",
+            aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_NE(nullptr, importer.ApplyPostProcessing(aiProcess_ValidateDataStructure));
+
+    for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
+        const aiMesh *mesh = scene->mMeshes[m];
+        unsigned int next = 0;
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            for (unsigned int i = 0; i < mesh->mFaces[f].mNumIndices; ++i) {
+                EXPECT_LE(mesh->mFaces[f].mIndices[i], next);
+                next = std::max(next, mesh->mFaces[f].mIndices[i] + 1);
+            }
+        }
+    }
+}
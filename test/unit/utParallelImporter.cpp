@@ -0,0 +1,124 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include <assimp/ParallelImporter.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <atomic>
+#include <vector>
+
+using namespace ::Assimp;
+
+class ParallelImporterTest : public ::testing::Test {
+    // empty
+};
+
+TEST_F( ParallelImporterTest, numThreadsTest ) {
+    ParallelImporter fixed( 3 );
+    EXPECT_EQ( 3u, fixed.GetNumThreads() );
+
+    ParallelImporter automatic;
+    EXPECT_LE( 1u, automatic.GetNumThreads() );
+}
+
+TEST_F( ParallelImporterTest, readFilesAsyncTest ) {
+    ParallelImporter importer( 2 );
+    std::vector<std::future<ImportResult>> results;
+    results.push_back( importer.ReadFileAsync( ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj", aiProcess_Triangulate ) );
+    results.push_back( importer.ReadFileAsync( ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_Triangulate ) );
+    results.push_back( importer.ReadFileAsync( ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl", 0 ) );
+    results.push_back( importer.ReadFileAsync( ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj", aiProcess_Triangulate ) );
+
+    for ( auto &result : results ) {
+        ImportResult res = result.get();
+        ASSERT_NE( nullptr, res.mScene ) << res.mFile;
+        EXPECT_TRUE( res.mErrorString.empty() );
+        EXPECT_LT( 0u, res.mScene->mNumMeshes );
+    }
+}
+
+TEST_F( ParallelImporterTest, perFileErrorTest ) {
+    ParallelImporter importer( 2 );
+    std::future<ImportResult> missing = importer.ReadFileAsync( ASSIMP_TEST_MODELS_DIR "/OBJ/does_not_exist.obj", 0 );
+    std::future<ImportResult> box = importer.ReadFileAsync( ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj", 0 );
+
+    ImportResult missingResult = missing.get();
+    EXPECT_EQ( nullptr, missingResult.mScene );
+    EXPECT_FALSE( missingResult.mErrorString.empty() );
+
+    ImportResult boxResult = box.get();
+    EXPECT_NE( nullptr, boxResult.mScene );
+}
+
+TEST_F( ParallelImporterTest, callbackTest ) {
+    std::atomic<int> numScenes( 0 );
+    {
+        ParallelImporter importer( 2 );
+        for ( int i = 0; i < 4; ++i ) {
+            importer.ReadFileAsync( ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj", 0, [&numScenes]( ImportResult &&result ) {
+                if ( result.mScene ) {
+                    ++numScenes;
+                }
+            } );
+        }
+        importer.WaitAll();
+        EXPECT_EQ( 4, numScenes.load() );
+    }
+}
+
+TEST_F( ParallelImporterTest, propertiesAreCopiedPerRequestTest ) {
+    ParallelImporter importer( 1 );
+    importer.SetPropertyInteger( AI_CONFIG_PP_RVC_FLAGS, aiComponent_NORMALS );
+    std::future<ImportResult> withoutNormals = importer.ReadFileAsync( ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_RemoveComponent );
+    importer.SetPropertyInteger( AI_CONFIG_PP_RVC_FLAGS, 0 );
+    std::future<ImportResult> withNormals = importer.ReadFileAsync( ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_RemoveComponent );
+
+    ImportResult first = withoutNormals.get();
+    ImportResult second = withNormals.get();
+    ASSERT_NE( nullptr, first.mScene );
+    ASSERT_NE( nullptr, second.mScene );
+    EXPECT_FALSE( first.mScene->mMeshes[0]->HasNormals() );
+    EXPECT_TRUE( second.mScene->mMeshes[0]->HasNormals() );
+}
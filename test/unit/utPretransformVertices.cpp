@@ -41,8 +41,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include "PostProcessing/PretransformVertices.h"
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
 #include <assimp/scene.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace Assimp;
 
@@ -155,3 +160,34 @@ TEST_F(PretransformVerticesTest, testProcessKeepHierarchy) {
     EXPECT_EQ(5U, mScene->mNumMaterials);
     EXPECT_EQ(49U, mScene->mNumMeshes); // see note on mesh 12 above
 }
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(PretransformVerticesTest, testNormalize) {
+    Importer plainImporter, normalizeImporter;
+    normalizeImporter.SetPropertyBool(AI_CONFIG_PP_PTV_NORMALIZE, true);
+    const aiScene *plain = plainImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_PreTransformVertices);
+    const aiScene *normalized = normalizeImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_PreTransformVertices);
+    ASSERT_NE(nullptr, plain);
+    ASSERT_NE(nullptr, normalized);
+    ASSERT_EQ(plain->mNumMeshes, normalized->mNumMeshes);
+
+    aiVector3D min = plain->mMeshes[0]->mVertices[0], max = min;
+    for (unsigned int a = 0; a < plain->mNumMeshes; ++a) {
+        for (unsigned int i = 0; i < plain->mMeshes[a]->mNumVertices; ++i) {
+            const aiVector3D &v = plain->mMeshes[a]->mVertices[i];
+            min = aiVector3D(std::min(min.x, v.x), std::min(min.y, v.y), std::min(min.z, v.z));
+            max = aiVector3D(std::max(max.x, v.x), std::max(max.y, v.y), std::max(max.z, v.z));
+        }
+    }
+    aiVector3D d = max - min;
+    const ai_real div = std::max(d.x, std::max(d.y, d.z)) * ai_real(0.5);
+    d = min + d * ai_real(0.5);
+
+    // the vertices are moved to the center and scaled with exactly this arithmetic
+    for (unsigned int a = 0; a < plain->mNumMeshes; ++a) {
+        ASSERT_EQ(plain->mMeshes[a]->mNumVertices, normalized->mMeshes[a]->mNumVertices);
+        for (unsigned int i = 0; i < plain->mMeshes[a]->mNumVertices; ++i) {
+            EXPECT_EQ((plain->mMeshes[a]->mVertices[i] - d) / div, normalized->mMeshes[a]->mVertices[i]);
+        }
+    }
+}
@@ -42,6 +42,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UTLogStream.h"
 #include <assimp/Profiler.h>
 #include <assimp/DefaultLogger.hpp>
+#include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <sstream>
 
 using namespace ::Assimp;
 using namespace ::Assimp::Profiling;
@@ -61,3 +67,78 @@ TEST_F( utProfiler, addRegion_success ) {
     }
     myProfiler.EndRegion( "t1" );
 }
+
+TEST_F(utProfiler, nestedRegionsTest) {
+    Profiler profiler;
+    profiler.BeginRegion("outer");
+    profiler.BeginRegion("inner");
+    profiler.EndRegion("inner");
+    profiler.BeginRegion("inner");
+    profiler.BeginRegion("leaf");
+    // closing the parent closes the children still open
+    profiler.EndRegion("outer");
+    // unknown regions are ignored
+    profiler.EndRegion("unknown");
+
+    const ProfileRegion *outer = profiler.FindRegion("outer");
+    ASSERT_NE(nullptr, outer);
+    EXPECT_EQ(2u, outer->mChildren.size());
+    EXPECT_GE(outer->mWallTime, 0.0);
+    EXPECT_NE(nullptr, profiler.FindRegion("outer/inner/leaf"));
+    EXPECT_EQ(nullptr, profiler.FindRegion("outer/leaf"));
+    EXPECT_EQ(nullptr, profiler.FindRegion("unknown"));
+}
+
+TEST_F(utProfiler, scopedRegionAcceptsNullTest) {
+    ScopedRegion noop(nullptr, "region");
+
+    Profiler profiler;
+    {
+        ScopedRegion region(&profiler, "region");
+    }
+    EXPECT_NE(nullptr, profiler.FindRegion("region"));
+}
+
+TEST_F(utProfiler, importProfileTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/box.fbx", aiProcess_Triangulate);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(nullptr, importer.GetProfile());
+
+    importer.SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
+    scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/box.fbx", aiProcess_Triangulate);
+    ASSERT_NE(nullptr, scene);
+
+    const Profiler *profiler = importer.GetProfile();
+    ASSERT_NE(nullptr, profiler);
+    EXPECT_NE(nullptr, profiler->FindRegion("total/detect"));
+    EXPECT_NE(nullptr, profiler->FindRegion("total/import/tokenize"));
+    EXPECT_NE(nullptr, profiler->FindRegion("total/import/convert"));
+    EXPECT_NE(nullptr, profiler->FindRegion("total/postprocess/Triangulate"));
+
+    std::ostringstream trace;
+    profiler->WriteChromeTrace(trace);
+    EXPECT_NE(std::string::npos, trace.str().find("\"traceEvents\""));
+    EXPECT_NE(std::string::npos, trace.str().find("\"Triangulate\""));
+}
+
+TEST_F(utProfiler, exportProfileTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj", 0);
+    ASSERT_NE(nullptr, scene);
+
+    ExportProperties properties;
+    properties.SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
+    Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "obj", aiProcess_Triangulate, &properties);
+    ASSERT_NE(nullptr, blob);
+
+    const Profiler *profiler = exporter.GetProfile();
+    ASSERT_NE(nullptr, profiler);
+    EXPECT_NE(nullptr, profiler->FindRegion("export/copy"));
+    EXPECT_NE(nullptr, profiler->FindRegion("export/postprocess/Triangulate"));
+    EXPECT_NE(nullptr, profiler->FindRegion("export/write"));
+
+    exporter.ExportToBlob(scene, "obj");
+    EXPECT_EQ(nullptr, exporter.GetProfile());
+}
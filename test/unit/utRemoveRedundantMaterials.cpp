@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "UnitTestPCH.h"
 
+#include "Common/ThreadPool.h"
 #include "Material/MaterialSystem.h"
 #include "PostProcessing/RemoveRedundantMaterials.h"
 #include <assimp/scene.h>
@@ -175,3 +176,51 @@ TEST_F(RemoveRedundantMatsTest, testRedundantMaterialsWithExcludeList) {
     EXPECT_EQ(AI_SUCCESS, aiGetMaterialString(pcScene1->mMaterials[3], AI_MATKEY_NAME, &sName));
     EXPECT_STREQ("Complex material name", sName.data);
 }
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(RemoveRedundantMatsTest, testEqualHashesDifferentMaterials) {
+    // the same bytes stored with another type hash alike, as the hash ignores the
+    // property type, but they are not the same material
+    const int value = 1;
+    aiMaterial *asInt = new aiMaterial(), *asBuffer = new aiMaterial();
+    asInt->AddProperty(&value, 1, "$mat.test", 0, 0);
+    asBuffer->AddBinaryProperty(&value, sizeof(value), "$mat.test", 0, 0, aiPTI_Buffer);
+
+    delete pcScene1->mMaterials[2];
+    pcScene1->mMaterials[2] = asInt;
+    delete pcScene1->mMaterials[3];
+    pcScene1->mMaterials[3] = asBuffer;
+
+    piProcess->SetFixedMaterialsString();
+    piProcess->Execute(pcScene1);
+    EXPECT_EQ(5U, pcScene1->mNumMaterials);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(RemoveRedundantMatsTest, testManyMaterialsOnThreadPool) {
+    // enough materials to hash them on the pool, each of the first three is repeated
+    const unsigned int num = 3000;
+    aiScene *scene = new aiScene();
+    scene->mNumMaterials = num;
+    scene->mMaterials = new aiMaterial *[num];
+    scene->mNumMeshes = num;
+    scene->mMeshes = new aiMesh *[num];
+    aiMaterial *(*const create[3])() = { getUniqueMaterial1, getUniqueMaterial2, getUniqueMaterial3 };
+    for (unsigned int i = 0; i < num; ++i) {
+        scene->mMaterials[i] = create[i % 3]();
+        scene->mMeshes[i] = new aiMesh();
+        scene->mMeshes[i]->mMaterialIndex = i;
+    }
+
+    ThreadPool pool(4);
+    piProcess->SetFixedMaterialsString();
+    piProcess->SetThreadPool(&pool);
+    piProcess->Execute(scene);
+    piProcess->SetThreadPool(nullptr);
+
+    EXPECT_EQ(3U, scene->mNumMaterials);
+    for (unsigned int i = 0; i < num; ++i) {
+        EXPECT_EQ(i % 3, scene->mMeshes[i]->mMaterialIndex);
+    }
+    delete scene;
+}
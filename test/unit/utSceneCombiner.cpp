@@ -40,7 +40,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "UnitTestPCH.h"
 #include <assimp/SceneCombiner.h>
+#include <assimp/material.h>
 #include <assimp/mesh.h>
+#include <assimp/scene.h>
 #include <memory>
 
 using namespace ::Assimp;
@@ -126,3 +128,45 @@ TEST_F(utSceneCombiner, CopyMeshDoesNotAliasSparseOrEmptyChannels) {
         delete src;
     }
 }
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utSceneCombiner, MergeScenesDeduplicatesMaterials) {
+    // two scenes with one mesh each, their first materials differ only by name
+    auto createScene = [](const char *name, float shininess) {
+        aiScene *scene = new aiScene();
+        scene->mRootNode = new aiNode();
+        scene->mNumMaterials = 2;
+        scene->mMaterials = new aiMaterial *[2];
+        for (unsigned int i = 0; i < 2; ++i) {
+            scene->mMaterials[i] = new aiMaterial();
+            const aiString matName(name);
+            scene->mMaterials[i]->AddProperty(&matName, AI_MATKEY_NAME);
+            const float value = i == 0 ? 1.f : shininess;
+            scene->mMaterials[i]->AddProperty(&value, 1, AI_MATKEY_SHININESS);
+        }
+        scene->mNumMeshes = 2;
+        scene->mMeshes = new aiMesh *[2];
+        for (unsigned int i = 0; i < 2; ++i) {
+            scene->mMeshes[i] = new aiMesh();
+            scene->mMeshes[i]->mMaterialIndex = i;
+        }
+        return scene;
+    };
+
+    std::vector<aiScene *> src = { createScene("a", 2.f), createScene("b", 3.f) };
+    aiScene *dest = nullptr;
+    SceneCombiner::MergeScenes(&dest, src, AI_INT_MERGE_SCENE_DEDUP_MATERIALS);
+    ASSERT_NE(nullptr, dest);
+    std::unique_ptr<aiScene> guard(dest);
+
+    ASSERT_EQ(3u, dest->mNumMaterials);
+    ASSERT_EQ(4u, dest->mNumMeshes);
+    EXPECT_EQ(0u, dest->mMeshes[0]->mMaterialIndex);
+    EXPECT_EQ(1u, dest->mMeshes[1]->mMaterialIndex);
+    EXPECT_EQ(0u, dest->mMeshes[2]->mMaterialIndex);
+    EXPECT_EQ(2u, dest->mMeshes[3]->mMaterialIndex);
+
+    float shininess = 0.f;
+    EXPECT_EQ(AI_SUCCESS, dest->mMaterials[2]->Get(AI_MATKEY_SHININESS, shininess));
+    EXPECT_EQ(3.f, shininess);
+}
@@ -43,11 +43,54 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "Common/simd.h"
 
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
 using namespace ::Assimp;
 
 class utSimd : public ::testing::Test {
 protected:
-    // empty
+    void SetUp() override {
+        mDefaultSet = SIMD::GetInstructionSet();
+    }
+
+    void TearDown() override {
+        SIMD::SetInstructionSet(mDefaultSet);
+    }
+
+    // All instruction sets this machine can run, the scalar reference included.
+    static std::vector<SIMD::InstructionSet> SupportedSets() {
+        std::vector<SIMD::InstructionSet> sets;
+        for (SIMD::InstructionSet set : { SIMD::InstructionSet::Scalar, SIMD::InstructionSet::SSE2,
+                     SIMD::InstructionSet::AVX, SIMD::InstructionSet::NEON }) {
+            if (SIMD::IsInstructionSetSupported(set)) {
+                sets.push_back(set);
+            }
+        }
+        return sets;
+    }
+
+    static std::vector<aiVector3D> RandomVectors(size_t count, unsigned int seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(-100.f, 100.f);
+        std::vector<aiVector3D> result(count);
+        for (aiVector3D &v : result) {
+            v.Set(dist(rng), dist(rng), dist(rng));
+        }
+        return result;
+    }
+
+    static void ExpectEqual(const aiVector3D &expected, const aiVector3D &actual) {
+        EXPECT_FLOAT_EQ(expected.x, actual.x);
+        EXPECT_FLOAT_EQ(expected.y, actual.y);
+        EXPECT_FLOAT_EQ(expected.z, actual.z);
+    }
+
+    // Sizes around the vector widths, to cover the scalar tails as well.
+    const size_t mCounts[13] = { 0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 100, 1001 };
+    SIMD::InstructionSet mDefaultSet = SIMD::InstructionSet::Scalar;
 };
 
 TEST_F( utSimd, SSE2SupportedTest ) {
@@ -60,3 +103,182 @@ TEST_F( utSimd, SSE2SupportedTest ) {
         std::cout << "Not supported" << std::endl;
     }
 }
+
+TEST_F( utSimd, selectInstructionSetTest ) {
+    EXPECT_TRUE(SIMD::IsInstructionSetSupported(SIMD::InstructionSet::Scalar));
+    for (SIMD::InstructionSet set : SupportedSets()) {
+        EXPECT_EQ(set, SIMD::SetInstructionSet(set));
+        EXPECT_EQ(set, SIMD::GetInstructionSet());
+        std::cout << SIMD::GetInstructionSetName(set) << " supported" << std::endl;
+    }
+#if defined(__x86_64__) || defined(_M_X64)
+    EXPECT_FALSE(SIMD::IsInstructionSetSupported(SIMD::InstructionSet::NEON));
+    EXPECT_EQ(SIMD::InstructionSet::Scalar, SIMD::SetInstructionSet(SIMD::InstructionSet::NEON));
+#endif
+}
+
+TEST_F( utSimd, transformPositionsTest ) {
+    const aiMatrix4x4 mat(aiVector3D(2.f, 0.5f, 3.f), aiQuaternion(0.3f, -1.2f, 2.1f), aiVector3D(10.f, -20.f, 5.f));
+
+    for (SIMD::InstructionSet set : SupportedSets()) {
+        SIMD::SetInstructionSet(set);
+        for (size_t count : mCounts) {
+            const std::vector<aiVector3D> in = RandomVectors(count, 1);
+            std::vector<aiVector3D> out(count);
+            SIMD::TransformPositions(mat, in.data(), out.data(), count);
+            for (size_t i = 0; i < count; ++i) {
+                ExpectEqual(mat * in[i], out[i]);
+            }
+
+            // in place
+            std::vector<aiVector3D> inPlace = in;
+            SIMD::TransformPositions(mat, inPlace.data(), inPlace.data(), count);
+            EXPECT_EQ(out, inPlace);
+        }
+    }
+}
+
+TEST_F( utSimd, transformDirectionsTest ) {
+    const aiMatrix3x3 mat = aiMatrix3x3(aiMatrix4x4(aiVector3D(2.f, 0.5f, 3.f),
+            aiQuaternion(0.3f, -1.2f, 2.1f), aiVector3D())).Inverse().Transpose();
+
+    for (SIMD::InstructionSet set : SupportedSets()) {
+        SIMD::SetInstructionSet(set);
+        for (size_t count : mCounts) {
+            std::vector<aiVector3D> in = RandomVectors(count, 2);
+            if (count > 2) {
+                // must survive normalization unchanged
+                in[2] = aiVector3D();
+            }
+            std::vector<aiVector3D> out(count), normalized(count);
+            SIMD::TransformDirections(mat, in.data(), out.data(), count, false);
+            SIMD::TransformDirections(mat, in.data(), normalized.data(), count, true);
+            for (size_t i = 0; i < count; ++i) {
+                aiVector3D expected = mat * in[i];
+                ExpectEqual(expected, out[i]);
+                ExpectEqual(expected.Normalize(), normalized[i]);
+            }
+        }
+    }
+}
+
+TEST_F( utSimd, scaleVectorsTest ) {
+    const aiVector3D scale(1.f, 2.5f, -1.f);
+    for (SIMD::InstructionSet set : SupportedSets()) {
+        SIMD::SetInstructionSet(set);
+        for (size_t count : mCounts) {
+            const std::vector<aiVector3D> in = RandomVectors(count, 3);
+            std::vector<aiVector3D> out = in;
+            SIMD::ScaleVectors(out.data(), count, scale);
+            for (size_t i = 0; i < count; ++i) {
+                ExpectEqual(aiVector3D(in[i].x * scale.x, in[i].y * scale.y, in[i].z * scale.z), out[i]);
+            }
+        }
+    }
+}
+
+TEST_F( utSimd, extendBoundsTest ) {
+    constexpr float kMax = std::numeric_limits<float>::max();
+    for (SIMD::InstructionSet set : SupportedSets()) {
+        SIMD::SetInstructionSet(set);
+        for (size_t count : mCounts) {
+            std::vector<aiVector3D> in = RandomVectors(count, 4);
+            if (count > 5) {
+                in[5].y = std::numeric_limits<float>::quiet_NaN();
+            }
+            aiVector3D expectedMin(kMax, kMax, kMax), expectedMax(-kMax, -kMax, -kMax);
+            for (const aiVector3D &v : in) {
+                for (unsigned int c = 0; c < 3; ++c) {
+                    if (v[c] < expectedMin[c]) {
+                        expectedMin[c] = v[c];
+                    }
+                    if (v[c] > expectedMax[c]) {
+                        expectedMax[c] = v[c];
+                    }
+                }
+            }
+
+            aiVector3D min(kMax, kMax, kMax), max(-kMax, -kMax, -kMax);
+            SIMD::ExtendBounds(in.data(), count, min, max);
+            EXPECT_EQ(expectedMin, min);
+            EXPECT_EQ(expectedMax, max);
+        }
+    }
+}
+
+TEST_F( utSimd, compareVectorsTest ) {
+    const float epsilon = 1e-4f;
+    for (SIMD::InstructionSet set : SupportedSets()) {
+        SIMD::SetInstructionSet(set);
+        for (size_t count : mCounts) {
+            const std::vector<aiVector3D> a = RandomVectors(count, 5);
+            std::vector<aiVector3D> b = a;
+            EXPECT_TRUE(SIMD::CompareVectors(a.data(), b.data(), count, epsilon));
+
+            // a difference anywhere, in the vector blocks as well as in the tail
+            for (size_t i = 0; i < count; ++i) {
+                b[i].z += 0.5f;
+                EXPECT_FALSE(SIMD::CompareVectors(a.data(), b.data(), count, epsilon));
+                b[i] = a[i];
+                b[i].x += 0.001f;
+                EXPECT_TRUE(SIMD::CompareVectors(a.data(), b.data(), count, 0.1f));
+                b[i] = a[i];
+            }
+        }
+    }
+}
+
+TEST_F( utSimd, interpolateLinearTest ) {
+    for (SIMD::InstructionSet set : SupportedSets()) {
+        SIMD::SetInstructionSet(set);
+        for (size_t count : mCounts) {
+            const std::vector<aiVector3D> values = RandomVectors(count, 6);
+            std::vector<ai_real> a(count), b(count), num(count), den(count), out(count);
+            for (size_t i = 0; i < count; ++i) {
+                a[i] = values[i].x;
+                b[i] = values[i].y;
+                den[i] = static_cast<ai_real>(i % 7) * 100.f;
+                num[i] = den[i] * std::fabs(values[i].z) / 100.f;
+            }
+            SIMD::InterpolateLinear(a.data(), b.data(), num.data(), den.data(), out.data(), count);
+            for (size_t i = 0; i < count; ++i) {
+                const ai_real factor = den[i] == 0.f ? 0.f : num[i] / den[i];
+                EXPECT_EQ(a[i] + (b[i] - a[i]) * factor, out[i]);
+            }
+        }
+    }
+}
+
+TEST_F( utSimd, interpolateLinearZeroSpanTest ) {
+    // a zero span gives factor 0 whatever the numerator, as in the scalar code
+    const ai_real inf = std::numeric_limits<ai_real>::infinity(), nan = std::numeric_limits<ai_real>::quiet_NaN();
+    const ai_real num[16] = { inf, -inf, nan, 1.f, inf, -inf, nan, 0.f, inf, nan, 2.f, -inf, 0.f, nan, inf, 1.f };
+    const ai_real den[16] = { 0.f, 0.f, 0.f, 0.f, -0.f, -0.f, -0.f, 0.f, 2.f, 2.f, 0.f, 4.f, 0.f, 0.f, 0.f, 2.f };
+    std::vector<ai_real> a(16), b(16);
+    for (size_t i = 0; i < 16; ++i) {
+        a[i] = static_cast<ai_real>(i);
+        b[i] = static_cast<ai_real>(2 * i + 1);
+    }
+
+    SIMD::SetInstructionSet(SIMD::InstructionSet::Scalar);
+    std::vector<ai_real> expected(16);
+    SIMD::InterpolateLinear(a.data(), b.data(), num, den, expected.data(), 16);
+    for (size_t i = 0; i < 16; ++i) {
+        if (den[i] == 0.f) {
+            EXPECT_EQ(a[i], expected[i]);
+        }
+    }
+
+    for (SIMD::InstructionSet set : SupportedSets()) {
+        SIMD::SetInstructionSet(set);
+        std::vector<ai_real> out(16);
+        SIMD::InterpolateLinear(a.data(), b.data(), num, den, out.data(), 16);
+        for (size_t i = 0; i < 16; ++i) {
+            if (std::isnan(expected[i])) {
+                EXPECT_TRUE(std::isnan(out[i])) << SIMD::GetInstructionSetName(set) << " " << i;
+            } else {
+                EXPECT_EQ(expected[i], out[i]) << SIMD::GetInstructionSetName(set) << " " << i;
+            }
+        }
+    }
+}
@@ -57,15 +57,19 @@ TEST_F( utVersion, aiGetVersionMajorTest ) {
 }
 
 TEST_F( utVersion, aiGetVersionMinorTest ) {
-    EXPECT_EQ(aiGetVersionMinor(), 0U);
+    EXPECT_EQ(aiGetVersionMinor(), 1U);
 }
 
 TEST_F( utVersion, aiGetVersionPatchTest ) {
-    EXPECT_EQ(aiGetVersionPatch(), 5U );
+    EXPECT_EQ(aiGetVersionPatch(), 0U );
 }
 
 TEST_F( utVersion, aiGetCompileFlagsTest ) {
-    EXPECT_NE( aiGetCompileFlags(), 0U );
+    const unsigned int flags = aiGetCompileFlags();
+    EXPECT_NE( flags, 0U );
+
+    // a build is either single- or multithreaded
+    EXPECT_NE( 0U == ( flags & ASSIMP_CFLAGS_SINGLETHREADED ), 0U == ( flags & ASSIMP_CFLAGS_MULTITHREADED ) );
 }
 
 TEST_F( utVersion, aiGetVersionRevisionTest ) {
@@ -53,6 +53,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <rapidjson/schema.h>
 
 #include <array>
+#include <fstream>
 
 #include <assimp/material.h>
 #include <assimp/GltfMaterial.h>
@@ -154,6 +155,56 @@ TEST_F(utglTF2ImportExport, importBinaryglTF2FromFileTest) {
     EXPECT_TRUE(binaryImporterTest());
 }
 
+TEST_F(utglTF2ImportExport, importStreamedBuffersTest) {
+    // Reading buffer views on demand must not change the imported data
+    const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine.glb",
+        ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb",
+        ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf",
+        ASSIMP_TEST_MODELS_DIR "/glTF2/simple_skin/quad_skin.glb"
+    };
+    for (const char *file : files) {
+        SCOPED_TRACE(file);
+        Assimp::Importer loaded;
+        const aiScene *expected = loaded.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(expected, nullptr);
+
+        Assimp::Importer streamed;
+        streamed.SetPropertyBool(AI_CONFIG_IMPORT_GLTF_STREAM_BUFFERS, true);
+        const aiScene *scene = streamed.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(scene, nullptr);
+
+        ASSERT_EQ(scene->mNumMeshes, expected->mNumMeshes);
+        for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
+            const aiMesh *mesh = scene->mMeshes[m];
+            const aiMesh *expectedMesh = expected->mMeshes[m];
+            ASSERT_EQ(mesh->mNumVertices, expectedMesh->mNumVertices);
+            ASSERT_EQ(mesh->mNumFaces, expectedMesh->mNumFaces);
+            ASSERT_EQ(mesh->mNumBones, expectedMesh->mNumBones);
+            EXPECT_EQ(0, memcmp(mesh->mVertices, expectedMesh->mVertices, mesh->mNumVertices * sizeof(aiVector3D)));
+            ASSERT_EQ(mesh->HasNormals(), expectedMesh->HasNormals());
+            if (mesh->HasNormals()) {
+                EXPECT_EQ(0, memcmp(mesh->mNormals, expectedMesh->mNormals, mesh->mNumVertices * sizeof(aiVector3D)));
+            }
+            for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+                ASSERT_EQ(mesh->mFaces[f].mNumIndices, expectedMesh->mFaces[f].mNumIndices);
+                EXPECT_EQ(0, memcmp(mesh->mFaces[f].mIndices, expectedMesh->mFaces[f].mIndices, mesh->mFaces[f].mNumIndices * sizeof(unsigned int)));
+            }
+            for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+                ASSERT_EQ(mesh->mBones[b]->mNumWeights, expectedMesh->mBones[b]->mNumWeights);
+                EXPECT_EQ(mesh->mBones[b]->mOffsetMatrix, expectedMesh->mBones[b]->mOffsetMatrix);
+            }
+        }
+
+        ASSERT_EQ(scene->mNumTextures, expected->mNumTextures);
+        for (unsigned int t = 0; t < scene->mNumTextures; ++t) {
+            ASSERT_EQ(scene->mTextures[t]->mWidth, expected->mTextures[t]->mWidth);
+            EXPECT_EQ(0, memcmp(scene->mTextures[t]->pcData, expected->mTextures[t]->pcData, scene->mTextures[t]->mWidth));
+        }
+        EXPECT_EQ(scene->mNumAnimations, expected->mNumAnimations);
+    }
+}
+
 TEST_F(utglTF2ImportExport, importglTF2_KHR_materials_pbrSpecularGlossiness) {
     EXPECT_TRUE(importerMatTest(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-pbrSpecularGlossiness/BoxTextured.gltf", true, true));
 }
@@ -866,6 +917,300 @@ TEST_F(utglTF2ImportExport, allIndicesOutOfRange) {
     ASSERT_NE(error.find("Mesh \"Mesh\" has no faces"), std::string::npos);
 }
 
+TEST_F(utglTF2ImportExport, importQuantizedAttributes) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/KHR_mesh_quantization/QuantizedTriangle.gltf", aiProcess_ValidateDataStructure);
+    ASSERT_NE(scene, nullptr);
+    ASSERT_EQ(scene->mNumMeshes, 1u);
+    const aiMesh *mesh = scene->mMeshes[0];
+    ASSERT_EQ(mesh->mNumVertices, 3u);
+    ASSERT_EQ(mesh->mNumFaces, 1u);
+    EXPECT_EQ(mesh->mFaces[0].mIndices[0], 0u);
+    EXPECT_EQ(mesh->mFaces[0].mIndices[1], 1u);
+    EXPECT_EQ(mesh->mFaces[0].mIndices[2], 2u);
+
+    // Non-normalized shorts in a padded stream keep their integer value
+    EXPECT_EQ(mesh->mVertices[1], aiVector3D(100, 0, 0));
+    EXPECT_EQ(mesh->mVertices[2], aiVector3D(0, 200, -300));
+
+    // Normalized signed bytes map to [-1, 1], with -128 clamped to -1
+    ASSERT_TRUE(mesh->HasNormals());
+    EXPECT_EQ(mesh->mNormals[0], aiVector3D(0, 0, 1));
+    EXPECT_EQ(mesh->mNormals[2], aiVector3D(0, -1, 0));
+
+    // Normalized unsigned shorts map to [0, 1], before the V flip
+    ASSERT_TRUE(mesh->HasTextureCoords(0));
+    EXPECT_EQ(mesh->mNumUVComponents[0], 2u);
+    EXPECT_EQ(mesh->mTextureCoords[0][1], aiVector3D(1, 1, 0));
+    EXPECT_EQ(mesh->mTextureCoords[0][2], aiVector3D(0, 0, 0));
+
+    ASSERT_TRUE(mesh->HasVertexColors(0));
+    EXPECT_EQ(mesh->mColors[0][0], aiColor4D(1, 0, 0, 1));
+    EXPECT_FLOAT_EQ(mesh->mColors[0][2].b, 1.0f);
+    EXPECT_FLOAT_EQ(mesh->mColors[0][2].a, 0.2f);
+}
+
+TEST_F(utglTF2ImportExport, importMeshoptCompressed) {
+    // The decoded views must not depend on whether they are decoded concurrently or streamed
+    for (int variant = 0; variant < 3; ++variant) {
+        SCOPED_TRACE(variant);
+        Assimp::Importer importer;
+        if (variant > 0) {
+            importer.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 4);
+        }
+        importer.SetPropertyBool(AI_CONFIG_IMPORT_GLTF_STREAM_BUFFERS, variant == 2);
+        const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/EXT_meshopt_compression/MeshoptGrid.gltf", aiProcess_ValidateDataStructure);
+        ASSERT_NE(scene, nullptr);
+        ASSERT_EQ(scene->mNumMeshes, 1u);
+        const aiMesh *mesh = scene->mMeshes[0];
+        ASSERT_EQ(mesh->mNumVertices, 16u);
+        ASSERT_EQ(mesh->mNumFaces, 18u);
+        ASSERT_TRUE(mesh->HasTextureCoords(0));
+
+        // The exponential filter keeps 12 fractional bits
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            EXPECT_NEAR(mesh->mTextureCoords[0][i].x, mesh->mVertices[i].x / 3, 1e-3);
+            EXPECT_NEAR(mesh->mTextureCoords[0][i].y, 1 - mesh->mVertices[i].y / 3, 1e-3);
+        }
+
+        // A 4x4 grid of vertices with two triangles per cell
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            const aiVector3D corner(static_cast<float>(f % 6 / 2), static_cast<float>(f / 6), 0);
+            const aiFace &face = mesh->mFaces[f];
+            ASSERT_EQ(face.mNumIndices, 3u);
+            EXPECT_EQ(mesh->mVertices[face.mIndices[0]], corner);
+            EXPECT_EQ(mesh->mVertices[face.mIndices[1]], corner + (f % 2 ? aiVector3D(1, 1, 0) : aiVector3D(1, 0, 0)));
+            EXPECT_EQ(mesh->mVertices[face.mIndices[2]], corner + (f % 2 ? aiVector3D(0, 1, 0) : aiVector3D(1, 1, 0)));
+        }
+    }
+}
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+
+namespace {
+
+size_t GetFileSize(const char *path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    return file ? static_cast<size_t>(file.tellg()) : 0;
+}
+
+// Compares the face corners of two meshes, the vertices may be reordered and the faces rotated
+void ExpectSameTriangles(const aiMesh *expected, const aiMesh *actual, float positionEps, float normalEps, float uvEps) {
+    ASSERT_EQ(expected->mNumFaces, actual->mNumFaces);
+    ASSERT_EQ(expected->HasNormals(), actual->HasNormals());
+    ASSERT_EQ(expected->HasTextureCoords(0), actual->HasTextureCoords(0));
+    for (unsigned int f = 0; f < expected->mNumFaces; ++f) {
+        const aiFace &expectedFace = expected->mFaces[f];
+        const aiFace &actualFace = actual->mFaces[f];
+        ASSERT_EQ(expectedFace.mNumIndices, actualFace.mNumIndices);
+        unsigned int rotation = 0;
+        while (rotation < actualFace.mNumIndices &&
+                (expected->mVertices[expectedFace.mIndices[0]] - actual->mVertices[actualFace.mIndices[rotation]]).Length() > positionEps) {
+            ++rotation;
+        }
+        ASSERT_LT(rotation, actualFace.mNumIndices) << "face " << f;
+        for (unsigned int j = 0; j < expectedFace.mNumIndices; ++j) {
+            const unsigned int e = expectedFace.mIndices[j];
+            const unsigned int a = actualFace.mIndices[(j + rotation) % actualFace.mNumIndices];
+            EXPECT_NEAR(0, (expected->mVertices[e] - actual->mVertices[a]).Length(), positionEps);
+            if (expected->HasNormals()) {
+                EXPECT_NEAR(0, (expected->mNormals[e] - actual->mNormals[a]).Length(), normalEps);
+            }
+            if (expected->HasTextureCoords(0)) {
+                EXPECT_NEAR(0, (expected->mTextureCoords[0][e] - actual->mTextureCoords[0][a]).Length(), uvEps);
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST_F(utglTF2ImportExport, exportCompressedMeshes) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb", aiProcess_ValidateDataStructure);
+    ASSERT_NE(scene, nullptr);
+
+    Assimp::Exporter exporter;
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured_plain_out.glb"));
+
+    Assimp::ExportProperties meshopt;
+    meshopt.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_MESHOPT_COMPRESSION, true);
+    meshopt.SetPropertyInteger(AI_CONFIG_EXPORT_NUM_THREADS, 4);
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured_meshopt_out.glb", 0u, &meshopt));
+
+    Assimp::ExportProperties quantized(meshopt);
+    quantized.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_QUANTIZE_MESHES, true);
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured_quantized_out.glb", 0u, &quantized));
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "gltf2", ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured_quantized_out.gltf", 0u, &quantized));
+
+    Assimp::Importer plainImporter;
+    const aiScene *plain = plainImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured_plain_out.glb",
+            aiProcess_ValidateDataStructure | aiProcess_PreTransformVertices);
+    ASSERT_NE(plain, nullptr);
+    ASSERT_EQ(plain->mNumMeshes, 1u);
+
+    // meshopt compression is lossless
+    Assimp::Importer meshoptImporter;
+    const aiScene *compressed = meshoptImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured_meshopt_out.glb",
+            aiProcess_ValidateDataStructure | aiProcess_PreTransformVertices);
+    ASSERT_NE(compressed, nullptr);
+    ASSERT_EQ(compressed->mNumMeshes, 1u);
+    ExpectSameTriangles(plain->mMeshes[0], compressed->mMeshes[0], 0, 0, 0);
+
+    // the node transforms dequantize the positions
+    for (const char *path : { ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured_quantized_out.glb",
+                 ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured_quantized_out.gltf" }) {
+        SCOPED_TRACE(path);
+        Assimp::Importer quantizedImporter;
+        const aiScene *imported = quantizedImporter.ReadFile(path, aiProcess_ValidateDataStructure | aiProcess_PreTransformVertices);
+        ASSERT_NE(imported, nullptr);
+        ASSERT_EQ(imported->mNumMeshes, 1u);
+        ExpectSameTriangles(plain->mMeshes[0], imported->mMeshes[0], 1e-4f, 1e-2f, 1e-4f);
+    }
+}
+
+TEST_F(utglTF2ImportExport, exportCompressedMeshesSize) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine.glb", aiProcess_ValidateDataStructure);
+    ASSERT_NE(scene, nullptr);
+
+    Assimp::Exporter exporter;
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine_plain_out.glb"));
+
+    Assimp::ExportProperties meshopt;
+    meshopt.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_MESHOPT_COMPRESSION, true);
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine_meshopt_out.glb", 0u, &meshopt));
+
+    Assimp::ExportProperties quantized(meshopt);
+    quantized.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_QUANTIZE_MESHES, true);
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine_quantized_out.glb", 0u, &quantized));
+
+    const size_t plainSize = GetFileSize(ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine_plain_out.glb");
+    const size_t meshoptSize = GetFileSize(ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine_meshopt_out.glb");
+    const size_t quantizedSize = GetFileSize(ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine_quantized_out.glb");
+    EXPECT_LT(meshoptSize, plainSize);
+    EXPECT_LT(quantizedSize, meshoptSize);
+
+    Assimp::Importer quantizedImporter;
+    const aiScene *imported = quantizedImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine_quantized_out.glb", aiProcess_ValidateDataStructure);
+    ASSERT_NE(imported, nullptr);
+    EXPECT_EQ(imported->mNumMeshes, scene->mNumMeshes);
+}
+
+namespace {
+
+unsigned int CountMeshReferences(const aiNode *node) {
+    unsigned int count = node->mNumMeshes;
+    for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+        count += CountMeshReferences(node->mChildren[i]);
+    }
+    return count;
+}
+
+} // namespace
+
+TEST_F(utglTF2ImportExport, exportManyNodes) {
+    Assimp::Importer importer;
+    ASSERT_NE(nullptr, importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb", aiProcess_ValidateDataStructure));
+    std::unique_ptr<aiScene> scene(importer.GetOrphanedScene());
+
+    // enough nodes for the streamed JSON to pass through the output buffer several times
+    constexpr unsigned int NumInstances = 5000;
+    std::vector<aiNode *> instances(NumInstances);
+    for (unsigned int i = 0; i < NumInstances; ++i) {
+        instances[i] = new aiNode("instance_" + std::to_string(i));
+        aiMatrix4x4::Translation(aiVector3D(static_cast<ai_real>(i), 0, 0), instances[i]->mTransformation);
+        instances[i]->mNumMeshes = 1;
+        instances[i]->mMeshes = new unsigned int[1]{ 0 };
+    }
+    scene->mRootNode->addChildren(NumInstances, instances.data());
+    const unsigned int numReferences = CountMeshReferences(scene->mRootNode);
+
+    Assimp::Exporter exporter;
+    for (const char *format : { "glb2", "gltf2" }) {
+        SCOPED_TRACE(format);
+        const std::string path = std::string(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured_instances_out.") + (format[2] == 'b' ? "glb" : "gltf");
+        ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene.get(), format, path));
+
+        Assimp::Importer instancesImporter;
+        const aiScene *imported = instancesImporter.ReadFile(path, aiProcess_ValidateDataStructure);
+        ASSERT_NE(imported, nullptr);
+        EXPECT_EQ(numReferences, CountMeshReferences(imported->mRootNode));
+        const aiNode *last = imported->mRootNode->FindNode("instance_4999");
+        ASSERT_NE(last, nullptr);
+        EXPECT_FLOAT_EQ(4999.0f, last->mTransformation.a4);
+    }
+}
+
+TEST_F(utglTF2ImportExport, exportQuantizedSkin) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/simple_skin/quad_skin.glb", aiProcess_ValidateDataStructure);
+    ASSERT_NE(scene, nullptr);
+
+    Assimp::ExportProperties properties;
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_QUANTIZE_MESHES, true);
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_MESHOPT_COMPRESSION, true);
+    Assimp::Exporter exporter;
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", ASSIMP_TEST_MODELS_DIR "/glTF2/simple_skin/quad_quantized_out.glb", 0u, &properties));
+
+    // positions are stored on the grid, the inverse bind matrices map them back
+    Assimp::Importer quantizedImporter;
+    const aiScene *imported = quantizedImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/simple_skin/quad_quantized_out.glb", aiProcess_ValidateDataStructure);
+    ASSERT_NE(imported, nullptr);
+    ASSERT_EQ(imported->mNumMeshes, 1u);
+    const aiMesh *mesh = imported->mMeshes[0];
+    ASSERT_EQ(mesh->mNumVertices, 4u);
+    ASSERT_EQ(mesh->mNumBones, scene->mMeshes[0]->mNumBones);
+    for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+        const aiBone *bone = mesh->mBones[b];
+        const aiBone *original = scene->mMeshes[0]->mBones[b];
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            const aiVector3D expected = original->mOffsetMatrix * scene->mMeshes[0]->mVertices[i];
+            const aiVector3D actual = bone->mOffsetMatrix * mesh->mVertices[i];
+            EXPECT_NEAR(0, (expected - actual).Length(), 1e-3);
+        }
+    }
+}
+
+#ifdef ASSIMP_ENABLE_DRACO
+TEST_F(utglTF2ImportExport, exportDracoCompressed) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb",
+            aiProcess_ValidateDataStructure | aiProcess_PreTransformVertices);
+    ASSERT_NE(scene, nullptr);
+    ASSERT_EQ(scene->mNumMeshes, 1u);
+    const aiMesh *expected = scene->mMeshes[0];
+
+    Assimp::ExportProperties properties;
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_DRACO_COMPRESSION, true);
+    properties.SetPropertyInteger(AI_CONFIG_EXPORT_NUM_THREADS, 4);
+    Assimp::Exporter exporter;
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured_draco_out.glb", 0u, &properties));
+
+    Assimp::Importer dracoImporter;
+    const aiScene *imported = dracoImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured_draco_out.glb", aiProcess_ValidateDataStructure);
+    ASSERT_NE(imported, nullptr);
+    ASSERT_EQ(imported->mNumMeshes, 1u);
+    const aiMesh *mesh = imported->mMeshes[0];
+    ASSERT_EQ(mesh->mNumFaces, expected->mNumFaces);
+    ASSERT_TRUE(mesh->HasNormals());
+    ASSERT_TRUE(mesh->HasTextureCoords(0));
+
+    // Draco may reorder the vertices, each decoded one is within the quantization error of an original one
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        bool found = false;
+        for (unsigned int j = 0; j < expected->mNumVertices && !found; ++j) {
+            found = (mesh->mVertices[i] - expected->mVertices[j]).Length() < 1e-3f &&
+                    (mesh->mNormals[i] - expected->mNormals[j]).Length() < 1e-2f &&
+                    (mesh->mTextureCoords[0][i] - expected->mTextureCoords[0][j]).Length() < 1e-2f;
+        }
+        EXPECT_TRUE(found) << "vertex " << i;
+    }
+}
+#endif
+
+#endif // ASSIMP_BUILD_NO_EXPORT
+
 /////////////////////////////////
 // Draco decoding
 
@@ -42,11 +42,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include <assimp/postprocess.h>
+#include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
 #include <assimp/commonMetaData.h>
 #include <assimp/scene.h>
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
 using namespace Assimp;
 
 class utglTFImportExport : public AbstractImportExportBase {
@@ -109,3 +116,30 @@ TEST_F(utglTFImportExport, sceneMetadata) {
         ASSERT_EQ(strncmp(generator.C_Str(), "collada2gltf", 12), 0);
     }
 }
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+TEST_F(utglTFImportExport, exportGLBLengthTest) {
+    // the length in the header covers the padding in front of the body as well
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF/TwoBoxes/TwoBoxes.gltf", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    const char *path = ASSIMP_TEST_MODELS_DIR "/glTF/TwoBoxes/TwoBoxes_out.glb";
+    Assimp::Exporter exporter;
+    ASSERT_EQ(AI_SUCCESS, exporter.Export(scene, "glb", path));
+
+    std::ifstream file(path, std::ios::binary);
+    const std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_LE(20u, data.size());
+    uint32_t length = 0, sceneLength = 0;
+    ::memcpy(&length, &data[8], sizeof(length));
+    ::memcpy(&sceneLength, &data[12], sizeof(sceneLength));
+    ASSERT_NE(0u, (20 + sceneLength) % 4) << "the scene doesn't need padding";
+    EXPECT_EQ(data.size(), length);
+
+    Assimp::Importer reimporter;
+    const aiScene *reimported = reimporter.ReadFile(path, aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, reimported);
+    EXPECT_EQ(scene->mNumMeshes, reimported->mNumMeshes);
+}
+#endif // ASSIMP_BUILD_NO_EXPORT
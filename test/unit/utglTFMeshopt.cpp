@@ -0,0 +1,305 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2026, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include "AssetLib/glTFCommon/glTFMeshopt.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace glTFCommon::Meshopt;
+
+class utglTFMeshopt : public ::testing::Test {
+    // empty
+};
+
+namespace {
+
+struct TestVertex {
+    int16_t x, y, z;
+    uint8_t r, g;
+};
+
+std::vector<TestVertex> GetTestVertices() {
+    std::vector<TestVertex> vertices;
+    for (int i = 0; i < 20; ++i) {
+        TestVertex v;
+        v.x = static_cast<int16_t>(i * 3 - 20);
+        v.y = static_cast<int16_t>((i * i * 37) % 2000 - 1000);
+        v.z = 5;
+        v.r = static_cast<uint8_t>(i * 13);
+        v.g = 200;
+        vertices.push_back(v);
+    }
+    return vertices;
+}
+
+// GetTestVertices, encoded with the version 0 vertex codec
+const uint8_t EncodedVertices[] = {
+    0xa0, 0x06, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xff, 0x00,
+    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x01, 0x00, 0x02, 0x00, 0x00, 0x07,
+    0x00, 0x4a, 0xde, 0x8d, 0x06, 0x9a, 0xd1, 0x3d, 0xb6, 0xea, 0x81, 0x72,
+    0xa6, 0x65, 0x31, 0xc2, 0xff, 0x00, 0x00, 0x00, 0xf6, 0x15, 0x1e, 0xed,
+    0x06, 0x00, 0x02, 0x22, 0x44, 0xb4, 0x69, 0x87, 0x65, 0xff, 0x00, 0x00,
+    0x00, 0x08, 0x05, 0x0a, 0x03, 0x00, 0x00, 0x07, 0x00, 0x1a, 0x1a, 0x1a,
+    0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a,
+    0xff, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1a, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0x18,
+    0xfc, 0x05, 0x00, 0x00, 0xc8,
+};
+
+const unsigned int SequenceIndices[] = { 0, 1, 2, 2, 1, 3, 70000, 69999, 4, 5, 70001, 3 };
+
+// SequenceIndices, alternating between both baselines
+const uint8_t EncodedSequence[] = {
+    0xd1, 0x00, 0x05, 0x08, 0x05, 0x02, 0x05, 0xbc, 0x8b, 0x11, 0xb1, 0x8b,
+    0x11, 0xae, 0x8b, 0x11, 0xa7, 0x8b, 0x11, 0xb4, 0x8b, 0x11, 0x07, 0x00,
+    0x00, 0x00, 0x00,
+};
+
+// a 3x3 grid of quads and one unconnected triangle
+const unsigned int TriangleIndices[] = {
+    0, 1, 5, 0, 5, 4, 1, 2, 6, 1, 6, 5,
+    2, 3, 7, 2, 7, 6, 4, 5, 9, 4, 9, 8,
+    5, 6, 10, 5, 10, 9, 6, 7, 11, 6, 11, 10,
+    8, 9, 13, 8, 13, 12, 9, 10, 14, 9, 14, 13,
+    10, 11, 15, 10, 15, 14, 100, 15, 3,
+};
+
+const uint8_t EncodedTrianglesV1[] = {
+    0xe1, 0xfe, 0x0d, 0xff, 0x04, 0xff, 0x03, 0xbf, 0x0d, 0xaf, 0x02, 0x9e,
+    0x01, 0x9f, 0x0d, 0x9f, 0x02, 0x9e, 0x01, 0xff, 0x0f, 0x0a, 0x0f, 0x05,
+    0x0a, 0x0f, 0x07, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x1a, 0xaa, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+};
+
+const uint8_t EncodedTrianglesV0[] = {
+    0xe0, 0xfe, 0x0f, 0xff, 0x04, 0xff, 0x03, 0xbf, 0x0f, 0xaf, 0x02, 0x9f,
+    0x01, 0x9f, 0x0f, 0x9f, 0x02, 0x9f, 0x01, 0xff, 0x0f, 0x0a, 0x01, 0x0f,
+    0x05, 0x0a, 0x0f, 0x07, 0x0a, 0x04, 0x01, 0x04, 0x02, 0x04, 0x01, 0x04,
+    0x02, 0x1a, 0xaa, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+template <typename T>
+std::vector<T> DecodeTriangles(const uint8_t *buffer, size_t size) {
+    std::vector<T> indices(sizeof(TriangleIndices) / sizeof(TriangleIndices[0]));
+    if (!DecodeIndexBuffer(reinterpret_cast<uint8_t *>(indices.data()), indices.size(), sizeof(T), buffer, size)) {
+        indices.clear();
+    }
+    return indices;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utglTFMeshopt, decodeVertexBufferTest) {
+    const std::vector<TestVertex> expected = GetTestVertices();
+    std::vector<TestVertex> decoded(expected.size());
+    ASSERT_TRUE(DecodeVertexBuffer(reinterpret_cast<uint8_t *>(decoded.data()), decoded.size(), sizeof(TestVertex),
+            EncodedVertices, sizeof(EncodedVertices)));
+    EXPECT_EQ(0, memcmp(expected.data(), decoded.data(), expected.size() * sizeof(TestVertex)));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utglTFMeshopt, decodeMalformedVertexBufferTest) {
+    std::vector<TestVertex> decoded(20);
+    uint8_t *destination = reinterpret_cast<uint8_t *>(decoded.data());
+
+    // truncated stream
+    EXPECT_FALSE(DecodeVertexBuffer(destination, decoded.size(), sizeof(TestVertex), EncodedVertices, sizeof(EncodedVertices) - 1));
+
+    // unsupported codec version
+    std::vector<uint8_t> encoded(EncodedVertices, EncodedVertices + sizeof(EncodedVertices));
+    encoded[0] = 0xa1;
+    EXPECT_FALSE(DecodeVertexBuffer(destination, decoded.size(), sizeof(TestVertex), encoded.data(), encoded.size()));
+
+    // stride must be a multiple of 4
+    EXPECT_FALSE(DecodeVertexBuffer(destination, decoded.size(), 6, EncodedVertices, sizeof(EncodedVertices)));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utglTFMeshopt, decodeIndexSequenceTest) {
+    const size_t count = sizeof(SequenceIndices) / sizeof(SequenceIndices[0]);
+    std::vector<uint32_t> decoded(count);
+    ASSERT_TRUE(DecodeIndexSequence(reinterpret_cast<uint8_t *>(decoded.data()), count, sizeof(uint32_t),
+            EncodedSequence, sizeof(EncodedSequence)));
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(SequenceIndices[i], decoded[i]);
+    }
+
+    // the stream holds exactly count indices
+    EXPECT_FALSE(DecodeIndexSequence(reinterpret_cast<uint8_t *>(decoded.data()), count - 1, sizeof(uint32_t),
+            EncodedSequence, sizeof(EncodedSequence)));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utglTFMeshopt, decodeIndexBufferTest) {
+    const size_t count = sizeof(TriangleIndices) / sizeof(TriangleIndices[0]);
+
+    const std::vector<uint32_t> decodedV1 = DecodeTriangles<uint32_t>(EncodedTrianglesV1, sizeof(EncodedTrianglesV1));
+    const std::vector<uint32_t> decodedV0 = DecodeTriangles<uint32_t>(EncodedTrianglesV0, sizeof(EncodedTrianglesV0));
+    const std::vector<uint16_t> decoded16 = DecodeTriangles<uint16_t>(EncodedTrianglesV1, sizeof(EncodedTrianglesV1));
+    ASSERT_EQ(count, decodedV1.size());
+    ASSERT_EQ(count, decodedV0.size());
+    ASSERT_EQ(count, decoded16.size());
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(TriangleIndices[i], decodedV1[i]);
+        EXPECT_EQ(TriangleIndices[i], decodedV0[i]);
+        EXPECT_EQ(TriangleIndices[i], decoded16[i]);
+    }
+
+    // the codeaux table is missing
+    EXPECT_TRUE(DecodeTriangles<uint32_t>(EncodedTrianglesV1, sizeof(EncodedTrianglesV1) - 16).empty());
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utglTFMeshopt, octahedralFilterTest) {
+    // +Z, -Z (folded onto the corners) and +X at 8 bits, with the fourth component untouched
+    int8_t normals8[] = { 0, 0, 127, 7, 127, 127, 127, 0, 127, 0, 127, -1 };
+    ASSERT_TRUE(ApplyFilter(Filter::Octahedral, reinterpret_cast<uint8_t *>(normals8), 3, 4));
+    const int8_t expected8[] = { 0, 0, 127, 7, 0, 0, -127, 0, 127, 0, 0, -1 };
+    for (size_t i = 0; i < 12; ++i) {
+        EXPECT_EQ(expected8[i], normals8[i]);
+    }
+
+    // halfway between +X and -Y at 16 bits
+    int16_t normals16[] = { 16384, -16383, 32767, 0 };
+    ASSERT_TRUE(ApplyFilter(Filter::Octahedral, reinterpret_cast<uint8_t *>(normals16), 1, 8));
+    EXPECT_NEAR(23170, normals16[0], 1);
+    EXPECT_NEAR(-23170, normals16[1], 1);
+    EXPECT_EQ(0, normals16[2]);
+
+    EXPECT_FALSE(ApplyFilter(Filter::Octahedral, reinterpret_cast<uint8_t *>(normals16), 1, 12));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utglTFMeshopt, quaternionFilterTest) {
+    // identity and a quarter turn around Z, both with W dropped and a 12 bit scale
+    int16_t quats[] = { 0, 0, 0, 4095, 0, 0, 4095, 4095 };
+    ASSERT_TRUE(ApplyFilter(Filter::Quaternion, reinterpret_cast<uint8_t *>(quats), 2, 8));
+    EXPECT_EQ(0, quats[0]);
+    EXPECT_EQ(0, quats[1]);
+    EXPECT_EQ(0, quats[2]);
+    EXPECT_EQ(32767, quats[3]);
+    EXPECT_EQ(0, quats[4]);
+    EXPECT_EQ(0, quats[5]);
+    EXPECT_NEAR(23170, quats[6], 1);
+    EXPECT_NEAR(23170, quats[7], 1);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utglTFMeshopt, exponentialFilterTest) {
+    // 3 * 2^-1, -1 * 2^1 and 0
+    uint32_t values[] = { 0xff000003u, 0x01ffffffu, 0u, 0x7f000000u };
+    ASSERT_TRUE(ApplyFilter(Filter::Exponential, reinterpret_cast<uint8_t *>(values), 2, 8));
+    float decoded[4];
+    memcpy(decoded, values, sizeof(decoded));
+    EXPECT_EQ(1.5f, decoded[0]);
+    EXPECT_EQ(-2.0f, decoded[1]);
+    EXPECT_EQ(0.0f, decoded[2]);
+    EXPECT_EQ(0.0f, decoded[3]);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utglTFMeshopt, encodeVertexBufferTest) {
+    const std::vector<TestVertex> vertices = GetTestVertices();
+    std::vector<uint8_t> encoded;
+    ASSERT_TRUE(EncodeVertexBuffer(encoded, reinterpret_cast<const uint8_t *>(vertices.data()), vertices.size(), sizeof(TestVertex)));
+    ASSERT_EQ(sizeof(EncodedVertices), encoded.size());
+    EXPECT_EQ(0, memcmp(EncodedVertices, encoded.data(), encoded.size()));
+
+    // several blocks of a wider vertex
+    std::vector<uint32_t> wide(1000 * 3);
+    for (size_t i = 0; i < wide.size(); ++i) {
+        wide[i] = static_cast<uint32_t>(i * 2654435761u);
+    }
+    ASSERT_TRUE(EncodeVertexBuffer(encoded, reinterpret_cast<const uint8_t *>(wide.data()), 1000, 12));
+    std::vector<uint32_t> decoded(wide.size());
+    ASSERT_TRUE(DecodeVertexBuffer(reinterpret_cast<uint8_t *>(decoded.data()), 1000, 12, encoded.data(), encoded.size()));
+    EXPECT_EQ(wide, decoded);
+
+    EXPECT_FALSE(EncodeVertexBuffer(encoded, reinterpret_cast<const uint8_t *>(vertices.data()), vertices.size(), 6));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utglTFMeshopt, encodeIndexSequenceTest) {
+    const size_t count = sizeof(SequenceIndices) / sizeof(SequenceIndices[0]);
+    std::vector<uint8_t> encoded;
+    ASSERT_TRUE(EncodeIndexSequence(encoded, reinterpret_cast<const uint8_t *>(SequenceIndices), count, sizeof(uint32_t)));
+
+    std::vector<uint32_t> decoded(count);
+    ASSERT_TRUE(DecodeIndexSequence(reinterpret_cast<uint8_t *>(decoded.data()), count, sizeof(uint32_t),
+            encoded.data(), encoded.size()));
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(SequenceIndices[i], decoded[i]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utglTFMeshopt, encodeIndexBufferTest) {
+    // the grid, followed by two triangles of new vertices only
+    std::vector<uint16_t> indices(std::begin(TriangleIndices), std::end(TriangleIndices));
+    for (uint16_t i = 101; i < 107; ++i) {
+        indices.push_back(i);
+    }
+    std::vector<uint8_t> encoded;
+    ASSERT_TRUE(EncodeIndexBuffer(encoded, reinterpret_cast<const uint8_t *>(indices.data()), indices.size(), sizeof(uint16_t)));
+
+    std::vector<uint16_t> decoded(indices.size());
+    ASSERT_TRUE(DecodeIndexBuffer(reinterpret_cast<uint8_t *>(decoded.data()), decoded.size(), sizeof(uint16_t),
+            encoded.data(), encoded.size()));
+
+    // triangles keep their order and winding, but may be rotated
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        bool found = false;
+        for (size_t r = 0; r < 3; ++r) {
+            found = found || (decoded[i] == indices[i + r] && decoded[i + 1] == indices[i + (r + 1) % 3] &&
+                                     decoded[i + 2] == indices[i + (r + 2) % 3]);
+        }
+        EXPECT_TRUE(found) << "triangle " << i / 3;
+    }
+
+    EXPECT_FALSE(EncodeIndexBuffer(encoded, reinterpret_cast<const uint8_t *>(indices.data()), indices.size() - 1, sizeof(uint16_t)));
+}